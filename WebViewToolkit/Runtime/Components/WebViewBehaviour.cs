@@ -53,6 +53,11 @@ namespace WebViewToolkit.Components
         /// </summary>
         public Texture2D Texture => WebView?.Texture;
 
+        /// <summary>
+        /// The part of Texture that holds the WebView content
+        /// </summary>
+        public Rect UVRect => WebView?.UVRect ?? new Rect(0, 0, 1, 1);
+
         /// <summary>
         /// Whether the WebView is ready
         /// </summary>
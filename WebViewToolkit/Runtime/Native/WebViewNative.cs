@@ -29,6 +29,7 @@ namespace WebViewToolkit.Native
         ErrorInvalidHandle = -2,
         ErrorNotInitialized = -3,
         ErrorAlreadyInitialized = -4,
+        ErrorInvalidArgument = -5,
         
         // Graphics errors
         ErrorUnsupportedGraphicsAPI = -100,
@@ -65,6 +66,96 @@ namespace WebViewToolkit.Native
         Middle = 3
     }
 
+    /// <summary>
+    /// Strategy used to flip captured frames into Unity's bottom-up texture
+    /// </summary>
+    public enum FlipMode : int
+    {
+        None = 0,
+        RowCopy = 1,
+        SinglePass = 2
+    }
+
+    /// <summary>
+    /// How many queued capture frames are consumed per texture update
+    /// </summary>
+    public enum FrameDrainMode : int
+    {
+        Single = 0,
+        Latest = 1
+    }
+
+    /// <summary>
+    /// Whether Unity samples a copy of each captured frame or the frame itself
+    /// </summary>
+    public enum PresentMode : int
+    {
+        Copy = 0,
+        ZeroCopy = 1
+    }
+
+    /// <summary>
+    /// Per-view capture frame counters (matches the native CaptureFrameStats layout)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct CaptureFrameStats
+    {
+        public ulong Arrived;
+        public ulong Presented;
+        public ulong DroppedStale;
+        public ulong NoNewFrame;
+        public ulong LastCopyAgeUs;
+        public ulong MaxCopyAgeUs;
+        public ulong TotalCopyAgeUs;
+        public ulong CopyAgeSamples;
+    }
+
+    /// <summary>
+    /// Frames a view's texture has received (matches the native FrameVersion layout)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FrameVersion
+    {
+        public uint Handle;
+        public uint Reserved;
+        public ulong Sequence;
+        public ulong TimestampMs;
+    }
+
+    /// <summary>
+    /// Render thread allocations, QueryInterface calls and object creations per
+    /// texture update (matches the native FrameResourceStats layout). Debug
+    /// builds of the plugin only; zeros otherwise.
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct FrameResourceStats
+    {
+        public ulong Frames;
+        public ulong FramesOverBudget;
+        public ulong LastAllocations;
+        public ulong LastQueryInterfaces;
+        public ulong LastObjectCreations;
+        public ulong TotalAllocations;
+        public ulong TotalQueryInterfaces;
+        public ulong TotalObjectCreations;
+    }
+
+    /// <summary>
+    /// Per-view resize counters (matches the native ResizeStats layout)
+    /// </summary>
+    [StructLayout(LayoutKind.Sequential)]
+    public struct ResizeStats
+    {
+        public ulong Requested;
+        public ulong Applied;
+        public ulong Coalesced;
+        public ulong StretchedFrames;
+        public ulong HeldFrames;
+        public ulong TimedOut;
+        public uint LastFirstFrameMs;
+        public uint MaxFirstFrameMs;
+    }
+
     /// <summary>
     /// Render event types for GL.IssuePluginEvent
     /// </summary>
@@ -72,7 +163,8 @@ namespace WebViewToolkit.Native
     {
         Initialize = 0,
         Shutdown = 1,
-        UpdateTexture = 2
+        UpdateTexture = 2,
+        LateLatchTextures = 3
     }
 
     /// <summary>
@@ -169,6 +261,27 @@ namespace WebViewToolkit.Native
             out uint outHandle
         );
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_CreateWebViewEx(
+            uint width,
+            uint height,
+            [MarshalAs(UnmanagedType.LPWStr)] string userDataFolder,
+            [MarshalAs(UnmanagedType.LPWStr)] string initialUrl,
+            int enableDevTools,
+            uint framePoolDepth,
+            out uint outHandle
+        );
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_CreateAtlasWebView(
+            uint width,
+            uint height,
+            [MarshalAs(UnmanagedType.LPWStr)] string userDataFolder,
+            [MarshalAs(UnmanagedType.LPWStr)] string initialUrl,
+            int enableDevTools,
+            out uint outHandle
+        );
+
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int WebViewToolkit_DestroyWebView(uint handle);
 
@@ -178,6 +291,69 @@ namespace WebViewToolkit.Native
         [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
         public static extern int WebViewToolkit_Resize(uint handle, uint width, uint height);
 
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetResizeInterval(uint handle, uint intervalMs);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern void WebViewToolkit_ApplyPendingResizes();
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetResizeStats(uint handle, out ResizeStats outStats);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetFlipMode(uint handle, int flipMode);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetFrameDrainMode(uint handle, int drainMode);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetPresentMode(uint handle, int presentMode);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetLateLatch(uint handle, int enabled);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetCaptureStats(uint handle, out CaptureFrameStats outStats);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetFrameVersion(uint handle, out FrameVersion outVersion);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetFrameVersions([Out] FrameVersion[] outVersions, uint capacity, out uint outCount);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetFrameResourceStats(out FrameResourceStats outStats);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_AttachMirror(uint handle, uint width, uint height, out uint outMirrorId);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_DetachMirror(uint handle, uint mirrorId);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetMirrorTexture(uint handle, uint mirrorId, out IntPtr outTexture, out uint outWidth, out uint outHeight);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetMirrorUVRect(uint handle, uint mirrorId, [Out] float[] outUVRect);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_SetRenderScale(uint handle, float scale);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_EnableAutoRenderScale(uint handle, float frameBudgetMs, float minScale);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_ReportRenderScaleSample(uint handle, float frameTimeMs, float coverage);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetTextureSize(uint handle, out uint outWidth, out uint outHeight);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetTexture(uint handle, out IntPtr outTexture, out uint outWidth, out uint outHeight);
+
+        [DllImport(DllName, CallingConvention = CallingConvention.Cdecl)]
+        public static extern int WebViewToolkit_GetTextureUVRect(uint handle, [Out] float[] outUVRect);
+
         // ====================================================================
         // Navigation
         // ====================================================================
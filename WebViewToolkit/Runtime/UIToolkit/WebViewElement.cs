@@ -260,6 +260,7 @@ namespace WebViewToolkit.UIToolkit
                 _isCreated = true;
                 WebView.NavigationCompleted += OnNavigationCompleted;
                 WebView.MessageReceived += OnMessageReceived;
+                WebView.TextureChanged += OnTextureChanged;
                 UpdateTexture();
             }
         }
@@ -273,6 +274,7 @@ namespace WebViewToolkit.UIToolkit
             {
                 WebView.NavigationCompleted -= OnNavigationCompleted;
                 WebView.MessageReceived -= OnMessageReceived;
+                WebView.TextureChanged -= OnTextureChanged;
 
                 // Only dispose if manager is still valid (not during shutdown)
                 // This prevents double-destruction race condition
@@ -507,9 +509,15 @@ namespace WebViewToolkit.UIToolkit
             if (WebView?.Texture != null)
             {
                 _backgroundImage.image = WebView.Texture;
+                _backgroundImage.uv = WebView.UVRect;
             }
         }
 
+        private void OnTextureChanged(Texture2D texture)
+        {
+            UpdateTexture();
+        }
+
         private void OnNavigationCompleted(string url, bool isSuccess)
         {
             NavigationCompleted?.Invoke(url, isSuccess);
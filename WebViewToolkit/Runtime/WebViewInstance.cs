@@ -3,6 +3,7 @@
 // ============================================================================
 
 using System;
+using System.Collections.Generic;
 using UnityEngine;
 using WebViewToolkit.Native;
 
@@ -33,6 +34,23 @@ namespace WebViewToolkit
         /// </summary>
         public Texture2D Texture { get; private set; }
 
+        /// <summary>
+        /// The part of Texture that holds this view (x, y, width, height in UV coordinates).
+        /// Textures are allocated in size buckets, so this is usually a little less than the
+        /// whole texture; for a view in the capture atlas it is the view's place in the atlas
+        /// </summary>
+        public Rect UVRect { get; private set; } = new Rect(0, 0, 1, 1);
+
+        /// <summary>
+        /// Frames Texture has received; unchanged means the content is too
+        /// </summary>
+        public ulong FrameSequence { get; private set; }
+
+        /// <summary>
+        /// When the last frame arrived, in native GetTickCount64 milliseconds
+        /// </summary>
+        public ulong LastFrameTimestampMs { get; private set; }
+
         /// <summary>
         /// Whether this instance has been destroyed
         /// </summary>
@@ -53,25 +71,49 @@ namespace WebViewToolkit
         /// </summary>
         public event Action<string> MessageReceived;
 
+        /// <summary>
+        /// Event fired once per update when Texture received new frames, so dependent
+        /// work can be skipped for views whose content did not change
+        /// </summary>
+        public event Action<WebViewInstance> FrameUpdated;
+
+        /// <summary>
+        /// Event fired when Texture is replaced after a resize or render scale change,
+        /// or when UVRect changes
+        /// </summary>
+        public event Action<Texture2D> TextureChanged;
+
         // Native texture pointer
         private IntPtr _nativeTexturePtr;
 
+        // Reused for WebViewToolkit_GetTextureUVRect and WebViewToolkit_GetMirrorUVRect
+        private readonly float[] _uvRect = new float[4];
+
+        // Mirror textures by mirror id; attaching the same size again returns the same id
+        private readonly Dictionary<uint, Texture2D> _mirrors = new Dictionary<uint, Texture2D>();
+
         internal WebViewInstance(uint handle, int width, int height)
         {
             Handle = handle;
             Width = width;
             Height = height;
 
-            // Get native texture pointer
-            _nativeTexturePtr = WebViewNative.WebViewToolkit_GetTexturePtr(handle);
+            // Get native texture pointer, with its size: atlas views share a
+            // texture larger than the view
+            if ((NativeResult)WebViewNative.WebViewToolkit_GetTexture(handle, out _nativeTexturePtr, out uint textureWidth, out uint textureHeight) != NativeResult.Success)
+            {
+                _nativeTexturePtr = IntPtr.Zero;
+            }
 
             if (_nativeTexturePtr != IntPtr.Zero)
             {
+                UpdateUVRect();
+
                 // Create Unity texture from native pointer
                 // BGRA format matches what WebView2 produces
                 Texture = Texture2D.CreateExternalTexture(
-                    width,
-                    height,
+                    (int)textureWidth,
+                    (int)textureHeight,
                     TextureFormat.BGRA32,
                     mipChain: false,
                     linear: false,
@@ -177,33 +219,315 @@ namespace WebViewToolkit
             Width = width;
             Height = height;
 
-            // Recreate texture with new dimensions
-            // Unity's Texture2D doesn't support resizing, so we must create a new one
-            _nativeTexturePtr = WebViewNative.WebViewToolkit_GetTexturePtr(Handle);
-            if (_nativeTexturePtr != IntPtr.Zero)
+            // The native side keeps showing the old texture until the resized
+            // one holds a frame; SyncTexture picks it up from then on
+            SyncTexture();
+            return true;
+        }
+
+        /// <summary>
+        /// Apply at most one resize per interval; the newest size is applied once it has passed.
+        /// 0 applies every resize at once.
+        /// </summary>
+        public bool SetResizeInterval(int intervalMs)
+        {
+            if (IsDestroyed || intervalMs < 0) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetResizeInterval(Handle, (uint)intervalMs);
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Render at a fraction of the size (0.25 - 1.0) without changing the page layout.
+        /// Disables automatic scaling.
+        /// </summary>
+        public bool SetRenderScale(float scale)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetRenderScale(Handle, scale);
+            SyncTexture();
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Pick the render scale from the samples passed to ReportRenderScaleSample
+        /// </summary>
+        /// <param name="frameBudgetMs">Frame time budget of this view, 0 to follow coverage only</param>
+        /// <param name="minScale">Lowest scale to use</param>
+        public bool EnableAutoRenderScale(float frameBudgetMs, float minScale = 0.25f)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_EnableAutoRenderScale(Handle, frameBudgetMs, minScale);
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Report this frame's cost and on-screen size for automatic render scaling
+        /// </summary>
+        /// <param name="frameTimeMs">Frame time attributed to this view</param>
+        /// <param name="coverage">On-screen pixels divided by Width * Height</param>
+        public bool ReportRenderScaleSample(float frameTimeMs, float coverage)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_ReportRenderScaleSample(Handle, frameTimeMs, coverage);
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Recreate Texture if the native side swapped in a resized texture
+        /// </summary>
+        internal void SyncTexture()
+        {
+            if (IsDestroyed) return;
+
+            // Pointer and size in one call: in zero-copy mode each call takes the
+            // newest frame and retires the one before, so a second call could
+            // leave Texture on a frame that is about to be released
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetTexture(Handle, out IntPtr texturePtr, out uint width, out uint height);
+            if (result != NativeResult.Success || texturePtr == IntPtr.Zero || texturePtr == _nativeTexturePtr)
             {
-                // Destroy old texture if it exists
-                if (Texture != null)
+                // Atlas views move within the same texture
+                if (UpdateUVRect() && Texture != null)
                 {
-                    UnityEngine.Object.Destroy(Texture);
+                    TextureChanged?.Invoke(Texture);
                 }
+                return;
+            }
 
-                // Create new texture with updated dimensions
-                Texture = Texture2D.CreateExternalTexture(
-                    width,
-                    height,
-                    TextureFormat.BGRA32,
-                    mipChain: false,
-                    linear: false,
-                    _nativeTexturePtr
-                );
-                Texture.name = $"WebViewTexture_{Handle}";
-                Texture.filterMode = FilterMode.Bilinear;
-                Texture.wrapMode = TextureWrapMode.Clamp;
+            _nativeTexturePtr = texturePtr;
+
+            // Zero-copy hands over a new frame texture per frame, mostly of the same size
+            if (Texture != null && Texture.width == (int)width && Texture.height == (int)height)
+            {
+                Texture.UpdateExternalTexture(_nativeTexturePtr);
+                if (UpdateUVRect())
+                {
+                    TextureChanged?.Invoke(Texture);
+                }
+                return;
+            }
+
+            // Unity's Texture2D doesn't support resizing, so we must create a new one
+            if (Texture != null)
+            {
+                UnityEngine.Object.Destroy(Texture);
+            }
+
+            Texture = Texture2D.CreateExternalTexture(
+                (int)width,
+                (int)height,
+                TextureFormat.BGRA32,
+                mipChain: false,
+                linear: false,
+                _nativeTexturePtr
+            );
+            Texture.name = $"WebViewTexture_{Handle}";
+            Texture.filterMode = FilterMode.Bilinear;
+            Texture.wrapMode = TextureWrapMode.Clamp;
+
+            UpdateUVRect();
+            TextureChanged?.Invoke(Texture);
+        }
+
+        /// <returns>true if UVRect changed</returns>
+        private bool UpdateUVRect()
+        {
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetTextureUVRect(Handle, _uvRect);
+            if (result != NativeResult.Success) return false;
+
+            var uvRect = new Rect(_uvRect[0], _uvRect[1], _uvRect[2], _uvRect[3]);
+            if (uvRect == UVRect) return false;
+
+            UVRect = uvRect;
+            return true;
+        }
+ 
+        /// <summary>
+        /// Select how captured frames are flipped into the texture
+        /// </summary>
+        public bool SetFlipMode(FlipMode mode)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetFlipMode(Handle, (int)mode);
+            return result == NativeResult.Success;
+        }
+ 
+        /// <summary>
+        /// Select whether queued capture frames are shown one per update or skipped to the newest
+        /// </summary>
+        public bool SetFrameDrainMode(FrameDrainMode mode)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetFrameDrainMode(Handle, (int)mode);
+            return result == NativeResult.Success;
+        }
+ 
+        /// <summary>
+        /// Sample captured frames directly instead of a copy (DX11 only). Saves a
+        /// full-frame copy per update; frames are not flipped, as with FlipMode.None
+        /// </summary>
+        public bool SetPresentMode(PresentMode mode)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetPresentMode(Handle, (int)mode);
+            return result == NativeResult.Success;
+        }
+ 
+        /// <summary>
+        /// Whether frames are copied in the late-latch render event
+        /// </summary>
+        public bool IsLateLatched { get; private set; }
+
+        /// <summary>
+        /// Copy the newest frame as late as possible in Unity's frame instead of
+        /// at the update event: when the first camera starts rendering, or where
+        /// WebViewManager.IssueLateLatch puts it. PresentMode.Copy only; frames
+        /// are copied whole
+        /// </summary>
+        public bool SetLateLatch(bool enabled)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_SetLateLatch(Handle, enabled ? 1 : 0);
+            if (result != NativeResult.Success) return false;
+
+            IsLateLatched = enabled;
+            return true;
+        }
+
+        /// <summary>
+        /// Read the capture frame counters (arrived, presented, dropped as stale,
+        /// no new frame) and the time from capture to copy
+        /// </summary>
+        public bool TryGetCaptureStats(out CaptureFrameStats stats)
+        {
+            stats = default;
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetCaptureStats(Handle, out stats);
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Read the view's frame version straight from the native side
+        /// </summary>
+        public bool TryGetFrameVersion(out FrameVersion version)
+        {
+            version = default;
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetFrameVersion(Handle, out version);
+            return result == NativeResult.Success;
+        }
+
+        /// <summary>
+        /// Take a version read by the manager, raising FrameUpdated if it is new
+        /// </summary>
+        internal void OnFrameVersion(in FrameVersion version)
+        {
+            if (IsDestroyed || version.Sequence == FrameSequence) return;
+
+            FrameSequence = version.Sequence;
+            LastFrameTimestampMs = version.TimestampMs;
+            FrameUpdated?.Invoke(this);
+        }
+
+        /// <summary>
+        /// Attach another texture this view's frames are copied into, e.g. for a preview.
+        /// The page is captured once for all of them; content larger than the mirror is
+        /// scaled down to fit (DX11). Attaching the same size again shares the mirror,
+        /// and each attach needs a matching DetachMirror
+        /// </summary>
+        /// <param name="mirrorId">Id for DetachMirror and TryGetMirrorUVRect</param>
+        /// <param name="texture">Mirror texture; the view is in the part TryGetMirrorUVRect reports</param>
+        public bool TryAttachMirror(int width, int height, out uint mirrorId, out Texture2D texture)
+        {
+            mirrorId = 0;
+            texture = null;
+            if (IsDestroyed || width <= 0 || height <= 0) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_AttachMirror(Handle, (uint)width, (uint)height, out mirrorId);
+            if (result != NativeResult.Success) return false;
+
+            if (_mirrors.TryGetValue(mirrorId, out texture)) return true;
+
+            result = (NativeResult)WebViewNative.WebViewToolkit_GetMirrorTexture(Handle, mirrorId, out IntPtr texturePtr, out uint textureWidth, out uint textureHeight);
+            if (result != NativeResult.Success)
+            {
+                WebViewNative.WebViewToolkit_DetachMirror(Handle, mirrorId);
+                return false;
             }
 
+            texture = Texture2D.CreateExternalTexture(
+                (int)textureWidth,
+                (int)textureHeight,
+                TextureFormat.BGRA32,
+                mipChain: false,
+                linear: false,
+                texturePtr
+            );
+            texture.name = $"WebViewMirror_{Handle}_{mirrorId}";
+            texture.filterMode = FilterMode.Bilinear;
+            texture.wrapMode = TextureWrapMode.Clamp;
+
+            _mirrors[mirrorId] = texture;
+            return true;
+        }
+
+        /// <summary>
+        /// Detach a mirror; its texture is destroyed with its last attach
+        /// </summary>
+        public bool DetachMirror(uint mirrorId)
+        {
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_DetachMirror(Handle, mirrorId);
+            if (result != NativeResult.Success) return false;
+
+            // Still attached elsewhere while the native mirror exists
+            if (_mirrors.TryGetValue(mirrorId, out var texture) &&
+                (NativeResult)WebViewNative.WebViewToolkit_GetMirrorTexture(Handle, mirrorId, out _, out _, out _) != NativeResult.Success)
+            {
+                _mirrors.Remove(mirrorId);
+                DestroyTexture(texture);
+            }
             return true;
         }
+
+        /// <summary>
+        /// Read the part of a mirror's texture that holds the view (x, y, width, height in UV
+        /// coordinates). Changes when the view is resized
+        /// </summary>
+        public bool TryGetMirrorUVRect(uint mirrorId, out Rect uvRect)
+        {
+            uvRect = default;
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetMirrorUVRect(Handle, mirrorId, _uvRect);
+            if (result != NativeResult.Success) return false;
+
+            uvRect = new Rect(_uvRect[0], _uvRect[1], _uvRect[2], _uvRect[3]);
+            return true;
+        }
+
+        /// <summary>
+        /// Read the resize counters (requested, applied, coalesced into a later resize)
+        /// and how long resizes took to reach the captured frames
+        /// </summary>
+        public bool TryGetResizeStats(out ResizeStats stats)
+        {
+            stats = default;
+            if (IsDestroyed) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetResizeStats(Handle, out stats);
+            return result == NativeResult.Success;
+        }
  
         /// <summary>
         /// Refresh the native texture reference (e.g. after device reset)
@@ -278,18 +602,30 @@ namespace WebViewToolkit
 
             if (Texture != null)
             {
-#if UNITY_EDITOR
-                UnityEngine.Object.DestroyImmediate(Texture, true);
-#else
-                UnityEngine.Object.Destroy(Texture);
-#endif
+                DestroyTexture(Texture);
                 Texture = null;
             }
 
+            // The native mirrors went with the view
+            foreach (var mirror in _mirrors.Values)
+            {
+                DestroyTexture(mirror);
+            }
+            _mirrors.Clear();
+
             _nativeTexturePtr = IntPtr.Zero;
             Handle = 0;
         }
 
+        private static void DestroyTexture(Texture2D texture)
+        {
+#if UNITY_EDITOR
+            UnityEngine.Object.DestroyImmediate(texture, true);
+#else
+            UnityEngine.Object.Destroy(texture);
+#endif
+        }
+
         internal void OnNavigationCompleted(string url, bool isSuccess)
         {
             CurrentUrl = url;
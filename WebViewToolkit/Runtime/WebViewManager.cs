@@ -64,9 +64,21 @@ namespace WebViewToolkit
         private MessageCallback _messageCallback;
         private DeviceEventCallback _deviceEventCallback;
 
+        // Reused for WebViewToolkit_GetFrameVersions, grown with the instance count
+        private FrameVersion[] _frameVersions = new FrameVersion[16];
+
         // Render event function pointer
         private IntPtr _renderEventFunc;
 
+        // Late latch: once per frame, before the first camera renders
+        private int _lastLateLatchFrame = -1;
+
+        /// <summary>
+        /// Issue the late-latch copy when the first camera starts rendering. Turn
+        /// off when IssueLateLatch places it in a command buffer instead
+        /// </summary>
+        public bool AutoLateLatch { get; set; } = true;
+
         // Frame throttling
         private int _lastFrameCount = -1;
         private float _lastUpdateTime = 0f;
@@ -145,6 +157,10 @@ namespace WebViewToolkit
 
             _renderEventFunc = WebViewNative.WebViewToolkit_GetRenderEventFunc();
             IsInitialized = true;
+
+            // Built-in pipeline and SRPs respectively
+            Camera.onPreRender += OnCameraPreRender;
+            RenderPipelineManager.beginContextRendering += OnBeginContextRendering;
  
             Debug.Log("[WebViewManager] Initialized successfully");
         }
@@ -185,10 +201,85 @@ namespace WebViewToolkit
             if (Time.realtimeSinceStartup - _lastUpdateTime < UpdateInterval) return;
             _lastUpdateTime = Time.realtimeSinceStartup;
 
+            // Trailing edge of resizes coalesced during a drag
+            WebViewNative.WebViewToolkit_ApplyPendingResizes();
+
+            // Pick up textures swapped in by resizes and render scale changes
+            foreach (var instance in _instances.Values)
+            {
+                instance.SyncTexture();
+            }
+
+            // One call for every view's frame version
+            UpdateFrameVersions();
+
             // Issue render event to update all WebView textures
             GL.IssuePluginEvent(_renderEventFunc, (int)RenderEventType.UpdateTexture);
         }
 
+        private void UpdateFrameVersions()
+        {
+            if (_frameVersions.Length < _instances.Count)
+            {
+                _frameVersions = new FrameVersion[Mathf.NextPowerOfTwo(_instances.Count)];
+            }
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetFrameVersions(_frameVersions, (uint)_frameVersions.Length, out uint count);
+            if (result != NativeResult.Success) return;
+
+            for (int i = 0; i < count; i++)
+            {
+                if (_instances.TryGetValue(_frameVersions[i].Handle, out var instance))
+                {
+                    instance.OnFrameVersion(_frameVersions[i]);
+                }
+            }
+        }
+
+        /// <summary>
+        /// Record the copy of late-latched views (WebViewInstance.SetLateLatch)
+        /// into a command buffer, right before the draw that samples them
+        /// </summary>
+        public void IssueLateLatch(CommandBuffer commandBuffer)
+        {
+            if (!IsInitialized || _renderEventFunc == IntPtr.Zero) return;
+
+            commandBuffer.IssuePluginEvent(_renderEventFunc, (int)RenderEventType.LateLatchTextures);
+        }
+
+        private void OnCameraPreRender(Camera camera) => IssueAutoLateLatch();
+
+        private void OnBeginContextRendering(ScriptableRenderContext context, List<Camera> cameras) => IssueAutoLateLatch();
+
+        private void IssueAutoLateLatch()
+        {
+            if (!AutoLateLatch || !IsInitialized || _renderEventFunc == IntPtr.Zero) return;
+            if (Time.frameCount == _lastLateLatchFrame) return;
+            _lastLateLatchFrame = Time.frameCount;
+
+            foreach (var instance in _instances.Values)
+            {
+                if (instance.IsLateLatched)
+                {
+                    GL.IssuePluginEvent(_renderEventFunc, (int)RenderEventType.LateLatchTextures);
+                    return;
+                }
+            }
+        }
+
+        /// <summary>
+        /// Read the render thread's per-update allocation, QueryInterface and
+        /// object creation counts (debug builds of the plugin only)
+        /// </summary>
+        public bool TryGetFrameResourceStats(out FrameResourceStats stats)
+        {
+            stats = default;
+            if (!IsInitialized) return false;
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_GetFrameResourceStats(out stats);
+            return result == NativeResult.Success;
+        }
+
         /// <summary>
         /// Full shutdown of the manager and native resources
         /// </summary>
@@ -212,6 +303,9 @@ namespace WebViewToolkit
             }
             _instances.Clear();
 
+            Camera.onPreRender -= OnCameraPreRender;
+            RenderPipelineManager.beginContextRendering -= OnBeginContextRendering;
+
             // Native Shutdown
             WebViewNative.WebViewToolkit_Shutdown();
             
@@ -224,7 +318,8 @@ namespace WebViewToolkit
         // WebView Factory
         // ====================================================================
 
-        public WebViewInstance CreateWebView(int width, int height, string initialUrl = null, bool enableDevTools = false)
+        /// <param name="framePoolDepth">Capture buffers: 1 for lowest latency, 3 to ride out render hitches, 0 to adapt at runtime</param>
+        public WebViewInstance CreateWebView(int width, int height, string initialUrl = null, bool enableDevTools = false, int framePoolDepth = 2)
         {
             if (!IsInitialized)
             {
@@ -232,12 +327,13 @@ namespace WebViewToolkit
                 return null;
             }
 
-            var result = (NativeResult)WebViewNative.WebViewToolkit_CreateWebView(
+            var result = (NativeResult)WebViewNative.WebViewToolkit_CreateWebViewEx(
                 (uint)width,
                 (uint)height,
                 null,
                 initialUrl,
                 enableDevTools ? 1 : 0,
+                (uint)framePoolDepth,
                 out uint handle
             );
 
@@ -254,6 +350,41 @@ namespace WebViewToolkit
             return instance;
         }
 
+        /// <summary>
+        /// Create a WebView in the shared capture atlas: all atlas views are captured together
+        /// into one texture, which is cheaper for many small views. Sample the view's part of
+        /// WebViewInstance.Texture with WebViewInstance.UVRect
+        /// </summary>
+        public WebViewInstance CreateAtlasWebView(int width, int height, string initialUrl = null, bool enableDevTools = false)
+        {
+            if (!IsInitialized)
+            {
+                Debug.LogError("[WebViewManager] Cannot create WebView - not initialized");
+                return null;
+            }
+
+            var result = (NativeResult)WebViewNative.WebViewToolkit_CreateAtlasWebView(
+                (uint)width,
+                (uint)height,
+                null,
+                initialUrl,
+                enableDevTools ? 1 : 0,
+                out uint handle
+            );
+
+            if (result != NativeResult.Success)
+            {
+                Debug.LogError($"[WebViewManager] Failed to create atlas WebView: {result}");
+                return null;
+            }
+
+            var instance = new WebViewInstance(handle, width, height);
+            _instances[handle] = instance;
+
+            Debug.Log($"[WebViewManager] Created atlas WebView (handle={handle}, size={width}x{height})");
+            return instance;
+        }
+
         internal void DestroyWebView(WebViewInstance instance)
         {
             if (instance == null) return;
@@ -0,0 +1,81 @@
+// ============================================================================
+// WebViewToolkit - AtlasPacker Benchmarks
+// ============================================================================
+// Cost of keeping N small views packed in a 4096 atlas while they come, go
+// and change size. Each iteration is one operation on a random view; the
+// counters report how full the atlas is and how often a resize had to move.
+// ============================================================================
+
+#include "Core/AtlasPacker.h"
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // Panel-like sizes: buttons, tooltips, small HUD views
+    uint32_t RandomSize(std::mt19937& rng)
+    {
+        static const uint32_t kSizes[] = { 64, 96, 128, 192, 256, 320, 384 };
+        std::uniform_int_distribution<size_t> pick(0, sizeof(kSizes) / sizeof(kSizes[0]) - 1);
+        return kSizes[pick(rng)];
+    }
+
+    void FillAtlas(AtlasPacker& packer, uint32_t views, std::mt19937& rng)
+    {
+        for (uint32_t id = 0; id < views; id++)
+        {
+            packer.Add(id, RandomSize(rng), RandomSize(rng));
+        }
+    }
+}
+
+static void BM_AtlasPacker_Resize(benchmark::State& state)
+{
+    const auto views = static_cast<uint32_t>(state.range(0));
+    std::mt19937 rng(7);
+    AtlasPacker packer(4096, 4096);
+    FillAtlas(packer, views, rng);
+
+    std::uniform_int_distribution<uint32_t> pick(0, views - 1);
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(packer.Resize(pick(rng), RandomSize(rng), RandomSize(rng)));
+    }
+
+    const AtlasPackerStats& stats = packer.GetStats();
+    state.counters["used%"] = 100.0 * static_cast<double>(packer.GetUsedArea()) / (4096.0 * 4096.0);
+    state.counters["moved%"] = 100.0 * static_cast<double>(stats.relocated) /
+        static_cast<double>(std::max<uint64_t>(stats.resizedInPlace + stats.relocated, 1));
+    state.counters["holes"] = static_cast<double>(packer.GetFreeRects().size());
+}
+
+static void BM_AtlasPacker_Churn(benchmark::State& state)
+{
+    const auto views = static_cast<uint32_t>(state.range(0));
+    std::mt19937 rng(7);
+    AtlasPacker packer(4096, 4096);
+    FillAtlas(packer, views, rng);
+
+    // A view closes and another opens in its place
+    std::uniform_int_distribution<uint32_t> pick(0, views - 1);
+    for (auto _ : state)
+    {
+        const uint32_t id = pick(rng);
+        packer.Remove(id);
+        benchmark::DoNotOptimize(packer.Add(id, RandomSize(rng), RandomSize(rng)));
+    }
+
+    state.counters["views"] = static_cast<double>(packer.GetCount());
+    state.counters["used%"] = 100.0 * static_cast<double>(packer.GetUsedArea()) / (4096.0 * 4096.0);
+    state.counters["holes"] = static_cast<double>(packer.GetFreeRects().size());
+}
+
+// Args: views in the atlas
+BENCHMARK(BM_AtlasPacker_Resize)->Arg(16)->Arg(64)->Arg(128)->ArgNames({ "views" });
+BENCHMARK(BM_AtlasPacker_Churn)->Arg(16)->Arg(64)->Arg(128)->ArgNames({ "views" });
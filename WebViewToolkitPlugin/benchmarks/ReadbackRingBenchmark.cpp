@@ -0,0 +1,88 @@
+// ============================================================================
+// WebViewToolkit - ReadbackRing Benchmarks
+// ============================================================================
+// Simulates a GPU whose copies retire a fixed number of frames after submit
+// and measures the ring's per-frame scheduling cost and presentation rate.
+// ============================================================================
+
+#include "Core/ReadbackRing.h"
+
+#include <benchmark/benchmark.h>
+
+#include <deque>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    class SimulatedReadbackDevice final : public IReadbackDevice
+    {
+    public:
+        explicit SimulatedReadbackDevice(uint64_t latencyFrames) : m_latency(latencyFrames) {}
+
+        void* CreateStagingTexture(uint32_t, uint32_t) override
+        {
+            m_staging.push_back(0);
+            return &m_staging.back();
+        }
+        void DestroyStagingTexture(void*) override {}
+
+        void* CreateCompletionQuery() override
+        {
+            m_queries.push_back(0);
+            return &m_queries.back();
+        }
+        void DestroyCompletionQuery(void*) override {}
+
+        void CopyToStaging(void*, void*, void* query) override
+        {
+            *static_cast<uint64_t*>(query) = m_frame + m_latency;
+        }
+
+        bool IsCopyComplete(void* query) override
+        {
+            return *static_cast<uint64_t*>(query) <= m_frame;
+        }
+
+        void EndFrame() { m_frame++; }
+
+    private:
+        uint64_t m_latency;
+        uint64_t m_frame = 0;
+        std::deque<uint64_t> m_staging;     // deque keeps handles stable
+        std::deque<uint64_t> m_queries;
+    };
+}
+
+static void BM_ReadbackRing_SubmitAcquire(benchmark::State& state)
+{
+    const auto depth = static_cast<uint32_t>(state.range(0));
+    const auto latency = static_cast<uint64_t>(state.range(1));
+
+    SimulatedReadbackDevice device(latency);
+    ReadbackRing ring(&device, depth);
+
+    uint64_t presented = 0;
+    int source = 0;
+
+    for (auto _ : state)
+    {
+        ring.Submit(&source, 1920, 1080);
+        if (const ReadbackSlot* slot = ring.AcquireLatest())
+        {
+            presented++;
+            ring.Release(slot);
+        }
+        device.EndFrame();
+    }
+
+    const auto& stats = ring.GetStats();
+    state.counters["presented%"] = 100.0 * static_cast<double>(presented) / static_cast<double>(state.iterations());
+    state.counters["overwritten"] = static_cast<double>(stats.overwritten);
+    state.counters["staging"] = static_cast<double>(stats.stagingCreated);
+}
+
+// Args: ring depth, simulated GPU latency in frames
+BENCHMARK(BM_ReadbackRing_SubmitAcquire)
+    ->ArgsProduct({ { 1, 2, 3, 4 }, { 1, 2, 3 } })
+    ->ArgNames({ "depth", "latency" });
@@ -0,0 +1,157 @@
+// ============================================================================
+// WebViewToolkit - ScrollDetector Benchmarks
+// ============================================================================
+// Hash-and-match cost per frame on synthetic pages. Each iteration alternates
+// between two prebuilt viewports of one page that differ by the pattern, so
+// every Detect() sees exactly that change. Throughput is hashed bytes per
+// second; "patchShare" is the part of the frame still uploaded.
+// ============================================================================
+
+#include "Core/ScrollDetector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    enum class ScrollPattern
+    {
+        Static,         // Nothing changes
+        Caret,          // A few pixels change, no scroll
+        Vertical,       // Content moves by 3% of the height
+        Horizontal,     // Content moves by 3% of the width
+        Replaced,       // Every row changes, nothing matches
+    };
+
+    struct PatternCase
+    {
+        const char* name;
+        ScrollPattern pattern;
+    };
+
+    const PatternCase kPatterns[] = {
+        { "Static", ScrollPattern::Static },
+        { "Caret", ScrollPattern::Caret },
+        { "Vertical", ScrollPattern::Vertical },
+        { "Horizontal", ScrollPattern::Horizontal },
+        { "Replaced", ScrollPattern::Replaced },
+    };
+
+    const PixelIsa kIsas[] = { PixelIsa::Scalar, PixelIsa::SSE2, PixelIsa::AVX2, PixelIsa::NEON };
+
+    // Text-like page: lines of noise separated by blank gaps, on a canvas
+    // larger than the viewport in both directions
+    std::vector<uint32_t> BuildPage(uint32_t width, uint32_t height)
+    {
+        std::mt19937 rng(11);
+        std::vector<uint32_t> page(static_cast<size_t>(width) * height, 0xFFFFFFFFu);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            if (y % 24 >= 16)
+            {
+                continue;
+            }
+            for (uint32_t x = 0; x < width; x++)
+            {
+                page[static_cast<size_t>(y) * width + x] = rng() | 0xFF000000u;
+            }
+        }
+        return page;
+    }
+
+    void CopyViewport(const std::vector<uint32_t>& page, uint32_t pageWidth, uint32_t left, uint32_t top,
+        std::vector<uint8_t>& frame, size_t pitch, uint32_t width, uint32_t height)
+    {
+        for (uint32_t y = 0; y < height; y++)
+        {
+            std::memcpy(&frame[y * pitch], &page[static_cast<size_t>(top + y) * pageWidth + left], static_cast<size_t>(width) * 4);
+        }
+    }
+
+    void BM_ScrollDetector(benchmark::State& state, ScrollPattern pattern, PixelIsa isa)
+    {
+        if (!SetPixelKernelIsa(isa))
+        {
+            state.SkipWithError("instruction set not supported");
+            return;
+        }
+
+        const auto width = static_cast<uint32_t>(state.range(0));
+        const auto height = static_cast<uint32_t>(state.range(1));
+        const size_t pitch = (static_cast<size_t>(width) * 4 + 255) & ~size_t(255);
+        const uint32_t pageWidth = width * 2;
+        const uint32_t pageHeight = height * 2;
+        const std::vector<uint32_t> page = BuildPage(pageWidth, pageHeight);
+
+        std::vector<uint8_t> frameA(pitch * height);
+        std::vector<uint8_t> frameB(pitch * height);
+        CopyViewport(page, pageWidth, 0, 0, frameA, pitch, width, height);
+        switch (pattern)
+        {
+        case ScrollPattern::Static:
+            frameB = frameA;
+            break;
+        case ScrollPattern::Caret:
+            frameB = frameA;
+            for (uint32_t y = 100; y < 120 && y < height; y++)
+            {
+                frameB[y * pitch + 100 * 4] ^= 0xFF;
+            }
+            break;
+        case ScrollPattern::Vertical:
+            CopyViewport(page, pageWidth, 0, height * 3 / 100, frameB, pitch, width, height);
+            break;
+        case ScrollPattern::Horizontal:
+            CopyViewport(page, pageWidth, width * 3 / 100, 0, frameB, pitch, width, height);
+            break;
+        case ScrollPattern::Replaced:
+            CopyViewport(page, pageWidth, width, height, frameB, pitch, width, height);
+            break;
+        }
+
+        ScrollDetector detector;
+        detector.Detect(frameA.data(), pitch, width, height);
+
+        // Scrolling back and forth: every frame is a shift of the one before
+        bool useB = true;
+        bool found = false;
+        int64_t patchArea = 0;
+        for (auto _ : state)
+        {
+            found = detector.Detect((useB ? frameB : frameA).data(), pitch, width, height);
+            benchmark::DoNotOptimize(found);
+            patchArea = found ? detector.GetPatchArea() : 0;
+            useB = !useB;
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * width * 4 * height);
+        state.counters["found"] = found ? 1.0 : 0.0;
+        state.counters["moves"] = static_cast<double>(detector.GetMoves().size());
+        state.counters["patchShare"] = static_cast<double>(patchArea) / (static_cast<double>(width) * height);
+        ResetPixelKernelIsa();
+    }
+
+    // Registered at startup so every pattern x ISA pair gets its own name
+    const bool kRegistered = []
+    {
+        for (const PatternCase& pattern : kPatterns)
+        {
+            for (PixelIsa isa : kIsas)
+            {
+                const std::string name = std::string("BM_ScrollDetector/") + pattern.name + "/" + GetPixelIsaName(isa);
+                benchmark::RegisterBenchmark(name.c_str(), BM_ScrollDetector, pattern.pattern, isa)
+                    ->Args({ 1280, 720 })
+                    ->Args({ 1920, 1080 })
+                    ->Args({ 2560, 1440 })
+                    ->ArgNames({ "width", "height" });
+            }
+        }
+        return true;
+    }();
+}
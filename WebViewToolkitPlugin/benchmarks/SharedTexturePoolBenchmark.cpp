@@ -0,0 +1,67 @@
+// ============================================================================
+// WebViewToolkit - SharedTexturePool Benchmarks
+// ============================================================================
+// A panel animating its width every frame, resized the way the backends do:
+// in place if the texture fits, else released and acquired. The counters
+// report how many resizes still reached the texture factory.
+// ============================================================================
+
+#include "Core/SharedTexturePool.h"
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <deque>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    class CountingTextureFactory final : public ISharedTextureFactory
+    {
+    public:
+        void* CreateTexture(uint32_t, uint32_t) override
+        {
+            created++;
+            m_textures.push_back(0);
+            return &m_textures.back();
+        }
+        void DestroyTexture(void*) override { destroyed++; }
+
+        uint64_t created = 0;
+        uint64_t destroyed = 0;
+
+    private:
+        std::deque<int> m_textures; // deque keeps handles stable
+    };
+}
+
+static void BM_SharedTexturePool_AnimatedResize(benchmark::State& state)
+{
+    // Width swings around 800 by +-amplitude over a second at 60 fps
+    const auto amplitude = static_cast<double>(state.range(0));
+    CountingTextureFactory factory;
+    SharedTexturePool pool(&factory);
+    void* texture = pool.Acquire(800, 600);
+
+    uint64_t frame = 0;
+    uint64_t resizes = 0;
+    for (auto _ : state)
+    {
+        const auto width = static_cast<uint32_t>(800.0 + amplitude * std::sin(static_cast<double>(frame++) * 6.2831853 / 60.0));
+        if (!pool.ResizeInPlace(texture, width, 600))
+        {
+            pool.Release(texture);
+            texture = pool.Acquire(width, 600);
+        }
+        benchmark::DoNotOptimize(texture);
+        resizes++;
+    }
+
+    state.counters["created%"] = 100.0 * static_cast<double>(factory.created) / static_cast<double>(resizes);
+    state.counters["inPlace%"] = 100.0 * static_cast<double>(pool.GetStats().resizedInPlace) / static_cast<double>(resizes);
+    state.counters["idleMB"] = static_cast<double>(pool.GetStats().idleBytes) / (1024.0 * 1024.0);
+}
+
+// Args: amplitude of the width animation in texels
+BENCHMARK(BM_SharedTexturePool_AnimatedResize)->Arg(16)->Arg(128)->Arg(512)->ArgNames({ "amplitude" });
@@ -0,0 +1,140 @@
+// ============================================================================
+// WebViewToolkit - TileChangeDetector Benchmarks
+// ============================================================================
+// Hash-and-diff cost per frame for synthetic change patterns. Each iteration
+// alternates between two prebuilt frames that differ by the pattern, so every
+// Detect() sees exactly that change. Throughput is hashed bytes per second.
+// ============================================================================
+
+#include "Core/TileChangeDetector.h"
+
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    enum class ChangePattern
+    {
+        Static,         // Nothing changes
+        Caret,          // One pixel column in a single tile
+        Scattered,      // ~10% of tiles, random positions
+        Scroll,         // Every tile
+    };
+
+    struct PatternCase
+    {
+        const char* name;
+        ChangePattern pattern;
+    };
+
+    const PatternCase kPatterns[] = {
+        { "Static", ChangePattern::Static },
+        { "Caret", ChangePattern::Caret },
+        { "Scattered", ChangePattern::Scattered },
+        { "Scroll", ChangePattern::Scroll },
+    };
+
+    const PixelIsa kIsas[] = { PixelIsa::Scalar, PixelIsa::SSE2, PixelIsa::AVX2, PixelIsa::NEON };
+
+    void ApplyPattern(std::vector<uint8_t>& frame, size_t pitch, uint32_t width, uint32_t height,
+        uint32_t tileSize, ChangePattern pattern)
+    {
+        std::mt19937 rng(7);
+        switch (pattern)
+        {
+        case ChangePattern::Static:
+            break;
+        case ChangePattern::Caret:
+            for (uint32_t y = 100; y < 120 && y < height; y++)
+            {
+                frame[y * pitch + 100 * 4] ^= 0xFF;
+            }
+            break;
+        case ChangePattern::Scattered:
+            for (uint32_t ty = 0; ty < height; ty += tileSize)
+            {
+                for (uint32_t tx = 0; tx < width; tx += tileSize)
+                {
+                    if (rng() % 10 == 0)
+                    {
+                        frame[ty * pitch + tx * 4] ^= 0xFF;
+                    }
+                }
+            }
+            break;
+        case ChangePattern::Scroll:
+            for (uint32_t y = 0; y < height; y++)
+            {
+                for (uint32_t x = 0; x < width; x += 8)
+                {
+                    frame[y * pitch + x * 4 + 1] ^= 0x55;
+                }
+            }
+            break;
+        }
+    }
+
+    void BM_TileChangeDetector(benchmark::State& state, ChangePattern pattern, PixelIsa isa)
+    {
+        if (!SetPixelKernelIsa(isa))
+        {
+            state.SkipWithError("instruction set not supported");
+            return;
+        }
+
+        const auto width = static_cast<uint32_t>(state.range(0));
+        const auto height = static_cast<uint32_t>(state.range(1));
+        const auto tileSize = static_cast<uint32_t>(state.range(2));
+        const size_t pitch = (static_cast<size_t>(width) * 4 + 255) & ~size_t(255);
+
+        std::vector<uint8_t> frameA(pitch * height);
+        for (size_t i = 0; i < frameA.size(); i++)
+        {
+            frameA[i] = static_cast<uint8_t>(i * 2654435761u >> 24);
+        }
+        std::vector<uint8_t> frameB = frameA;
+        ApplyPattern(frameB, pitch, width, height, tileSize, pattern);
+
+        TileChangeDetector detector(tileSize);
+        detector.Detect(frameA.data(), pitch, width, height);
+
+        bool useB = true;
+        size_t rects = 0;
+        for (auto _ : state)
+        {
+            const auto& changed = detector.Detect((useB ? frameB : frameA).data(), pitch, width, height);
+            benchmark::DoNotOptimize(changed.data());
+            rects = changed.size();
+            useB = !useB;
+        }
+
+        state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * width * 4 * height);
+        state.counters["changedTiles"] = static_cast<double>(detector.GetChangedTileCount());
+        state.counters["rects"] = static_cast<double>(rects);
+        ResetPixelKernelIsa();
+    }
+
+    // Registered at startup so every pattern x ISA pair gets its own name
+    const bool kRegistered = []
+    {
+        for (const PatternCase& pattern : kPatterns)
+        {
+            for (PixelIsa isa : kIsas)
+            {
+                const std::string name = std::string("BM_TileChangeDetector/") + pattern.name + "/" + GetPixelIsaName(isa);
+                benchmark::RegisterBenchmark(name.c_str(), BM_TileChangeDetector, pattern.pattern, isa)
+                    ->Args({ 1280, 720, 64 })
+                    ->Args({ 1920, 1080, 32 })
+                    ->Args({ 1920, 1080, 64 })
+                    ->Args({ 1920, 1080, 128 })
+                    ->ArgNames({ "width", "height", "tile" });
+            }
+        }
+        return true;
+    }();
+}
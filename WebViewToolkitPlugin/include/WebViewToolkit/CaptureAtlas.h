@@ -0,0 +1,154 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Capture Atlas
+// ============================================================================
+// Opt-in capture mode for many small views. Their WebView2 visuals are laid
+// out side by side under one hidden host window, which a single capture
+// session copies into one shared texture per frame. Each view samples its
+// own sub-rectangle of that texture (WebViewToolkit_GetTextureUVRect), so N
+// views cost one session, one frame pool and one copy instead of N.
+//
+// Atlas views are always flipped in a single pass and drained to the newest
+// frame, and their frames are copied whole.
+// ============================================================================
+
+#include "Types.h"
+#include "RenderAPI.h"
+#include "Core/AtlasPacker.h"
+#include "Core/FrameDrain.h"
+#include "Core/FrameVersionTable.h"
+#include "Core/PendingHandleQueue.h"
+#include "Core/SurfaceTextureCache.h"
+#include <mutex>
+#include <unordered_map>
+
+namespace WebViewToolkit
+{
+    class CaptureAtlas : private ISurfaceTextureResolver
+    {
+    public:
+        static constexpr uint32_t InitialSize = 1024;
+        static constexpr uint32_t MaxSize = 4096;
+        static constexpr uint32_t Gutter = 2;   // Texels between views, so filtering does not bleed
+
+        explicit CaptureAtlas(IRenderAPI* renderAPI);
+        ~CaptureAtlas() override;
+
+        CaptureAtlas(const CaptureAtlas&) = delete;
+        CaptureAtlas& operator=(const CaptureAtlas&) = delete;
+
+        // ====================================================================
+        // Views (main thread)
+        // ====================================================================
+
+        /// @brief Reserve space for a view, growing the atlas if needed
+        /// @return ErrorTextureCreationFailed if it does not fit even at MaxSize
+        Result AddView(WebViewHandle handle, uint32_t width, uint32_t height);
+
+        /// @brief Host the view's WebView2 visual at its place in the atlas
+        Result AttachView(WebViewHandle handle, void* compositionController);
+
+        /// @brief Keeps the view where it is if the new size fits there
+        Result ResizeView(WebViewHandle handle, uint32_t width, uint32_t height);
+
+        void RemoveView(WebViewHandle handle);
+
+        /// @brief Parent window for the views' composition controllers
+        void* GetHostWindow() const { return m_hostWindow; }
+
+        // ====================================================================
+        // Texture
+        // ====================================================================
+
+        /// @brief Copy the newest captured frame into the atlas texture (render thread)
+        /// @param frameVersions Bumped for every view in the atlas when a frame is copied
+        /// @return true if the atlas should be visited again on the next render event
+        bool UpdateTexture(FrameVersionTable& frameVersions);
+
+        /// @brief Raised by FrameArrived; the manager visits the atlas while it is set
+        bool IsUpdateRequested() const { return m_updateRequested.IsRaised(); }
+        void RequestUpdate() { m_updateRequested.Raise(); }
+
+        void* GetTexturePtr() const;
+        void GetTextureSize(uint32_t& outWidth, uint32_t& outHeight) const;
+        void GetTexture(void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const;
+
+        /// @brief A view's part of the texture as {x, y, width, height}, normalized
+        /// @note Follows the texture: a moved or resized view's rectangle changes
+        ///       with the first frame presented after the change
+        bool GetUVRect(WebViewHandle handle, float outUVRect[4]) const;
+
+        CaptureFrameStats GetFrameStats() const { return m_frameCounters.Snapshot(); }
+
+        void OnDeviceLost();
+        void OnDeviceRestored();
+
+    private:
+        struct ViewSlot
+        {
+            AtlasRect rect;                 // Current layout, without the gutter
+            AtlasRect presentedRect;        // Layout of the frame in the texture
+            void* visual = nullptr;         // ContainerVisual
+            void* compositionController = nullptr; // Weak ref
+        };
+
+        Result Initialize();
+        void Shutdown();
+
+        Result Place(WebViewHandle handle, uint32_t width, uint32_t height, bool resize);
+        void ApplyLayout();
+        Result ResizeAtlas(uint32_t width, uint32_t height);
+
+        void* CreateHostWindow(uint32_t width, uint32_t height);
+        void InitializeVisualTree();
+        void CreateCaptureSession(uint32_t width, uint32_t height);
+        void CloseCaptureSession();
+
+        // ISurfaceTextureResolver
+        void* ResolveTexture(void* surface) override;
+        void ReleaseEntry(void* surface, void* texture) override;
+
+        IRenderAPI* m_renderAPI; // Weak ref
+        AtlasPacker m_packer;
+        std::unordered_map<WebViewHandle, ViewSlot> m_views;
+
+        void* m_hostWindow = nullptr;    // HWND
+        void* m_compositor = nullptr;    // Compositor
+        void* m_windowTarget = nullptr;  // DesktopWindowTarget
+        void* m_rootVisual = nullptr;    // ContainerVisual
+
+        // Capture
+        void* m_d3dDevice = nullptr;     // WinRT IDirect3DDevice
+        void* m_captureItem = nullptr;
+        void* m_framePool = nullptr;
+        void* m_session = nullptr;
+        bool m_frameEventsEnabled = true;
+        uint64_t m_frameSerial = 0;
+
+        // Textures behind the frame pool's surfaces, so frames do not query
+        // them. Cleared with the pool; used under m_mutex.
+        SurfaceTextureCache m_surfaceTextures;
+
+        // The render thread holds the mutex while it copies, the main thread
+        // while it changes the layout, the texture or the frame pool. A grown
+        // atlas renders into m_pendingTexture until it holds a frame, as
+        // WebView does after a resize.
+        mutable std::mutex m_mutex;
+        // Pooled textures may be larger than the atlas, which fills their top-left part
+        void* m_texturePtr = nullptr;
+        uint32_t m_textureWidth = 0;    // Allocated size
+        uint32_t m_textureHeight = 0;
+        uint32_t m_atlasHeight = 0;     // Of the atlas in m_texturePtr
+        void* m_pendingTexture = nullptr;
+        uint32_t m_pendingWidth = 0;
+        uint32_t m_pendingHeight = 0;
+        uint32_t m_pendingAtlasHeight = 0;
+        void* m_retiredTexture = nullptr;
+        bool m_layoutChanged = false;
+
+        CaptureFrameCounters m_frameCounters;
+        PendingFlag m_updateRequested;
+    };
+
+} // namespace WebViewToolkit
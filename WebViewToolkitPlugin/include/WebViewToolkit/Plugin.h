@@ -49,12 +49,44 @@ WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebView(
     uint32_t* outHandle
 );
 
+/// @brief Create a new WebView instance with a chosen capture frame pool depth
+/// @param framePoolDepth Capture buffers: 1 for lowest latency, 3 to ride out
+///        render hitches, 0 to adapt to observed drops (WebViewToolkit_CreateWebView uses 2)
+/// @param outHandle [out] Handle to the created instance
+/// @return Result code, ErrorInvalidArgument if framePoolDepth is above 3
+WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebViewEx(
+    uint32_t width,
+    uint32_t height,
+    const wchar_t* userDataFolder,
+    const wchar_t* initialUrl,
+    int32_t enableDevTools,
+    uint32_t framePoolDepth,
+    uint32_t* outHandle
+);
+
+/// @brief Create a WebView in the shared capture atlas
+/// @note Many small views are cheaper this way: all atlas views are captured
+///       by one session into one texture. Sample the view's part of it with
+///       WebViewToolkit_GetTextureUVRect. The atlas grows up to 4096x4096
+/// @param outHandle [out] Handle to the created instance
+/// @return Result code, ErrorTextureCreationFailed if the view does not fit in the atlas
+WEBVIEW_EXPORT int32_t WebViewToolkit_CreateAtlasWebView(
+    uint32_t width,
+    uint32_t height,
+    const wchar_t* userDataFolder,
+    const wchar_t* initialUrl,
+    int32_t enableDevTools,
+    uint32_t* outHandle
+);
+
 /// @brief Destroy a WebView instance
 /// @param handle Instance handle
 /// @return Result code
 WEBVIEW_EXPORT int32_t WebViewToolkit_DestroyWebView(uint32_t handle);
 
 /// @brief Get the native texture pointer for a WebView
+/// @note After a resize or render scale change the pointer changes once the
+///       resized texture holds a frame; poll it with WebViewToolkit_GetTextureSize
 /// @param handle Instance handle
 /// @return Native texture pointer, or nullptr on failure
 WEBVIEW_EXPORT void* WebViewToolkit_GetTexturePtr(uint32_t handle);
@@ -64,8 +96,164 @@ WEBVIEW_EXPORT void* WebViewToolkit_GetTexturePtr(uint32_t handle);
 /// @param width New width in pixels
 /// @param height New height in pixels
 /// @return Result code
+/// @note Applied at once unless the last resize was less than the resize
+///       interval ago; the newest size is then applied by
+///       WebViewToolkit_ApplyPendingResizes once the interval has passed
 WEBVIEW_EXPORT int32_t WebViewToolkit_Resize(uint32_t handle, uint32_t width, uint32_t height);
 
+/// @brief Set the minimum time between applied resizes of a WebView
+/// @param handle Instance handle
+/// @param intervalMs Interval in milliseconds (default 100), 0 to apply every resize at once
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetResizeInterval(uint32_t handle, uint32_t intervalMs);
+
+/// @brief Apply the coalesced resizes whose interval has passed
+/// @note Call once per frame from the main thread
+WEBVIEW_EXPORT void WebViewToolkit_ApplyPendingResizes();
+
+/// @brief Get the resize counters of a WebView
+/// @param handle Instance handle
+/// @param outStats [out] Counters since the WebView was created
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetResizeStats(uint32_t handle, WebViewToolkit::ResizeStats* outStats);
+
+/// @brief Select how captured frames are flipped into Unity's texture
+/// @param handle Instance handle
+/// @param flipMode Flip strategy (0=None, 1=RowCopy, 2=SinglePass)
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetFlipMode(uint32_t handle, int32_t flipMode);
+
+/// @brief Select how many queued capture frames are consumed per render event
+/// @param handle Instance handle
+/// @param drainMode Drain strategy (0=Single, 1=Latest)
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetFrameDrainMode(uint32_t handle, int32_t drainMode);
+
+/// @brief Select whether Unity samples a copy of each captured frame or the frame itself
+/// @param handle Instance handle
+/// @param presentMode 0=Copy, 1=ZeroCopy (DX11 only, not for atlas views; frames are not flipped)
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetPresentMode(uint32_t handle, int32_t presentMode);
+
+/// @brief Copy a WebView's newest frame in the LateLatchTextures render event
+///        instead of UpdateTexture
+/// @note Frames are taken from the capture as they arrive and only the newest
+///       is copied, whole. Applies in PresentMode Copy; not for atlas views
+/// @param handle Instance handle
+/// @param enabled Non-zero to late-latch
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetLateLatch(uint32_t handle, int32_t enabled);
+
+/// @brief Get the capture frame counters of a WebView
+/// @param handle Instance handle
+/// @param outStats [out] Counters since the WebView was created, and the time
+///                 from capture to copy of the copied frames
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetCaptureStats(uint32_t handle, WebViewToolkit::CaptureFrameStats* outStats);
+
+/// @brief Get how many frames a WebView's texture has received and when the last one came
+/// @note Lock-free; cheap enough to poll every frame to skip work for unchanged views
+/// @param handle Instance handle
+/// @param outVersion [out] Frame sequence number (0 until the first frame) and timestamp
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameVersion(uint32_t handle, WebViewToolkit::FrameVersion* outVersion);
+
+/// @brief Get the frame versions of all WebViews in one call
+/// @note Lock-free. Views beyond capacity are left out; entries are in no particular order
+/// @param outVersions [out] Array of at least capacity entries
+/// @param capacity Entries outVersions can hold
+/// @param outCount [out] Entries written
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameVersions(WebViewToolkit::FrameVersion* outVersions, uint32_t capacity, uint32_t* outCount);
+
+/// @brief Get the heap allocations, QueryInterface calls and graphics objects
+///        created by the render thread's texture updates
+/// @note Only counted in debug builds of the plugin; release builds report zeros.
+///       Frames that do any of the three count as over budget
+/// @param outStats [out] Counts of the last update and since startup
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameResourceStats(WebViewToolkit::FrameResourceStats* outStats);
+
+/// @brief Attach another texture the view's captured frames are copied into
+/// @note Frames are captured once and copied into every mirror in the same
+///       render event. Content larger than the mirror is scaled down to fit,
+///       keeping its aspect ratio, on backends that can scale (DX11); elsewhere
+///       such frames skip the mirror. Attaching the same size twice shares one
+///       mirror and id; each attach needs a matching detach. Not for atlas views
+/// @param handle Instance handle
+/// @param width Mirror width in pixels
+/// @param height Mirror height in pixels
+/// @param outMirrorId [out] Id for the other mirror functions
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_AttachMirror(uint32_t handle, uint32_t width, uint32_t height, uint32_t* outMirrorId);
+
+/// @brief Detach a mirror; its texture is destroyed with its last attach
+/// @param handle Instance handle
+/// @param mirrorId Id from WebViewToolkit_AttachMirror
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_DetachMirror(uint32_t handle, uint32_t mirrorId);
+
+/// @brief Get a mirror's native texture, which stays the same until it is detached
+/// @param handle Instance handle
+/// @param mirrorId Id from WebViewToolkit_AttachMirror
+/// @param outTexture [out] Native texture pointer
+/// @param outWidth [out] Texture width in pixels, at least the mirror's
+/// @param outHeight [out] Texture height in pixels, at least the mirror's
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetMirrorTexture(uint32_t handle, uint32_t mirrorId, void** outTexture, uint32_t* outWidth, uint32_t* outHeight);
+
+/// @brief Get the part of a mirror's texture that holds the view
+/// @param handle Instance handle
+/// @param mirrorId Id from WebViewToolkit_AttachMirror
+/// @param outUVRect [out] Four floats: x, y, width, height in UV coordinates
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetMirrorUVRect(uint32_t handle, uint32_t mirrorId, float* outUVRect);
+
+/// @brief Render and capture a WebView at a fraction of its size, keeping its layout
+/// @param handle Instance handle
+/// @param scale Fraction of the width and height (0.25 - 1.0); disables automatic scaling
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetRenderScale(uint32_t handle, float scale);
+
+/// @brief Let the render scale follow WebViewToolkit_ReportRenderScaleSample
+/// @param handle Instance handle
+/// @param frameBudgetMs Frame time budget of this view, 0 to follow coverage only
+/// @param minScale Lowest scale to pick (0.25 - 1.0)
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_EnableAutoRenderScale(uint32_t handle, float frameBudgetMs, float minScale);
+
+/// @brief Feed one frame to the automatic render scale, resizing when it changes
+/// @param handle Instance handle
+/// @param frameTimeMs Frame time the host attributes to this view
+/// @param coverage On-screen pixels over the view's pixels at full scale
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_ReportRenderScaleSample(uint32_t handle, float frameTimeMs, float coverage);
+
+/// @brief Get the size of the texture returned by WebViewToolkit_GetTexturePtr
+/// @param handle Instance handle
+/// @param outWidth [out] Texture width in pixels
+/// @param outHeight [out] Texture height in pixels
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTextureSize(uint32_t handle, uint32_t* outWidth, uint32_t* outHeight);
+
+/// @brief Get the native texture pointer and its size in one call
+/// @note Same as WebViewToolkit_GetTexturePtr, which in zero-copy mode takes the
+///       newest frame; the size always belongs to the returned texture
+/// @param handle Instance handle
+/// @param outTexture [out] Native texture pointer, nullptr if there is none
+/// @param outWidth [out] Texture width in pixels
+/// @param outHeight [out] Texture height in pixels
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTexture(uint32_t handle, void** outTexture, uint32_t* outWidth, uint32_t* outHeight);
+
+/// @brief Get the part of the texture that holds the view
+/// @note {0, 0, 1, 1} except for atlas views, whose rectangle changes when
+///       the view is resized or the atlas grows
+/// @param handle Instance handle
+/// @param outUVRect [out] Four floats: x, y, width, height in UV coordinates
+/// @return Result code
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTextureUVRect(uint32_t handle, float* outUVRect);
+
 // ============================================================================
 // Navigation
 // ============================================================================
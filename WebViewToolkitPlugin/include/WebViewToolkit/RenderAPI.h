@@ -18,6 +18,21 @@ namespace WebViewToolkit
     // Forward declarations
     class WebViewInstance;
 
+    // ========================================================================
+    // Captured Frame
+    // ========================================================================
+    struct CapturedFrame
+    {
+        void* texture = nullptr;                    // ID3D11Texture2D* on the capture device
+        uint32_t width = 0;                         // Live part at the top-left of texture, 0 = whole texture
+        uint32_t height = 0;
+        uint64_t serial = 0;                        // Per-view frame counter, +1 per delivered frame
+        const PixelRect* dirtyRects = nullptr;      // Changes since frame serial - 1, nullptr if unknown
+        uint32_t dirtyRectCount = 0;
+        uint32_t scaledWidth = 0;                   // Stretch the live part to this size, 0 = copy 1:1
+        uint32_t scaledHeight = 0;                  // (a frame from before a resize, see CanScaleFrames)
+    };
+
     // ========================================================================
     // Abstract Render API Interface
     // ========================================================================
@@ -50,10 +65,13 @@ namespace WebViewToolkit
         /// @param height Texture height in pixels
         /// @param outNativePtr [out] Native texture pointer for Unity
         /// @return Result code
+        /// @note The texture may be larger than requested (see GetSharedTextureSize);
+        ///       captured frames are copied into its top-left part
         virtual Result CreateSharedTexture(uint32_t width, uint32_t height, void** outNativePtr) = 0;
 
         /// @brief Destroy a previously created shared texture
         /// @param nativePtr Native texture pointer
+        /// @note Pooling backends keep the texture for reuse by a later create or resize
         virtual void DestroySharedTexture(void* nativePtr) = 0;
 
         /// @brief Resize an existing shared texture
@@ -64,6 +82,15 @@ namespace WebViewToolkit
         /// @return Result code
         virtual Result ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr) = 0;
 
+        /// @brief Keep a shared texture for a new size if its allocation already fits it
+        /// @return false if a new texture is needed; nativePtr is then unchanged
+        /// @note Backends without a texture pool need not override
+        virtual bool ResizeSharedTextureInPlace(void* /*nativePtr*/, uint32_t /*newWidth*/, uint32_t /*newHeight*/) { return false; }
+
+        /// @brief Allocated size of a shared texture, which may exceed the size it was created or resized for
+        /// @return false if unknown; the texture then has exactly the size it was created for
+        virtual bool GetSharedTextureSize(void* /*nativePtr*/, uint32_t& /*outWidth*/, uint32_t& /*outHeight*/) { return false; }
+
         // ====================================================================
         // WebView Rendering
         // ====================================================================
@@ -96,22 +123,55 @@ namespace WebViewToolkit
         // ====================================================================
         
         /// @brief Wait for GPU operations to complete
-        /// @note Critical for DX12 to prevent flickering
+        /// @note A full CPU/GPU sync; prefer WaitForTextureWrites()
         virtual void WaitForGPU() = 0;
 
         /// @brief Signal that WebView rendering is complete
+        /// @note Submits only if work was recorded since the last submission
         virtual void SignalRenderComplete() = 0;
 
+        /// @brief Timeline value after which the copies into a texture recorded so far have completed
+        /// @param texturePtr Unity's native texture pointer
+        /// @return 0 if nothing was copied into it, or the backend keeps no timeline
+        virtual uint64_t GetLastWrittenFence(void* /*texturePtr*/) { return 0; }
+
+        /// @brief Block until the copies into a texture have completed
+        /// @note Returns at once if they already have. Backends without a
+        ///       timeline fall back to WaitForGPU().
+        virtual void WaitForTextureWrites(void* /*texturePtr*/) { WaitForGPU(); }
+
         // ====================================================================
         // Texture Copying (for Windows Graphics Capture API)
         // ====================================================================
 
         /// @brief Copy a captured texture to Unity's texture
-        /// @param capturedTexture Texture from Windows Graphics Capture API
+        /// @param frame Frame from Windows Graphics Capture API
+        /// @param unityTexturePtr Unity's native texture pointer
+        /// @param flipMode How to flip Y coordinates during copy
+        /// @note Only the frame's dirty rectangles are copied when the destination
+        ///       already holds the previous frame; otherwise the whole frame is.
+        ///       For DX12, handles cross-device copy and texture wrapping.
+        virtual void CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode flipMode) = 0;
+
+        /// @brief Whether CopyCapturedTextureToUnityTexture honours CapturedFrame::scaledWidth/Height
+        /// @note Backends that cannot scale never get a scaled frame; frames from
+        ///       before a resize are then held back instead
+        virtual bool CanScaleFrames() const { return false; }
+
+        /// @brief Present copies that completed since the last captured frame
         /// @param unityTexturePtr Unity's native texture pointer
-        /// @param flipY Whether to flip Y coordinates during copy
-        /// @note For DX12, handles cross-device copy and texture wrapping
-        virtual void CopyCapturedTextureToUnityTexture(void* capturedTexture, void* unityTexturePtr, bool flipY) = 0;
+        /// @return true if copies for this texture are still in flight
+        /// @note Called when no new frame is available. Backends with synchronous copies need not override.
+        virtual bool ResolvePendingCopies(void* /*unityTexturePtr*/) { return false; }
+
+        /// @brief Start collecting the copies of one render event
+        /// @note Copies requested until EndCopyBatch() may be recorded and submitted
+        ///       only then, all at once. Calls may nest. Backends without per-copy
+        ///       submission cost need not override.
+        virtual void BeginCopyBatch() {}
+
+        /// @brief Record and submit the copies collected since BeginCopyBatch()
+        virtual void EndCopyBatch() {}
 
     protected:
         IRenderAPI() = default;
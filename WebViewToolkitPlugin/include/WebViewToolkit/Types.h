@@ -47,6 +47,7 @@ namespace WebViewToolkit
         ErrorInvalidHandle = -2,
         ErrorNotInitialized = -3,
         ErrorAlreadyInitialized = -4,
+        ErrorInvalidArgument = -5,
         
         // Graphics errors
         ErrorUnsupportedGraphicsAPI = -100,
@@ -60,6 +61,116 @@ namespace WebViewToolkit
         ErrorNavigationFailed = -202,
     };
 
+    // ========================================================================
+    // Y-Flip Strategy
+    // ========================================================================
+    // Captured frames are top-down, Unity textures bottom-up. The strategy
+    // decides how the flip is applied when copying into Unity's texture.
+    enum class FlipMode : int32_t
+    {
+        None = 0,           // Plain copy, content appears upside down in Unity
+        RowCopy = 1,        // One copy call per row (legacy, O(height) API calls)
+        SinglePass = 2,     // Constant call count: shader blit (DX11) or flipped CPU buffer (DX12)
+    };
+
+    // ========================================================================
+    // Frame Drain Strategy
+    // ========================================================================
+    // How many frames UpdateTexture pulls from the capture frame pool per
+    // render event. Frames queue up whenever capture outpaces rendering.
+    enum class FrameDrainMode : int32_t
+    {
+        Single = 0,         // One frame per event, queued frames are shown late
+        Latest = 1,         // Discard all but the newest available frame
+    };
+
+    // ========================================================================
+    // Present Mode
+    // ========================================================================
+    // Whether Unity samples a copy of each captured frame or the frame itself.
+    enum class PresentMode : int32_t
+    {
+        Copy = 0,           // Frames are copied (and flipped) into the view's texture
+        ZeroCopy = 1,       // DX11 only: Unity samples the capture frame's texture, unflipped like FlipMode::None
+    };
+
+    // ========================================================================
+    // Capture Frame Statistics
+    // ========================================================================
+    // Per-view counters since creation. Layout is shared with C#.
+    struct CaptureFrameStats
+    {
+        uint64_t arrived;       // Frames taken from the capture frame pool
+        uint64_t presented;     // Frames copied into Unity's texture
+        uint64_t droppedStale;  // Frames discarded because a newer one was available
+        uint64_t noNewFrame;    // Render events that found the frame pool empty
+
+        // Time from capture to the copy into Unity's texture, in microseconds
+        uint64_t lastCopyAgeUs;
+        uint64_t maxCopyAgeUs;
+        uint64_t totalCopyAgeUs;    // Over copyAgeSamples copies
+        uint64_t copyAgeSamples;
+    };
+
+    // ========================================================================
+    // Frame Version
+    // ========================================================================
+    // Bumped each time a view's texture receives a new frame. Layout is
+    // shared with C#.
+    struct FrameVersion
+    {
+        WebViewHandle handle;
+        uint32_t reserved;
+        uint64_t sequence;      // Frames presented since creation; 0 until the first
+        uint64_t timestampMs;   // GetTickCount64 when the last frame was presented
+    };
+
+    // ========================================================================
+    // Frame Resource Statistics
+    // ========================================================================
+    // Heap allocations, QueryInterface calls and COM/GPU object creations on
+    // the render thread per render event. Counted in debug builds only;
+    // release builds report zeros. Layout is shared with C#.
+    struct FrameResourceStats
+    {
+        uint64_t frames;                // Render events measured
+        uint64_t framesOverBudget;      // Render events that counted anything
+        uint64_t lastAllocations;       // Counts of the last render event
+        uint64_t lastQueryInterfaces;
+        uint64_t lastObjectCreations;
+        uint64_t totalAllocations;      // Counts of all measured render events
+        uint64_t totalQueryInterfaces;
+        uint64_t totalObjectCreations;
+    };
+
+    // ========================================================================
+    // Resize Statistics
+    // ========================================================================
+    // Per-view counters since creation. Layout is shared with C#.
+    struct ResizeStats
+    {
+        uint64_t requested;     // Size changes asked for by Resize or a render scale change
+        uint64_t applied;       // Resizes carried out on the controller, window, texture and capture
+        uint64_t coalesced;     // Requests replaced by a later one before they were applied
+        uint64_t stretchedFrames;   // Frames of the old size scaled over the new one
+        uint64_t heldFrames;        // Frames of the old size skipped, keeping the previous one
+        uint64_t timedOut;          // Resizes whose first frame of the new size never came
+        uint32_t lastFirstFrameMs;  // Resize to first frame of the new size, last resize
+        uint32_t maxFirstFrameMs;
+    };
+
+    // ========================================================================
+    // Pixel Rectangle
+    // ========================================================================
+    // Half-open [left, right) x [top, bottom), top-down like capture frames.
+    struct PixelRect
+    {
+        int32_t left;
+        int32_t top;
+        int32_t right;
+        int32_t bottom;
+    };
+
     // ========================================================================
     // WebView Creation Parameters
     // ========================================================================
@@ -70,6 +181,8 @@ namespace WebViewToolkit
         const wchar_t* userDataFolder;      // Can be nullptr for default
         const wchar_t* initialUrl;          // Can be nullptr for blank
         bool enableDevTools;
+        uint32_t framePoolDepth;            // Capture buffers: 1-3 fixed, 0 = adaptive
+        bool useCaptureAtlas;               // Share one capture and texture with other atlas views
     };
 
     // ========================================================================
@@ -117,6 +230,7 @@ namespace WebViewToolkit
         Initialize = 0,
         Shutdown = 1,
         UpdateTexture = 2,
+        LateLatchTextures = 3,  // Copy late-latched views' newest frames
     };
 
     // ========================================================================
@@ -1,6 +1,11 @@
 #pragma once
 
 #include "Types.h"
+#include "Core/CaptureCapacityPolicy.h"
+#include "Core/FrameHandoff.h"
+#include "Core/MirrorRegistry.h"
+#include "Core/RenderScaleController.h"
+#include "Core/ResizeCoalescer.h"
 #include <memory>
 #include <string>
 #include <atomic>
@@ -10,6 +15,7 @@ namespace WebViewToolkit
 {
     class WebViewManager;
     class WebViewCapture;
+    class CaptureAtlas;
 
     // Instance state enumeration
     enum class WebViewState : int32_t
@@ -43,6 +49,8 @@ namespace WebViewToolkit
         WebViewHandle GetHandle() const { return m_handle; }
         uint32_t GetWidth() const { return m_width; }
         uint32_t GetHeight() const { return m_height; }
+        uint32_t GetRenderWidth() const { return m_renderWidth; }     // Logical size times render scale
+        uint32_t GetRenderHeight() const { return m_renderHeight; }
         WebViewState GetState() const { return m_state; }
         bool IsReady() const { return m_state == WebViewState::Ready; }
         
@@ -64,6 +72,36 @@ namespace WebViewToolkit
         // Lifecycle
         Result Resize(uint32_t width, uint32_t height);
 
+        // Resize coalescing (main thread)
+        Result ApplyPendingResize();    // Trailing edge of coalesced resizes, polled once per frame
+        bool HasPendingResize() const { return m_resizeCoalescer.HasPending(); }
+        Result SetResizeInterval(uint32_t intervalMs);
+        Result GetResizeStats(ResizeStats& outStats) const;
+
+        // Capture
+        Result SetFlipMode(FlipMode mode);
+        FlipMode GetFlipMode() const { return m_flipMode.load(std::memory_order_relaxed); }
+        Result SetFrameDrainMode(FrameDrainMode mode);
+        FrameDrainMode GetFrameDrainMode() const { return m_drainMode.load(std::memory_order_relaxed); }
+        Result SetPresentMode(PresentMode mode);
+        PresentMode GetPresentMode() const { return m_presentMode.load(std::memory_order_relaxed); }
+        Result SetLateLatch(bool enabled);
+        /// @brief Copies wait for the late-latch render event (only in PresentMode::Copy)
+        bool IsLateLatched() const;
+        Result GetCaptureStats(CaptureFrameStats& outStats) const;
+
+        // Mirrors: more textures fed from the view's capture (main thread)
+        Result AttachMirror(uint32_t width, uint32_t height, MirrorId& outId);
+        Result DetachMirror(MirrorId id);
+        Result GetMirrorTexture(MirrorId id, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const;
+        Result GetMirrorUVRect(MirrorId id, float outUVRect[4]) const;
+
+        // Render scale (main thread)
+        Result SetRenderScale(float scale);
+        Result EnableAutoRenderScale(float frameBudgetMs, float minScale);
+        Result ReportRenderScaleSample(float frameTimeMs, float coverage);
+        float GetRenderScale() const { return m_renderScale; }
+
         // Input
         Result SendMouseEvent(const MouseEventParams& params);
         Result SendKeyEvent(const KeyEventParams& params);
@@ -81,6 +119,11 @@ namespace WebViewToolkit
         void* CreateHostWindow(uint32_t width, uint32_t height);
         void DestroyHostWindow();
 
+        Result ApplyRenderScale(float scale);
+        Result ApplyRenderSize();
+        Result ApplyRenderSize(uint32_t width, uint32_t height);
+        void ApplyRasterizationScale();
+
         WebViewHandle m_handle;
         WebViewManager* m_manager; // Weak ref
 
@@ -89,6 +132,7 @@ namespace WebViewToolkit
         std::wstring m_userDataFolder;
         std::wstring m_pendingUrl;
         bool m_devToolsEnabled;
+        uint32_t m_framePoolDepth;       // 0 = adaptive
 
         std::atomic<WebViewState> m_state{ WebViewState::Uninitialized };
         
@@ -104,13 +148,72 @@ namespace WebViewToolkit
         
         std::unique_ptr<WebViewCapture> m_capture;
 
+        // Atlas views have no capture, texture or host window of their own
+        CaptureAtlas* m_atlas; // Weak ref, owned by the manager
+
     public:
         // Added for Manager delegation
-        void UpdateTexture();
-        void* GetTexturePtr() const { return m_texturePtr; }
+        bool UpdateTexture();   // true: visit again on the next render event
+        void LatchTexture();    // Late-latch render event
+        void RequestTextureUpdate();
+        void* GetTexturePtr() const;
+        void GetTextureSize(uint32_t& outWidth, uint32_t& outHeight) const;
+        /// @brief GetTexturePtr and the size of that texture, read together
+        void GetTexture(void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const;
+        /// @brief The view's part of its texture: the top-left content of a pooled
+        ///        texture, or its place in the capture atlas
+        void GetTextureUVRect(float outUVRect[4]) const;
 
     private:
+        // A resize renders into m_pendingTexture while Unity keeps sampling
+        // m_texturePtr; the render thread swaps them once the new one holds a
+        // frame. The replaced texture is released on the next resize.
+        // Textures come from a size-bucketed pool and may be larger than the
+        // content, which fills their top-left part. A resize that still fits
+        // keeps the texture and only changes the content size, also once a
+        // frame of the new size is presented.
+        mutable std::mutex m_textureMutex;
         void* m_texturePtr = nullptr; // Shared texture
+        uint32_t m_textureWidth = 0;  // Allocated size
+        uint32_t m_textureHeight = 0;
+        uint32_t m_contentWidth = 0;
+        uint32_t m_contentHeight = 0;
+        void* m_pendingTexture = nullptr;
+        uint32_t m_pendingWidth = 0;
+        uint32_t m_pendingHeight = 0;
+        uint32_t m_pendingContentWidth = 0;
+        uint32_t m_pendingContentHeight = 0;
+        bool m_resizePending = false;
+        void* m_retiredTexture = nullptr;
+
+        // Every captured frame is also copied into each mirror's texture
+        MirrorRegistry m_mirrors;
+
+        // In PresentMode::ZeroCopy Unity samples capture frames instead of
+        // m_texturePtr: the frame GetTexturePtr last returned, if any
+        mutable HandoffTexture m_sampledFrame;
+
+        uint32_t m_renderWidth;
+        uint32_t m_renderHeight;
+        float m_renderScale = 1.0f;
+        bool m_autoRenderScale = false;
+        RenderScaleController m_scaleController;
+        double m_baseRasterizationScale = 0.0;  // WebView2's own scale, 0 until overridden
+
+        // m_renderWidth/Height are the applied size; a coalesced resize waits
+        // here until ApplyPendingResize
+        ResizeCoalescer m_resizeCoalescer;
+
+        // The host window (and so the capture frame pool) is sized to a
+        // capacity around the render size and only resized when it no longer fits
+        CaptureCapacityPolicy m_captureCapacity;
+
+        std::atomic<FlipMode> m_flipMode{ FlipMode::SinglePass };
+        std::atomic<FrameDrainMode> m_drainMode{ FrameDrainMode::Latest };
+        std::atomic<PresentMode> m_presentMode{ PresentMode::Copy };
+        std::atomic<bool> m_lateLatch{ false };
+
+        void OnTextureUpdated(bool newFrame);
     };
 
 } // namespace WebViewToolkit
@@ -2,8 +2,19 @@
 
 #include "Types.h"
 #include "RenderAPI.h"
+#include "Core/FrameDrain.h"
+#include "Core/FrameHandoff.h"
+#include "Core/LatestFrameMailbox.h"
+#include "Core/FramePoolDepthController.h"
+#include "Core/MirrorRegistry.h"
+#include "Core/PendingHandleQueue.h"
+#include "Core/ResizeTransaction.h"
+#include "Core/SurfaceTextureCache.h"
+#include <array>
+#include <atomic>
 #include <memory>
 #include <mutex>
+#include <vector>
 #include <winrt/Windows.Graphics.Capture.h>
 #include <winrt/Windows.Graphics.DirectX.Direct3D11.h>
 #include <winrt/Windows.UI.Composition.h>
@@ -16,20 +27,73 @@ namespace WebViewToolkit
     /// Handles GraphicsCapture and Visual Composition for a WebView instance.
     /// Manages the bridge between WebView2's visual tree and Unity's texture.
     /// </summary>
-    class WebViewCapture
+    class WebViewCapture : private IFrameReleaser, private ISurfaceTextureResolver, private ILatestFrameReleaser
     {
     public:
-        WebViewCapture(WebView* webView, IRenderAPI* renderAPI);
-        ~WebViewCapture();
+        /// @param framePoolDepth Capture buffers (1-3), or AdaptiveFramePoolDepth
+        WebViewCapture(WebView* webView, IRenderAPI* renderAPI, uint32_t framePoolDepth = DefaultFramePoolDepth);
+        ~WebViewCapture() override;
 
         Result Initialize();
         void Shutdown();
-        void UpdateTexture(void* unityTexturePtr);
-        Result Resize(uint32_t width, uint32_t height);
+        /// @param mirrors Textures each presented frame is also copied into
+        /// @return true if the view should be visited again on the next render event
+        bool UpdateTexture(void* unityTexturePtr, FlipMode flipMode, FrameDrainMode drainMode, PresentMode presentMode,
+            MirrorRegistry& mirrors);
+
+        /// @brief Copy the newest frame taken since the last call (late-latch render event)
+        void LatchTexture(void* unityTexturePtr, FlipMode flipMode, MirrorRegistry& mirrors);
+
+        /// @brief Take frames as they arrive and leave the copy to LatchTexture
+        ///        instead of UpdateTexture (main thread)
+        void SetLateLatch(bool enabled);
+
+        // Zero-copy frames handed to Unity (PresentMode::ZeroCopy). Both
+        // threads call these with the view's texture lock held.
+        /// @brief Newest handed-off frame, which Unity samples from now on
+        HandoffTexture AcquirePresentedFrame();
+        /// @brief Leave zero-copy: the frame Unity keeps sampling until the
+        ///        render thread has copied it into the view's texture
+        /// @return Texture of nullptr once Unity can sample the copy again
+        HandoffTexture EndPresentingFrames();
+        /// @brief Follow a new live size within a capacity (main thread, texture lock held)
+        /// @note The frame pool and session are only recreated if the capacity changed
+        Result Resize(uint32_t width, uint32_t height, uint32_t capacityWidth, uint32_t capacityHeight);
+
+        /// @brief Recreate the frame pool with a new buffer count (main thread)
+        Result SetFramePoolDepth(uint32_t depth);
+        uint32_t GetFramePoolDepth() const { return m_poolDepth.load(std::memory_order_relaxed); }
+
+        CaptureFrameStats GetFrameStats() const { return m_frameCounters.Snapshot(); }
+
+        /// @brief Resize-to-first-frame tracking (texture lock held)
+        const ResizeTransactionStats& GetResizeTransactionStats() const { return m_resizeTransaction.GetStats(); }
+
+        /// @brief Queue the view for the next render event (any thread)
+        void RequestUpdate();
 
     private:
         void InitializeVisualTree();
         void InitializeGraphicsCapture();
+        void ConfigureDirtyRegions();
+        void RecreateCaptureSession(uint32_t width, uint32_t height);
+        void AdaptFramePoolDepth(uint32_t framesTaken);
+        void CopyToMirrors(const CapturedFrame& captured, MirrorRegistry& mirrors, FlipMode flipMode);
+        void PresentFrame(winrt::Windows::Graphics::Capture::Direct3D11CaptureFrame const& frame, void* unityTexturePtr,
+            FlipMode flipMode, PresentMode presentMode, MirrorRegistry& mirrors, const std::vector<PixelRect>* dirtyRects);
+        void LatchArrivedFrames();
+        void* WrapFramePool(winrt::Windows::Graphics::Capture::Direct3D11CaptureFramePool const& framePool);
+        void CloseFramePool();
+
+        // IFrameReleaser: closes a frame handed to Unity
+        void ReleaseFrame(void* frame, void* texture) override;
+
+        // ISurfaceTextureResolver: D3D11 texture behind a capture surface
+        void* ResolveTexture(void* surface) override;
+        void ReleaseEntry(void* surface, void* texture) override;
+
+        // ILatestFrameReleaser: closes a late-latched frame
+        void ReleaseLatestFrame(void* frame) override;
 
         WebView* m_webView; // Weak ref
         IRenderAPI* m_renderAPI; // Weak ref
@@ -50,6 +114,67 @@ namespace WebViewToolkit
 
         // Helpers
         void* m_d3dDevice = nullptr; // WinRT IDirect3DDevice
+
+        // The host window and frame pool have the capacity size; frames are
+        // cropped to the live size at their top-left when copied
+        uint32_t m_contentWidth = 0;
+        uint32_t m_contentHeight = 0;
+        uint32_t m_capacityWidth = 0;
+        uint32_t m_capacityHeight = 0;
+
+        // Frames of the window size from before a resize are stretched or held
+        // until one of the new size arrives. Both threads use it under the
+        // view's texture lock.
+        ResizeTransaction m_resizeTransaction;
+        bool m_resizeHoldLogged = false;    // Held frames are counted, only the first is logged
+
+        // Dirty regions (Windows 11 24H2+)
+        bool m_dirtyRegionsEnabled = false;
+        uint64_t m_frameSerial = 0;
+        std::vector<PixelRect> m_dirtyRects; // Reused across frames
+        std::vector<MirrorCopy> m_mirrorCopies;
+        std::vector<void*> m_mirrorTextures;
+
+        // Written on the render thread, read by GetFrameStats from any thread
+        CaptureFrameCounters m_frameCounters;
+
+        // Frame pool depth. The controller runs on the render thread; the pool
+        // is only recreated on the main thread, which reads m_poolDepth
+        bool m_adaptivePoolDepth;
+        FramePoolDepthController m_depthController;
+        std::atomic<uint32_t> m_poolDepth;
+
+        // Set by FrameArrived, cleared by the render thread. Without the event
+        // the render thread keeps visiting the view every event instead
+        PendingFlag m_updateRequested;
+        bool m_frameEventsEnabled = true;
+
+        // Frames held open for Unity in PresentMode::ZeroCopy. Leaving it, the
+        // acquired frame is first copied into the texture Unity returns to.
+        FrameHandoff m_handoff;
+        bool m_presentedFrameCopied = false;
+        bool m_zeroCopyUnsupportedLogged = false;  // Surfaces without shader binding are copied instead
+
+        // The frame pool cycles through the same few surfaces, so their
+        // textures are looked up once, not queried on every frame. Cleared
+        // with the pool. Render thread.
+        SurfaceTextureCache m_surfaceTextures;
+
+        // Frames in m_handoff, in slots reused instead of allocated per frame.
+        // A frame pool holds at most MaxFramePoolDepth frames, plus one left
+        // over from a pool being recreated; past that, slots are allocated.
+        struct FrameSlot
+        {
+            winrt::Windows::Graphics::Capture::Direct3D11CaptureFrame frame{ nullptr };
+            bool inUse = false;
+        };
+        FrameSlot* AcquireFrameSlot();
+        std::array<FrameSlot, MaxFramePoolDepth + 1> m_frameSlots;
+
+        // Late latch: FrameArrived (main thread) takes each frame from the
+        // pool into the mailbox and the late render event copies the newest
+        std::atomic<bool> m_lateLatching{ false };
+        LatestFrameMailbox m_latestFrames;
     };
 
 } // namespace WebViewToolkit
@@ -9,15 +9,22 @@
 
 #include "Types.h"
 #include "RenderAPI.h"
+#include "Core/FrameResourceCounters.h"
+#include "Core/FrameVersionTable.h"
+#include "Core/MirrorRegistry.h"
+#include "Core/PendingHandleQueue.h"
 #include <memory>
 #include <unordered_map>
 #include <mutex>
 #include <atomic>
+#include <functional>
 #include <string>
+#include <vector>
 
 namespace WebViewToolkit
 {
     class WebView; // Forward declaration
+    class CaptureAtlas;
     
     // ========================================================================
     // WebView Manager
@@ -48,6 +55,29 @@ namespace WebViewToolkit
         Result DestroyWebView(WebViewHandle handle);
         WebView* GetWebView(WebViewHandle handle);
         Result ResizeWebView(WebViewHandle handle, uint32_t width, uint32_t height);
+        Result SetFlipMode(WebViewHandle handle, FlipMode mode);
+        Result SetFrameDrainMode(WebViewHandle handle, FrameDrainMode mode);
+        Result SetPresentMode(WebViewHandle handle, PresentMode mode);
+        Result SetLateLatch(WebViewHandle handle, bool enabled);
+        Result GetCaptureStats(WebViewHandle handle, CaptureFrameStats& outStats);
+        Result AttachMirror(WebViewHandle handle, uint32_t width, uint32_t height, MirrorId& outId);
+        Result DetachMirror(WebViewHandle handle, MirrorId id);
+        Result GetMirrorTexture(WebViewHandle handle, MirrorId id, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight);
+        Result GetMirrorUVRect(WebViewHandle handle, MirrorId id, float outUVRect[4]);
+        Result SetRenderScale(WebViewHandle handle, float scale);
+        Result EnableAutoRenderScale(WebViewHandle handle, float frameBudgetMs, float minScale);
+        Result ReportRenderScaleSample(WebViewHandle handle, float frameTimeMs, float coverage);
+        Result SetResizeInterval(WebViewHandle handle, uint32_t intervalMs);
+        Result GetResizeStats(WebViewHandle handle, ResizeStats& outStats);
+
+        /// @brief Apply the coalesced resizes whose interval has passed (main thread, once per frame)
+        void ApplyPendingResizes();
+        Result GetTextureSize(WebViewHandle handle, uint32_t& outWidth, uint32_t& outHeight);
+        Result GetTexture(WebViewHandle handle, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight);
+        Result GetTextureUVRect(WebViewHandle handle, float outUVRect[4]);
+
+        /// @brief The atlas shared by views created with useCaptureAtlas, once one exists
+        CaptureAtlas* GetCaptureAtlas() const { return m_captureAtlas.get(); }
 
         // ====================================================================
         // Navigation
@@ -73,8 +103,25 @@ namespace WebViewToolkit
         // ====================================================================
         
         void UpdateTexture(WebViewHandle handle);
+
+        /// @brief Update the views queued by QueueTextureUpdate (render thread)
         void UpdateAllTextures();
 
+        /// @brief Copy the newest frame of each late-latched view (render thread)
+        void LatchAllTextures();
+
+        /// @brief Have the next UpdateAllTextures visit a view (any thread, lock-free)
+        void QueueTextureUpdate(WebViewHandle handle);
+
+        /// @brief Frame versions of the views, published by the render thread
+        /// @note Read from any thread without the manager lock
+        FrameVersionTable& GetFrameVersions() { return m_frameVersions; }
+
+        /// @brief Heap allocations, QueryInterface calls and graphics objects
+        ///        created per UpdateAllTextures (counted in debug builds only)
+        /// @note Read from any thread without the manager lock
+        FrameResourceStats GetFrameResourceStats() const { return m_frameResources.GetStats(); }
+
         void OnDeviceLost();
         void OnDeviceRestored();
 
@@ -90,6 +137,10 @@ namespace WebViewToolkit
         static bool IsShuttingDown();
         static void SignalShuttingDown();
 
+        /// @brief Run a task on the thread that initialized the manager (Unity's main thread)
+        /// @note Safe to call from any thread; the task is skipped once shutdown has started
+        static bool PostToMainThread(std::function<void()> task);
+
         // Internal access
         void Log(int32_t level, const char* message);
         void LogW(int32_t level, const wchar_t* message);
@@ -117,9 +168,19 @@ namespace WebViewToolkit
         
         // New: Map of Handles to WebView objects
         std::unordered_map<WebViewHandle, std::unique_ptr<WebView>> m_instances;
+
+        // Created with the first atlas view, outlives every view in it
+        std::unique_ptr<CaptureAtlas> m_captureAtlas;
         
         WebViewHandle m_nextHandle = 1;
 
+        // Views with new frames, so idle views cost nothing per render event
+        PendingHandleQueue m_pendingUpdates;
+        std::vector<WebView*> m_revisits;  // Render thread only
+
+        FrameVersionTable m_frameVersions;
+        FrameResourceMonitor m_frameResources;
+
         // Callbacks
         LogCallback m_logCallback = nullptr;
         NavigationCallback m_navigationCallback = nullptr;
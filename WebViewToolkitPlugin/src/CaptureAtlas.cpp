@@ -0,0 +1,727 @@
+// ============================================================================
+// WebViewToolkit - Capture Atlas Implementation
+// ============================================================================
+
+#include "WebViewToolkit/CaptureAtlas.h"
+#include "WebViewToolkit/WebViewManager.h"
+#include "Core/FramePoolDepthController.h"
+#include "Core/FrameResourceCounters.h"
+
+// Windows headers
+#include <Windows.h>
+#include <wrl.h>
+#include <WebView2.h>
+
+#include "RenderAPI/DebugLog.h"
+
+// WinRT headers
+#include <winrt/base.h>
+#include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Foundation.Numerics.h>
+#include <winrt/Windows.UI.Composition.h>
+#include <winrt/Windows.UI.Composition.Desktop.h>
+#include <winrt/Windows.Graphics.Capture.h>
+#include <winrt/Windows.Graphics.DirectX.Direct3D11.h>
+#include <windows.ui.composition.interop.h>
+#include <windows.graphics.capture.interop.h>
+#include <Windows.Graphics.DirectX.Direct3D11.interop.h>
+
+#include <d3d11.h>
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    namespace winrt_impl
+    {
+        using namespace winrt;
+        using namespace winrt::Windows::UI::Composition;
+        using namespace winrt::Windows::UI::Composition::Desktop;
+        using namespace winrt::Windows::Graphics;
+        using namespace winrt::Windows::Graphics::Capture;
+        using namespace winrt::Windows::Graphics::DirectX;
+        using namespace winrt::Windows::Graphics::DirectX::Direct3D11;
+    }
+
+    namespace
+    {
+        struct AtlasCompositor { winrt_impl::Compositor Value{ nullptr }; };
+        struct AtlasWindowTarget { winrt_impl::DesktopWindowTarget Value{ nullptr }; };
+        struct AtlasVisual { winrt_impl::ContainerVisual Value{ nullptr }; };
+        struct AtlasCaptureItem { winrt_impl::GraphicsCaptureItem Value{ nullptr }; };
+        struct AtlasFramePool
+        {
+            winrt_impl::Direct3D11CaptureFramePool Value{ nullptr };
+            winrt::event_token FrameArrivedToken{};
+        };
+        struct AtlasSession { winrt_impl::GraphicsCaptureSession Value{ nullptr }; };
+
+        const wchar_t* g_atlasWindowClassName = L"WebViewToolkitAtlasWindow";
+
+        LRESULT CALLBACK AtlasWindowProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
+        {
+            return DefWindowProcW(hwnd, msg, wParam, lParam);
+        }
+
+        void PlaceVisual(void* visual, const AtlasRect& rect)
+        {
+            auto container = static_cast<AtlasVisual*>(visual)->Value;
+            container.Offset({ static_cast<float>(rect.x), static_cast<float>(rect.y), 0.0f });
+            container.Size({ static_cast<float>(rect.width), static_cast<float>(rect.height) });
+        }
+    }
+
+    CaptureAtlas::CaptureAtlas(IRenderAPI* renderAPI)
+        : m_renderAPI(renderAPI)
+        , m_packer(InitialSize, InitialSize)
+        , m_surfaceTextures(this)
+    {
+    }
+
+    CaptureAtlas::~CaptureAtlas()
+    {
+        Shutdown();
+    }
+
+    // ========================================================================
+    // Setup
+    // ========================================================================
+
+    Result CaptureAtlas::Initialize()
+    {
+        DebugLog::Log("CaptureAtlas::Initialize: %ux%u", m_packer.GetWidth(), m_packer.GetHeight());
+
+        m_hostWindow = CreateHostWindow(m_packer.GetWidth(), m_packer.GetHeight());
+        if (!m_hostWindow)
+        {
+            return Result::ErrorUnknown;
+        }
+
+        Result result = m_renderAPI->CreateSharedTexture(m_packer.GetWidth(), m_packer.GetHeight(), &m_texturePtr);
+        if (result != Result::Success)
+        {
+            return result;
+        }
+        m_textureWidth = m_packer.GetWidth();
+        m_textureHeight = m_atlasHeight = m_packer.GetHeight();
+        m_renderAPI->GetSharedTextureSize(m_texturePtr, m_textureWidth, m_textureHeight);
+
+        try
+        {
+            InitializeVisualTree();
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("CaptureAtlas::Initialize: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+            return Result::ErrorCompositionFailed;
+        }
+
+        CreateCaptureSession(m_packer.GetWidth(), m_packer.GetHeight());
+        return Result::Success;
+    }
+
+    void CaptureAtlas::Shutdown()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        try
+        {
+            CloseCaptureSession();
+
+            delete static_cast<AtlasCaptureItem*>(m_captureItem);
+            m_captureItem = nullptr;
+
+            if (m_d3dDevice)
+            {
+                static_cast<::IInspectable*>(m_d3dDevice)->Release();
+                m_d3dDevice = nullptr;
+            }
+
+            for (auto& pair : m_views)
+            {
+                delete static_cast<AtlasVisual*>(pair.second.visual);
+            }
+            m_views.clear();
+
+            delete static_cast<AtlasVisual*>(m_rootVisual);
+            m_rootVisual = nullptr;
+            delete static_cast<AtlasWindowTarget*>(m_windowTarget);
+            m_windowTarget = nullptr;
+            delete static_cast<AtlasCompositor*>(m_compositor);
+            m_compositor = nullptr;
+        }
+        catch (...)
+        {
+            DebugLog::Log("CaptureAtlas::Shutdown: ERROR - Exception while releasing capture objects");
+        }
+
+        for (void** texture : { &m_texturePtr, &m_pendingTexture, &m_retiredTexture })
+        {
+            if (*texture && m_renderAPI)
+            {
+                m_renderAPI->DestroySharedTexture(*texture);
+            }
+            *texture = nullptr;
+        }
+
+        if (m_hostWindow)
+        {
+            HWND hwnd = static_cast<HWND>(m_hostWindow);
+            if (IsWindow(hwnd) && !WebViewManager::IsShuttingDown())
+            {
+                DestroyWindow(hwnd);
+            }
+            m_hostWindow = nullptr;
+        }
+    }
+
+    void* CaptureAtlas::CreateHostWindow(uint32_t width, uint32_t height)
+    {
+        WNDCLASSEXW wc = {};
+        wc.cbSize = sizeof(wc);
+        wc.lpfnWndProc = AtlasWindowProc;
+        wc.hInstance = GetModuleHandleW(nullptr);
+        wc.lpszClassName = g_atlasWindowClassName;
+        if (!RegisterClassExW(&wc) && GetLastError() != ERROR_CLASS_ALREADY_EXISTS)
+        {
+            return nullptr;
+        }
+
+        // Off screen and transparent like a single view's host window
+        HWND hwnd = CreateWindowExW(
+            WS_EX_TOOLWINDOW | WS_EX_NOACTIVATE | WS_EX_LAYERED | WS_EX_TRANSPARENT,
+            g_atlasWindowClassName,
+            L"WebViewToolkitAtlas",
+            WS_POPUP,
+            GetSystemMetrics(SM_CXSCREEN) + 100, 0,
+            static_cast<int>(width),
+            static_cast<int>(height),
+            nullptr, nullptr,
+            GetModuleHandleW(nullptr),
+            nullptr
+        );
+
+        if (hwnd)
+        {
+            SetLayeredWindowAttributes(hwnd, 0, 1, LWA_ALPHA);
+            ShowWindow(hwnd, SW_SHOWNOACTIVATE);
+        }
+        return hwnd;
+    }
+
+    void CaptureAtlas::InitializeVisualTree()
+    {
+        auto compositor = winrt_impl::Compositor();
+        m_compositor = new AtlasCompositor{ compositor };
+
+        auto abiCompositor = compositor.as<ABI::Windows::UI::Composition::ICompositor>();
+        winrt::com_ptr<ABI::Windows::UI::Composition::Desktop::ICompositorDesktopInterop> compositorInterop;
+        winrt::check_hresult(abiCompositor->QueryInterface(IID_PPV_ARGS(compositorInterop.put())));
+
+        winrt::com_ptr<IUnknown> windowTargetUnk;
+        winrt::check_hresult(compositorInterop->CreateDesktopWindowTarget(
+            static_cast<HWND>(m_hostWindow),
+            FALSE,
+            reinterpret_cast<ABI::Windows::UI::Composition::Desktop::IDesktopWindowTarget**>(windowTargetUnk.put())
+        ));
+        auto windowTarget = windowTargetUnk.as<winrt_impl::DesktopWindowTarget>();
+        m_windowTarget = new AtlasWindowTarget{ windowTarget };
+
+        // Views are children of the root, each at its place in the atlas
+        auto root = compositor.CreateContainerVisual();
+        root.Size({ static_cast<float>(m_packer.GetWidth()), static_cast<float>(m_packer.GetHeight()) });
+        windowTarget.Root(root);
+        m_rootVisual = new AtlasVisual{ root };
+    }
+
+    void CaptureAtlas::CreateCaptureSession(uint32_t width, uint32_t height)
+    {
+        CloseCaptureSession();
+
+        try
+        {
+            if (!m_d3dDevice)
+            {
+                auto d3dDevice = static_cast<ID3D11Device*>(m_renderAPI->GetCaptureD3D11Device());
+                Microsoft::WRL::ComPtr<IDXGIDevice> dxgiDevice;
+                if (!d3dDevice || FAILED(d3dDevice->QueryInterface(IID_PPV_ARGS(&dxgiDevice))))
+                {
+                    DebugLog::Log("CaptureAtlas::CreateCaptureSession: ERROR - No capture D3D11 device");
+                    return;
+                }
+
+                winrt::com_ptr<::IInspectable> inspectable;
+                winrt::check_hresult(CreateDirect3D11DeviceFromDXGIDevice(dxgiDevice.Get(), inspectable.put()));
+                m_d3dDevice = inspectable.detach();
+            }
+
+            if (!m_captureItem)
+            {
+                auto interop = winrt::get_activation_factory<winrt_impl::GraphicsCaptureItem, IGraphicsCaptureItemInterop>();
+                winrt_impl::GraphicsCaptureItem captureItem{ nullptr };
+                winrt::check_hresult(interop->CreateForWindow(
+                    static_cast<HWND>(m_hostWindow),
+                    winrt::guid_of<winrt_impl::GraphicsCaptureItem>(),
+                    winrt::put_abi(captureItem)
+                ));
+                m_captureItem = new AtlasCaptureItem{ captureItem };
+            }
+
+            winrt_impl::IDirect3DDevice rtDevice{ nullptr };
+            winrt::copy_from_abi(rtDevice, m_d3dDevice);
+
+            auto framePool = winrt_impl::Direct3D11CaptureFramePool::Create(
+                rtDevice,
+                winrt_impl::DirectXPixelFormat::B8G8R8A8UIntNormalized,
+                static_cast<int32_t>(DefaultFramePoolDepth),
+                { static_cast<int32_t>(width), static_cast<int32_t>(height) }
+            );
+
+            auto pool = new AtlasFramePool{ framePool };
+            m_framePool = pool;
+            try
+            {
+                pool->FrameArrivedToken = framePool.FrameArrived(
+                    [this](winrt_impl::Direct3D11CaptureFramePool const&, winrt::Windows::Foundation::IInspectable const&)
+                    {
+                        RequestUpdate();
+                    });
+            }
+            catch (winrt::hresult_error const& ex)
+            {
+                DebugLog::Log("CaptureAtlas::CreateCaptureSession: FrameArrived unavailable (0x%08X), polling every render event", ex.code());
+                m_frameEventsEnabled = false;
+            }
+
+            auto session = framePool.CreateCaptureSession(static_cast<AtlasCaptureItem*>(m_captureItem)->Value);
+            m_session = new AtlasSession{ session };
+            session.StartCapture();
+            DebugLog::Log("CaptureAtlas::CreateCaptureSession: Capturing %ux%u", width, height);
+
+            // Visit once even if FrameArrived could not be subscribed
+            RequestUpdate();
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("CaptureAtlas::CreateCaptureSession: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+        }
+    }
+
+    void CaptureAtlas::CloseCaptureSession()
+    {
+        if (m_session)
+        {
+            auto session = static_cast<AtlasSession*>(m_session);
+            session->Value.Close();
+            delete session;
+            m_session = nullptr;
+        }
+
+        if (m_framePool)
+        {
+            auto pool = static_cast<AtlasFramePool*>(m_framePool);
+            if (pool->FrameArrivedToken)
+            {
+                pool->Value.FrameArrived(pool->FrameArrivedToken);
+            }
+            pool->Value.Close();
+            delete pool;
+            m_framePool = nullptr;
+        }
+
+        // The next pool brings its own surfaces
+        m_surfaceTextures.Clear();
+    }
+
+    void* CaptureAtlas::ResolveTexture(void* surface)
+    {
+        // The cache holds the surface, so its address is not reused while cached
+        winrt_impl::IDirect3DSurface captureSurface{ nullptr };
+        winrt::copy_from_abi(captureSurface, surface);
+
+        ID3D11Texture2D* texture = nullptr;
+        auto access = captureSurface.try_as<::Windows::Graphics::DirectX::Direct3D11::IDirect3DDxgiInterfaceAccess>();
+        WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE();
+        if (!access || FAILED(access->GetInterface(IID_PPV_ARGS(&texture))))
+        {
+            return nullptr;
+        }
+        WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE();
+
+        captureSurface.detach();
+        return texture;
+    }
+
+    void CaptureAtlas::ReleaseEntry(void* surface, void* texture)
+    {
+        static_cast<ID3D11Texture2D*>(texture)->Release();
+        static_cast<::IUnknown*>(surface)->Release();
+    }
+
+    // ========================================================================
+    // Views
+    // ========================================================================
+
+    Result CaptureAtlas::AddView(WebViewHandle handle, uint32_t width, uint32_t height)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hostWindow)
+        {
+            Result result = Initialize();
+            if (result != Result::Success)
+            {
+                return result;
+            }
+        }
+
+        Result result = Place(handle, width, height, false);
+        if (result == Result::Success)
+        {
+            m_views[handle] = ViewSlot{};
+            ApplyLayout();
+        }
+        return result;
+    }
+
+    Result CaptureAtlas::AttachView(WebViewHandle handle, void* compositionController)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_views.find(handle);
+        if (it == m_views.end() || !m_compositor || !compositionController)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        try
+        {
+            auto visual = static_cast<AtlasCompositor*>(m_compositor)->Value.CreateContainerVisual();
+            it->second.visual = new AtlasVisual{ visual };
+            it->second.compositionController = compositionController;
+            PlaceVisual(it->second.visual, it->second.rect);
+            static_cast<AtlasVisual*>(m_rootVisual)->Value.Children().InsertAtTop(visual);
+
+            // WebView2 renders into the visual, at the view's offset in the host window
+            auto controller = static_cast<ICoreWebView2CompositionController*>(compositionController);
+            winrt::check_hresult(controller->put_RootVisualTarget(static_cast<::IUnknown*>(winrt::get_abi(visual))));
+            return Result::Success;
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("CaptureAtlas::AttachView: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+            return Result::ErrorCompositionFailed;
+        }
+    }
+
+    Result CaptureAtlas::ResizeView(WebViewHandle handle, uint32_t width, uint32_t height)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_views.find(handle) == m_views.end())
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        Result result = Place(handle, width, height, true);
+        ApplyLayout();
+        return result;
+    }
+
+    void CaptureAtlas::RemoveView(WebViewHandle handle)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_views.find(handle);
+        if (it == m_views.end())
+        {
+            return;
+        }
+
+        try
+        {
+            if (it->second.visual)
+            {
+                auto controller = static_cast<ICoreWebView2CompositionController*>(it->second.compositionController);
+                controller->put_RootVisualTarget(nullptr);
+                static_cast<AtlasVisual*>(m_rootVisual)->Value.Children().Remove(static_cast<AtlasVisual*>(it->second.visual)->Value);
+            }
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("CaptureAtlas::RemoveView: ERROR - WinRT exception: 0x%08X", ex.code());
+        }
+
+        delete static_cast<AtlasVisual*>(it->second.visual);
+        m_views.erase(it);
+        m_packer.Remove(handle);
+    }
+
+    Result CaptureAtlas::Place(WebViewHandle handle, uint32_t width, uint32_t height, bool resize)
+    {
+        const uint32_t paddedWidth = width + Gutter;
+        const uint32_t paddedHeight = height + Gutter;
+        if (width == 0 || height == 0 || paddedWidth > MaxSize || paddedHeight > MaxSize)
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        const uint32_t oldWidth = m_packer.GetWidth();
+        const uint32_t oldHeight = m_packer.GetHeight();
+        bool placed = resize ? m_packer.Resize(handle, paddedWidth, paddedHeight) : m_packer.Add(handle, paddedWidth, paddedHeight);
+        while (!placed && (m_packer.GetWidth() < MaxSize || m_packer.GetHeight() < MaxSize))
+        {
+            // Double the shorter side, keeping the atlas close to square
+            uint32_t atlasWidth = m_packer.GetWidth();
+            uint32_t atlasHeight = m_packer.GetHeight();
+            if (atlasWidth <= atlasHeight && atlasWidth < MaxSize)
+            {
+                atlasWidth = std::min(atlasWidth * 2, MaxSize);
+            }
+            else
+            {
+                atlasHeight = std::min(atlasHeight * 2, MaxSize);
+            }
+
+            m_packer.Grow(atlasWidth, atlasHeight);
+            placed = resize ? m_packer.Resize(handle, paddedWidth, paddedHeight) : m_packer.Add(handle, paddedWidth, paddedHeight);
+        }
+
+        if (m_packer.GetWidth() != oldWidth || m_packer.GetHeight() != oldHeight)
+        {
+            ResizeAtlas(m_packer.GetWidth(), m_packer.GetHeight());
+        }
+
+        if (!placed)
+        {
+            DebugLog::Log("CaptureAtlas::Place: %ux%u does not fit in the %ux%u atlas", width, height,
+                m_packer.GetWidth(), m_packer.GetHeight());
+            return Result::ErrorTextureCreationFailed;
+        }
+        return Result::Success;
+    }
+
+    void CaptureAtlas::ApplyLayout()
+    {
+        // A resize may have moved its view; every other view stays put
+        for (auto& pair : m_views)
+        {
+            AtlasRect padded;
+            if (!m_packer.GetRect(pair.first, padded))
+            {
+                continue;
+            }
+
+            ViewSlot& slot = pair.second;
+            const AtlasRect rect{ padded.x, padded.y, padded.width - Gutter, padded.height - Gutter };
+            if (rect.x == slot.rect.x && rect.y == slot.rect.y && rect.width == slot.rect.width && rect.height == slot.rect.height)
+            {
+                continue;
+            }
+
+            slot.rect = rect;
+            if (slot.presentedRect.width == 0)
+            {
+                slot.presentedRect = rect;  // Nothing presented yet
+            }
+            if (slot.visual)
+            {
+                PlaceVisual(slot.visual, rect);
+            }
+            m_layoutChanged = true;
+        }
+    }
+
+    Result CaptureAtlas::ResizeAtlas(uint32_t width, uint32_t height)
+    {
+        DebugLog::Log("CaptureAtlas::ResizeAtlas: Growing to %ux%u", width, height);
+
+        // The capture follows the window's client area
+        SetWindowPos(static_cast<HWND>(m_hostWindow), nullptr, 0, 0, static_cast<int>(width), static_cast<int>(height),
+            SWP_NOMOVE | SWP_NOZORDER | SWP_NOACTIVATE);
+        if (m_rootVisual)
+        {
+            static_cast<AtlasVisual*>(m_rootVisual)->Value.Size({ static_cast<float>(width), static_cast<float>(height) });
+        }
+
+        void* newTexture = nullptr;
+        Result result = m_renderAPI->CreateSharedTexture(width, height, &newTexture);
+        if (result != Result::Success)
+        {
+            DebugLog::Log("CaptureAtlas::ResizeAtlas: ERROR - Texture creation failed");
+            return result;
+        }
+
+        // The render thread is out while the mutex is held
+        for (void** texture : { &m_pendingTexture, &m_retiredTexture })
+        {
+            if (*texture)
+            {
+                m_renderAPI->DestroySharedTexture(*texture);
+                *texture = nullptr;
+            }
+        }
+        m_pendingTexture = newTexture;
+        m_pendingWidth = width;
+        m_pendingHeight = m_pendingAtlasHeight = height;
+        m_renderAPI->GetSharedTextureSize(newTexture, m_pendingWidth, m_pendingHeight);
+
+        CreateCaptureSession(width, height);
+        return Result::Success;
+    }
+
+    // ========================================================================
+    // Texture
+    // ========================================================================
+
+    bool CaptureAtlas::UpdateTexture(FrameVersionTable& frameVersions)
+    {
+        m_updateRequested.Clear();
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        void* target = m_pendingTexture ? m_pendingTexture : m_texturePtr;
+        if (!m_framePool || !target)
+        {
+            return false;
+        }
+
+        try
+        {
+            auto framePool = static_cast<AtlasFramePool*>(m_framePool)->Value;
+            auto frame = DrainFrames(FrameDrainMode::Latest,
+                [&framePool]() { return framePool.TryGetNextFrame(); },
+                [](winrt_impl::Direct3D11CaptureFrame& staleFrame) { staleFrame.Close(); },
+                m_frameCounters);
+
+            if (!frame)
+            {
+                const bool inFlight = m_renderAPI->ResolvePendingCopies(target);
+                return inFlight || !m_frameEventsEnabled;
+            }
+
+            // D3D11 texture behind the surface; the cache holds the reference
+            auto surface = frame.Surface();
+            auto capturedTexture = surface ? static_cast<ID3D11Texture2D*>(m_surfaceTextures.Get(winrt::get_abi(surface))) : nullptr;
+            if (capturedTexture)
+            {
+                // One copy for every view in the atlas
+                CapturedFrame captured;
+                captured.texture = capturedTexture;
+                captured.serial = ++m_frameSerial;
+                m_renderAPI->CopyCapturedTextureToUnityTexture(captured, target, FlipMode::SinglePass);
+                m_frameCounters.RecordPresented();
+
+                const uint64_t now = GetTickCount64();
+                for (const auto& pair : m_views)
+                {
+                    frameVersions.Publish(pair.first, now);
+                }
+
+                if (m_pendingTexture)
+                {
+                    m_retiredTexture = m_texturePtr;
+                    m_texturePtr = m_pendingTexture;
+                    m_textureWidth = m_pendingWidth;
+                    m_textureHeight = m_pendingHeight;
+                    m_atlasHeight = m_pendingAtlasHeight;
+                    m_pendingTexture = nullptr;
+                }
+
+                if (m_layoutChanged)
+                {
+                    for (auto& pair : m_views)
+                    {
+                        pair.second.presentedRect = pair.second.rect;
+                    }
+                    m_layoutChanged = false;
+                }
+            }
+            frame.Close();
+            return true;
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("CaptureAtlas::UpdateTexture: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+        }
+        return false;
+    }
+
+    void* CaptureAtlas::GetTexturePtr() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_texturePtr;
+    }
+
+    void CaptureAtlas::GetTextureSize(uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        outWidth = m_textureWidth;
+        outHeight = m_textureHeight;
+    }
+
+    void CaptureAtlas::GetTexture(void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        outTexture = m_texturePtr;
+        outWidth = m_textureWidth;
+        outHeight = m_textureHeight;
+    }
+
+    bool CaptureAtlas::GetUVRect(WebViewHandle handle, float outUVRect[4]) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_views.find(handle);
+        if (it == m_views.end() || m_textureWidth == 0)
+        {
+            return false;
+        }
+
+        // Flipped in a single pass: the atlas is bottom-up in the texture
+        ComputeAtlasUVRect(it->second.presentedRect, m_atlasHeight, m_textureWidth, m_textureHeight, true, outUVRect);
+        return true;
+    }
+
+    // ========================================================================
+    // Device Events
+    // ========================================================================
+
+    void CaptureAtlas::OnDeviceLost()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        try
+        {
+            CloseCaptureSession();
+        }
+        catch (...)
+        {
+        }
+
+        if (m_d3dDevice)
+        {
+            static_cast<::IInspectable*>(m_d3dDevice)->Release();
+            m_d3dDevice = nullptr;
+        }
+
+        // The device took the textures with it
+        m_texturePtr = nullptr;
+        m_pendingTexture = nullptr;
+        m_retiredTexture = nullptr;
+    }
+
+    void CaptureAtlas::OnDeviceRestored()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_hostWindow || !m_renderAPI || !m_renderAPI->IsInitialized())
+        {
+            return;
+        }
+
+        const uint32_t width = m_packer.GetWidth();
+        const uint32_t height = m_packer.GetHeight();
+        if (m_renderAPI->CreateSharedTexture(width, height, &m_texturePtr) != Result::Success)
+        {
+            return;
+        }
+        m_textureWidth = width;
+        m_textureHeight = m_atlasHeight = height;
+        m_renderAPI->GetSharedTextureSize(m_texturePtr, m_textureWidth, m_textureHeight);
+
+        CreateCaptureSession(width, height);
+    }
+
+} // namespace WebViewToolkit
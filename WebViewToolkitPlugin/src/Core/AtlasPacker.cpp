@@ -0,0 +1,435 @@
+// ============================================================================
+// WebViewToolkit - Atlas Packer Implementation
+// ============================================================================
+// Invariant: every texel of the atlas is in exactly one of a placement, a
+// free rectangle, or the free area past the skyline.
+// ============================================================================
+
+#include "Core/AtlasPacker.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace WebViewToolkit
+{
+    static bool Overlaps(const AtlasRect& a, const AtlasRect& b)
+    {
+        return a.x < b.Right() && b.x < a.Right() && a.y < b.Bottom() && b.y < a.Bottom();
+    }
+
+    void ComputeAtlasUVRect(const AtlasRect& rect, uint32_t atlasHeight, uint32_t textureWidth, uint32_t textureHeight,
+        bool flipY, float outUVRect[4])
+    {
+        const float width = static_cast<float>(std::max<uint32_t>(textureWidth, 1));
+        const float height = static_cast<float>(std::max<uint32_t>(textureHeight, 1));
+
+        // The flip mirrors the atlas rows only, not the unused rows below them
+        outUVRect[0] = static_cast<float>(rect.x) / width;
+        outUVRect[1] = static_cast<float>(flipY ? atlasHeight - rect.Bottom() : rect.y) / height;
+        outUVRect[2] = static_cast<float>(rect.width) / width;
+        outUVRect[3] = static_cast<float>(rect.height) / height;
+    }
+
+    AtlasPacker::AtlasPacker(uint32_t width, uint32_t height)
+        : m_width(width)
+        , m_height(height)
+    {
+        if (m_width > 0)
+        {
+            m_skyline.push_back({ 0, 0, m_width });
+        }
+    }
+
+    // ========================================================================
+    // Placement
+    // ========================================================================
+
+    bool AtlasPacker::Add(uint32_t id, uint32_t width, uint32_t height)
+    {
+        AtlasRect rect;
+        if (width == 0 || height == 0 || FindPlacement(id) || !FindPosition(width, height, rect))
+        {
+            m_stats.failed++;
+            return false;
+        }
+
+        Occupy(rect);
+        m_placements.push_back({ id, rect });
+        m_stats.added++;
+        return true;
+    }
+
+    bool AtlasPacker::Remove(uint32_t id)
+    {
+        Placement* placement = FindPlacement(id);
+        if (!placement)
+        {
+            return false;
+        }
+
+        Release(placement->rect);
+        *placement = m_placements.back();
+        m_placements.pop_back();
+        m_stats.removed++;
+
+        if (m_placements.empty())
+        {
+            // Holes that never lined up with the skyline: start over whole
+            m_freeRects.clear();
+            m_skyline.assign(1, Segment{ 0, 0, m_width });
+        }
+        return true;
+    }
+
+    bool AtlasPacker::Resize(uint32_t id, uint32_t width, uint32_t height)
+    {
+        Placement* placement = FindPlacement(id);
+        if (!placement || width == 0 || height == 0)
+        {
+            return false;
+        }
+
+        const AtlasRect old = placement->rect;
+        if (old.width == width && old.height == height)
+        {
+            return true;
+        }
+
+        // Give the space back first so a grown view can extend into its own
+        placement->rect = AtlasRect{};
+        Release(old);
+
+        AtlasRect rect{ old.x, old.y, width, height };
+        if (IsFree(rect))
+        {
+            m_stats.resizedInPlace++;
+        }
+        else if (FindPosition(width, height, rect))
+        {
+            m_stats.relocated++;
+        }
+        else
+        {
+            m_stats.failed++;
+            rect = old;
+        }
+
+        Occupy(rect);
+        placement->rect = rect;
+        return rect.width == width && rect.height == height;
+    }
+
+    bool AtlasPacker::Grow(uint32_t width, uint32_t height)
+    {
+        if (width < m_width || height < m_height)
+        {
+            return false;
+        }
+
+        if (width > m_width)
+        {
+            m_skyline.push_back({ m_width, 0, width - m_width });
+            MergeSkyline();
+        }
+        m_width = width;
+        m_height = height;
+        return true;
+    }
+
+    bool AtlasPacker::GetRect(uint32_t id, AtlasRect& outRect) const
+    {
+        for (const auto& placement : m_placements)
+        {
+            if (placement.id == id)
+            {
+                outRect = placement.rect;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    uint64_t AtlasPacker::GetUsedArea() const
+    {
+        uint64_t area = 0;
+        for (const auto& placement : m_placements)
+        {
+            area += static_cast<uint64_t>(placement.rect.width) * placement.rect.height;
+        }
+        return area;
+    }
+
+    uint32_t AtlasPacker::GetSkylineHeight(uint32_t x) const
+    {
+        for (const auto& segment : m_skyline)
+        {
+            if (x < segment.x + segment.width)
+            {
+                return segment.y;
+            }
+        }
+        return 0;
+    }
+
+    AtlasPacker::Placement* AtlasPacker::FindPlacement(uint32_t id)
+    {
+        for (auto& placement : m_placements)
+        {
+            if (placement.id == id)
+            {
+                return &placement;
+            }
+        }
+        return nullptr;
+    }
+
+    bool AtlasPacker::FindPosition(uint32_t width, uint32_t height, AtlasRect& outRect) const
+    {
+        // Holes first, best short side fit: keeps the skyline low
+        const AtlasRect* bestHole = nullptr;
+        uint32_t bestShort = std::numeric_limits<uint32_t>::max();
+        uint32_t bestLong = std::numeric_limits<uint32_t>::max();
+        for (const auto& hole : m_freeRects)
+        {
+            if (hole.width < width || hole.height < height)
+            {
+                continue;
+            }
+
+            const uint32_t dx = hole.width - width;
+            const uint32_t dy = hole.height - height;
+            const uint32_t shortSide = std::min(dx, dy);
+            const uint32_t longSide = std::max(dx, dy);
+            if (shortSide < bestShort || (shortSide == bestShort && longSide < bestLong))
+            {
+                bestHole = &hole;
+                bestShort = shortSide;
+                bestLong = longSide;
+            }
+        }
+
+        if (bestHole)
+        {
+            outRect = { bestHole->x, bestHole->y, width, height };
+            return true;
+        }
+
+        // Skyline, bottom-left: the position whose bottom edge ends up highest
+        uint32_t bestBottom = std::numeric_limits<uint32_t>::max();
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            const uint32_t x = m_skyline[i].x;
+            if (x + width > m_width)
+            {
+                break;
+            }
+
+            uint32_t y = 0;
+            for (size_t j = i; j < m_skyline.size() && m_skyline[j].x < x + width; ++j)
+            {
+                y = std::max(y, m_skyline[j].y);
+            }
+
+            if (y + height <= m_height && y + height < bestBottom)
+            {
+                bestBottom = y + height;
+                outRect = { x, y, width, height };
+            }
+        }
+
+        return bestBottom != std::numeric_limits<uint32_t>::max();
+    }
+
+    bool AtlasPacker::IsFree(const AtlasRect& rect) const
+    {
+        if (rect.Right() > m_width || rect.Bottom() > m_height)
+        {
+            return false;
+        }
+
+        // Whatever no placement covers is free by the invariant
+        for (const auto& placement : m_placements)
+        {
+            if (Overlaps(rect, placement.rect))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // ========================================================================
+    // Free Space
+    // ========================================================================
+
+    void AtlasPacker::Occupy(const AtlasRect& rect)
+    {
+        // Cut the rectangle out of the holes it covers: up to four pieces each
+        for (size_t i = 0; i < m_freeRects.size();)
+        {
+            const AtlasRect hole = m_freeRects[i];
+            if (!Overlaps(hole, rect))
+            {
+                ++i;
+                continue;
+            }
+
+            m_freeRects[i] = m_freeRects.back();
+            m_freeRects.pop_back();
+
+            if (rect.x > hole.x)
+            {
+                m_freeRects.push_back({ hole.x, hole.y, rect.x - hole.x, hole.height });
+            }
+            if (hole.Right() > rect.Right())
+            {
+                m_freeRects.push_back({ rect.Right(), hole.y, hole.Right() - rect.Right(), hole.height });
+            }
+
+            const uint32_t left = std::max(hole.x, rect.x);
+            const uint32_t right = std::min(hole.Right(), rect.Right());
+            if (rect.y > hole.y)
+            {
+                m_freeRects.push_back({ left, hole.y, right - left, rect.y - hole.y });
+            }
+            if (hole.Bottom() > rect.Bottom())
+            {
+                m_freeRects.push_back({ left, rect.Bottom(), right - left, hole.Bottom() - rect.Bottom() });
+            }
+        }
+
+        // Raise the skyline; the gap a rectangle steps over becomes a hole
+        const size_t first = SplitSkylineAt(rect.x);
+        const size_t last = SplitSkylineAt(rect.Right());
+        for (size_t i = first; i < last; ++i)
+        {
+            Segment& segment = m_skyline[i];
+            if (segment.y < rect.y)
+            {
+                m_freeRects.push_back({ segment.x, segment.y, segment.width, rect.y - segment.y });
+            }
+            segment.y = std::max(segment.y, rect.Bottom());
+        }
+        MergeSkyline();
+    }
+
+    void AtlasPacker::Release(const AtlasRect& rect)
+    {
+        m_freeRects.push_back(rect);
+        MergeFreeRects();
+        LowerSkyline();
+    }
+
+    size_t AtlasPacker::SplitSkylineAt(uint32_t x)
+    {
+        for (size_t i = 0; i < m_skyline.size(); ++i)
+        {
+            Segment& segment = m_skyline[i];
+            if (segment.x == x)
+            {
+                return i;
+            }
+            if (x < segment.x + segment.width)
+            {
+                const Segment right{ x, segment.y, segment.x + segment.width - x };
+                segment.width = x - segment.x;
+                m_skyline.insert(m_skyline.begin() + static_cast<ptrdiff_t>(i) + 1, right);
+                return i + 1;
+            }
+        }
+        return m_skyline.size();
+    }
+
+    void AtlasPacker::MergeSkyline()
+    {
+        for (size_t i = 1; i < m_skyline.size();)
+        {
+            if (m_skyline[i - 1].y == m_skyline[i].y)
+            {
+                m_skyline[i - 1].width += m_skyline[i].width;
+                m_skyline.erase(m_skyline.begin() + static_cast<ptrdiff_t>(i));
+            }
+            else
+            {
+                ++i;
+            }
+        }
+    }
+
+    void AtlasPacker::MergeFreeRects()
+    {
+        // Join holes sharing a whole edge, so a freed view can be reused whole
+        bool merged = true;
+        while (merged)
+        {
+            merged = false;
+            for (size_t i = 0; i < m_freeRects.size() && !merged; ++i)
+            {
+                for (size_t j = i + 1; j < m_freeRects.size(); ++j)
+                {
+                    AtlasRect& a = m_freeRects[i];
+                    const AtlasRect& b = m_freeRects[j];
+                    if (a.x == b.x && a.width == b.width && (a.Bottom() == b.y || b.Bottom() == a.y))
+                    {
+                        a = { a.x, std::min(a.y, b.y), a.width, a.height + b.height };
+                    }
+                    else if (a.y == b.y && a.height == b.height && (a.Right() == b.x || b.Right() == a.x))
+                    {
+                        a = { std::min(a.x, b.x), a.y, a.width + b.width, a.height };
+                    }
+                    else
+                    {
+                        continue;
+                    }
+
+                    m_freeRects[j] = m_freeRects.back();
+                    m_freeRects.pop_back();
+                    merged = true;
+                    break;
+                }
+            }
+        }
+    }
+
+    void AtlasPacker::LowerSkyline()
+    {
+        // A hole whose bottom is the skyline over its whole width joins the
+        // free area past it
+        bool lowered = true;
+        while (lowered)
+        {
+            lowered = false;
+            for (size_t i = 0; i < m_freeRects.size(); ++i)
+            {
+                const AtlasRect hole = m_freeRects[i];
+                bool onSkyline = true;
+                for (const auto& segment : m_skyline)
+                {
+                    if (segment.x < hole.Right() && hole.x < segment.x + segment.width && segment.y != hole.Bottom())
+                    {
+                        onSkyline = false;
+                        break;
+                    }
+                }
+                if (!onSkyline)
+                {
+                    continue;
+                }
+
+                const size_t first = SplitSkylineAt(hole.x);
+                const size_t last = SplitSkylineAt(hole.Right());
+                for (size_t s = first; s < last; ++s)
+                {
+                    m_skyline[s].y = hole.y;
+                }
+                MergeSkyline();
+
+                m_freeRects[i] = m_freeRects.back();
+                m_freeRects.pop_back();
+                lowered = true;
+                break;
+            }
+        }
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,112 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Atlas Packer
+// ============================================================================
+// Places rectangles (views) in a shared atlas and keeps them there while
+// others come, go and change size, so a view only moves when it has to.
+//
+// New rectangles go on a bottom-left skyline. Space the skyline steps over
+// and space given back by removed or shrunk rectangles is kept as a list of
+// free rectangles (guillotine splits, merged back when they line up), which
+// is tried first; free space touching the skyline lowers it again. Nothing
+// is ever repacked as a whole.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    struct AtlasRect
+    {
+        uint32_t x = 0;
+        uint32_t y = 0;
+        uint32_t width = 0;
+        uint32_t height = 0;
+
+        uint32_t Right() const { return x + width; }
+        uint32_t Bottom() const { return y + height; }
+    };
+
+    /// @brief Sub-rectangle of a texture in normalized coordinates, as {x, y, width, height}
+    /// @param atlasHeight Height of the atlas, held in the top rows of the texture
+    /// @param textureWidth, textureHeight Allocated size, which may be larger than the atlas
+    /// @param flipY The texture holds the atlas bottom-up (FlipMode other than None)
+    void ComputeAtlasUVRect(const AtlasRect& rect, uint32_t atlasHeight, uint32_t textureWidth, uint32_t textureHeight,
+        bool flipY, float outUVRect[4]);
+
+    struct AtlasPackerStats
+    {
+        uint64_t added = 0;
+        uint64_t removed = 0;
+        uint64_t resizedInPlace = 0;    // Kept their position
+        uint64_t relocated = 0;         // Resizes that had to move
+        uint64_t failed = 0;            // Adds and resizes that did not fit
+    };
+
+    class AtlasPacker
+    {
+    public:
+        AtlasPacker(uint32_t width, uint32_t height);
+
+        /// @return false if the id is taken, a size is zero or the rectangle does not fit
+        bool Add(uint32_t id, uint32_t width, uint32_t height);
+
+        bool Remove(uint32_t id);
+
+        /// @brief Keeps the position when the new size fits there, otherwise moves
+        /// @return false if it fits nowhere; the old placement is kept
+        bool Resize(uint32_t id, uint32_t width, uint32_t height);
+
+        /// @brief Enlarge the atlas. Every placement stays where it is.
+        bool Grow(uint32_t width, uint32_t height);
+
+        bool GetRect(uint32_t id, AtlasRect& outRect) const;
+
+        uint32_t GetWidth() const { return m_width; }
+        uint32_t GetHeight() const { return m_height; }
+        size_t GetCount() const { return m_placements.size(); }
+        uint64_t GetUsedArea() const;
+        const AtlasPackerStats& GetStats() const { return m_stats; }
+
+        // Free space bookkeeping, exposed for tests
+        const std::vector<AtlasRect>& GetFreeRects() const { return m_freeRects; }
+        uint32_t GetSkylineHeight(uint32_t x) const;
+
+    private:
+        struct Segment
+        {
+            uint32_t x;
+            uint32_t y;         // Stacked height; from here to the atlas height is free
+            uint32_t width;
+        };
+
+        struct Placement
+        {
+            uint32_t id;
+            AtlasRect rect;
+        };
+
+        Placement* FindPlacement(uint32_t id);
+        bool FindPosition(uint32_t width, uint32_t height, AtlasRect& outRect) const;
+        bool IsFree(const AtlasRect& rect) const;
+
+        void Occupy(const AtlasRect& rect);
+        void Release(const AtlasRect& rect);
+
+        size_t SplitSkylineAt(uint32_t x);
+        void MergeSkyline();
+        void MergeFreeRects();
+        void LowerSkyline();
+
+        uint32_t m_width;
+        uint32_t m_height;
+        std::vector<Segment> m_skyline;     // Sorted by x, covers [0, m_width)
+        std::vector<AtlasRect> m_freeRects; // Holes within the stacked height, disjoint
+        std::vector<Placement> m_placements;
+        AtlasPackerStats m_stats;
+    };
+
+} // namespace WebViewToolkit
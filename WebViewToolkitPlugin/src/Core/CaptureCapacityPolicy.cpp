@@ -0,0 +1,81 @@
+// ============================================================================
+// WebViewToolkit - Capture Capacity Policy Implementation
+// ============================================================================
+
+#include "Core/CaptureCapacityPolicy.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    CaptureCapacityPolicy::CaptureCapacityPolicy(const CaptureCapacitySettings& settings)
+        : m_settings(settings)
+    {
+        m_settings.minCapacity = std::max<uint32_t>(m_settings.minCapacity, 1);
+        m_settings.maxCapacity = std::max(m_settings.maxCapacity, m_settings.minCapacity);
+        m_settings.stepsPerOctave = std::max<uint32_t>(m_settings.stepsPerOctave, 1);
+    }
+
+    uint32_t CaptureCapacityPolicy::RoundUp(uint32_t size) const
+    {
+        if (size <= m_settings.minCapacity)
+        {
+            return m_settings.minCapacity;
+        }
+        if (size >= m_settings.maxCapacity)
+        {
+            return size;
+        }
+
+        // Largest power of two not above size, split into equal steps
+        uint32_t octave = 1;
+        while (octave <= size / 2)
+        {
+            octave *= 2;
+        }
+        const uint32_t step = std::max<uint32_t>(octave / m_settings.stepsPerOctave, 1);
+        const uint64_t rounded = (static_cast<uint64_t>(size) + step - 1) / step * step;
+        return static_cast<uint32_t>(std::min<uint64_t>(rounded, m_settings.maxCapacity));
+    }
+
+    bool CaptureCapacityPolicy::Fits(uint32_t size, uint32_t capacity) const
+    {
+        if (size > capacity)
+        {
+            return false;
+        }
+
+        // Far below the capacity, unless it could not get any smaller
+        return RoundUp(size) >= capacity ||
+            static_cast<float>(size) >= static_cast<float>(capacity) * m_settings.shrinkRatio;
+    }
+
+    bool CaptureCapacityPolicy::Update(uint32_t width, uint32_t height)
+    {
+        if (m_capacityWidth != 0 && Fits(width, m_capacityWidth) && Fits(height, m_capacityHeight))
+        {
+            m_stats.absorbed++;
+            return false;
+        }
+
+        const bool grown = m_capacityWidth == 0 || width > m_capacityWidth || height > m_capacityHeight;
+        m_capacityWidth = RoundUp(width);
+        m_capacityHeight = RoundUp(height);
+        if (grown)
+        {
+            m_stats.grown++;
+        }
+        else
+        {
+            m_stats.shrunk++;
+        }
+        return true;
+    }
+
+    void CaptureCapacityPolicy::Reset()
+    {
+        m_capacityWidth = 0;
+        m_capacityHeight = 0;
+    }
+
+} // namespace WebViewToolkit
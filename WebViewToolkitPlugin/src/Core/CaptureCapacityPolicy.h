@@ -0,0 +1,73 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Capture Capacity Policy
+// ============================================================================
+// Recreating the capture frame pool and session costs a restart and a few
+// frames of stale output, so a 1 px resize should not trigger one. The host
+// window and frame pool are sized to a capacity instead: each dimension
+// rounded up to the next step of a geometric series (stepsPerOctave steps per
+// doubling, e.g. 256, 320, 384, 448, 512, 640, ...). The WebView2 bounds
+// follow the live size within it and copies crop frames to it.
+//
+// The capacity only changes when the live size outgrows it, or falls below
+// shrinkRatio of it in a dimension so a view shrunk for good gives the memory
+// back.
+//
+// Not thread-safe; the owning view serializes calls.
+// ============================================================================
+
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    struct CaptureCapacitySettings
+    {
+        uint32_t minCapacity = 256;
+        uint32_t maxCapacity = 16384;       // D3D11 texture limit; larger sizes get no headroom
+        uint32_t stepsPerOctave = 4;        // 1 = powers of two
+        float shrinkRatio = 0.5f;           // Shrink once a dimension is below capacity * this
+    };
+
+    struct CaptureCapacityStats
+    {
+        uint64_t grown = 0;         // Capacity changes because the size outgrew it
+        uint64_t shrunk = 0;        // Capacity changes because the size fell far below it
+        uint64_t absorbed = 0;      // Size changes that kept the capacity
+    };
+
+    // ========================================================================
+    // Capacity Policy
+    // ========================================================================
+    class CaptureCapacityPolicy
+    {
+    public:
+        explicit CaptureCapacityPolicy(const CaptureCapacitySettings& settings = CaptureCapacitySettings{});
+
+        /// @brief Capacity a dimension of this size is given
+        uint32_t RoundUp(uint32_t size) const;
+
+        /// @brief Track a new live size
+        /// @return true if the capacity changed (always for the first size):
+        ///         the host window and frame pool need recreating
+        bool Update(uint32_t width, uint32_t height);
+
+        /// @brief Forget the capacity, so the next Update picks one anew
+        void Reset();
+
+        uint32_t GetCapacityWidth() const { return m_capacityWidth; }
+        uint32_t GetCapacityHeight() const { return m_capacityHeight; }
+
+        const CaptureCapacitySettings& GetSettings() const { return m_settings; }
+        const CaptureCapacityStats& GetStats() const { return m_stats; }
+
+    private:
+        bool Fits(uint32_t size, uint32_t capacity) const;
+
+        CaptureCapacitySettings m_settings;
+        uint32_t m_capacityWidth = 0;
+        uint32_t m_capacityHeight = 0;
+        CaptureCapacityStats m_stats;
+    };
+
+} // namespace WebViewToolkit
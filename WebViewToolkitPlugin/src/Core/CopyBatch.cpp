@@ -0,0 +1,107 @@
+// ============================================================================
+// WebViewToolkit - Copy Batch Implementation
+// ============================================================================
+
+#include "Core/CopyBatch.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    void CopyBatch::End(ICopyBatchRecorder& recorder)
+    {
+        if (m_depth == 0)
+        {
+            return;
+        }
+
+        if (--m_depth == 0)
+        {
+            Execute(recorder);
+        }
+    }
+
+    void CopyBatch::Submit(const CopyBatchEntry& entry, ICopyBatchRecorder& recorder)
+    {
+        m_entries.push_back(entry);
+        AddResource(entry.source);
+        AddResource(entry.destination);
+
+        if (!IsOpen())
+        {
+            Execute(recorder);
+        }
+    }
+
+    void CopyBatch::RequestFlush(ICopyBatchRecorder& recorder)
+    {
+        m_flushRequested = true;
+        if (!IsOpen())
+        {
+            Execute(recorder);
+        }
+    }
+
+    void CopyBatch::Execute(ICopyBatchRecorder& recorder)
+    {
+        if (m_entries.empty())
+        {
+            if (m_flushRequested)
+            {
+                recorder.Flush();
+                m_stats.flushes++;
+                m_flushRequested = false;
+            }
+            return;
+        }
+
+        for (const auto& entry : m_entries)
+        {
+            recorder.PrepareCopy(entry);
+        }
+
+        const auto resourceCount = static_cast<uint32_t>(m_resources.size());
+        if (resourceCount > 0)
+        {
+            recorder.BeginAccess(m_resources.data(), resourceCount);
+        }
+        for (const auto& entry : m_entries)
+        {
+            recorder.RecordCopy(entry);
+        }
+        if (resourceCount > 0)
+        {
+            recorder.EndAccess(m_resources.data(), resourceCount);
+        }
+
+        recorder.Flush();
+
+        for (const auto& entry : m_entries)
+        {
+            recorder.FinishCopy(entry);
+        }
+
+        m_stats.batches++;
+        m_stats.copies += m_entries.size();
+        m_stats.flushes++;
+
+        m_entries.clear();
+        m_resources.clear();
+        m_flushRequested = false;
+    }
+
+    bool CopyBatch::Contains(const void* resource) const
+    {
+        return resource && std::find(m_resources.begin(), m_resources.end(), resource) != m_resources.end();
+    }
+
+    void CopyBatch::AddResource(void* resource)
+    {
+        // A handful of views per event: a linear scan beats hashing
+        if (resource && !Contains(resource))
+        {
+            m_resources.push_back(resource);
+        }
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,110 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Copy Batch
+// ============================================================================
+// Collects the copies of one render event so a backend that hands resources
+// between APIs (D3D11On12) acquires all of them in one call, records every
+// copy, releases them in one call and submits once, instead of doing all
+// four per view.
+//
+// Backends submit every copy through the batch. While it is open the copies
+// wait for the outermost End(); otherwise each executes on its own through
+// the same path.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Entries
+    // ========================================================================
+    struct CopyBatchEntry
+    {
+        void* source = nullptr;         // Resource read by the copy, nullptr for CPU uploads
+        void* destination = nullptr;    // Resource written by the copy
+        void* payload = nullptr;        // Backend state needed to record the copy
+        uint32_t kind = 0;              // Backend-defined
+    };
+
+    // ========================================================================
+    // Recorder Interface
+    // ========================================================================
+
+    /// Backend side of a batch, called in submission order
+    class ICopyBatchRecorder
+    {
+    public:
+        virtual ~ICopyBatchRecorder() = default;
+
+        /// @brief Queue work the copy depends on, e.g. a fence wait. Before the acquire.
+        virtual void PrepareCopy(const CopyBatchEntry& /*entry*/) {}
+
+        /// @brief Every resource of the batch, each listed once
+        virtual void BeginAccess(void* const* resources, uint32_t count) = 0;
+
+        virtual void RecordCopy(const CopyBatchEntry& entry) = 0;
+
+        virtual void EndAccess(void* const* resources, uint32_t count) = 0;
+
+        /// @brief Submit the recorded commands
+        virtual void Flush() = 0;
+
+        /// @brief Queue work that depends on the copy, e.g. a fence signal. After the flush.
+        virtual void FinishCopy(const CopyBatchEntry& /*entry*/) {}
+    };
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+    struct CopyBatchStats
+    {
+        uint64_t batches = 0;   // Executions that recorded copies
+        uint64_t copies = 0;    // Copies recorded
+        uint64_t flushes = 0;   // Flushes issued, at most one per execution
+    };
+
+    // ========================================================================
+    // Batch
+    // ========================================================================
+    class CopyBatch
+    {
+    public:
+        /// @brief Open a batch; nested calls join the outer one
+        void Begin() { m_depth++; }
+
+        /// @brief Close one level, executing the batch when the outermost closes
+        void End(ICopyBatchRecorder& recorder);
+
+        bool IsOpen() const { return m_depth > 0; }
+
+        /// @brief Add a copy, executed right away unless a batch is open
+        void Submit(const CopyBatchEntry& entry, ICopyBatchRecorder& recorder);
+
+        /// @brief Commands were recorded outside the batch: make sure it flushes,
+        ///        or flush right away if none is open
+        void RequestFlush(ICopyBatchRecorder& recorder);
+
+        /// @brief Execute the copies added so far; the batch stays open
+        void Execute(ICopyBatchRecorder& recorder);
+
+        /// @brief Whether a copy that has not executed yet reads or writes the resource
+        bool Contains(const void* resource) const;
+
+        size_t GetPendingCount() const { return m_entries.size(); }
+        const CopyBatchStats& GetStats() const { return m_stats; }
+
+    private:
+        void AddResource(void* resource);
+
+        std::vector<CopyBatchEntry> m_entries;
+        std::vector<void*> m_resources;     // Unique, in first-use order
+        uint32_t m_depth = 0;
+        bool m_flushRequested = false;
+        CopyBatchStats m_stats;
+    };
+
+} // namespace WebViewToolkit
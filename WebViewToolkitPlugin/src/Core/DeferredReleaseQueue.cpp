@@ -0,0 +1,103 @@
+// ============================================================================
+// WebViewToolkit - Deferred Release Queue Implementation
+// ============================================================================
+
+#include "Core/DeferredReleaseQueue.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    DeferredReleaseQueue::DeferredReleaseQueue(IGpuFence* fence, IDeferredReleaser* releaser)
+        : m_fence(fence)
+        , m_releaser(releaser)
+    {
+    }
+
+    void DeferredReleaseQueue::Retire(void* resource, uint32_t kind)
+    {
+        if (!resource)
+        {
+            return;
+        }
+
+        m_stats.retired++;
+        const uint64_t fenceValue = m_fence ? m_fence->Signal() : 0;
+        if (fenceValue == 0)
+        {
+            m_stats.released++;
+            if (m_releaser)
+            {
+                m_releaser->ReleaseNow(resource, kind);
+            }
+            return;
+        }
+
+        // Keep the queue ordered even if a caller's timeline went backwards
+        Entry entry;
+        entry.resource = resource;
+        entry.kind = kind;
+        entry.fenceValue = m_entries.empty() ? fenceValue : std::max(fenceValue, m_entries.back().fenceValue);
+        m_entries.push_back(entry);
+
+        m_stats.pending = static_cast<uint32_t>(m_entries.size());
+        m_stats.maxPending = std::max(m_stats.maxPending, m_stats.pending);
+    }
+
+    size_t DeferredReleaseQueue::Poll()
+    {
+        if (m_entries.empty())
+        {
+            return 0;
+        }
+
+        m_stats.polls++;
+        const uint64_t completed = m_fence ? m_fence->GetCompletedValue() : UINT64_MAX;
+
+        size_t count = 0;
+        while (count < m_entries.size() && m_entries[count].fenceValue <= completed)
+        {
+            count++;
+        }
+
+        ReleaseFront(count);
+        return count;
+    }
+
+    void DeferredReleaseQueue::WaitForAll()
+    {
+        // Fence values never decrease along the queue
+        if (!m_entries.empty() && m_fence)
+        {
+            m_fence->Wait(m_entries.back().fenceValue);
+        }
+    }
+
+    void DeferredReleaseQueue::ReleaseAll()
+    {
+        ReleaseFront(m_entries.size());
+    }
+
+    void DeferredReleaseQueue::ReleaseFront(size_t count)
+    {
+        if (count == 0)
+        {
+            return;
+        }
+
+        // Taken out first: releasing may retire further resources
+        std::vector<Entry> released(m_entries.begin(), m_entries.begin() + static_cast<ptrdiff_t>(count));
+        m_entries.erase(m_entries.begin(), m_entries.begin() + static_cast<ptrdiff_t>(count));
+        m_stats.pending = static_cast<uint32_t>(m_entries.size());
+
+        for (const Entry& entry : released)
+        {
+            m_stats.released++;
+            if (m_releaser)
+            {
+                m_releaser->ReleaseNow(entry.resource, entry.kind);
+            }
+        }
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,103 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Deferred Release Queue
+// ============================================================================
+// GPU resources may still be read or written by submitted work when their
+// owner lets go of them. Instead of waiting for the GPU, a retired resource is
+// tagged with a fence value signaled after all work submitted so far and
+// released once the GPU timeline has reached it. Poll() is cheap: one fence
+// read when anything is queued, nothing otherwise.
+//
+// The queue is platform-neutral: the fence and the actual release go through
+// IGpuFence and IDeferredReleaser, which the D3D12 backend implements and the
+// unit tests fake. The fence must signal on every Retire: a timeline that
+// skips idle signals would date the resource before work still using it.
+// It is not thread-safe; the backend serializes calls.
+// ============================================================================
+
+#include "Core/GpuFence.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Device Abstraction
+    // ========================================================================
+    class IDeferredReleaser
+    {
+    public:
+        virtual ~IDeferredReleaser() = default;
+
+        /// @brief Release a resource the GPU no longer uses
+        /// @param kind Backend-defined, as passed to Retire
+        virtual void ReleaseNow(void* resource, uint32_t kind) = 0;
+    };
+
+    // ========================================================================
+    // Statistics
+    // ========================================================================
+    struct DeferredReleaseStats
+    {
+        uint64_t retired = 0;
+        uint64_t released = 0;
+        uint64_t polls = 0;         // Polls that read the fence
+        uint32_t pending = 0;
+        uint32_t maxPending = 0;
+    };
+
+    // ========================================================================
+    // Queue
+    // ========================================================================
+    class DeferredReleaseQueue
+    {
+    public:
+        /// @param fence Timeline of the queue that uses the resources (weak ref)
+        /// @param releaser Releases resources once they retire (weak ref)
+        DeferredReleaseQueue(IGpuFence* fence, IDeferredReleaser* releaser);
+
+        // Non-copyable
+        DeferredReleaseQueue(const DeferredReleaseQueue&) = delete;
+        DeferredReleaseQueue& operator=(const DeferredReleaseQueue&) = delete;
+
+        /// @brief Release a resource once the work submitted so far has completed
+        /// @note Released right away if the fence cannot be signaled (no device)
+        void Retire(void* resource, uint32_t kind);
+
+        /// @brief Release every resource whose fence value has been reached
+        /// @return Number of resources released
+        size_t Poll();
+
+        /// @brief Block until the fence has passed every queued resource
+        /// @note Does not release them; follow with Poll() or ReleaseAll()
+        void WaitForAll();
+
+        /// @brief Release everything now
+        /// @note Only once the GPU is idle or gone, e.g. at device shutdown,
+        ///       or after WaitForAll()
+        void ReleaseAll();
+
+        size_t GetPendingCount() const { return m_entries.size(); }
+        const DeferredReleaseStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Entry
+        {
+            void* resource = nullptr;
+            uint32_t kind = 0;
+            uint64_t fenceValue = 0;
+        };
+
+        void ReleaseFront(size_t count);
+
+        IGpuFence* m_fence;             // Weak ref
+        IDeferredReleaser* m_releaser;  // Weak ref
+
+        std::vector<Entry> m_entries;   // Retirement order, so fence values never decrease
+        DeferredReleaseStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,278 @@
+// ============================================================================
+// WebViewToolkit - Dirty Region Coalescing Implementation
+// ============================================================================
+
+#include "Core/DirtyRegion.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace WebViewToolkit
+{
+    PixelRect RectUnion(const PixelRect& a, const PixelRect& b)
+    {
+        return PixelRect{
+            std::min(a.left, b.left),
+            std::min(a.top, b.top),
+            std::max(a.right, b.right),
+            std::max(a.bottom, b.bottom)
+        };
+    }
+
+    PixelRect RectIntersection(const PixelRect& a, const PixelRect& b)
+    {
+        PixelRect result{
+            std::max(a.left, b.left),
+            std::max(a.top, b.top),
+            std::min(a.right, b.right),
+            std::min(a.bottom, b.bottom)
+        };
+        return RectIsEmpty(result) ? PixelRect{ 0, 0, 0, 0 } : result;
+    }
+
+    // ========================================================================
+    // Coalescer
+    // ========================================================================
+
+    DirtyRegionCoalescer::DirtyRegionCoalescer(const DirtyRegionSettings& settings)
+        : m_settings(settings)
+    {
+        m_settings.maxBoxes = std::max<uint32_t>(m_settings.maxBoxes, 1);
+    }
+
+    void DirtyRegionCoalescer::SetFullFrame(uint32_t width, uint32_t height)
+    {
+        m_boxes.clear();
+        m_boxes.push_back(PixelRect{ 0, 0, static_cast<int32_t>(width), static_cast<int32_t>(height) });
+        m_fullFrame = true;
+        m_coveredArea = static_cast<int64_t>(width) * height;
+    }
+
+    const std::vector<PixelRect>& DirtyRegionCoalescer::Coalesce(const PixelRect* rects, size_t count, uint32_t width, uint32_t height)
+    {
+        m_boxes.clear();
+        m_fullFrame = false;
+        m_coveredArea = 0;
+
+        if (width == 0 || height == 0)
+        {
+            return m_boxes;
+        }
+
+        const PixelRect surface{ 0, 0, static_cast<int32_t>(width), static_cast<int32_t>(height) };
+        for (size_t i = 0; rects && i < count; i++)
+        {
+            PixelRect clipped = RectIntersection(rects[i], surface);
+            if (!RectIsEmpty(clipped))
+            {
+                m_boxes.push_back(clipped);
+            }
+        }
+
+        if (m_boxes.empty())
+        {
+            return m_boxes;
+        }
+
+        // Too fragmented to be worth pairwise merging
+        if (m_boxes.size() > m_settings.maxInputRects)
+        {
+            PixelRect bounds = m_boxes[0];
+            for (const PixelRect& box : m_boxes)
+            {
+                bounds = RectUnion(bounds, box);
+            }
+            m_boxes.assign(1, bounds);
+        }
+        else
+        {
+            MergeCheapestPairs();
+        }
+
+        for (const PixelRect& box : m_boxes)
+        {
+            m_coveredArea += RectArea(box);
+        }
+
+        const double surfaceArea = static_cast<double>(width) * height;
+        if (static_cast<double>(m_coveredArea) >= m_settings.fullFrameFraction * surfaceArea)
+        {
+            SetFullFrame(width, height);
+        }
+
+        return m_boxes;
+    }
+
+    namespace
+    {
+        // Clean pixels added by replacing a and b with their bounding box
+        int64_t MergeWaste(const PixelRect& a, const PixelRect& b)
+        {
+            return RectArea(RectUnion(a, b)) - RectArea(a) - RectArea(b) + RectArea(RectIntersection(a, b));
+        }
+    }
+
+    void DirtyRegionCoalescer::RefreshBestPartner(size_t index)
+    {
+        m_bestWaste[index] = std::numeric_limits<int64_t>::max();
+        for (size_t other = 0; other < m_boxes.size(); other++)
+        {
+            if (other != index)
+            {
+                const int64_t waste = MergeWaste(m_boxes[index], m_boxes[other]);
+                if (waste < m_bestWaste[index])
+                {
+                    m_bestWaste[index] = waste;
+                    m_bestPartner[index] = other;
+                }
+            }
+        }
+    }
+
+    void DirtyRegionCoalescer::MergeCheapestPairs()
+    {
+        // Greedy agglomeration: repeatedly merge the pair whose bounding box adds
+        // the fewest clean pixels. Always merge while over budget; under budget,
+        // only merge when nearly free (overlapping, touching or close neighbours).
+        // Each box caches its cheapest partner, so a merge only rescans the boxes
+        // it affected instead of every pair.
+        const size_t count = m_boxes.size();
+        m_bestPartner.assign(count, 0);
+        m_bestWaste.assign(count, 0);
+        for (size_t i = 0; i < count; i++)
+        {
+            RefreshBestPartner(i);
+        }
+
+        while (m_boxes.size() > 1)
+        {
+            size_t keep = 0;
+            for (size_t i = 1; i < m_boxes.size(); i++)
+            {
+                if (m_bestWaste[i] < m_bestWaste[keep])
+                {
+                    keep = i;
+                }
+            }
+
+            const bool overBudget = m_boxes.size() > m_settings.maxBoxes;
+            if (!overBudget && m_bestWaste[keep] > static_cast<int64_t>(m_settings.mergeSlackPixels))
+            {
+                break;
+            }
+
+            size_t drop = m_bestPartner[keep];
+            if (drop < keep)
+            {
+                std::swap(keep, drop);
+            }
+            m_boxes[keep] = RectUnion(m_boxes[keep], m_boxes[drop]);
+
+            // Remove `drop` by moving the last box into its slot
+            const size_t last = m_boxes.size() - 1;
+            m_boxes[drop] = m_boxes[last];
+            m_bestPartner[drop] = m_bestPartner[last];
+            m_bestWaste[drop] = m_bestWaste[last];
+            m_boxes.pop_back();
+            m_bestPartner.pop_back();
+            m_bestWaste.pop_back();
+
+            for (size_t i = 0; i < m_boxes.size(); i++)
+            {
+                if (m_bestPartner[i] == last)
+                {
+                    m_bestPartner[i] = drop;
+                }
+            }
+
+            RefreshBestPartner(keep);
+            for (size_t i = 0; i < m_boxes.size(); i++)
+            {
+                if (i == keep)
+                {
+                    continue;
+                }
+
+                // Partners of the merged pair must be rescanned; everyone else
+                // only needs to consider the grown box
+                if (m_bestPartner[i] == keep || m_bestPartner[i] == drop)
+                {
+                    RefreshBestPartner(i);
+                }
+                else
+                {
+                    const int64_t waste = MergeWaste(m_boxes[i], m_boxes[keep]);
+                    if (waste < m_bestWaste[i])
+                    {
+                        m_bestWaste[i] = waste;
+                        m_bestPartner[i] = keep;
+                    }
+                }
+            }
+        }
+    }
+
+    // ========================================================================
+    // History
+    // ========================================================================
+
+    const DirtyRegionHistory::Entry* DirtyRegionHistory::Find(uint64_t serial) const
+    {
+        const Entry& entry = m_entries[serial % MaxFrames];
+        return entry.serial == serial ? &entry : nullptr;
+    }
+
+    void DirtyRegionHistory::Record(uint64_t serial, const PixelRect* rects, size_t count)
+    {
+        if (serial == 0)
+        {
+            return;
+        }
+
+        Entry& entry = m_entries[serial % MaxFrames];
+        entry.serial = serial;
+        entry.known = rects != nullptr;
+        entry.rects.assign(rects, rects ? rects + count : rects);
+    }
+
+    bool DirtyRegionHistory::Collect(uint64_t presentedSerial, uint64_t serial, std::vector<PixelRect>& outRects) const
+    {
+        outRects.clear();
+
+        if (presentedSerial == 0 || serial <= presentedSerial || serial - presentedSerial > MaxFrames)
+        {
+            return false;
+        }
+
+        for (uint64_t s = presentedSerial + 1; s <= serial; s++)
+        {
+            const Entry* entry = Find(s);
+            if (!entry || !entry->known)
+            {
+                outRects.clear();
+                return false;
+            }
+            outRects.insert(outRects.end(), entry->rects.begin(), entry->rects.end());
+        }
+
+        return true;
+    }
+
+    void DirtyRegionHistory::DiscardThrough(uint64_t serial)
+    {
+        for (Entry& entry : m_entries)
+        {
+            if (entry.serial != 0 && entry.serial <= serial)
+            {
+                entry.serial = 0;
+                entry.rects.clear();
+            }
+        }
+    }
+
+    void DirtyRegionHistory::Clear()
+    {
+        DiscardThrough(std::numeric_limits<uint64_t>::max());
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,131 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Dirty Region Coalescing
+// ============================================================================
+// Windows 11 capture frames report which rectangles changed since the
+// previous frame. Copying each rectangle separately costs one API call per
+// rectangle, and caret blinks or animated text produce many tiny, scattered
+// ones. The coalescer merges them into at most N copy boxes, trading a few
+// redundant pixels for fewer calls, and gives up on partial copies once most
+// of the surface is dirty anyway.
+//
+// DirtyRegionHistory keeps the per-frame rectangles for paths that present
+// frames late or skip frames (the DX12 readback ring): the destination then
+// needs the union of every frame since the one it last received.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Rectangle Helpers
+    // ========================================================================
+    inline int64_t RectArea(const PixelRect& rect)
+    {
+        return rect.right > rect.left && rect.bottom > rect.top
+            ? static_cast<int64_t>(rect.right - rect.left) * (rect.bottom - rect.top)
+            : 0;
+    }
+
+    inline bool RectIsEmpty(const PixelRect& rect)
+    {
+        return rect.right <= rect.left || rect.bottom <= rect.top;
+    }
+
+    /// @brief Smallest rectangle containing both
+    PixelRect RectUnion(const PixelRect& a, const PixelRect& b);
+
+    /// @brief Overlap of both (empty if disjoint)
+    PixelRect RectIntersection(const PixelRect& a, const PixelRect& b);
+
+    /// @brief Mirror a rectangle vertically within a surface of the given height
+    inline PixelRect RectFlipY(const PixelRect& rect, uint32_t height)
+    {
+        const int32_t h = static_cast<int32_t>(height);
+        return PixelRect{ rect.left, h - rect.bottom, rect.right, h - rect.top };
+    }
+
+    // ========================================================================
+    // Coalescer
+    // ========================================================================
+    struct DirtyRegionSettings
+    {
+        uint32_t maxBoxes = 4;              // Upper bound on copy boxes per frame
+        uint32_t mergeSlackPixels = 4096;   // Merge even under maxBoxes if it adds at most this many clean pixels
+        float fullFrameFraction = 0.6f;     // Covered fraction at which one full copy is cheaper
+        uint32_t maxInputRects = 32;        // Above this, collapse straight to the bounding box
+    };
+
+    class DirtyRegionCoalescer
+    {
+    public:
+        explicit DirtyRegionCoalescer(const DirtyRegionSettings& settings = DirtyRegionSettings{});
+
+        /// @brief Merge dirty rectangles into copy boxes for a width x height surface
+        /// @return Boxes covering every dirty pixel, clipped to the surface. Empty if
+        ///         nothing is dirty. Valid until the next call.
+        const std::vector<PixelRect>& Coalesce(const PixelRect* rects, size_t count, uint32_t width, uint32_t height);
+
+        /// @brief Whether the last result is a single box covering the whole surface
+        bool IsFullFrame() const { return m_fullFrame; }
+
+        /// @brief Pixels covered by the last result's boxes
+        int64_t GetCoveredArea() const { return m_coveredArea; }
+
+        const DirtyRegionSettings& GetSettings() const { return m_settings; }
+
+    private:
+        void MergeCheapestPairs();
+        void RefreshBestPartner(size_t index);
+        void SetFullFrame(uint32_t width, uint32_t height);
+
+        DirtyRegionSettings m_settings;
+        std::vector<PixelRect> m_boxes;
+        std::vector<size_t> m_bestPartner;      // Scratch for MergeCheapestPairs, reused across frames
+        std::vector<int64_t> m_bestWaste;
+        bool m_fullFrame = false;
+        int64_t m_coveredArea = 0;
+    };
+
+    // ========================================================================
+    // Per-Destination History
+    // ========================================================================
+    class DirtyRegionHistory
+    {
+    public:
+        static constexpr size_t MaxFrames = 8;
+
+        /// @brief Record the dirty rectangles of frame `serial`
+        /// @param rects Dirty rectangles, or nullptr if unknown (treated as fully dirty)
+        void Record(uint64_t serial, const PixelRect* rects, size_t count);
+
+        /// @brief Gather the dirty rectangles of frames (presentedSerial, serial]
+        /// @return false if the destination needs a full update: nothing presented yet,
+        ///         a frame in the range is unknown, or it has fallen out of the history
+        bool Collect(uint64_t presentedSerial, uint64_t serial, std::vector<PixelRect>& outRects) const;
+
+        /// @brief Forget frames up to and including serial
+        void DiscardThrough(uint64_t serial);
+
+        void Clear();
+
+    private:
+        struct Entry
+        {
+            uint64_t serial = 0;
+            bool known = false;
+            std::vector<PixelRect> rects;
+        };
+
+        const Entry* Find(uint64_t serial) const;
+
+        Entry m_entries[MaxFrames];    // Indexed by serial % MaxFrames, storage reused across frames
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,53 @@
+// ============================================================================
+// WebViewToolkit - Capture Frame Draining Implementation
+// ============================================================================
+
+#include "Core/FrameDrain.h"
+
+namespace WebViewToolkit
+{
+    // Relaxed is enough, readers only need each counter to be torn-free.
+    // Arrivals may come from two threads, hence the atomic adds.
+    void CaptureFrameCounters::RecordDrain(uint64_t arrived, uint64_t droppedStale)
+    {
+        m_arrived.fetch_add(arrived, std::memory_order_relaxed);
+        m_droppedStale.fetch_add(droppedStale, std::memory_order_relaxed);
+    }
+
+    void CaptureFrameCounters::RecordPresented()
+    {
+        m_presented.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void CaptureFrameCounters::RecordNoNewFrame()
+    {
+        m_noNewFrame.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void CaptureFrameCounters::RecordCopyAge(uint64_t ageUs)
+    {
+        // Copies are only recorded by the render thread
+        m_lastCopyAgeUs.store(ageUs, std::memory_order_relaxed);
+        if (ageUs > m_maxCopyAgeUs.load(std::memory_order_relaxed))
+        {
+            m_maxCopyAgeUs.store(ageUs, std::memory_order_relaxed);
+        }
+        m_totalCopyAgeUs.fetch_add(ageUs, std::memory_order_relaxed);
+        m_copyAgeSamples.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CaptureFrameStats CaptureFrameCounters::Snapshot() const
+    {
+        CaptureFrameStats stats;
+        stats.arrived = m_arrived.load(std::memory_order_relaxed);
+        stats.presented = m_presented.load(std::memory_order_relaxed);
+        stats.droppedStale = m_droppedStale.load(std::memory_order_relaxed);
+        stats.noNewFrame = m_noNewFrame.load(std::memory_order_relaxed);
+        stats.lastCopyAgeUs = m_lastCopyAgeUs.load(std::memory_order_relaxed);
+        stats.maxCopyAgeUs = m_maxCopyAgeUs.load(std::memory_order_relaxed);
+        stats.totalCopyAgeUs = m_totalCopyAgeUs.load(std::memory_order_relaxed);
+        stats.copyAgeSamples = m_copyAgeSamples.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace WebViewToolkit
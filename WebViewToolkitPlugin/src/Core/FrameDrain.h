@@ -0,0 +1,101 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Capture Frame Draining
+// ============================================================================
+// Pulls frames from a capture frame pool once per render event. In Latest
+// mode every queued frame but the newest is discarded, so the presented frame
+// is never older than the pool allows. CaptureFrameCounters keeps per-view
+// counts written by the render thread (arrivals also by the late-latch
+// producer) and read from any thread.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <atomic>
+#include <cstdint>
+#include <utility>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Frame Counters
+    // ========================================================================
+    class CaptureFrameCounters
+    {
+    public:
+        void RecordDrain(uint64_t arrived, uint64_t droppedStale);
+        void RecordPresented();
+        void RecordNoNewFrame();
+        /// @brief Time from a frame's capture to its copy into Unity's texture
+        void RecordCopyAge(uint64_t ageUs);
+
+        /// @brief Consistent enough for monitoring; fields are read independently
+        CaptureFrameStats Snapshot() const;
+
+    private:
+        std::atomic<uint64_t> m_arrived{ 0 };
+        std::atomic<uint64_t> m_presented{ 0 };
+        std::atomic<uint64_t> m_droppedStale{ 0 };
+        std::atomic<uint64_t> m_noNewFrame{ 0 };
+        std::atomic<uint64_t> m_lastCopyAgeUs{ 0 };
+        std::atomic<uint64_t> m_maxCopyAgeUs{ 0 };
+        std::atomic<uint64_t> m_totalCopyAgeUs{ 0 };
+        std::atomic<uint64_t> m_copyAgeSamples{ 0 };
+    };
+
+    // ========================================================================
+    // Drain
+    // ========================================================================
+
+    /// Upper bound on frames pulled per call, in case the producer refills
+    /// the pool as fast as frames are discarded
+    constexpr uint32_t MaxFramesPerDrain = 16;
+
+    /// @brief Take the frame to present from a frame pool
+    /// @param tryGetNext Returns the next queued frame, or a frame testing false if none
+    /// @param discard Called with each superseded frame; must release it back to the pool
+    /// @param outArrived [out, optional] Frames taken by this call, the returned one included
+    /// @return The frame to present, or a frame testing false if the pool was empty
+    template <typename TryGetNext, typename Discard>
+    auto DrainFrames(FrameDrainMode mode, TryGetNext&& tryGetNext, Discard&& discard, CaptureFrameCounters& counters,
+        uint32_t* outArrived = nullptr) -> decltype(tryGetNext())
+    {
+        if (outArrived)
+        {
+            *outArrived = 0;
+        }
+
+        auto newest = tryGetNext();
+        if (!newest)
+        {
+            counters.RecordNoNewFrame();
+            return newest;
+        }
+
+        uint64_t arrived = 1;
+        if (mode == FrameDrainMode::Latest)
+        {
+            while (arrived < MaxFramesPerDrain)
+            {
+                auto next = tryGetNext();
+                if (!next)
+                {
+                    break;
+                }
+
+                discard(newest);
+                newest = std::move(next);
+                arrived++;
+            }
+        }
+
+        counters.RecordDrain(arrived, arrived - 1);
+        if (outArrived)
+        {
+            *outArrived = static_cast<uint32_t>(arrived);
+        }
+        return newest;
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,132 @@
+// ============================================================================
+// WebViewToolkit - Frame Handoff Implementation
+// ============================================================================
+
+#include "Core/FrameHandoff.h"
+
+namespace WebViewToolkit
+{
+    FrameHandoff::FrameHandoff(IFrameReleaser* releaser, uint32_t releaseDelay)
+        : m_releaser(releaser)
+        , m_releaseDelay(releaseDelay)
+    {
+    }
+
+    FrameHandoff::~FrameHandoff()
+    {
+        ReleaseAll();
+    }
+
+    void FrameHandoff::Release(Held& held)
+    {
+        if (!held.frame)
+        {
+            return;
+        }
+
+        m_stats.released++;
+        if (m_releaser)
+        {
+            m_releaser->ReleaseFrame(held.frame, held.texture.texture);
+        }
+        held = Held{};
+    }
+
+    void FrameHandoff::Retire(Held& held)
+    {
+        if (!held.frame)
+        {
+            return;
+        }
+
+        if (m_releaseDelay == 0)
+        {
+            Release(held);
+            return;
+        }
+
+        Retired retired;
+        retired.held = held;
+        retired.eventsLeft = m_releaseDelay;
+        m_retired.push_back(retired);
+        held = Held{};
+    }
+
+    uint64_t FrameHandoff::Publish(void* frame, void* texture, uint32_t width, uint32_t height)
+    {
+        // Never handed out, so nothing can be sampling it
+        if (m_published.frame)
+        {
+            m_stats.superseded++;
+            Release(m_published);
+        }
+
+        m_published.frame = frame;
+        m_published.texture.texture = texture;
+        m_published.texture.width = width;
+        m_published.texture.height = height;
+        m_published.texture.version = ++m_version;
+        m_stats.published++;
+        return m_version;
+    }
+
+    void FrameHandoff::Collect()
+    {
+        size_t kept = 0;
+        for (size_t i = 0; i < m_retired.size(); i++)
+        {
+            if (--m_retired[i].eventsLeft == 0)
+            {
+                Release(m_retired[i].held);
+            }
+            else
+            {
+                m_retired[kept++] = m_retired[i];
+            }
+        }
+        m_retired.resize(kept);
+    }
+
+    HandoffTexture FrameHandoff::Acquire()
+    {
+        if (m_published.frame)
+        {
+            Retire(m_acquired);
+            m_acquired = m_published;
+            m_published = Held{};
+            m_stats.acquired++;
+        }
+        return m_acquired.texture;
+    }
+
+    void FrameHandoff::RetireAll()
+    {
+        if (m_published.frame)
+        {
+            m_stats.superseded++;
+            Release(m_published);
+        }
+        Retire(m_acquired);
+    }
+
+    void FrameHandoff::ReleaseAll()
+    {
+        if (m_published.frame)
+        {
+            m_stats.superseded++;
+            Release(m_published);
+        }
+        Release(m_acquired);
+        for (Retired& retired : m_retired)
+        {
+            Release(retired.held);
+        }
+        m_retired.clear();
+    }
+
+    uint32_t FrameHandoff::GetHeldCount() const
+    {
+        return (m_acquired.frame ? 1u : 0u) + (m_published.frame ? 1u : 0u) + static_cast<uint32_t>(m_retired.size());
+    }
+
+} // namespace WebViewToolkit
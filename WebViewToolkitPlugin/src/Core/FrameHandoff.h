@@ -0,0 +1,132 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Frame Handoff
+// ============================================================================
+// Hands captured frames to Unity without copying them: Unity samples the
+// frame's own texture, so the frame is held open until Unity has moved on to
+// a newer one.
+//
+// The producer (render thread) publishes each new frame under the next
+// version. The consumer (main thread) acquires the newest version, which
+// also retires the frame it held before. A retired frame may still be
+// sampled by render commands Unity queued earlier, so the producer releases
+// it only after releaseDelay more render events (Collect calls). A published
+// frame superseded before the consumer acquired it was never handed out and
+// is released at once. With one acquire per frame and a delay of one event,
+// three frames are held: the acquired one, the newest published one and one
+// retired, so the capture frame pool needs three buffers to keep flowing.
+//
+// Frames are opaque; IFrameReleaser gives them back to the capture. Not
+// thread-safe: both sides hold the owning view's texture lock.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    class IFrameReleaser
+    {
+    public:
+        virtual ~IFrameReleaser() = default;
+
+        /// @brief Return a frame and its texture reference to the capture
+        virtual void ReleaseFrame(void* frame, void* texture) = 0;
+    };
+
+    /// Texture of a handed-off frame. Versions start at 1; 0 means no frame.
+    struct HandoffTexture
+    {
+        void* texture = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t version = 0;
+    };
+
+    struct FrameHandoffStats
+    {
+        uint64_t published = 0;
+        uint64_t acquired = 0;      // Versions the consumer moved to
+        uint64_t superseded = 0;    // Published frames released without being acquired
+        uint64_t released = 0;      // All frames released, superseded ones included
+    };
+
+    // ========================================================================
+    // Handoff
+    // ========================================================================
+    class FrameHandoff
+    {
+    public:
+        static constexpr uint32_t DefaultReleaseDelay = 1;
+
+        /// @param releaser Releases frames (weak ref)
+        /// @param releaseDelay Render events a retired frame is kept for
+        explicit FrameHandoff(IFrameReleaser* releaser, uint32_t releaseDelay = DefaultReleaseDelay);
+        ~FrameHandoff();
+
+        // Non-copyable
+        FrameHandoff(const FrameHandoff&) = delete;
+        FrameHandoff& operator=(const FrameHandoff&) = delete;
+
+        // ====================================================================
+        // Producer
+        // ====================================================================
+
+        /// @brief Hand a frame over; it is held until the consumer moves past it
+        /// @return The frame's version
+        uint64_t Publish(void* frame, void* texture, uint32_t width, uint32_t height);
+
+        /// @brief Count one render event, releasing retired frames whose delay ran out
+        void Collect();
+
+        // ====================================================================
+        // Consumer
+        // ====================================================================
+
+        /// @brief Move to the newest published frame, retiring the one held before
+        /// @return The frame to sample; texture is nullptr before the first publish
+        HandoffTexture Acquire();
+
+        /// @brief The acquired frame, without moving to a newer one
+        const HandoffTexture& GetAcquired() const { return m_acquired.texture; }
+
+        /// @brief Retire every held frame, e.g. when the consumer stops sampling them
+        void RetireAll();
+
+        /// @brief Release every frame now
+        /// @note Only once nothing can sample them any more
+        void ReleaseAll();
+
+        uint32_t GetHeldCount() const;
+        bool HasRetired() const { return !m_retired.empty(); }
+        const FrameHandoffStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Held
+        {
+            void* frame = nullptr;
+            HandoffTexture texture;
+        };
+
+        struct Retired
+        {
+            Held held;
+            uint32_t eventsLeft = 0;
+        };
+
+        void Release(Held& held);
+        void Retire(Held& held);
+
+        IFrameReleaser* m_releaser;     // Weak ref
+        uint32_t m_releaseDelay;
+        uint64_t m_version = 0;
+
+        Held m_acquired;                // Sampled by the consumer
+        Held m_published;               // Newest, not yet acquired
+        std::vector<Retired> m_retired;
+        FrameHandoffStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,94 @@
+// ============================================================================
+// WebViewToolkit - Adaptive Capture Frame Pool Depth Implementation
+// ============================================================================
+
+#include "Core/FramePoolDepthController.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    FramePoolDepthController::FramePoolDepthController(uint32_t initialDepth, const FramePoolDepthSettings& settings)
+        : m_settings(settings)
+    {
+        m_settings.minDepth = std::max<uint32_t>(m_settings.minDepth, 1);
+        m_settings.maxDepth = std::max(m_settings.maxDepth, m_settings.minDepth);
+        m_settings.windowEvents = std::max<uint32_t>(m_settings.windowEvents, 1);
+        m_settings.calmWindowsToLower = std::max<uint32_t>(m_settings.calmWindowsToLower, 1);
+
+        m_depth = std::clamp(initialDepth, m_settings.minDepth, m_settings.maxDepth);
+        m_calmWindowsToLower = m_settings.calmWindowsToLower;
+    }
+
+    void FramePoolDepthController::RestartWindow()
+    {
+        m_events = 0;
+        m_fullEvents = 0;
+        m_discarded = 0;
+    }
+
+    bool FramePoolDepthController::OnRenderEvent(uint32_t framesTaken, uint32_t framesDiscarded)
+    {
+        m_events++;
+        m_discarded += std::min(framesDiscarded, framesTaken);
+
+        // Taking as many frames as there are buffers means none was free
+        if (framesTaken >= m_depth)
+        {
+            m_fullEvents++;
+        }
+
+        if (m_events < m_settings.windowEvents)
+        {
+            return false;
+        }
+
+        const bool changed = EvaluateWindow();
+        RestartWindow();
+        return changed;
+    }
+
+    bool FramePoolDepthController::EvaluateWindow()
+    {
+        m_stats.windows++;
+
+        const float dropRate = static_cast<float>(m_fullEvents) / static_cast<float>(m_events);
+        const float staleRate = static_cast<float>(m_discarded) / static_cast<float>(m_events);
+
+        // Sustained overproduction: deeper buffers would only hold discarded frames
+        if (staleRate >= m_settings.lowerStaleRate && m_depth > m_settings.minDepth)
+        {
+            m_depth--;
+            m_calmWindows = 0;
+            m_stats.lowered++;
+            return true;
+        }
+
+        const bool hitches = dropRate >= m_settings.raiseDropRate && dropRate < m_settings.sustainedDropRate;
+        if (hitches && m_depth < m_settings.maxDepth)
+        {
+            m_depth++;
+            m_calmWindows = 0;
+            m_calmWindowsToLower = std::min(m_calmWindowsToLower * 2, std::max(m_settings.maxCalmWindows, m_settings.calmWindowsToLower));
+            m_stats.raised++;
+            return true;
+        }
+
+        if (m_fullEvents != 0)
+        {
+            m_calmWindows = 0;
+            return false;
+        }
+
+        if (++m_calmWindows >= m_calmWindowsToLower && m_depth > m_settings.minDepth)
+        {
+            m_depth--;
+            m_calmWindows = 0;
+            m_stats.lowered++;
+            return true;
+        }
+
+        return false;
+    }
+
+} // namespace WebViewToolkit
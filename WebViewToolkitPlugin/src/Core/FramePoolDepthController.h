@@ -0,0 +1,95 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Adaptive Capture Frame Pool Depth
+// ============================================================================
+// Picks the number of capture frame pool buffers from what the render thread
+// observes in each drain:
+//
+//   - drops: the drain found every buffer queued, so the capture had nowhere
+//     to write and frames were lost upstream. Occasional drops are render
+//     hitches and a deeper pool rides them out. Drops on nearly every event
+//     only mean capture runs at least as fast as rendering, which more
+//     buffers cannot fix.
+//   - stale: frames taken but discarded for a newer one. When most events
+//     discard frames the capture simply outpaces rendering; extra buffers
+//     only hold frames that will be thrown away, so the pool shrinks.
+//
+// Decisions are made once per window of render events. With no drops for a
+// while the pool shrinks one step, and every raise doubles how long that takes
+// so a borderline load does not oscillate. Needs FrameDrainMode::Latest: a
+// Single drain takes one frame and cannot see a full pool deeper than one.
+// ============================================================================
+
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Depth Limits
+    // ========================================================================
+    constexpr uint32_t AdaptiveFramePoolDepth = 0;  // Creation value selecting the controller
+    constexpr uint32_t MinFramePoolDepth = 1;
+    constexpr uint32_t MaxFramePoolDepth = 3;
+    constexpr uint32_t DefaultFramePoolDepth = 2;
+
+    struct FramePoolDepthSettings
+    {
+        uint32_t minDepth = MinFramePoolDepth;
+        uint32_t maxDepth = MaxFramePoolDepth;
+        uint32_t windowEvents = 120;        // Render events per decision (~2 s at 60 Hz)
+        float raiseDropRate = 0.05f;        // Fraction of events finding the pool full
+        float sustainedDropRate = 0.9f;     // At or above this, drops are steady load, not hitches
+        float lowerStaleRate = 0.5f;        // Stale frames per render event
+        uint32_t calmWindowsToLower = 4;    // Drop-free windows before shrinking, doubled per raise
+        uint32_t maxCalmWindows = 64;
+    };
+
+    struct FramePoolDepthStats
+    {
+        uint64_t raised = 0;
+        uint64_t lowered = 0;
+        uint64_t windows = 0;
+    };
+
+    // ========================================================================
+    // Depth Controller
+    // ========================================================================
+    class FramePoolDepthController
+    {
+    public:
+        /// @param initialDepth Starting depth, clamped to the settings' range
+        explicit FramePoolDepthController(uint32_t initialDepth = DefaultFramePoolDepth,
+            const FramePoolDepthSettings& settings = FramePoolDepthSettings{});
+
+        /// @brief Record one render event
+        /// @param framesTaken Frames drained from the pool, 0 if it was empty
+        /// @param framesDiscarded Of those, frames dropped for a newer one
+        /// @return true if the depth changed and the pool should be recreated
+        bool OnRenderEvent(uint32_t framesTaken, uint32_t framesDiscarded);
+
+        /// @brief Start a new window, e.g. after the pool was recreated for a resize
+        void RestartWindow();
+
+        uint32_t GetDepth() const { return m_depth; }
+        const FramePoolDepthSettings& GetSettings() const { return m_settings; }
+        const FramePoolDepthStats& GetStats() const { return m_stats; }
+
+    private:
+        bool EvaluateWindow();
+
+        FramePoolDepthSettings m_settings;
+        uint32_t m_depth;
+
+        // Current window
+        uint32_t m_events = 0;
+        uint32_t m_fullEvents = 0;
+        uint64_t m_discarded = 0;
+
+        uint32_t m_calmWindows = 0;
+        uint32_t m_calmWindowsToLower;
+
+        FramePoolDepthStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,75 @@
+// ============================================================================
+// WebViewToolkit - Frame Resource Counters Implementation
+// ============================================================================
+
+#include "Core/FrameResourceCounters.h"
+
+namespace WebViewToolkit
+{
+    namespace
+    {
+        // Constant-initialized, so touching it from operator new cannot recurse
+        thread_local FrameResourceCounts t_counts;
+    }
+
+    void FrameResourceCounters::CountAllocation()
+    {
+        t_counts.allocations++;
+    }
+
+    void FrameResourceCounters::CountQueryInterface()
+    {
+        t_counts.queryInterfaces++;
+    }
+
+    void FrameResourceCounters::CountObjectCreation()
+    {
+        t_counts.objectCreations++;
+    }
+
+    FrameResourceCounts FrameResourceCounters::GetThreadCounts()
+    {
+        return t_counts;
+    }
+
+    void FrameResourceMonitor::BeginFrame()
+    {
+        m_frameStart = FrameResourceCounters::GetThreadCounts();
+    }
+
+    void FrameResourceMonitor::EndFrame()
+    {
+        const FrameResourceCounts now = FrameResourceCounters::GetThreadCounts();
+        const uint64_t allocations = now.allocations - m_frameStart.allocations;
+        const uint64_t queryInterfaces = now.queryInterfaces - m_frameStart.queryInterfaces;
+        const uint64_t objectCreations = now.objectCreations - m_frameStart.objectCreations;
+
+        // Single writer: relaxed is enough, readers only need each field to be torn-free
+        m_frames.fetch_add(1, std::memory_order_relaxed);
+        if (allocations || queryInterfaces || objectCreations)
+        {
+            m_framesOverBudget.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_lastAllocations.store(allocations, std::memory_order_relaxed);
+        m_lastQueryInterfaces.store(queryInterfaces, std::memory_order_relaxed);
+        m_lastObjectCreations.store(objectCreations, std::memory_order_relaxed);
+        m_totalAllocations.fetch_add(allocations, std::memory_order_relaxed);
+        m_totalQueryInterfaces.fetch_add(queryInterfaces, std::memory_order_relaxed);
+        m_totalObjectCreations.fetch_add(objectCreations, std::memory_order_relaxed);
+    }
+
+    FrameResourceStats FrameResourceMonitor::GetStats() const
+    {
+        FrameResourceStats stats;
+        stats.frames = m_frames.load(std::memory_order_relaxed);
+        stats.framesOverBudget = m_framesOverBudget.load(std::memory_order_relaxed);
+        stats.lastAllocations = m_lastAllocations.load(std::memory_order_relaxed);
+        stats.lastQueryInterfaces = m_lastQueryInterfaces.load(std::memory_order_relaxed);
+        stats.lastObjectCreations = m_lastObjectCreations.load(std::memory_order_relaxed);
+        stats.totalAllocations = m_totalAllocations.load(std::memory_order_relaxed);
+        stats.totalQueryInterfaces = m_totalQueryInterfaces.load(std::memory_order_relaxed);
+        stats.totalObjectCreations = m_totalObjectCreations.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace WebViewToolkit
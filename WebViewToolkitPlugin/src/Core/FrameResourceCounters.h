@@ -0,0 +1,82 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Frame Resource Counters
+// ============================================================================
+// Instrumentation for the per-frame budget: once no view is created or
+// resized, a render event should do no heap allocation, no QueryInterface
+// and create no COM or GPU object.
+//
+// Counts are kept per thread, so a frame measured on the render thread is
+// not polluted by the main thread. The backends count QueryInterface calls
+// and object creations with the WEBVIEW_TOOLKIT_COUNT_* macros, which only
+// do something in debug builds (WEBVIEW_TOOLKIT_DEBUG); allocations are
+// counted by a replaced global operator new in the same builds.
+// FrameResourceMonitor turns the counts into per-frame statistics.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <atomic>
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Counters
+    // ========================================================================
+    struct FrameResourceCounts
+    {
+        uint64_t allocations = 0;
+        uint64_t queryInterfaces = 0;
+        uint64_t objectCreations = 0;
+    };
+
+    namespace FrameResourceCounters
+    {
+        // Calling thread only; never allocate
+        void CountAllocation();
+        void CountQueryInterface();
+        void CountObjectCreation();
+
+        /// @brief Counts of the calling thread since it started
+        FrameResourceCounts GetThreadCounts();
+    }
+
+    // ========================================================================
+    // Monitor
+    // ========================================================================
+
+    /// Per-frame statistics of one thread. BeginFrame and EndFrame run on the
+    /// measured thread; GetStats may be called from any thread.
+    class FrameResourceMonitor
+    {
+    public:
+        void BeginFrame();
+        void EndFrame();
+
+        /// @brief Consistent enough for monitoring; fields are read independently
+        FrameResourceStats GetStats() const;
+
+    private:
+        FrameResourceCounts m_frameStart;
+
+        std::atomic<uint64_t> m_frames{ 0 };
+        std::atomic<uint64_t> m_framesOverBudget{ 0 };
+        std::atomic<uint64_t> m_lastAllocations{ 0 };
+        std::atomic<uint64_t> m_lastQueryInterfaces{ 0 };
+        std::atomic<uint64_t> m_lastObjectCreations{ 0 };
+        std::atomic<uint64_t> m_totalAllocations{ 0 };
+        std::atomic<uint64_t> m_totalQueryInterfaces{ 0 };
+        std::atomic<uint64_t> m_totalObjectCreations{ 0 };
+    };
+
+} // namespace WebViewToolkit
+
+#ifdef WEBVIEW_TOOLKIT_DEBUG
+#define WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE() ::WebViewToolkit::FrameResourceCounters::CountQueryInterface()
+#define WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION() ::WebViewToolkit::FrameResourceCounters::CountObjectCreation()
+#else
+#define WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE() ((void)0)
+#define WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION() ((void)0)
+#endif
@@ -0,0 +1,126 @@
+// ============================================================================
+// WebViewToolkit - Frame Timeline Implementation
+// ============================================================================
+
+#include "Core/FrameTimeline.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    FrameTimeline::FrameTimeline(IGpuFence* fence)
+        : m_fence(fence)
+    {
+    }
+
+    void FrameTimeline::MarkWritten(void* resource)
+    {
+        m_recorded = true;
+        if (!resource)
+        {
+            return;
+        }
+
+        uint64_t& value = m_lastWritten[resource];
+        if (value != Unsignaled)
+        {
+            value = Unsignaled;
+            m_unsignaled.push_back(resource);
+        }
+    }
+
+    uint64_t FrameTimeline::Signal()
+    {
+        if (!m_recorded)
+        {
+            m_stats.signalsSkipped++;
+            return m_lastSignaled;
+        }
+
+        // Without a timeline value the writes count as complete with the last one
+        const uint64_t value = m_fence ? m_fence->Signal() : 0;
+        if (value != 0)
+        {
+            m_stats.signals++;
+            m_lastSignaled = std::max(m_lastSignaled, value);
+        }
+        for (void* resource : m_unsignaled)
+        {
+            m_lastWritten[resource] = m_lastSignaled;
+        }
+
+        m_unsignaled.clear();
+        m_recorded = false;
+        return m_lastSignaled;
+    }
+
+    uint64_t FrameTimeline::GetCompletedValue()
+    {
+        if (!m_fence)
+        {
+            return UINT64_MAX;
+        }
+
+        m_stats.fenceReads++;
+        m_completed = std::max(m_completed, m_fence->GetCompletedValue());
+        return m_completed;
+    }
+
+    bool FrameTimeline::IsComplete(uint64_t value)
+    {
+        return value <= m_completed || value <= GetCompletedValue();
+    }
+
+    void FrameTimeline::Wait(uint64_t value)
+    {
+        if (IsComplete(value))
+        {
+            m_stats.waitsSkipped++;
+            return;
+        }
+
+        m_stats.waits++;
+        m_fence->Wait(value);
+        m_completed = std::max(m_completed, value);
+    }
+
+    uint64_t FrameTimeline::GetLastWritten(void* resource)
+    {
+        auto it = m_lastWritten.find(resource);
+        if (it == m_lastWritten.end())
+        {
+            return 0;
+        }
+        if (it->second == Unsignaled)
+        {
+            Signal();
+        }
+        return it->second;
+    }
+
+    void FrameTimeline::WaitForWrites(void* resource)
+    {
+        Wait(GetLastWritten(resource));
+    }
+
+    void FrameTimeline::WaitForIdle()
+    {
+        Wait(Signal());
+    }
+
+    void FrameTimeline::Forget(void* resource)
+    {
+        auto it = m_lastWritten.find(resource);
+        if (it == m_lastWritten.end())
+        {
+            return;
+        }
+
+        if (it->second == Unsignaled)
+        {
+            m_unsignaled.erase(std::find(m_unsignaled.begin(), m_unsignaled.end(), resource));
+        }
+        m_lastWritten.erase(it);
+    }
+
+} // namespace WebViewToolkit
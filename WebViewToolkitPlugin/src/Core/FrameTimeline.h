@@ -0,0 +1,95 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Frame Timeline
+// ============================================================================
+// Tracks, per destination resource, the fence value after which the copies
+// written into it so far have completed, so the CPU only blocks for a
+// resource whose writes are still in flight rather than draining the GPU.
+//
+// Work is marked as it is recorded. Signal() submits it behind one fence
+// value; with nothing recorded since the last signal it returns that value
+// again without submitting, so per-event and per-release signals cost
+// nothing when idle. The last completed value is cached and the fence only
+// read for values above it.
+//
+// The timeline is itself an IGpuFence over the backend's fence, so a
+// DeferredReleaseQueue can share it. Not thread-safe; the backend
+// serializes calls.
+// ============================================================================
+
+#include "Core/GpuFence.h"
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    struct FrameTimelineStats
+    {
+        uint64_t signals = 0;           // Signals submitted to the fence
+        uint64_t signalsSkipped = 0;    // Signals with nothing recorded since the last
+        uint64_t fenceReads = 0;        // Completion checks the cached value could not answer
+        uint64_t waits = 0;             // CPU waits that blocked on the fence
+        uint64_t waitsSkipped = 0;      // CPU waits for values already reached
+    };
+
+    // ========================================================================
+    // Timeline
+    // ========================================================================
+    class FrameTimeline final : public IGpuFence
+    {
+    public:
+        /// @param fence The backend's fence (weak ref); nullptr tracks nothing
+        explicit FrameTimeline(IGpuFence* fence);
+
+        // Non-copyable
+        FrameTimeline(const FrameTimeline&) = delete;
+        FrameTimeline& operator=(const FrameTimeline&) = delete;
+
+        /// @brief Note recorded, not yet signaled work that writes a resource
+        void MarkWritten(void* resource);
+
+        /// @brief Signal the work recorded since the last signal, if any
+        /// @return Value covering all recorded work, 0 if none was ever signaled
+        uint64_t Signal() override;
+
+        /// @brief Read the fence; the result is cached for IsComplete()
+        uint64_t GetCompletedValue() override;
+
+        /// @brief Block until the timeline reaches a value, unless it already has
+        void Wait(uint64_t value) override;
+
+        bool IsComplete(uint64_t value);
+
+        /// @brief Value after which the writes into a resource have completed
+        /// @return 0 if nothing was written into it. Unsignaled writes are signaled first.
+        uint64_t GetLastWritten(void* resource);
+
+        /// @brief Block until the writes into a resource have completed
+        void WaitForWrites(void* resource);
+
+        /// @brief Block until all recorded work has completed
+        void WaitForIdle();
+
+        /// @brief Stop tracking a resource, e.g. once it has been released
+        void Forget(void* resource);
+
+        uint64_t GetLastSignaled() const { return m_lastSignaled; }
+        const FrameTimelineStats& GetStats() const { return m_stats; }
+
+    private:
+        static constexpr uint64_t Unsignaled = UINT64_MAX;
+
+        IGpuFence* m_fence;             // Weak ref
+        uint64_t m_lastSignaled = 0;
+        uint64_t m_completed = 0;       // Cached; never above the fence's value
+        bool m_recorded = false;        // Work marked since the last signal
+
+        std::unordered_map<void*, uint64_t> m_lastWritten;  // Unsignaled until the next signal
+        std::vector<void*> m_unsignaled;
+        FrameTimelineStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,129 @@
+// ============================================================================
+// WebViewToolkit - Frame Version Table Implementation
+// ============================================================================
+
+#include "Core/FrameVersionTable.h"
+
+namespace WebViewToolkit
+{
+    bool FrameVersionTable::Register(WebViewHandle handle)
+    {
+        if (handle == InvalidWebViewHandle)
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            Slot& slot = m_slots[(handle + i) % Capacity];
+            WebViewHandle expected = InvalidWebViewHandle;
+            if (slot.handle.compare_exchange_strong(expected, handle, std::memory_order_acq_rel))
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void FrameVersionTable::Unregister(WebViewHandle handle)
+    {
+        Slot* slot = Find(handle);
+        if (!slot)
+        {
+            return;
+        }
+
+        // Cleared before the slot is freed, so its next view starts at 0
+        Write(*slot, 0, 0);
+        slot->handle.store(InvalidWebViewHandle, std::memory_order_release);
+    }
+
+    void FrameVersionTable::Publish(WebViewHandle handle, uint64_t timestampMs)
+    {
+        Slot* slot = Find(handle);
+        if (slot)
+        {
+            Write(*slot, slot->sequence.load(std::memory_order_relaxed) + 1, timestampMs);
+        }
+    }
+
+    bool FrameVersionTable::Read(WebViewHandle handle, FrameVersion& outVersion) const
+    {
+        const Slot* slot = Find(handle);
+        return slot && ReadSlot(*slot, handle, outVersion);
+    }
+
+    size_t FrameVersionTable::ReadAll(FrameVersion* outVersions, size_t capacity) const
+    {
+        size_t count = 0;
+        for (size_t i = 0; i < Capacity && count < capacity; i++)
+        {
+            const WebViewHandle handle = m_slots[i].handle.load(std::memory_order_acquire);
+            if (handle != InvalidWebViewHandle && ReadSlot(m_slots[i], handle, outVersions[count]))
+            {
+                count++;
+            }
+        }
+        return count;
+    }
+
+    FrameVersionTable::Slot* FrameVersionTable::Find(WebViewHandle handle)
+    {
+        return const_cast<Slot*>(static_cast<const FrameVersionTable*>(this)->Find(handle));
+    }
+
+    const FrameVersionTable::Slot* FrameVersionTable::Find(WebViewHandle handle) const
+    {
+        if (handle == InvalidWebViewHandle)
+        {
+            return nullptr;
+        }
+
+        for (size_t i = 0; i < Capacity; i++)
+        {
+            const Slot& slot = m_slots[(handle + i) % Capacity];
+            if (slot.handle.load(std::memory_order_acquire) == handle)
+            {
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    bool FrameVersionTable::ReadSlot(const Slot& slot, WebViewHandle handle, FrameVersion& outVersion)
+    {
+        uint32_t before;
+        uint64_t sequence;
+        uint64_t timestampMs;
+        do
+        {
+            before = slot.lock.load(std::memory_order_acquire);
+            sequence = slot.sequence.load(std::memory_order_relaxed);
+            timestampMs = slot.timestampMs.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((before & 1) != 0 || slot.lock.load(std::memory_order_relaxed) != before);
+
+        // The view may have been destroyed and its slot reused meanwhile
+        if (slot.handle.load(std::memory_order_acquire) != handle)
+        {
+            return false;
+        }
+
+        outVersion.handle = handle;
+        outVersion.reserved = 0;
+        outVersion.sequence = sequence;
+        outVersion.timestampMs = timestampMs;
+        return true;
+    }
+
+    void FrameVersionTable::Write(Slot& slot, uint64_t sequence, uint64_t timestampMs)
+    {
+        const uint32_t lock = slot.lock.load(std::memory_order_relaxed);
+        slot.lock.store(lock + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        slot.sequence.store(sequence, std::memory_order_relaxed);
+        slot.timestampMs.store(timestampMs, std::memory_order_relaxed);
+        slot.lock.store(lock + 2, std::memory_order_release);
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,68 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Frame Version Table
+// ============================================================================
+// Per-view frame sequence numbers that any thread can read without a lock,
+// so the host can tell which textures changed and skip work for the rest.
+//
+// Views register a slot when they are created and give it back when they
+// are destroyed. The render thread publishes each presented frame into the
+// view's slot under a sequence lock; readers retry while a publish is under
+// way, so a version and its timestamp always belong together. Slots are
+// found by probing from the handle, which for sequential handles is almost
+// always the first slot tried.
+//
+// Register, Unregister and Publish must not race for the same handle (the
+// manager serializes them); Read and ReadAll are safe from any thread.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    class FrameVersionTable
+    {
+    public:
+        static constexpr size_t Capacity = 512;
+
+        FrameVersionTable() = default;
+        FrameVersionTable(const FrameVersionTable&) = delete;
+        FrameVersionTable& operator=(const FrameVersionTable&) = delete;
+
+        /// @return false for InvalidWebViewHandle or when every slot is taken
+        bool Register(WebViewHandle handle);
+        void Unregister(WebViewHandle handle);
+
+        /// @brief Record a new frame for a view; ignored for unregistered views
+        void Publish(WebViewHandle handle, uint64_t timestampMs);
+
+        /// @return false for an unregistered view
+        bool Read(WebViewHandle handle, FrameVersion& outVersion) const;
+
+        /// @brief Versions of all registered views, in no particular order
+        /// @return Entries written; views beyond capacity are left out
+        size_t ReadAll(FrameVersion* outVersions, size_t capacity) const;
+
+    private:
+        struct Slot
+        {
+            std::atomic<WebViewHandle> handle{ InvalidWebViewHandle };
+            std::atomic<uint32_t> lock{ 0 };    // Odd while a publish is under way
+            std::atomic<uint64_t> sequence{ 0 };
+            std::atomic<uint64_t> timestampMs{ 0 };
+        };
+
+        Slot* Find(WebViewHandle handle);
+        const Slot* Find(WebViewHandle handle) const;
+        static bool ReadSlot(const Slot& slot, WebViewHandle handle, FrameVersion& outVersion);
+        static void Write(Slot& slot, uint64_t sequence, uint64_t timestampMs);
+
+        Slot m_slots[Capacity];
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,31 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - GPU Fence Interface
+// ============================================================================
+// A monotonic timeline on the queue that runs the toolkit's copies. The D3D12
+// backend implements it on an ID3D12Fence; unit tests fake it.
+// ============================================================================
+
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    class IGpuFence
+    {
+    public:
+        virtual ~IGpuFence() = default;
+
+        /// @brief Submit the work recorded so far and queue a signal behind it
+        /// @return The value the timeline reaches once that work has completed,
+        ///         0 if there is no timeline (and so no work in flight)
+        virtual uint64_t Signal() = 0;
+
+        /// @brief Highest value the timeline has reached; must not block
+        virtual uint64_t GetCompletedValue() = 0;
+
+        /// @brief Block until the timeline reaches a value returned by Signal()
+        virtual void Wait(uint64_t value) = 0;
+    };
+
+} // namespace WebViewToolkit
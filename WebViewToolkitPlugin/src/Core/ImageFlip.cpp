@@ -0,0 +1,27 @@
+// ============================================================================
+// WebViewToolkit - CPU Y-Flip Reference Implementation
+// ============================================================================
+
+#include "Core/ImageFlip.h"
+
+#include <cstring>
+
+namespace WebViewToolkit
+{
+    void FlipRows(const uint8_t* src, size_t srcPitch, uint8_t* dst, size_t dstPitch, size_t rowBytes, uint32_t rows)
+    {
+        if (!src || !dst || rows == 0 || rowBytes == 0)
+        {
+            return;
+        }
+
+        const uint8_t* srcRow = src + static_cast<size_t>(rows - 1) * srcPitch;
+        for (uint32_t y = 0; y < rows; y++)
+        {
+            std::memcpy(dst, srcRow, rowBytes);
+            dst += dstPitch;
+            srcRow -= srcPitch;
+        }
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,27 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - CPU Y-Flip Reference
+// ============================================================================
+// Windows Graphics Capture delivers frames top-down while Unity samples
+// textures bottom-up, so every captured frame is flipped vertically on its
+// way into Unity. This is the reference implementation that defines the
+// expected output of every flip strategy; production CPU transfers go
+// through TransformPixels (PixelKernels.h).
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    /// @brief Copy rows so that destination row y receives source row (rows - 1 - y)
+    /// @param src First source row
+    /// @param srcPitch Byte distance between source rows
+    /// @param dst First destination row (must not overlap src)
+    /// @param dstPitch Byte distance between destination rows
+    /// @param rowBytes Bytes copied per row (<= both pitches)
+    /// @param rows Number of rows
+    void FlipRows(const uint8_t* src, size_t srcPitch, uint8_t* dst, size_t dstPitch, size_t rowBytes, uint32_t rows);
+
+} // namespace WebViewToolkit
@@ -0,0 +1,87 @@
+// ============================================================================
+// WebViewToolkit - Latest Frame Mailbox Implementation
+// ============================================================================
+
+#include "Core/LatestFrameMailbox.h"
+
+namespace WebViewToolkit
+{
+    LatestFrameMailbox::LatestFrameMailbox(ILatestFrameReleaser* releaser)
+        : m_releaser(releaser)
+    {
+    }
+
+    LatestFrameMailbox::~LatestFrameMailbox()
+    {
+        ReleaseAll();
+    }
+
+    bool LatestFrameMailbox::Publish(void* frame, uint64_t captureTime)
+    {
+        m_slots[m_back].frame = frame;
+        m_slots[m_back].captureTime = captureTime;
+
+        // Release: the consumer that swaps the slot in sees the frame written.
+        // Acquire: a slot handed back by the consumer is empty.
+        const uint32_t previous = m_middle.exchange(m_back | FreshBit, std::memory_order_acq_rel);
+        m_back = previous & IndexMask;
+        m_published.fetch_add(1, std::memory_order_relaxed);
+
+        LatchedFrame& dropped = m_slots[m_back];
+        const bool superseded = (previous & FreshBit) != 0;
+        if (superseded)
+        {
+            m_superseded.fetch_add(1, std::memory_order_relaxed);
+            if (m_releaser)
+            {
+                m_releaser->ReleaseLatestFrame(dropped.frame);
+            }
+        }
+        dropped = LatchedFrame{};
+        return superseded;
+    }
+
+    bool LatestFrameMailbox::Take(LatchedFrame& outFrame)
+    {
+        // Only the producer sets the bit, so it is still set at the exchange
+        if ((m_middle.load(std::memory_order_relaxed) & FreshBit) == 0)
+        {
+            return false;
+        }
+
+        const uint32_t previous = m_middle.exchange(m_front, std::memory_order_acq_rel);
+        m_front = previous & IndexMask;
+        m_taken.fetch_add(1, std::memory_order_relaxed);
+
+        outFrame = m_slots[m_front];
+        m_slots[m_front] = LatchedFrame{};
+        return true;
+    }
+
+    void LatestFrameMailbox::ReleaseAll()
+    {
+        const uint32_t middle = m_middle.load(std::memory_order_acquire);
+        if ((middle & FreshBit) == 0)
+        {
+            return;
+        }
+
+        LatchedFrame& leftover = m_slots[middle & IndexMask];
+        if (m_releaser)
+        {
+            m_releaser->ReleaseLatestFrame(leftover.frame);
+        }
+        leftover = LatchedFrame{};
+        m_middle.store(middle & IndexMask, std::memory_order_release);
+    }
+
+    LatestFrameMailboxStats LatestFrameMailbox::GetStats() const
+    {
+        LatestFrameMailboxStats stats;
+        stats.published = m_published.load(std::memory_order_relaxed);
+        stats.superseded = m_superseded.load(std::memory_order_relaxed);
+        stats.taken = m_taken.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+} // namespace WebViewToolkit
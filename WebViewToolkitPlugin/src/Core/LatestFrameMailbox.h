@@ -0,0 +1,91 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Latest Frame Mailbox
+// ============================================================================
+// Late-latch handoff between the thread that takes frames from the capture
+// as they arrive (producer) and the render thread, which copies the newest
+// one as late in Unity's frame as it can (consumer).
+//
+// A triple buffer: the producer fills its own slot and swaps it with the
+// shared middle slot; the consumer swaps its slot with the middle one when
+// it holds a frame it has not seen. Neither side waits or locks. A frame
+// the producer replaces before the consumer took it is released by the
+// producer; a taken frame belongs to the consumer, which releases it once
+// copied. Frames are opaque, each with its capture time in the caller's
+// units.
+// ============================================================================
+
+#include <atomic>
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    class ILatestFrameReleaser
+    {
+    public:
+        virtual ~ILatestFrameReleaser() = default;
+
+        /// @brief Return a frame to the capture (called by whichever side drops it)
+        virtual void ReleaseLatestFrame(void* frame) = 0;
+    };
+
+    struct LatchedFrame
+    {
+        void* frame = nullptr;
+        uint64_t captureTime = 0;
+    };
+
+    struct LatestFrameMailboxStats
+    {
+        uint64_t published = 0;
+        uint64_t superseded = 0;    // Released by the producer without being taken
+        uint64_t taken = 0;
+    };
+
+    // ========================================================================
+    // Mailbox
+    // ========================================================================
+    class LatestFrameMailbox
+    {
+    public:
+        /// @param releaser Releases superseded and leftover frames (weak ref)
+        explicit LatestFrameMailbox(ILatestFrameReleaser* releaser);
+        ~LatestFrameMailbox();
+
+        // Non-copyable
+        LatestFrameMailbox(const LatestFrameMailbox&) = delete;
+        LatestFrameMailbox& operator=(const LatestFrameMailbox&) = delete;
+
+        /// @brief Producer: make a frame the newest, releasing one never taken
+        /// @return true if a frame was superseded
+        bool Publish(void* frame, uint64_t captureTime);
+
+        /// @brief Consumer: take the newest frame if it has not been taken yet
+        /// @return false if no frame was published since the last take
+        bool Take(LatchedFrame& outFrame);
+
+        /// @brief Release the frame waiting to be taken, if any
+        /// @note Only while neither side runs, e.g. at shutdown
+        void ReleaseAll();
+
+        /// @brief Consistent enough for monitoring; fields are read independently
+        LatestFrameMailboxStats GetStats() const;
+
+    private:
+        static constexpr uint32_t IndexMask = 0x3;
+        static constexpr uint32_t FreshBit = 0x4;   // Middle slot holds an untaken frame
+
+        ILatestFrameReleaser* m_releaser;   // Weak ref
+
+        LatchedFrame m_slots[3];
+        std::atomic<uint32_t> m_middle{ 0 };    // Index of the shared slot | FreshBit
+        uint32_t m_back = 1;                    // Producer's slot
+        uint32_t m_front = 2;                   // Consumer's slot, always empty
+
+        std::atomic<uint64_t> m_published{ 0 };
+        std::atomic<uint64_t> m_superseded{ 0 };
+        std::atomic<uint64_t> m_taken{ 0 };
+    };
+
+} // namespace WebViewToolkit
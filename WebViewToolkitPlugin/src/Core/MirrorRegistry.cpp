@@ -0,0 +1,161 @@
+// ============================================================================
+// WebViewToolkit - Mirror Registry Implementation
+// ============================================================================
+
+#include "Core/MirrorRegistry.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    MirrorId MirrorRegistry::AddRef(uint32_t width, uint32_t height)
+    {
+        for (Mirror& mirror : m_mirrors)
+        {
+            if (mirror.width == width && mirror.height == height)
+            {
+                mirror.refCount++;
+                return mirror.id;
+            }
+        }
+        return InvalidMirrorId;
+    }
+
+    MirrorId MirrorRegistry::Add(void* texture, uint32_t width, uint32_t height, uint32_t textureWidth, uint32_t textureHeight)
+    {
+        if (!texture || width == 0 || height == 0 || textureWidth < width || textureHeight < height ||
+            m_mirrors.size() >= MaxMirrors)
+        {
+            return InvalidMirrorId;
+        }
+
+        const MirrorId id = m_nextId++;
+        if (m_nextId == InvalidMirrorId)
+        {
+            m_nextId = 1;
+        }
+
+        m_mirrors.push_back(Mirror{ id, texture, width, height, textureWidth, textureHeight, 1, 0, 0 });
+        return id;
+    }
+
+    bool MirrorRegistry::Release(MirrorId id, void*& outTexture)
+    {
+        outTexture = nullptr;
+
+        auto it = std::find_if(m_mirrors.begin(), m_mirrors.end(), [id](const Mirror& mirror) { return mirror.id == id; });
+        if (it == m_mirrors.end())
+        {
+            return false;
+        }
+
+        if (--it->refCount == 0)
+        {
+            outTexture = it->texture;
+            m_mirrors.erase(it);
+        }
+        return true;
+    }
+
+    void MirrorRegistry::Clear(std::vector<void*>& outTextures)
+    {
+        GetTextures(outTextures);
+        m_mirrors.clear();
+    }
+
+    void* MirrorRegistry::GetTexture(MirrorId id) const
+    {
+        const Mirror* mirror = Find(id);
+        return mirror ? mirror->texture : nullptr;
+    }
+
+    bool MirrorRegistry::GetTextureSize(MirrorId id, uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        const Mirror* mirror = Find(id);
+        if (!mirror)
+        {
+            return false;
+        }
+
+        outWidth = mirror->textureWidth;
+        outHeight = mirror->textureHeight;
+        return true;
+    }
+
+    bool MirrorRegistry::GetUVRect(MirrorId id, float outUVRect[4]) const
+    {
+        const Mirror* mirror = Find(id);
+        if (!mirror)
+        {
+            return false;
+        }
+
+        // Content starts at row 0, which Unity samples at v = 0
+        outUVRect[0] = 0.0f;
+        outUVRect[1] = 0.0f;
+        outUVRect[2] = static_cast<float>(mirror->contentWidth ? mirror->contentWidth : mirror->width) / mirror->textureWidth;
+        outUVRect[3] = static_cast<float>(mirror->contentHeight ? mirror->contentHeight : mirror->height) / mirror->textureHeight;
+        return true;
+    }
+
+    void MirrorRegistry::PlanFanOut(uint32_t contentWidth, uint32_t contentHeight, bool canScale, std::vector<MirrorCopy>& outCopies)
+    {
+        outCopies.clear();
+        if (contentWidth == 0 || contentHeight == 0)
+        {
+            return;
+        }
+
+        for (Mirror& mirror : m_mirrors)
+        {
+            MirrorCopy copy{ mirror.id, mirror.texture, contentWidth, contentHeight, false };
+            if (contentWidth > mirror.width || contentHeight > mirror.height)
+            {
+                if (!canScale)
+                {
+                    m_stats.skippedCopies++;
+                    continue;
+                }
+
+                // Fit the limiting side, the other one rounded to the nearest pixel
+                const uint64_t widthLimited = static_cast<uint64_t>(mirror.width) * contentHeight;
+                const uint64_t heightLimited = static_cast<uint64_t>(mirror.height) * contentWidth;
+                if (widthLimited <= heightLimited)
+                {
+                    copy.width = mirror.width;
+                    copy.height = static_cast<uint32_t>((widthLimited + contentWidth / 2) / contentWidth);
+                }
+                else
+                {
+                    copy.width = static_cast<uint32_t>((heightLimited + contentHeight / 2) / contentHeight);
+                    copy.height = mirror.height;
+                }
+                copy.width = std::clamp<uint32_t>(copy.width, 1, mirror.width);
+                copy.height = std::clamp<uint32_t>(copy.height, 1, mirror.height);
+                copy.scaled = true;
+                m_stats.scaledCopies++;
+            }
+
+            mirror.contentWidth = copy.width;
+            mirror.contentHeight = copy.height;
+            m_stats.copies++;
+            outCopies.push_back(copy);
+        }
+    }
+
+    void MirrorRegistry::GetTextures(std::vector<void*>& outTextures) const
+    {
+        outTextures.clear();
+        for (const Mirror& mirror : m_mirrors)
+        {
+            outTextures.push_back(mirror.texture);
+        }
+    }
+
+    const MirrorRegistry::Mirror* MirrorRegistry::Find(MirrorId id) const
+    {
+        auto it = std::find_if(m_mirrors.begin(), m_mirrors.end(), [id](const Mirror& mirror) { return mirror.id == id; });
+        return it != m_mirrors.end() ? &*it : nullptr;
+    }
+
+} // namespace WebViewToolkit
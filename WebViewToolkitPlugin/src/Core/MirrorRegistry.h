@@ -0,0 +1,119 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Mirror Registry
+// ============================================================================
+// Extra textures a view's frames are copied into, so the same content can be
+// shown in several places without a second browser and capture session.
+//
+// A mirror has a fixed size chosen when it is attached. Consumers
+// asking for the same size share one mirror, and so one texture and one
+// copy per frame; the mirror goes when its last consumer detaches. Each
+// frame is planned into one copy per mirror: 1:1 into the top-left part of
+// its texture if the content fits the size, otherwise scaled down to fit
+// with its aspect ratio kept.
+// Backends that cannot scale skip mirrors the content does not fit.
+//
+// Textures are opaque to the registry; the owner creates and destroys them.
+// Not thread-safe; the owning view serializes calls.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    using MirrorId = uint32_t;
+    constexpr MirrorId InvalidMirrorId = 0;
+
+    /// @brief One copy of a frame into a mirror
+    struct MirrorCopy
+    {
+        MirrorId id;
+        void* texture;
+        uint32_t width;     // Part of the mirror texture the content covers
+        uint32_t height;
+        bool scaled;        // width x height differs from the content size
+    };
+
+    struct MirrorStats
+    {
+        uint64_t copies = 0;        // Planned copies, scaled ones included
+        uint64_t scaledCopies = 0;
+        uint64_t skippedCopies = 0; // Content did not fit and could not be scaled
+    };
+
+    // ========================================================================
+    // Registry
+    // ========================================================================
+    class MirrorRegistry
+    {
+    public:
+        static constexpr size_t MaxMirrors = 8;
+
+        /// @brief Add a consumer to the mirror of this size, if there is one
+        /// @return Its id, or InvalidMirrorId if the caller has to Add one
+        MirrorId AddRef(uint32_t width, uint32_t height);
+
+        /// @brief Add a mirror with one consumer
+        /// @param textureWidth, textureHeight Size of the texture, at least the mirror's
+        /// @return Its id, or InvalidMirrorId for an empty size, a null or too
+        ///         small texture or when MaxMirrors are attached
+        MirrorId Add(void* texture, uint32_t width, uint32_t height, uint32_t textureWidth, uint32_t textureHeight);
+
+        /// @brief Remove a consumer
+        /// @param outTexture Set to the mirror's texture once its last consumer
+        ///        is gone, for the caller to destroy; nullptr otherwise
+        /// @return false for an unknown id
+        bool Release(MirrorId id, void*& outTexture);
+
+        /// @brief Remove all mirrors, handing out their textures
+        void Clear(std::vector<void*>& outTextures);
+
+        /// @return nullptr for an unknown id
+        void* GetTexture(MirrorId id) const;
+
+        /// @return false for an unknown id
+        bool GetTextureSize(MirrorId id, uint32_t& outWidth, uint32_t& outHeight) const;
+
+        /// @brief Texture-relative part holding the content of the last planned frame
+        /// @param outUVRect x, y, width, height
+        /// @return false for an unknown id
+        bool GetUVRect(MirrorId id, float outUVRect[4]) const;
+
+        size_t GetCount() const { return m_mirrors.size(); }
+        bool IsEmpty() const { return m_mirrors.empty(); }
+
+        /// @brief Plan the copies of a frame into every mirror
+        /// @param contentWidth, contentHeight Live part of the frame
+        /// @param canScale Whether the backend can scale while copying
+        void PlanFanOut(uint32_t contentWidth, uint32_t contentHeight, bool canScale, std::vector<MirrorCopy>& outCopies);
+
+        /// @brief Textures of all mirrors, e.g. to resolve their pending copies
+        void GetTextures(std::vector<void*>& outTextures) const;
+
+        const MirrorStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Mirror
+        {
+            MirrorId id;
+            void* texture;
+            uint32_t width;
+            uint32_t height;
+            uint32_t textureWidth;
+            uint32_t textureHeight;
+            uint32_t refCount;
+            uint32_t contentWidth;  // Last planned copy
+            uint32_t contentHeight;
+        };
+
+        const Mirror* Find(MirrorId id) const;
+
+        std::vector<Mirror> m_mirrors;
+        MirrorId m_nextId = 1;
+        MirrorStats m_stats;
+    };
+
+} // namespace WebViewToolkit
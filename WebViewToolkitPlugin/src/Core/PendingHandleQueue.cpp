@@ -0,0 +1,78 @@
+// ============================================================================
+// WebViewToolkit - Pending View Queue Implementation
+// ============================================================================
+// Bounded ring after Dmitry Vyukov's MPMC queue: each cell's sequence tells
+// whether it is free for the producer at a position or holds the value the
+// consumer expects there, so producers only contend on m_enqueuePos.
+// ============================================================================
+
+#include "Core/PendingHandleQueue.h"
+
+namespace WebViewToolkit
+{
+    PendingHandleQueue::PendingHandleQueue(uint32_t capacity)
+    {
+        uint64_t size = 2;
+        while (size < capacity)
+        {
+            size <<= 1;
+        }
+
+        m_cells = std::make_unique<Cell[]>(size);
+        m_mask = size - 1;
+        for (uint64_t i = 0; i < size; ++i)
+        {
+            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bool PendingHandleQueue::Push(uint32_t handle)
+    {
+        uint64_t pos = m_enqueuePos.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell = m_cells[pos & m_mask];
+            const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+            const int64_t diff = static_cast<int64_t>(sequence) - static_cast<int64_t>(pos);
+
+            if (diff == 0)
+            {
+                // Free for this position: claim it
+                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.handle = handle;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                // Still holds the value from one lap ago
+                m_overflow.store(true, std::memory_order_release);
+                return false;
+            }
+            else
+            {
+                // Another producer claimed it first
+                pos = m_enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool PendingHandleQueue::TryPop(uint32_t& outHandle)
+    {
+        Cell& cell = m_cells[m_dequeuePos & m_mask];
+        const uint64_t sequence = cell.sequence.load(std::memory_order_acquire);
+        if (sequence != m_dequeuePos + 1)
+        {
+            // Empty, or a producer has claimed the cell but not yet written it
+            return false;
+        }
+
+        outHandle = cell.handle;
+        cell.sequence.store(m_dequeuePos + m_mask + 1, std::memory_order_release);
+        m_dequeuePos++;
+        return true;
+    }
+
+} // namespace WebViewToolkit
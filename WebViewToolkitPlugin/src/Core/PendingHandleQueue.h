@@ -0,0 +1,82 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Pending View Queue
+// ============================================================================
+// Bounded lock-free queue of view handles. Capture callbacks push the handle
+// of a view that received a frame from any thread; the render thread pops
+// them so it only visits views with new content.
+//
+// Producers deduplicate with a per-view flag (see PendingFlag), so the queue
+// never holds more entries than there are views. Should it fill up anyway,
+// the failed push is remembered and the consumer falls back to visiting every
+// view once, which clears all flags and brings the queue back in sync.
+// ============================================================================
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Pending Flag
+    // ========================================================================
+
+    /// Per-view "queued" bit: only the producer that raises it pushes the handle
+    class PendingFlag
+    {
+    public:
+        /// @return true if the flag was clear, i.e. the caller must queue the view
+        bool Raise() { return !m_raised.exchange(true, std::memory_order_acq_rel); }
+
+        /// @brief Called by the consumer before it looks at the view, so a frame
+        ///        arriving during the visit queues the view again
+        void Clear() { m_raised.store(false, std::memory_order_release); }
+
+        bool IsRaised() const { return m_raised.load(std::memory_order_acquire); }
+
+    private:
+        std::atomic<bool> m_raised{ false };
+    };
+
+    // ========================================================================
+    // Queue
+    // ========================================================================
+    class PendingHandleQueue
+    {
+    public:
+        /// @param capacity Rounded up to a power of two
+        explicit PendingHandleQueue(uint32_t capacity = 1024);
+
+        PendingHandleQueue(const PendingHandleQueue&) = delete;
+        PendingHandleQueue& operator=(const PendingHandleQueue&) = delete;
+
+        /// @brief Any thread. Lock-free; fails only when the queue is full
+        bool Push(uint32_t handle);
+
+        /// @brief Single consumer
+        bool TryPop(uint32_t& outHandle);
+
+        /// @brief Single consumer. true once after any push failed
+        bool TakeOverflow() { return m_overflow.exchange(false, std::memory_order_acq_rel); }
+
+        uint32_t GetCapacity() const { return static_cast<uint32_t>(m_mask + 1); }
+
+    private:
+        struct Cell
+        {
+            std::atomic<uint64_t> sequence;
+            uint32_t handle;
+        };
+
+        std::unique_ptr<Cell[]> m_cells;
+        uint64_t m_mask;
+
+        // Producers and the consumer write different cache lines
+        alignas(64) std::atomic<uint64_t> m_enqueuePos{ 0 };
+        alignas(64) uint64_t m_dequeuePos = 0;
+        std::atomic<bool> m_overflow{ false };
+    };
+
+} // namespace WebViewToolkit
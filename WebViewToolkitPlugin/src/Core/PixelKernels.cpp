@@ -0,0 +1,357 @@
+// ============================================================================
+// WebViewToolkit - Pixel Transform Kernels Implementation
+// ============================================================================
+// Scalar reference kernels, runtime ISA selection and the row loop.
+// ============================================================================
+
+#include "Core/PixelKernels.h"
+#include "Core/PixelKernelsInternal.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace WebViewToolkit
+{
+    namespace Detail
+    {
+        // ====================================================================
+        // Scalar Reference
+        // ====================================================================
+
+        void SwizzleRBScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            for (uint32_t i = 0; i < pixels; i++, src += 4, dst += 4)
+            {
+                const uint8_t c0 = src[0];
+                const uint8_t c2 = src[2];
+                dst[0] = c2;
+                dst[1] = src[1];
+                dst[2] = c0;
+                dst[3] = src[3];
+            }
+        }
+
+        void PremultiplyScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            for (uint32_t i = 0; i < pixels; i++, src += 4, dst += 4)
+            {
+                const uint32_t a = src[3];
+                for (int c = 0; c < 3; c++)
+                {
+                    // Exact round(c * a / 255) without a division
+                    const uint32_t t = src[c] * a + 128;
+                    dst[c] = static_cast<uint8_t>((t + (t >> 8)) >> 8);
+                }
+                dst[3] = static_cast<uint8_t>(a);
+            }
+        }
+
+        void UnpremultiplyScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            for (uint32_t i = 0; i < pixels; i++, src += 4, dst += 4)
+            {
+                const uint32_t a = src[3];
+                for (int c = 0; c < 3; c++)
+                {
+                    dst[c] = a == 0 ? 0 : static_cast<uint8_t>(std::min<uint32_t>(255, (src[c] * 255 + a / 2) / a));
+                }
+                dst[3] = static_cast<uint8_t>(a);
+            }
+        }
+
+        void HashTileSpanScalar(const uint8_t* span, uint32_t firstPixel, uint32_t pixels, TileSignature& signature)
+        {
+            for (uint32_t i = 0; i < pixels; i++)
+            {
+                uint32_t pixel;
+                std::memcpy(&pixel, span + static_cast<size_t>(i) * 4, 4);
+                uint32_t& lane = signature.lanes[(firstPixel + i) % TileSignature::LaneCount];
+                lane = (lane ^ pixel) * TileHashPrime;
+            }
+        }
+
+        void HashTileRowScalar(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures)
+        {
+            for (uint32_t x = 0; x < pixels; x += tileWidth, signatures++)
+            {
+                HashTileSpanScalar(row + static_cast<size_t>(x) * 4, 0, std::min(tileWidth, pixels - x), *signatures);
+            }
+        }
+
+        void HashLineSpanScalar(const uint8_t* span, uint32_t firstPixel, uint32_t pixels, uint32_t* columns,
+            TileSignature& rowSignature)
+        {
+            for (uint32_t i = 0; i < pixels; i++)
+            {
+                uint32_t pixel;
+                std::memcpy(&pixel, span + static_cast<size_t>(i) * 4, 4);
+                uint32_t& lane = rowSignature.lanes[(firstPixel + i) % TileSignature::LaneCount];
+                lane = (lane ^ pixel) * TileHashPrime;
+                columns[i] = (columns[i] ^ pixel) * TileHashPrime;
+            }
+        }
+
+        void HashLineRowScalar(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature)
+        {
+            HashLineSpanScalar(row, 0, pixels, columns, rowSignature);
+        }
+
+        const PixelKernelTable* GetScalarPixelKernels()
+        {
+            static const PixelKernelTable table = { SwizzleRBScalar, PremultiplyScalar, UnpremultiplyScalar, HashTileRowScalar,
+                HashLineRowScalar };
+            return &table;
+        }
+    }
+
+    // ========================================================================
+    // Dispatch
+    // ========================================================================
+    namespace
+    {
+        bool CpuSupportsAvx2()
+        {
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] < 7)
+            {
+                return false;
+            }
+
+            // AVX2 also needs the OS to save YMM state
+            __cpuid(info, 1);
+            const bool osxsave = (info[2] & (1 << 27)) != 0;
+            const bool avx = (info[2] & (1 << 28)) != 0;
+            if (!osxsave || !avx || (_xgetbv(0) & 0x6) != 0x6)
+            {
+                return false;
+            }
+
+            __cpuidex(info, 7, 0);
+            return (info[1] & (1 << 5)) != 0;
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+            return __builtin_cpu_supports("avx2");
+#else
+            return false;
+#endif
+        }
+
+        const Detail::PixelKernelTable* GetTable(PixelIsa isa)
+        {
+            switch (isa)
+            {
+            case PixelIsa::Scalar: return Detail::GetScalarPixelKernels();
+            case PixelIsa::SSE2: return Detail::GetSse2PixelKernels();
+            case PixelIsa::AVX2: return CpuSupportsAvx2() ? Detail::GetAvx2PixelKernels() : nullptr;
+            case PixelIsa::NEON: return Detail::GetNeonPixelKernels();
+            default: return nullptr;
+            }
+        }
+
+        PixelIsa DetectBestIsa()
+        {
+            for (PixelIsa isa : { PixelIsa::AVX2, PixelIsa::NEON, PixelIsa::SSE2 })
+            {
+                if (GetTable(isa))
+                {
+                    return isa;
+                }
+            }
+            return PixelIsa::Scalar;
+        }
+
+        struct ActiveKernels
+        {
+            std::atomic<PixelIsa> isa;
+            std::atomic<const Detail::PixelKernelTable*> table;
+
+            ActiveKernels()
+                : isa(DetectBestIsa())
+                , table(GetTable(isa.load()))
+            {
+            }
+        };
+
+        ActiveKernels& Active()
+        {
+            static ActiveKernels active;
+            return active;
+        }
+
+        Detail::PixelRowKernel GetKernel(const Detail::PixelKernelTable& table, PixelOps op)
+        {
+            switch (op)
+            {
+            case PixelOps::SwizzleRB: return table.swizzleRB;
+            case PixelOps::Premultiply: return table.premultiply;
+            case PixelOps::Unpremultiply: return table.unpremultiply;
+            default: return nullptr;
+            }
+        }
+    }
+
+    bool HashTileRow(const uint8_t* row, uint32_t width, uint32_t tileWidth, TileSignature* signatures)
+    {
+        if (!row || !signatures || tileWidth == 0 || tileWidth % TileSignature::LaneCount != 0)
+        {
+            return false;
+        }
+
+        Active().table.load(std::memory_order_acquire)->hashTileRow(row, width, tileWidth, signatures);
+        return true;
+    }
+
+    bool HashLineRow(const uint8_t* row, uint32_t width, uint32_t* columns, TileSignature& rowSignature)
+    {
+        if (!row || !columns)
+        {
+            return false;
+        }
+
+        Active().table.load(std::memory_order_acquire)->hashLineRow(row, width, columns, rowSignature);
+        return true;
+    }
+
+    PixelIsa GetPixelKernelIsa()
+    {
+        return Active().isa.load(std::memory_order_relaxed);
+    }
+
+    bool IsPixelIsaSupported(PixelIsa isa)
+    {
+        return GetTable(isa) != nullptr;
+    }
+
+    bool SetPixelKernelIsa(PixelIsa isa)
+    {
+        const Detail::PixelKernelTable* table = GetTable(isa);
+        if (!table)
+        {
+            return false;
+        }
+
+        Active().table.store(table, std::memory_order_release);
+        Active().isa.store(isa, std::memory_order_relaxed);
+        return true;
+    }
+
+    void ResetPixelKernelIsa()
+    {
+        SetPixelKernelIsa(DetectBestIsa());
+    }
+
+    const char* GetPixelIsaName(PixelIsa isa)
+    {
+        switch (isa)
+        {
+        case PixelIsa::Scalar: return "Scalar";
+        case PixelIsa::SSE2: return "SSE2";
+        case PixelIsa::AVX2: return "AVX2";
+        case PixelIsa::NEON: return "NEON";
+        default: return "Unknown";
+        }
+    }
+
+    // ========================================================================
+    // Transform
+    // ========================================================================
+
+    bool TransformPixels(const PixelTransform& transform)
+    {
+        const size_t rowBytes = static_cast<size_t>(transform.width) * 4;
+
+        if (!transform.src || !transform.dst ||
+            transform.srcPitch < rowBytes || transform.dstPitch < rowBytes ||
+            (HasPixelOp(transform.ops, PixelOps::Premultiply) && HasPixelOp(transform.ops, PixelOps::Unpremultiply)) ||
+            (transform.flipY && transform.src == transform.dst && transform.height > 1))
+        {
+            return false;
+        }
+
+        if (rowBytes == 0 || transform.height == 0)
+        {
+            return true;
+        }
+
+        // Resolve the per-row kernel chain once: the first kernel reads the
+        // source row, the rest run in place on the destination row
+        const Detail::PixelKernelTable& table = *Active().table.load(std::memory_order_acquire);
+        Detail::PixelRowKernel chain[3];
+        int chainLength = 0;
+        for (PixelOps op : { PixelOps::Unpremultiply, PixelOps::SwizzleRB, PixelOps::Premultiply })
+        {
+            if (HasPixelOp(transform.ops, op))
+            {
+                chain[chainLength++] = GetKernel(table, op);
+            }
+        }
+
+        const uint8_t* srcRow = transform.src;
+        ptrdiff_t srcStep = static_cast<ptrdiff_t>(transform.srcPitch);
+        if (transform.flipY)
+        {
+            srcRow += static_cast<size_t>(transform.height - 1) * transform.srcPitch;
+            srcStep = -srcStep;
+        }
+
+        uint8_t* dstRow = transform.dst;
+        for (uint32_t y = 0; y < transform.height; y++)
+        {
+            if (chainLength == 0)
+            {
+                if (dstRow != srcRow)
+                {
+                    std::memcpy(dstRow, srcRow, rowBytes);
+                }
+            }
+            else
+            {
+                chain[0](srcRow, dstRow, transform.width);
+                for (int i = 1; i < chainLength; i++)
+                {
+                    chain[i](dstRow, dstRow, transform.width);
+                }
+            }
+
+            srcRow += srcStep;
+            dstRow += transform.dstPitch;
+        }
+
+        return true;
+    }
+
+    size_t TransformPixelsIntoBuffer(const uint8_t* src, size_t srcPitch, uint32_t width, uint32_t height,
+        PixelOps ops, bool flipY, std::vector<uint8_t>& buffer)
+    {
+        if (!src || width == 0 || height == 0)
+        {
+            return 0;
+        }
+
+        const size_t pitch = static_cast<size_t>(width) * 4;
+        const size_t size = pitch * height;
+        if (buffer.size() < size)
+        {
+            buffer.resize(size);
+        }
+
+        PixelTransform transform;
+        transform.src = src;
+        transform.srcPitch = srcPitch;
+        transform.dst = buffer.data();
+        transform.dstPitch = pitch;
+        transform.width = width;
+        transform.height = height;
+        transform.ops = ops;
+        transform.flipY = flipY;
+
+        return TransformPixels(transform) ? pitch : 0;
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,137 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Pixel Transform Kernels
+// ============================================================================
+// One entry point for every CPU pixel transfer: row-pitch repacking, Y-flip,
+// BGRA<->RGBA swizzle and alpha (un)premultiplication, plus the tile and
+// line signatures used for change and scroll detection. Row kernels exist in scalar, SSE2,
+// AVX2 and NEON flavours; the fastest one the CPU supports is picked at first
+// use. All flavours produce bit-identical output.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Operations
+    // ========================================================================
+    enum class PixelOps : uint32_t
+    {
+        None = 0,
+        SwizzleRB = 1 << 0,         // Swap channels 0 and 2 (BGRA <-> RGBA)
+        Premultiply = 1 << 1,       // c = round(c * a / 255)
+        Unpremultiply = 1 << 2,     // c = min(255, round(c * 255 / a)), 0 where a == 0
+    };
+
+    constexpr PixelOps operator|(PixelOps a, PixelOps b)
+    {
+        return static_cast<PixelOps>(static_cast<uint32_t>(a) | static_cast<uint32_t>(b));
+    }
+
+    constexpr bool HasPixelOp(PixelOps ops, PixelOps op)
+    {
+        return (static_cast<uint32_t>(ops) & static_cast<uint32_t>(op)) != 0;
+    }
+
+    /// @brief Instruction set used by the row kernels
+    enum class PixelIsa : int32_t
+    {
+        Scalar = 0,
+        SSE2 = 1,
+        AVX2 = 2,
+        NEON = 3,
+    };
+
+    // ========================================================================
+    // Transform Description
+    // ========================================================================
+
+    /// @brief A 32-bit-per-pixel image transfer
+    struct PixelTransform
+    {
+        const uint8_t* src = nullptr;
+        size_t srcPitch = 0;        // Bytes between source rows
+        uint8_t* dst = nullptr;     // May equal src for in-place transforms without flipY
+        size_t dstPitch = 0;        // Bytes between destination rows
+        uint32_t width = 0;         // Pixels per row
+        uint32_t height = 0;
+        PixelOps ops = PixelOps::None;
+        bool flipY = false;         // Destination row y receives source row (height - 1 - y)
+    };
+
+    // ========================================================================
+    // Tile Signatures
+    // ========================================================================
+
+    /// @brief Content signature of one image tile
+    /// @note Eight independent 32-bit lanes; lane k absorbs pixels k, k + 8, ...
+    ///       of every tile row as h = (h ^ pixel) * 0x9E3779B1. Each step is a
+    ///       bijection, so changing any single pixel always changes the signature.
+    struct TileSignature
+    {
+        static constexpr uint32_t LaneCount = 8;
+
+        uint32_t lanes[LaneCount];
+
+        /// @brief Starting state before the first row is hashed
+        static constexpr TileSignature Seed()
+        {
+            TileSignature seed{};
+            for (uint32_t k = 0; k < LaneCount; k++)
+            {
+                seed.lanes[k] = 0x811C9DC5u + k * 0x01000193u;
+            }
+            return seed;
+        }
+
+        bool operator==(const TileSignature&) const = default;
+    };
+
+    // ========================================================================
+    // API
+    // ========================================================================
+
+    /// @brief Run a transform with the active kernels
+    /// @return false on invalid input (null buffers, pitches smaller than a row,
+    ///         Premultiply combined with Unpremultiply, in-place flip)
+    bool TransformPixels(const PixelTransform& transform);
+
+    /// @brief Transform into a tightly packed, persistent buffer
+    /// @param buffer Destination, grown as needed and reused across calls
+    /// @return Row pitch of the packed image (width * 4), or 0 if nothing was written
+    size_t TransformPixelsIntoBuffer(const uint8_t* src, size_t srcPitch, uint32_t width, uint32_t height,
+        PixelOps ops, bool flipY, std::vector<uint8_t>& buffer);
+
+    /// @brief Fold one image row into the signatures of the tiles it crosses
+    /// @param signatures One per tile column: (width + tileWidth - 1) / tileWidth entries
+    /// @param tileWidth Pixels per tile column, a non-zero multiple of 8
+    /// @return false on invalid input
+    bool HashTileRow(const uint8_t* row, uint32_t width, uint32_t tileWidth, TileSignature* signatures);
+
+    /// @brief Fold one image row into its own signature and those of its columns, in one pass
+    /// @param columns One per pixel: column x absorbs pixel x of every row as
+    ///        c = (c ^ pixel) * 0x9E3779B1
+    /// @param rowSignature Hashed like a single tile as wide as the row
+    /// @return false on invalid input
+    bool HashLineRow(const uint8_t* row, uint32_t width, uint32_t* columns, TileSignature& rowSignature);
+
+    /// @brief Instruction set the kernels currently dispatch to
+    PixelIsa GetPixelKernelIsa();
+
+    /// @brief Whether this build and CPU can run the given instruction set
+    bool IsPixelIsaSupported(PixelIsa isa);
+
+    /// @brief Force an instruction set (tests and benchmarks)
+    /// @return false if unsupported; the active selection is left unchanged
+    bool SetPixelKernelIsa(PixelIsa isa);
+
+    /// @brief Return to the best supported instruction set
+    void ResetPixelKernelIsa();
+
+    const char* GetPixelIsaName(PixelIsa isa);
+
+} // namespace WebViewToolkit
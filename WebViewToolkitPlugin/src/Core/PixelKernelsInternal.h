@@ -0,0 +1,54 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Pixel Kernel Tables (internal)
+// ============================================================================
+// Each instruction-set translation unit exposes a table of row kernels.
+// A getter returns nullptr when its ISA is not compiled into this build.
+// Row kernels must tolerate src == dst.
+// ============================================================================
+
+#include "Core/PixelKernels.h"
+
+#include <cstdint>
+
+namespace WebViewToolkit::Detail
+{
+    using PixelRowKernel = void(*)(const uint8_t* src, uint8_t* dst, uint32_t pixels);
+
+    // tileWidth is a non-zero multiple of 8, so every full tile is whole SIMD steps
+    using TileHashRowKernel = void(*)(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures);
+
+    using LineHashRowKernel = void(*)(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature);
+
+    struct PixelKernelTable
+    {
+        PixelRowKernel swizzleRB;
+        PixelRowKernel premultiply;
+        PixelRowKernel unpremultiply;
+        TileHashRowKernel hashTileRow;
+        LineHashRowKernel hashLineRow;
+    };
+
+    constexpr uint32_t TileHashPrime = 0x9E3779B1u;
+
+    const PixelKernelTable* GetScalarPixelKernels();
+    const PixelKernelTable* GetSse2PixelKernels();
+    const PixelKernelTable* GetAvx2PixelKernels();
+    const PixelKernelTable* GetNeonPixelKernels();
+
+    // Scalar per-pixel reference, shared by the SIMD tails
+    void SwizzleRBScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels);
+    void PremultiplyScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels);
+    void UnpremultiplyScalar(const uint8_t* src, uint8_t* dst, uint32_t pixels);
+    void HashTileRowScalar(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures);
+    void HashLineRowScalar(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature);
+
+    /// @brief Hash pixels [firstPixel, firstPixel + pixels) of one tile row
+    void HashTileSpanScalar(const uint8_t* span, uint32_t firstPixel, uint32_t pixels, TileSignature& signature);
+
+    /// @brief Hash pixels [firstPixel, firstPixel + pixels) of a row; columns starts at firstPixel
+    void HashLineSpanScalar(const uint8_t* span, uint32_t firstPixel, uint32_t pixels, uint32_t* columns,
+        TileSignature& rowSignature);
+
+} // namespace WebViewToolkit::Detail
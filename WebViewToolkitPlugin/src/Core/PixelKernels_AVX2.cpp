@@ -0,0 +1,169 @@
+// ============================================================================
+// WebViewToolkit - Pixel Kernels (AVX2)
+// ============================================================================
+// Eight pixels per iteration. This file is compiled with AVX2 code generation
+// enabled, so nothing in it may run before the dispatcher has checked CPUID.
+// ============================================================================
+
+#include "Core/PixelKernelsInternal.h"
+
+#if defined(__AVX2__)
+#define WEBVIEW_TOOLKIT_PIXEL_AVX2 1
+#include <immintrin.h>
+#endif
+
+namespace WebViewToolkit::Detail
+{
+#ifdef WEBVIEW_TOOLKIT_PIXEL_AVX2
+    namespace
+    {
+        inline __m256i AlphaMask()
+        {
+            return _mm256_set1_epi32(static_cast<int>(0xFF000000u));
+        }
+
+        inline __m256i KeepAlpha(__m256i result, __m256i source)
+        {
+            return _mm256_or_si256(_mm256_andnot_si256(AlphaMask(), result), _mm256_and_si256(source, AlphaMask()));
+        }
+
+        void SwizzleRBAvx2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            const __m256i shuffle = _mm256_setr_epi8(
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15,
+                2, 1, 0, 3, 6, 5, 4, 7, 10, 9, 8, 11, 14, 13, 12, 15);
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_shuffle_epi8(v, shuffle));
+            }
+
+            SwizzleRBScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        inline __m256i PremultiplyWide(__m256i wide)
+        {
+            const __m256i alphaShuffle = _mm256_setr_epi8(
+                6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15,
+                6, 7, 6, 7, 6, 7, 6, 7, 14, 15, 14, 15, 14, 15, 14, 15);
+
+            __m256i alpha = _mm256_shuffle_epi8(wide, alphaShuffle);
+            __m256i t = _mm256_add_epi16(_mm256_mullo_epi16(wide, alpha), _mm256_set1_epi16(128));
+            return _mm256_srli_epi16(_mm256_add_epi16(t, _mm256_srli_epi16(t, 8)), 8);
+        }
+
+        void PremultiplyAvx2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            const __m256i zero = _mm256_setzero_si256();
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                // unpack/pack both work per 128-bit lane, so pixel order is preserved
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+                __m256i lo = PremultiplyWide(_mm256_unpacklo_epi8(v, zero));
+                __m256i hi = PremultiplyWide(_mm256_unpackhi_epi8(v, zero));
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), KeepAlpha(_mm256_packus_epi16(lo, hi), v));
+            }
+
+            PremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // Two pixels in 32-bit lanes, one per 128-bit half. See the SSE2 kernel
+        // for why the float division matches the integer reference exactly.
+        inline __m256i UnpremultiplyPixels(__m256i pixels)
+        {
+            __m256i alpha = _mm256_shuffle_epi32(pixels, 0xFF);
+            __m256 numerator = _mm256_cvtepi32_ps(_mm256_add_epi32(
+                _mm256_sub_epi32(_mm256_slli_epi32(pixels, 8), pixels),
+                _mm256_srli_epi32(alpha, 1)));
+            __m256i result = _mm256_cvttps_epi32(_mm256_div_ps(numerator, _mm256_cvtepi32_ps(alpha)));
+            return _mm256_andnot_si256(_mm256_cmpeq_epi32(alpha, _mm256_setzero_si256()), result);
+        }
+
+        void UnpremultiplyAvx2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            // After the per-lane packs the pixels come out as 0,2,4,6,1,3,5,7
+            const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                const uint8_t* p = src + i * 4;
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+
+                __m256i p01 = UnpremultiplyPixels(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p))));
+                __m256i p23 = UnpremultiplyPixels(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 8))));
+                __m256i p45 = UnpremultiplyPixels(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 16))));
+                __m256i p67 = UnpremultiplyPixels(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i*>(p + 24))));
+
+                __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(p01, p23), _mm256_packs_epi32(p45, p67));
+                packed = _mm256_permutevar8x32_epi32(packed, order);
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), KeepAlpha(packed, v));
+            }
+
+            UnpremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // One register holds all eight lanes; tiles are independent chains,
+        // so consecutive tiles overlap the multiply latency
+        void HashTileRowAvx2(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures)
+        {
+            const __m256i prime = _mm256_set1_epi32(static_cast<int>(TileHashPrime));
+
+            for (uint32_t x = 0; x < pixels; x += tileWidth, signatures++)
+            {
+                const uint8_t* span = row + static_cast<size_t>(x) * 4;
+                const uint32_t count = pixels - x < tileWidth ? pixels - x : tileWidth;
+
+                __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(signatures->lanes));
+
+                uint32_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(span + i * 4));
+                    lanes = _mm256_mullo_epi32(_mm256_xor_si256(lanes, v), prime);
+                }
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(signatures->lanes), lanes);
+                HashTileSpanScalar(span + i * 4, i, count - i, *signatures);
+            }
+        }
+
+        void HashLineRowAvx2(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature)
+        {
+            const __m256i prime = _mm256_set1_epi32(static_cast<int>(TileHashPrime));
+
+            __m256i lanes = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rowSignature.lanes));
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i * 4));
+                lanes = _mm256_mullo_epi32(_mm256_xor_si256(lanes, v), prime);
+
+                __m256i* column = reinterpret_cast<__m256i*>(columns + i);
+                _mm256_storeu_si256(column, _mm256_mullo_epi32(_mm256_xor_si256(_mm256_loadu_si256(column), v), prime));
+            }
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(rowSignature.lanes), lanes);
+            HashLineSpanScalar(row + i * 4, i, pixels - i, columns + i, rowSignature);
+        }
+    }
+
+    const PixelKernelTable* GetAvx2PixelKernels()
+    {
+        static const PixelKernelTable table = { SwizzleRBAvx2, PremultiplyAvx2, UnpremultiplyAvx2, HashTileRowAvx2,
+            HashLineRowAvx2 };
+        return &table;
+    }
+#else
+    const PixelKernelTable* GetAvx2PixelKernels()
+    {
+        return nullptr;
+    }
+#endif
+
+} // namespace WebViewToolkit::Detail
@@ -0,0 +1,168 @@
+// ============================================================================
+// WebViewToolkit - Pixel Kernels (NEON)
+// ============================================================================
+// AArch64 only (Windows on ARM, ARM64 Linux). Sixteen pixels per iteration
+// using de-interleaving loads, so every channel sits in its own register.
+// ============================================================================
+
+#include "Core/PixelKernelsInternal.h"
+
+#if defined(__aarch64__) || defined(_M_ARM64)
+#define WEBVIEW_TOOLKIT_PIXEL_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace WebViewToolkit::Detail
+{
+#ifdef WEBVIEW_TOOLKIT_PIXEL_NEON
+    namespace
+    {
+        void SwizzleRBNeon(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            uint32_t i = 0;
+            for (; i + 16 <= pixels; i += 16)
+            {
+                uint8x16x4_t v = vld4q_u8(src + i * 4);
+                uint8x16_t c0 = v.val[0];
+                v.val[0] = v.val[2];
+                v.val[2] = c0;
+                vst4q_u8(dst + i * 4, v);
+            }
+
+            SwizzleRBScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // round(c * a / 255) as (x + ((x + 128) >> 8) + 128) >> 8, x = c * a
+        inline uint8x16_t PremultiplyChannel(uint8x16_t c, uint8x16_t a)
+        {
+            uint16x8_t lo = vmull_u8(vget_low_u8(c), vget_low_u8(a));
+            uint16x8_t hi = vmull_high_u8(c, a);
+            return vcombine_u8(
+                vrshrn_n_u16(vrsraq_n_u16(lo, lo, 8), 8),
+                vrshrn_n_u16(vrsraq_n_u16(hi, hi, 8), 8));
+        }
+
+        void PremultiplyNeon(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            uint32_t i = 0;
+            for (; i + 16 <= pixels; i += 16)
+            {
+                uint8x16x4_t v = vld4q_u8(src + i * 4);
+                v.val[0] = PremultiplyChannel(v.val[0], v.val[3]);
+                v.val[1] = PremultiplyChannel(v.val[1], v.val[3]);
+                v.val[2] = PremultiplyChannel(v.val[2], v.val[3]);
+                vst4q_u8(dst + i * 4, v);
+            }
+
+            PremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // Four lanes of (c * 255 + a / 2) / a, truncated and saturated to 16 bits.
+        // The float quotient never crosses an integer boundary (see SSE2 kernel).
+        inline uint16x4_t UnpremultiplyQuarter(uint16x4_t c, uint16x4_t a)
+        {
+            uint32x4_t numerator = vmlal_n_u16(vmovl_u16(vshr_n_u16(a, 1)), c, 255);
+            float32x4_t quotient = vdivq_f32(vcvtq_f32_u32(numerator), vcvtq_f32_u32(vmovl_u16(a)));
+            return vqmovn_u32(vcvtq_u32_f32(quotient));
+        }
+
+        inline uint8x16_t UnpremultiplyChannel(uint8x16_t c, uint8x16_t a, uint8x16_t alphaZero)
+        {
+            uint16x8_t c16lo = vmovl_u8(vget_low_u8(c));
+            uint16x8_t c16hi = vmovl_high_u8(c);
+            uint16x8_t a16lo = vmovl_u8(vget_low_u8(a));
+            uint16x8_t a16hi = vmovl_high_u8(a);
+
+            uint16x8_t lo = vcombine_u16(
+                UnpremultiplyQuarter(vget_low_u16(c16lo), vget_low_u16(a16lo)),
+                UnpremultiplyQuarter(vget_high_u16(c16lo), vget_high_u16(a16lo)));
+            uint16x8_t hi = vcombine_u16(
+                UnpremultiplyQuarter(vget_low_u16(c16hi), vget_low_u16(a16hi)),
+                UnpremultiplyQuarter(vget_high_u16(c16hi), vget_high_u16(a16hi)));
+
+            // Saturating narrow clamps to 255; a == 0 lanes are forced to 0
+            return vbicq_u8(vcombine_u8(vqmovn_u16(lo), vqmovn_u16(hi)), alphaZero);
+        }
+
+        void UnpremultiplyNeon(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            uint32_t i = 0;
+            for (; i + 16 <= pixels; i += 16)
+            {
+                uint8x16x4_t v = vld4q_u8(src + i * 4);
+                uint8x16_t alphaZero = vceqzq_u8(v.val[3]);
+                v.val[0] = UnpremultiplyChannel(v.val[0], v.val[3], alphaZero);
+                v.val[1] = UnpremultiplyChannel(v.val[1], v.val[3], alphaZero);
+                v.val[2] = UnpremultiplyChannel(v.val[2], v.val[3], alphaZero);
+                vst4q_u8(dst + i * 4, v);
+            }
+
+            UnpremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        void HashTileRowNeon(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures)
+        {
+            const uint32x4_t prime = vdupq_n_u32(TileHashPrime);
+
+            for (uint32_t x = 0; x < pixels; x += tileWidth, signatures++)
+            {
+                const uint8_t* span = row + static_cast<size_t>(x) * 4;
+                const uint32_t count = pixels - x < tileWidth ? pixels - x : tileWidth;
+
+                uint32x4_t lanesLo = vld1q_u32(signatures->lanes);
+                uint32x4_t lanesHi = vld1q_u32(signatures->lanes + 4);
+
+                uint32_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    uint32x4_t lo = vreinterpretq_u32_u8(vld1q_u8(span + i * 4));
+                    uint32x4_t hi = vreinterpretq_u32_u8(vld1q_u8(span + i * 4 + 16));
+                    lanesLo = vmulq_u32(veorq_u32(lanesLo, lo), prime);
+                    lanesHi = vmulq_u32(veorq_u32(lanesHi, hi), prime);
+                }
+
+                vst1q_u32(signatures->lanes, lanesLo);
+                vst1q_u32(signatures->lanes + 4, lanesHi);
+                HashTileSpanScalar(span + i * 4, i, count - i, *signatures);
+            }
+        }
+
+        void HashLineRowNeon(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature)
+        {
+            const uint32x4_t prime = vdupq_n_u32(TileHashPrime);
+
+            uint32x4_t lanesLo = vld1q_u32(rowSignature.lanes);
+            uint32x4_t lanesHi = vld1q_u32(rowSignature.lanes + 4);
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                uint32x4_t lo = vreinterpretq_u32_u8(vld1q_u8(row + i * 4));
+                uint32x4_t hi = vreinterpretq_u32_u8(vld1q_u8(row + i * 4 + 16));
+                lanesLo = vmulq_u32(veorq_u32(lanesLo, lo), prime);
+                lanesHi = vmulq_u32(veorq_u32(lanesHi, hi), prime);
+
+                vst1q_u32(columns + i, vmulq_u32(veorq_u32(vld1q_u32(columns + i), lo), prime));
+                vst1q_u32(columns + i + 4, vmulq_u32(veorq_u32(vld1q_u32(columns + i + 4), hi), prime));
+            }
+
+            vst1q_u32(rowSignature.lanes, lanesLo);
+            vst1q_u32(rowSignature.lanes + 4, lanesHi);
+            HashLineSpanScalar(row + i * 4, i, pixels - i, columns + i, rowSignature);
+        }
+    }
+
+    const PixelKernelTable* GetNeonPixelKernels()
+    {
+        static const PixelKernelTable table = { SwizzleRBNeon, PremultiplyNeon, UnpremultiplyNeon, HashTileRowNeon,
+            HashLineRowNeon };
+        return &table;
+    }
+#else
+    const PixelKernelTable* GetNeonPixelKernels()
+    {
+        return nullptr;
+    }
+#endif
+
+} // namespace WebViewToolkit::Detail
@@ -0,0 +1,184 @@
+// ============================================================================
+// WebViewToolkit - Pixel Kernels (SSE2)
+// ============================================================================
+// Baseline on every x64 CPU. Four pixels per iteration.
+// ============================================================================
+
+#include "Core/PixelKernelsInternal.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define WEBVIEW_TOOLKIT_PIXEL_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace WebViewToolkit::Detail
+{
+#ifdef WEBVIEW_TOOLKIT_PIXEL_SSE2
+    namespace
+    {
+        const __m128i kAlphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+
+        void SwizzleRBSse2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            const __m128i keepMask = _mm_set1_epi32(static_cast<int>(0xFF00FF00u));
+            const __m128i lowMask = _mm_set1_epi32(0x000000FF);
+
+            uint32_t i = 0;
+            for (; i + 4 <= pixels; i += 4)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+                __m128i kept = _mm_and_si128(v, keepMask);
+                __m128i c2 = _mm_and_si128(_mm_srli_epi32(v, 16), lowMask);
+                __m128i c0 = _mm_slli_epi32(_mm_and_si128(v, lowMask), 16);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_or_si128(kept, _mm_or_si128(c0, c2)));
+            }
+
+            SwizzleRBScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // Two pixels widened to 16-bit lanes: round(c * a / 255) per lane
+        inline __m128i PremultiplyWide(__m128i wide)
+        {
+            __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(wide, 0xFF), 0xFF);
+            __m128i t = _mm_add_epi16(_mm_mullo_epi16(wide, alpha), _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+        }
+
+        void PremultiplySse2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            uint32_t i = 0;
+            for (; i + 4 <= pixels; i += 4)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+                __m128i lo = PremultiplyWide(_mm_unpacklo_epi8(v, zero));
+                __m128i hi = PremultiplyWide(_mm_unpackhi_epi8(v, zero));
+                __m128i result = _mm_packus_epi16(lo, hi);
+
+                // Alpha passes through unchanged
+                result = _mm_or_si128(_mm_andnot_si128(kAlphaMask, result), _mm_and_si128(v, kAlphaMask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), result);
+            }
+
+            PremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // One pixel in 32-bit lanes: (c * 255 + a / 2) / a, truncated.
+        // The float quotient of these small integers is never rounded across
+        // an integer boundary, so this matches the integer reference exactly.
+        inline __m128i UnpremultiplyPixel(__m128i pixel)
+        {
+            __m128i alpha = _mm_shuffle_epi32(pixel, 0xFF);
+            __m128 numerator = _mm_cvtepi32_ps(_mm_add_epi32(
+                _mm_sub_epi32(_mm_slli_epi32(pixel, 8), pixel),     // c * 255
+                _mm_srli_epi32(alpha, 1)));
+            __m128 quotient = _mm_div_ps(numerator, _mm_cvtepi32_ps(alpha));
+            __m128i result = _mm_cvttps_epi32(quotient);
+
+            // a == 0 divides by zero; force those channels to 0
+            return _mm_andnot_si128(_mm_cmpeq_epi32(alpha, _mm_setzero_si128()), result);
+        }
+
+        void UnpremultiplySse2(const uint8_t* src, uint8_t* dst, uint32_t pixels)
+        {
+            const __m128i zero = _mm_setzero_si128();
+
+            uint32_t i = 0;
+            for (; i + 4 <= pixels; i += 4)
+            {
+                __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+                __m128i lo16 = _mm_unpacklo_epi8(v, zero);
+                __m128i hi16 = _mm_unpackhi_epi8(v, zero);
+
+                __m128i p0 = UnpremultiplyPixel(_mm_unpacklo_epi16(lo16, zero));
+                __m128i p1 = UnpremultiplyPixel(_mm_unpackhi_epi16(lo16, zero));
+                __m128i p2 = UnpremultiplyPixel(_mm_unpacklo_epi16(hi16, zero));
+                __m128i p3 = UnpremultiplyPixel(_mm_unpackhi_epi16(hi16, zero));
+
+                // Saturating packs clamp to 255
+                __m128i result = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+                result = _mm_or_si128(_mm_andnot_si128(kAlphaMask, result), _mm_and_si128(v, kAlphaMask));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), result);
+            }
+
+            UnpremultiplyScalar(src + i * 4, dst + i * 4, pixels - i);
+        }
+
+        // Low 32 bits of each lane product; SSE2 only multiplies even lanes
+        inline __m128i MultiplyLo32(__m128i a, __m128i b)
+        {
+            __m128i even = _mm_mul_epu32(a, b);
+            __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+            return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, 0x08), _mm_shuffle_epi32(odd, 0x08));
+        }
+
+        // Lanes 0-3 and 4-7 each take one of the two four-pixel loads
+        void HashTileRowSse2(const uint8_t* row, uint32_t pixels, uint32_t tileWidth, TileSignature* signatures)
+        {
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(TileHashPrime));
+
+            for (uint32_t x = 0; x < pixels; x += tileWidth, signatures++)
+            {
+                const uint8_t* span = row + static_cast<size_t>(x) * 4;
+                const uint32_t count = pixels - x < tileWidth ? pixels - x : tileWidth;
+
+                __m128i lanesLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(signatures->lanes));
+                __m128i lanesHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(signatures->lanes + 4));
+
+                uint32_t i = 0;
+                for (; i + 8 <= count; i += 8)
+                {
+                    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(span + i * 4));
+                    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(span + i * 4 + 16));
+                    lanesLo = MultiplyLo32(_mm_xor_si128(lanesLo, lo), prime);
+                    lanesHi = MultiplyLo32(_mm_xor_si128(lanesHi, hi), prime);
+                }
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(signatures->lanes), lanesLo);
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(signatures->lanes + 4), lanesHi);
+                HashTileSpanScalar(span + i * 4, i, count - i, *signatures);
+            }
+        }
+
+        // The row lanes as above; every pixel also updates its own column
+        void HashLineRowSse2(const uint8_t* row, uint32_t pixels, uint32_t* columns, TileSignature& rowSignature)
+        {
+            const __m128i prime = _mm_set1_epi32(static_cast<int>(TileHashPrime));
+
+            __m128i lanesLo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowSignature.lanes));
+            __m128i lanesHi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowSignature.lanes + 4));
+
+            uint32_t i = 0;
+            for (; i + 8 <= pixels; i += 8)
+            {
+                __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i * 4));
+                __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i * 4 + 16));
+                lanesLo = MultiplyLo32(_mm_xor_si128(lanesLo, lo), prime);
+                lanesHi = MultiplyLo32(_mm_xor_si128(lanesHi, hi), prime);
+
+                __m128i* column = reinterpret_cast<__m128i*>(columns + i);
+                _mm_storeu_si128(column, MultiplyLo32(_mm_xor_si128(_mm_loadu_si128(column), lo), prime));
+                _mm_storeu_si128(column + 1, MultiplyLo32(_mm_xor_si128(_mm_loadu_si128(column + 1), hi), prime));
+            }
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rowSignature.lanes), lanesLo);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(rowSignature.lanes + 4), lanesHi);
+            HashLineSpanScalar(row + i * 4, i, pixels - i, columns + i, rowSignature);
+        }
+    }
+
+    const PixelKernelTable* GetSse2PixelKernels()
+    {
+        static const PixelKernelTable table = { SwizzleRBSse2, PremultiplySse2, UnpremultiplySse2, HashTileRowSse2,
+            HashLineRowSse2 };
+        return &table;
+    }
+#else
+    const PixelKernelTable* GetSse2PixelKernels()
+    {
+        return nullptr;
+    }
+#endif
+
+} // namespace WebViewToolkit::Detail
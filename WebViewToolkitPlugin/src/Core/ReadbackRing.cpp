@@ -0,0 +1,211 @@
+// ============================================================================
+// WebViewToolkit - Asynchronous Readback Ring Implementation
+// ============================================================================
+
+#include "Core/ReadbackRing.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    ReadbackRing::ReadbackRing(IReadbackDevice* device, uint32_t depth)
+        : m_device(device)
+        , m_depth(std::max<uint32_t>(depth, 1))
+    {
+        m_entries.resize(m_depth);
+    }
+
+    ReadbackRing::~ReadbackRing()
+    {
+        Reset();
+    }
+
+    void ReadbackRing::DestroyEntry(Entry& entry)
+    {
+        if (m_device)
+        {
+            if (entry.slot.stagingTexture)
+            {
+                m_device->DestroyStagingTexture(entry.slot.stagingTexture);
+            }
+            if (entry.query)
+            {
+                m_device->DestroyCompletionQuery(entry.query);
+            }
+        }
+
+        entry = Entry{};
+    }
+
+    void ReadbackRing::Reset()
+    {
+        for (auto& entry : m_entries)
+        {
+            DestroyEntry(entry);
+        }
+
+        m_width = 0;
+        m_height = 0;
+    }
+
+    ReadbackRing::Entry* ReadbackRing::FindSlotForSubmit()
+    {
+        Entry* oldestPending = nullptr;
+
+        for (auto& entry : m_entries)
+        {
+            if (entry.state == SlotState::Free)
+            {
+                return &entry;
+            }
+
+            if (entry.state == SlotState::Pending &&
+                (!oldestPending || entry.slot.sequence < oldestPending->slot.sequence))
+            {
+                oldestPending = &entry;
+            }
+        }
+
+        // Ring is full: reuse the oldest in-flight slot. The GPU serializes the
+        // new copy after the old one, so this drops a frame but never stalls.
+        if (oldestPending)
+        {
+            m_stats.overwritten++;
+        }
+
+        return oldestPending;
+    }
+
+    bool ReadbackRing::Submit(void* sourceTexture, uint32_t width, uint32_t height)
+    {
+        if (!m_device || !sourceTexture || width == 0 || height == 0)
+        {
+            return false;
+        }
+
+        // Slots are keyed by size: a resize invalidates every staging texture
+        if (width != m_width || height != m_height)
+        {
+            Reset();
+            m_width = width;
+            m_height = height;
+        }
+
+        Entry* entry = FindSlotForSubmit();
+        if (!entry)
+        {
+            return false;
+        }
+
+        if (!entry->slot.stagingTexture)
+        {
+            entry->slot.stagingTexture = m_device->CreateStagingTexture(width, height);
+            if (!entry->slot.stagingTexture)
+            {
+                return false;
+            }
+            entry->slot.width = width;
+            entry->slot.height = height;
+            m_stats.stagingCreated++;
+        }
+
+        if (!entry->query)
+        {
+            entry->query = m_device->CreateCompletionQuery();
+            if (!entry->query)
+            {
+                return false;
+            }
+        }
+
+        m_device->CopyToStaging(entry->slot.stagingTexture, sourceTexture, entry->query);
+
+        entry->slot.sequence = m_nextSequence++;
+        entry->state = SlotState::Pending;
+        m_stats.submitted++;
+        return true;
+    }
+
+    const ReadbackSlot* ReadbackRing::AcquireLatest()
+    {
+        if (!m_device)
+        {
+            return nullptr;
+        }
+
+        // Queries retire in submission order: poll from newest to oldest and
+        // stop at the first completed one, anything older is complete too.
+        Entry* newestComplete = nullptr;
+        uint64_t upperBound = UINT64_MAX;
+
+        for (;;)
+        {
+            Entry* candidate = nullptr;
+            for (auto& entry : m_entries)
+            {
+                if (entry.state == SlotState::Acquired)
+                {
+                    // Caller must Release() before acquiring again
+                    return nullptr;
+                }
+
+                if (entry.state == SlotState::Pending && entry.slot.sequence < upperBound &&
+                    (!candidate || entry.slot.sequence > candidate->slot.sequence))
+                {
+                    candidate = &entry;
+                }
+            }
+
+            if (!candidate)
+            {
+                break;
+            }
+
+            if (m_device->IsCopyComplete(candidate->query))
+            {
+                newestComplete = candidate;
+                break;
+            }
+
+            upperBound = candidate->slot.sequence;
+        }
+
+        if (!newestComplete)
+        {
+            return nullptr;
+        }
+
+        // Everything older than the acquired slot is complete but superseded
+        for (auto& entry : m_entries)
+        {
+            if (entry.state == SlotState::Pending && entry.slot.sequence < newestComplete->slot.sequence)
+            {
+                entry.state = SlotState::Free;
+                m_stats.skippedStale++;
+            }
+        }
+
+        newestComplete->state = SlotState::Acquired;
+        m_stats.acquired++;
+        return &newestComplete->slot;
+    }
+
+    void ReadbackRing::Release(const ReadbackSlot* slot)
+    {
+        for (auto& entry : m_entries)
+        {
+            if (&entry.slot == slot && entry.state == SlotState::Acquired)
+            {
+                entry.state = SlotState::Free;
+                return;
+            }
+        }
+    }
+
+    uint32_t ReadbackRing::GetPendingCount() const
+    {
+        return static_cast<uint32_t>(std::count_if(m_entries.begin(), m_entries.end(),
+            [](const Entry& entry) { return entry.state == SlotState::Pending; }));
+    }
+
+} // namespace WebViewToolkit
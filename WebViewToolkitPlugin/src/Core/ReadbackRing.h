@@ -0,0 +1,145 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Asynchronous Readback Ring
+// ============================================================================
+// N-deep ring of CPU-readable staging textures, reused across frames.
+// Each submitted copy is tagged with a completion query; a slot is handed out
+// for mapping only once its copy has retired on the GPU, so the caller never
+// blocks in Map(). The cost is (at least) one frame of latency.
+//
+// The ring is platform-neutral: all device work goes through IReadbackDevice,
+// which the D3D backends implement and the unit tests fake.
+// ============================================================================
+
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Device Abstraction
+    // ========================================================================
+    class IReadbackDevice
+    {
+    public:
+        virtual ~IReadbackDevice() = default;
+
+        /// @brief Create a CPU-readable staging texture
+        /// @return Opaque staging handle, or nullptr on failure
+        virtual void* CreateStagingTexture(uint32_t width, uint32_t height) = 0;
+
+        /// @brief Destroy a staging texture created by CreateStagingTexture
+        virtual void DestroyStagingTexture(void* stagingTexture) = 0;
+
+        /// @brief Create a completion query used to track one copy
+        /// @return Opaque query handle, or nullptr on failure
+        virtual void* CreateCompletionQuery() = 0;
+
+        /// @brief Destroy a query created by CreateCompletionQuery
+        virtual void DestroyCompletionQuery(void* query) = 0;
+
+        /// @brief Record a GPU copy of sourceTexture into stagingTexture, then issue query
+        /// @note sourceTexture may be larger; its top-left part is copied
+        virtual void CopyToStaging(void* stagingTexture, void* sourceTexture, void* query) = 0;
+
+        /// @brief Non-blocking check whether the copy tracked by query has retired
+        virtual bool IsCopyComplete(void* query) = 0;
+    };
+
+    // ========================================================================
+    // Ring Types
+    // ========================================================================
+
+    /// @brief A completed readback, safe to map without stalling
+    struct ReadbackSlot
+    {
+        void* stagingTexture = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        uint64_t sequence = 0;      // Submission order, starting at 1
+    };
+
+    struct ReadbackRingStats
+    {
+        uint64_t submitted = 0;         // Copies recorded
+        uint64_t acquired = 0;          // Slots handed out for mapping
+        uint64_t skippedStale = 0;      // Completed slots superseded by a newer one
+        uint64_t overwritten = 0;       // In-flight slots reused because the ring was full
+        uint64_t stagingCreated = 0;    // Staging textures allocated (grows only on resize)
+    };
+
+    // ========================================================================
+    // Readback Ring
+    // ========================================================================
+    class ReadbackRing
+    {
+    public:
+        static constexpr uint32_t DefaultDepth = 3;
+
+        /// @param device Device used for staging allocation and copies (weak ref)
+        /// @param depth Number of staging textures kept in flight (clamped to >= 1)
+        explicit ReadbackRing(IReadbackDevice* device, uint32_t depth = DefaultDepth);
+        ~ReadbackRing();
+
+        // Non-copyable
+        ReadbackRing(const ReadbackRing&) = delete;
+        ReadbackRing& operator=(const ReadbackRing&) = delete;
+
+        /// @brief Record a copy of sourceTexture into the next free slot
+        /// @note A size change drops every slot and reallocates at the new size.
+        ///       If every slot is in flight, the oldest one is reused.
+        /// @return false if no staging texture could be obtained
+        bool Submit(void* sourceTexture, uint32_t width, uint32_t height);
+
+        /// @brief Get the newest slot whose copy has retired
+        /// @return Slot to map, or nullptr if nothing completed yet.
+        ///         Must be returned with Release() before the next AcquireLatest().
+        const ReadbackSlot* AcquireLatest();
+
+        /// @brief Return a slot obtained from AcquireLatest()
+        void Release(const ReadbackSlot* slot);
+
+        /// @brief Destroy all staging textures and queries
+        void Reset();
+
+        /// @brief Number of copies recorded but not yet acquired or skipped
+        uint32_t GetPendingCount() const;
+
+        /// @brief Sequence of the most recent successful Submit(), 0 if none
+        uint64_t GetLastSubmittedSequence() const { return m_nextSequence - 1; }
+
+        uint32_t GetDepth() const { return m_depth; }
+        uint32_t GetWidth() const { return m_width; }
+        uint32_t GetHeight() const { return m_height; }
+        const ReadbackRingStats& GetStats() const { return m_stats; }
+
+    private:
+        enum class SlotState : uint8_t
+        {
+            Free,
+            Pending,
+            Acquired,
+        };
+
+        struct Entry
+        {
+            ReadbackSlot slot;
+            void* query = nullptr;
+            SlotState state = SlotState::Free;
+        };
+
+        Entry* FindSlotForSubmit();
+        void DestroyEntry(Entry& entry);
+
+        IReadbackDevice* m_device; // Weak ref
+        uint32_t m_depth;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint64_t m_nextSequence = 1;
+
+        std::vector<Entry> m_entries;
+        ReadbackRingStats m_stats;
+    };
+
+} // namespace WebViewToolkit
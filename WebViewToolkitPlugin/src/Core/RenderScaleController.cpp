@@ -0,0 +1,121 @@
+// ============================================================================
+// WebViewToolkit - Dynamic Render Scale Implementation
+// ============================================================================
+
+#include "Core/RenderScaleController.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace WebViewToolkit
+{
+    // Absorbs float error so exact multiples of the step stay put
+    static constexpr float QuantizeEpsilon = 1e-4f;
+
+    uint32_t ScaleDimension(uint32_t size, float scale)
+    {
+        const float scaled = std::round(static_cast<float>(size) * scale);
+        return std::max<uint32_t>(static_cast<uint32_t>(scaled), 1);
+    }
+
+    RenderScaleController::RenderScaleController(const RenderScaleSettings& settings, float initialScale)
+        : m_settings(settings)
+    {
+        m_settings.maxScale = std::clamp(m_settings.maxScale, MinRenderScale, MaxRenderScale);
+        m_settings.minScale = std::clamp(m_settings.minScale, MinRenderScale, m_settings.maxScale);
+        m_settings.step = std::max(m_settings.step, 0.01f);
+        m_settings.windowFrames = std::max<uint32_t>(m_settings.windowFrames, 1);
+        m_settings.calmWindowsToRaise = std::max<uint32_t>(m_settings.calmWindowsToRaise, 1);
+
+        m_scale = QuantizeDown(initialScale);
+        m_budgetScale = m_settings.maxScale;
+    }
+
+    float RenderScaleController::QuantizeDown(float scale) const
+    {
+        const float steps = std::floor(scale / m_settings.step + QuantizeEpsilon);
+        return std::clamp(steps * m_settings.step, m_settings.minScale, m_settings.maxScale);
+    }
+
+    float RenderScaleController::QuantizeUp(float scale) const
+    {
+        const float steps = std::ceil(scale / m_settings.step - QuantizeEpsilon);
+        return std::clamp(steps * m_settings.step, m_settings.minScale, m_settings.maxScale);
+    }
+
+    bool RenderScaleController::OnFrame(float frameTimeMs, float coverage)
+    {
+        m_frames++;
+        m_frameTimeSum += std::max(frameTimeMs, 0.0f);
+        m_maxCoverage = std::max(m_maxCoverage, coverage);
+
+        if (m_frames < m_settings.windowFrames)
+        {
+            return false;
+        }
+
+        const bool changed = EvaluateWindow();
+        m_frames = 0;
+        m_frameTimeSum = 0.0;
+        m_maxCoverage = 0.0f;
+        return changed;
+    }
+
+    bool RenderScaleController::EvaluateWindow()
+    {
+        m_stats.windows++;
+
+        const float budget = m_settings.frameBudgetMs;
+        if (budget > 0.0f)
+        {
+            const float frameTime = static_cast<float>(m_frameTimeSum / m_frames);
+            if (frameTime > budget)
+            {
+                // Pixel cost is quadratic in the scale; always give up at least one step
+                const float fitting = QuantizeDown(m_scale * std::sqrt(budget / frameTime));
+                const float target = std::min(fitting, QuantizeDown(m_scale - m_settings.step));
+                m_budgetScale = std::min(m_budgetScale, target);
+                m_calmWindows = 0;
+            }
+            else if (m_scale >= m_budgetScale && m_budgetScale < m_settings.maxScale)
+            {
+                const float next = QuantizeDown(m_budgetScale + m_settings.step);
+                const float growth = (next * next) / (m_scale * m_scale);
+                if (frameTime * growth < budget * m_settings.raiseHeadroom)
+                {
+                    if (++m_calmWindows >= m_settings.calmWindowsToRaise)
+                    {
+                        m_budgetScale = next;
+                        m_calmWindows = 0;
+                    }
+                }
+                else
+                {
+                    m_calmWindows = 0;
+                }
+            }
+        }
+
+        // Area coverage maps to the square root in side length; round up so
+        // the texture is never sampled below one texel per screen pixel
+        const float coverageScale = QuantizeUp(std::sqrt(std::clamp(m_maxCoverage, 0.0f, 1.0f)));
+
+        const float scale = std::min(m_budgetScale, coverageScale);
+        if (scale == m_scale)
+        {
+            return false;
+        }
+
+        if (scale > m_scale)
+        {
+            m_stats.raised++;
+        }
+        else
+        {
+            m_stats.lowered++;
+        }
+        m_scale = scale;
+        return true;
+    }
+
+} // namespace WebViewToolkit
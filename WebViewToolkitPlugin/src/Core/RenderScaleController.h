@@ -0,0 +1,90 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Dynamic Render Scale
+// ============================================================================
+// Picks the resolution a view renders and captures at, as a fraction of its
+// logical size, from two host-reported inputs per frame:
+//
+//   - frame time against a per-view budget. Cost follows the pixel count, so
+//     an overrun scales the side length by sqrt(budget / frameTime). The
+//     scale is raised one step after a few windows in which the frame time,
+//     extrapolated to that step, would still fit the budget.
+//   - on-screen coverage: displayed pixels over logical pixels. A view shown
+//     at a quarter of its area needs half its resolution; more would only be
+//     filtered away by the sampler.
+//
+// Scales are quantized to fixed steps and decided once per window of frames,
+// so every change is worth the pool and texture recreation it triggers.
+// ============================================================================
+
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Scale Limits
+    // ========================================================================
+    constexpr float MinRenderScale = 0.25f;
+    constexpr float MaxRenderScale = 1.0f;
+
+    struct RenderScaleSettings
+    {
+        float frameBudgetMs = 0.0f;         // 0 = follow coverage only
+        float minScale = MinRenderScale;
+        float maxScale = MaxRenderScale;
+        float step = 0.125f;                // Scales are multiples of this
+        uint32_t windowFrames = 30;         // Frames per decision
+        float raiseHeadroom = 0.9f;         // Raise only if the next step is predicted below budget * this
+        uint32_t calmWindowsToRaise = 3;
+    };
+
+    struct RenderScaleStats
+    {
+        uint64_t raised = 0;
+        uint64_t lowered = 0;
+        uint64_t windows = 0;
+    };
+
+    /// @brief Pixel size of one side at a render scale, never below 1
+    uint32_t ScaleDimension(uint32_t size, float scale);
+
+    // ========================================================================
+    // Scale Controller
+    // ========================================================================
+    class RenderScaleController
+    {
+    public:
+        explicit RenderScaleController(const RenderScaleSettings& settings = RenderScaleSettings{},
+            float initialScale = MaxRenderScale);
+
+        /// @brief Record one host frame
+        /// @param frameTimeMs Time the host attributes to this view's frame
+        /// @param coverage On-screen pixels over the view's logical pixels
+        /// @return true if the scale changed and the view should be resized
+        bool OnFrame(float frameTimeMs, float coverage);
+
+        float GetScale() const { return m_scale; }
+        const RenderScaleSettings& GetSettings() const { return m_settings; }
+        const RenderScaleStats& GetStats() const { return m_stats; }
+
+    private:
+        bool EvaluateWindow();
+        float QuantizeDown(float scale) const;
+        float QuantizeUp(float scale) const;
+
+        RenderScaleSettings m_settings;
+        float m_scale;
+        float m_budgetScale;    // Highest scale the frame budget allows
+
+        // Current window
+        uint32_t m_frames = 0;
+        double m_frameTimeSum = 0.0;
+        float m_maxCoverage = 0.0f;
+
+        uint32_t m_calmWindows = 0;
+
+        RenderScaleStats m_stats;
+    };
+
+} // namespace WebViewToolkit
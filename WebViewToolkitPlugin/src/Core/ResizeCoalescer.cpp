@@ -0,0 +1,77 @@
+// ============================================================================
+// WebViewToolkit - Resize Coalescing Implementation
+// ============================================================================
+
+#include "Core/ResizeCoalescer.h"
+
+namespace WebViewToolkit
+{
+    ResizeCoalescer::ResizeCoalescer(uint32_t intervalMs)
+        : m_intervalMs(intervalMs)
+    {
+    }
+
+    bool ResizeCoalescer::IntervalElapsed(uint64_t nowMs) const
+    {
+        // A clock that went backwards counts as elapsed rather than stalling
+        return !m_hasApplied || nowMs < m_lastApplyMs || nowMs - m_lastApplyMs >= m_intervalMs;
+    }
+
+    void ResizeCoalescer::MarkApplied(uint32_t width, uint32_t height, uint64_t nowMs)
+    {
+        m_hasApplied = true;
+        m_appliedWidth = width;
+        m_appliedHeight = height;
+        m_lastApplyMs = nowMs;
+        m_stats.applied++;
+    }
+
+    bool ResizeCoalescer::Request(uint32_t width, uint32_t height, uint64_t nowMs)
+    {
+        m_stats.requested++;
+
+        if (m_pending)
+        {
+            m_pending = false;
+            m_stats.coalesced++;
+        }
+
+        // Back to the applied size before the trailing edge: nothing to do
+        if (m_hasApplied && width == m_appliedWidth && height == m_appliedHeight)
+        {
+            return false;
+        }
+
+        if (IntervalElapsed(nowMs))
+        {
+            MarkApplied(width, height, nowMs);
+            return true;
+        }
+
+        m_pending = true;
+        m_pendingWidth = width;
+        m_pendingHeight = height;
+        return false;
+    }
+
+    void ResizeCoalescer::ForgetAppliedSize()
+    {
+        m_appliedWidth = 0;
+        m_appliedHeight = 0;
+    }
+
+    bool ResizeCoalescer::Poll(uint64_t nowMs, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        if (!m_pending || !IntervalElapsed(nowMs))
+        {
+            return false;
+        }
+
+        m_pending = false;
+        MarkApplied(m_pendingWidth, m_pendingHeight, nowMs);
+        outWidth = m_pendingWidth;
+        outHeight = m_pendingHeight;
+        return true;
+    }
+
+} // namespace WebViewToolkit
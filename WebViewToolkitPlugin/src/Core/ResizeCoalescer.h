@@ -0,0 +1,74 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Resize Coalescing
+// ============================================================================
+// A resize recreates the capture frame pool and session and resizes the
+// controller, host window and texture. A drag-resize asks for dozens per
+// second, most of them outdated before they could be seen.
+//
+// The coalescer lets a request through at once if the last resize was at
+// least one interval ago (leading edge). Requests within the interval
+// replace one another, and the newest is handed out by Poll once the
+// interval has passed (trailing edge), so the final size of a drag is
+// always applied and at most one resize is applied per interval.
+//
+// Time is passed in by the caller in milliseconds. The coalescer is not
+// thread-safe; its owner serializes calls.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Resize Coalescer
+    // ========================================================================
+    class ResizeCoalescer
+    {
+    public:
+        static constexpr uint32_t DefaultIntervalMs = 100;
+
+        /// @param intervalMs Minimum time between applied resizes, 0 = apply every request
+        explicit ResizeCoalescer(uint32_t intervalMs = DefaultIntervalMs);
+
+        /// @brief Ask for a new size
+        /// @return true if the caller applies it now; otherwise it is pending
+        ///         or already the applied size
+        bool Request(uint32_t width, uint32_t height, uint64_t nowMs);
+
+        /// @brief Take the pending size once the interval has passed
+        /// @return true if the caller applies outWidth x outHeight now
+        bool Poll(uint64_t nowMs, uint32_t& outWidth, uint32_t& outHeight);
+
+        bool HasPending() const { return m_pending; }
+
+        /// @brief The size last handed out could not be applied
+        /// @note A later request for it is then applied instead of dropped
+        void ForgetAppliedSize();
+
+        /// @note Takes effect for the next Request or Poll
+        void SetInterval(uint32_t intervalMs) { m_intervalMs = intervalMs; }
+        uint32_t GetInterval() const { return m_intervalMs; }
+
+        const ResizeStats& GetStats() const { return m_stats; }
+
+    private:
+        bool IntervalElapsed(uint64_t nowMs) const;
+        void MarkApplied(uint32_t width, uint32_t height, uint64_t nowMs);
+
+        uint32_t m_intervalMs;
+
+        bool m_hasApplied = false;
+        uint32_t m_appliedWidth = 0;
+        uint32_t m_appliedHeight = 0;
+        uint64_t m_lastApplyMs = 0;
+
+        bool m_pending = false;
+        uint32_t m_pendingWidth = 0;
+        uint32_t m_pendingHeight = 0;
+
+        ResizeStats m_stats{};
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,76 @@
+// ============================================================================
+// WebViewToolkit - Resize Transaction Implementation
+// ============================================================================
+
+#include "Core/ResizeTransaction.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    ResizeTransaction::ResizeTransaction(uint32_t timeoutMs)
+        : m_timeoutMs(timeoutMs)
+    {
+    }
+
+    void ResizeTransaction::Begin(uint32_t fromWidth, uint32_t fromHeight, uint32_t frameWidth, uint32_t frameHeight,
+        uint64_t nowMs)
+    {
+        if (m_active)
+        {
+            m_stats.superseded++;
+        }
+        else
+        {
+            m_sourceWidth = fromWidth;
+            m_sourceHeight = fromHeight;
+        }
+
+        m_active = true;
+        m_startMs = nowMs;
+        m_frameWidth = frameWidth;
+        m_frameHeight = frameHeight;
+    }
+
+    ResizeFrameAction ResizeTransaction::OnFrame(uint32_t frameWidth, uint32_t frameHeight, uint64_t nowMs, bool canStretch)
+    {
+        if (!m_active)
+        {
+            return ResizeFrameAction::Present;
+        }
+
+        if (frameWidth == m_frameWidth && frameHeight == m_frameHeight)
+        {
+            m_stats.completed++;
+            End(nowMs);
+            return ResizeFrameAction::Present;
+        }
+
+        // A clock that went backwards counts as timed out rather than holding forever
+        if (nowMs < m_startMs || nowMs - m_startMs >= m_timeoutMs)
+        {
+            m_stats.timedOut++;
+            m_active = false;
+            return ResizeFrameAction::Present;
+        }
+
+        if (canStretch && m_sourceWidth != 0 && m_sourceHeight != 0)
+        {
+            m_stats.stretchedFrames++;
+            return ResizeFrameAction::Stretch;
+        }
+
+        m_stats.heldFrames++;
+        return ResizeFrameAction::Hold;
+    }
+
+    void ResizeTransaction::End(uint64_t nowMs)
+    {
+        m_active = false;
+
+        const uint64_t latency = nowMs > m_startMs ? nowMs - m_startMs : 0;
+        m_stats.lastLatencyMs = static_cast<uint32_t>(std::min<uint64_t>(latency, UINT32_MAX));
+        m_stats.maxLatencyMs = std::max(m_stats.maxLatencyMs, m_stats.lastLatencyMs);
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,89 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Resize Transaction
+// ============================================================================
+// After a resize the capture keeps delivering frames of the old window size
+// for a few frames until the new size reaches the compositor. Copied as they
+// are, they show the old layout cropped or padded to the new size. Skipped,
+// they leave the view frozen, or black if it has just switched textures.
+//
+// A transaction runs from a resize to the first frame captured at the new
+// window size. Frames before that either stretch the content they hold (the
+// size presented before the resize) over the new size, or are held back so
+// the previous frame stays on screen when the backend cannot scale. A frame
+// that never comes is given up on after a timeout, after which frames are
+// presented as they are.
+//
+// Frame sizes are passed in by the caller, time in milliseconds. Not
+// thread-safe; the owning capture serializes calls.
+// ============================================================================
+
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    /// @brief What to do with a captured frame
+    enum class ResizeFrameAction
+    {
+        Present,    // Copy as usual
+        Stretch,    // Scale the source content over the new content size
+        Hold,       // Skip; the previous frame stays on screen
+    };
+
+    struct ResizeTransactionStats
+    {
+        uint64_t completed = 0;         // Transactions ended by a frame of the new size
+        uint64_t superseded = 0;        // Transactions replaced by a later resize
+        uint64_t timedOut = 0;          // Transactions given up on
+        uint64_t stretchedFrames = 0;
+        uint64_t heldFrames = 0;
+        uint32_t lastLatencyMs = 0;     // Resize to first frame of the new size, last completed
+        uint32_t maxLatencyMs = 0;
+    };
+
+    // ========================================================================
+    // Transaction
+    // ========================================================================
+    class ResizeTransaction
+    {
+    public:
+        static constexpr uint32_t DefaultTimeoutMs = 500;
+
+        explicit ResizeTransaction(uint32_t timeoutMs = DefaultTimeoutMs);
+
+        /// @brief A resize was applied
+        /// @param fromWidth, fromHeight Content size of the frames presented so far,
+        ///        0 if none; ignored while a transaction is active, whose frames still show it
+        /// @param frameWidth, frameHeight Frame size once the resize has taken effect
+        void Begin(uint32_t fromWidth, uint32_t fromHeight, uint32_t frameWidth, uint32_t frameHeight, uint64_t nowMs);
+
+        /// @brief Decide on a captured frame
+        /// @param canStretch Whether the frame can be scaled into the destination
+        ResizeFrameAction OnFrame(uint32_t frameWidth, uint32_t frameHeight, uint64_t nowMs, bool canStretch);
+
+        /// @brief Drop the transaction, e.g. when the capture is recreated
+        void Cancel() { m_active = false; }
+
+        bool IsActive() const { return m_active; }
+
+        /// @brief Part of a stretched frame holding content: the size before the transaction
+        uint32_t GetSourceWidth() const { return m_sourceWidth; }
+        uint32_t GetSourceHeight() const { return m_sourceHeight; }
+
+        const ResizeTransactionStats& GetStats() const { return m_stats; }
+
+    private:
+        void End(uint64_t nowMs);
+
+        uint32_t m_timeoutMs;
+        bool m_active = false;
+        uint64_t m_startMs = 0;         // Latest resize
+        uint32_t m_sourceWidth = 0;
+        uint32_t m_sourceHeight = 0;
+        uint32_t m_frameWidth = 0;
+        uint32_t m_frameHeight = 0;
+        ResizeTransactionStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,235 @@
+// ============================================================================
+// WebViewToolkit - Scroll Detection Implementation
+// ============================================================================
+
+#include "Core/ScrollDetector.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    namespace
+    {
+        // The eight lanes of a whole-row signature folded with 64-bit FNV-1a
+        uint64_t FoldSignature(const TileSignature& signature)
+        {
+            uint64_t hash = 0xCBF29CE484222325ull;
+            for (uint32_t lane : signature.lanes)
+            {
+                hash = (hash ^ lane) * 0x100000001B3ull;
+            }
+            return hash;
+        }
+    }
+
+    ScrollDetector::ScrollDetector(uint32_t minShiftedLines)
+        : m_minShiftedLines(std::max<uint32_t>(minShiftedLines, 1))
+    {
+    }
+
+    void ScrollDetector::Reset()
+    {
+        m_hasPrevious = false;
+    }
+
+    bool ScrollDetector::Detect(const uint8_t* pixels, size_t pitch, uint32_t width, uint32_t height)
+    {
+        m_moves.clear();
+        m_patches.clear();
+        m_shiftX = 0;
+        m_shiftY = 0;
+        m_shiftedLines = 0;
+        m_patchArea = 0;
+
+        if (!pixels || width == 0 || height == 0 || pitch < static_cast<size_t>(width) * 4)
+        {
+            Reset();
+            return false;
+        }
+
+        if (width != m_width || height != m_height)
+        {
+            m_width = width;
+            m_height = height;
+            m_hasPrevious = false;
+
+            const size_t lines = std::max(width, height);
+            m_rows.resize(height);
+            m_previousRows.resize(height);
+            m_columns.resize(width);
+            m_previousColumns.resize(width);
+            m_columnHashes.resize(width);
+            m_index.reserve(lines);
+            m_votes.resize(lines * 2 + 1);
+
+            // Moves and patches alternate at worst
+            m_moves.reserve(lines / 2 + 1);
+            m_patches.reserve(lines / 2 + 1);
+        }
+
+        HashFrame(pixels, pitch);
+
+        bool found = false;
+        if (m_hasPrevious)
+        {
+            if (const int32_t shift = FindShift(m_rows, m_previousRows))
+            {
+                m_shiftY = shift;
+                BuildPlan(m_rows, m_previousRows, shift, true);
+                found = true;
+            }
+            else if (const int32_t columnShift = FindShift(m_columns, m_previousColumns))
+            {
+                m_shiftX = columnShift;
+                BuildPlan(m_columns, m_previousColumns, columnShift, false);
+                found = true;
+            }
+        }
+
+        m_rows.swap(m_previousRows);
+        m_columns.swap(m_previousColumns);
+        m_hasPrevious = true;
+        return found;
+    }
+
+    void ScrollDetector::HashFrame(const uint8_t* pixels, size_t pitch)
+    {
+        // Every column starts from the same seed, so equal content hashes
+        // equally at any x
+        std::fill(m_columnHashes.begin(), m_columnHashes.end(), TileSignature::Seed().lanes[0]);
+
+        const uint8_t* row = pixels;
+        for (uint32_t y = 0; y < m_height; y++, row += pitch)
+        {
+            TileSignature rowSignature = TileSignature::Seed();
+            HashLineRow(row, m_width, m_columnHashes.data(), rowSignature);
+            m_rows[y] = FoldSignature(rowSignature);
+        }
+
+        std::copy(m_columnHashes.begin(), m_columnHashes.end(), m_columns.begin());
+    }
+
+    int32_t ScrollDetector::FindShift(const std::vector<uint64_t>& current, const std::vector<uint64_t>& previous)
+    {
+        const auto count = static_cast<int32_t>(current.size());
+
+        uint32_t changed = 0;
+        for (int32_t i = 0; i < count; i++)
+        {
+            changed += current[i] != previous[i] ? 1 : 0;
+        }
+        if (changed < m_minShiftedLines)
+        {
+            return 0;
+        }
+
+        // Each changed line whose content occurs exactly once in the previous
+        // frame votes for the offset it moved by. Repeated lines - blank rows,
+        // solid backgrounds - match anywhere and cannot anchor an offset.
+        m_index.clear();
+        for (int32_t i = 0; i < count; i++)
+        {
+            m_index.push_back(LineIndex{ previous[i], i });
+        }
+        std::sort(m_index.begin(), m_index.end(),
+            [](const LineIndex& a, const LineIndex& b) { return a.signature < b.signature; });
+
+        std::fill(m_votes.begin(), m_votes.begin() + count * 2 + 1, 0u);
+        const auto bySignature = [](const LineIndex& entry, uint64_t signature) { return entry.signature < signature; };
+        for (int32_t i = 0; i < count; i++)
+        {
+            if (current[i] == previous[i])
+            {
+                continue;
+            }
+
+            auto match = std::lower_bound(m_index.begin(), m_index.end(), current[i], bySignature);
+            if (match == m_index.end() || match->signature != current[i] ||
+                (match + 1 != m_index.end() && (match + 1)->signature == current[i]))
+            {
+                continue;
+            }
+            m_votes[static_cast<size_t>(i - match->line + count)]++;
+        }
+
+        const auto best = std::max_element(m_votes.begin(), m_votes.begin() + count * 2 + 1);
+        if (*best == 0)
+        {
+            return 0;
+        }
+        const int32_t shift = static_cast<int32_t>(best - m_votes.begin()) - count;
+
+        // The anchors only proposed the offset: count every changed line it explains
+        uint32_t explained = 0;
+        for (int32_t i = std::max(0, shift); i < std::min(count, count + shift); i++)
+        {
+            if (current[i] != previous[i] && current[i] == previous[i - shift])
+            {
+                explained++;
+            }
+        }
+        if (explained < m_minShiftedLines || explained * 2 < changed)
+        {
+            return 0;
+        }
+
+        m_shiftedLines = explained;
+        return shift;
+    }
+
+    void ScrollDetector::BuildPlan(const std::vector<uint64_t>& current, const std::vector<uint64_t>& previous,
+        int32_t shift, bool vertical)
+    {
+        enum class Line { Moved, Patched, Untouched };
+
+        const auto count = static_cast<int32_t>(current.size());
+        const auto span = static_cast<int32_t>(vertical ? m_width : m_height);
+        const auto classify = [&](int32_t i)
+        {
+            // A line that matches both ways is part of the move, so blank lines
+            // inside the scrolled content do not split it into many small copies
+            const int32_t from = i - shift;
+            if (from >= 0 && from < count && current[i] == previous[from])
+            {
+                return Line::Moved;
+            }
+            return current[i] == previous[i] ? Line::Untouched : Line::Patched;
+        };
+        const auto lineRect = [&](int32_t first, int32_t last)
+        {
+            return vertical ? PixelRect{ 0, first, span, last } : PixelRect{ first, 0, last, span };
+        };
+
+        for (int32_t i = 0; i < count;)
+        {
+            const Line kind = classify(i);
+            const int32_t first = i;
+            while (i < count && classify(i) == kind)
+            {
+                i++;
+            }
+
+            if (kind == Line::Moved)
+            {
+                ScrollMove move;
+                move.source = lineRect(first - shift, i - shift);
+                move.dx = vertical ? 0 : shift;
+                move.dy = vertical ? shift : 0;
+                m_moves.push_back(move);
+            }
+            else if (kind == Line::Patched)
+            {
+                m_patches.push_back(lineRect(first, i));
+                m_patchArea += static_cast<int64_t>(i - first) * span;
+            }
+        }
+
+        // Like memmove: moving towards higher lines starts with the last band,
+        // so no band is overwritten before it has been read
+        if (shift > 0)
+        {
+            std::reverse(m_moves.begin(), m_moves.end());
+        }
+    }
+
+} // namespace WebViewToolkit
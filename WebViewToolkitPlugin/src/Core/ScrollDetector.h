@@ -0,0 +1,105 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Scroll Detection
+// ============================================================================
+// Scrolling invalidates the whole viewport although most of it only moved.
+// One pass of the SIMD line-signature kernel gives every row and every
+// column of a frame a signature; a frame whose lines match the previous
+// frame's lines at one constant offset is a pure vertical (rows) or
+// horizontal (columns) scroll. The update then becomes GPU copies of the
+// shifted bands plus uploads of the lines that did not just move - the
+// exposed strip, and anything that changed besides the scroll.
+// ============================================================================
+
+#include "Core/PixelKernels.h"
+#include "WebViewToolkit/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    /// @brief Copy of a band of the previous frame to its place in the new one
+    struct ScrollMove
+    {
+        PixelRect source;   // In the previous frame
+        int32_t dx = 0;     // Destination is source offset by (dx, dy)
+        int32_t dy = 0;
+    };
+
+    class ScrollDetector
+    {
+    public:
+        static constexpr uint32_t DefaultMinShiftedLines = 16;
+
+        /// @param minShiftedLines Changed lines a shift must explain before it is reported
+        explicit ScrollDetector(uint32_t minShiftedLines = DefaultMinShiftedLines);
+
+        /// @brief Hash a 32-bit-per-pixel frame and look for a shift of the previous one
+        /// @return true if the frame is the previous one scrolled along one axis and
+        ///         the shift explains at least half of the changed lines. Moves and
+        ///         patches are then valid until the next call.
+        /// @note Every frame written to the destination must pass through here
+        ///       (or be followed by Reset()), the moves read the previous one
+        bool Detect(const uint8_t* pixels, size_t pitch, uint32_t width, uint32_t height);
+
+        /// @brief Forget the previous frame, the next Detect() finds no shift
+        void Reset();
+
+        /// @brief Content offset of the last shift: a pixel at (x, y) moved to (x + dx, y + dy)
+        int32_t GetShiftX() const { return m_shiftX; }
+        int32_t GetShiftY() const { return m_shiftY; }
+
+        /// @brief Bands to copy, in an order where no move reads lines an earlier one wrote
+        const std::vector<ScrollMove>& GetMoves() const { return m_moves; }
+
+        /// @brief Areas to upload from the new frame once the moves are done
+        const std::vector<PixelRect>& GetPatches() const { return m_patches; }
+
+        /// @brief Lines that changed and are covered by the moves
+        uint32_t GetShiftedLineCount() const { return m_shiftedLines; }
+
+        /// @brief Pixels the patches upload
+        int64_t GetPatchArea() const { return m_patchArea; }
+
+    private:
+        struct LineIndex
+        {
+            uint64_t signature;
+            int32_t line;
+        };
+
+        void HashFrame(const uint8_t* pixels, size_t pitch);
+
+        /// @return Offset along the axis, 0 if none explains enough changed lines
+        int32_t FindShift(const std::vector<uint64_t>& current, const std::vector<uint64_t>& previous);
+
+        /// @brief Split the axis into moved, patched and untouched bands
+        void BuildPlan(const std::vector<uint64_t>& current, const std::vector<uint64_t>& previous,
+            int32_t shift, bool vertical);
+
+        uint32_t m_minShiftedLines;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        bool m_hasPrevious = false;
+
+        int32_t m_shiftX = 0;
+        int32_t m_shiftY = 0;
+        uint32_t m_shiftedLines = 0;
+        int64_t m_patchArea = 0;
+
+        // Storage reused across frames
+        std::vector<uint64_t> m_rows;
+        std::vector<uint64_t> m_previousRows;
+        std::vector<uint64_t> m_columns;
+        std::vector<uint64_t> m_previousColumns;
+        std::vector<uint32_t> m_columnHashes;       // Kernel state while a frame is hashed
+        std::vector<LineIndex> m_index;             // Previous lines sorted by signature
+        std::vector<uint32_t> m_votes;              // Per offset, indexed by offset + line count
+        std::vector<ScrollMove> m_moves;
+        std::vector<PixelRect> m_patches;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,197 @@
+// ============================================================================
+// WebViewToolkit - Shared Surface Synchronization Implementation
+// ============================================================================
+
+#include "Core/SharedSurfaceSync.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    SharedSurfaceSync::SharedSurfaceSync(ISharedSurfaceDevice* device, uint32_t depth)
+        : m_device(device)
+        , m_depth(std::max<uint32_t>(depth, 1))
+    {
+        m_entries.resize(m_depth);
+    }
+
+    SharedSurfaceSync::~SharedSurfaceSync()
+    {
+        Reset();
+    }
+
+    void SharedSurfaceSync::Reset()
+    {
+        for (auto& entry : m_entries)
+        {
+            if (entry.surface && m_device)
+            {
+                m_device->DestroySharedSurface(entry.surface);
+            }
+            entry = Entry{};
+        }
+
+        m_width = 0;
+        m_height = 0;
+    }
+
+    void SharedSurfaceSync::RetireReads()
+    {
+        uint64_t completed = 0;
+        bool polled = false;
+
+        for (auto& entry : m_entries)
+        {
+            if (entry.state != SurfaceState::Reading)
+            {
+                continue;
+            }
+
+            if (!polled)
+            {
+                completed = m_device->GetConsumerCompletedValue();
+                polled = true;
+            }
+
+            if (entry.consumerValue <= completed)
+            {
+                entry.state = SurfaceState::Free;
+            }
+        }
+    }
+
+    SharedSurfaceSync::Entry* SharedSurfaceSync::FindEntryForPublish()
+    {
+        Entry* oldestPublished = nullptr;
+        Entry* oldestReading = nullptr;
+
+        for (auto& entry : m_entries)
+        {
+            switch (entry.state)
+            {
+            case SurfaceState::Free:
+                return &entry;
+            case SurfaceState::Published:
+                if (!oldestPublished || entry.frame < oldestPublished->frame)
+                {
+                    oldestPublished = &entry;
+                }
+                break;
+            case SurfaceState::Reading:
+                if (!oldestReading || entry.consumerValue < oldestReading->consumerValue)
+                {
+                    oldestReading = &entry;
+                }
+                break;
+            }
+        }
+
+        // Overwriting an unconsumed frame is ordered on the producer queue alone
+        if (oldestPublished)
+        {
+            m_stats.dropped++;
+            return oldestPublished;
+        }
+
+        // Every surface is being read: let the GPU hold the copy until the read retires
+        if (oldestReading)
+        {
+            m_device->ProducerWait(oldestReading->consumerValue);
+            m_stats.producerWaits++;
+        }
+
+        return oldestReading;
+    }
+
+    bool SharedSurfaceSync::Publish(void* sourceTexture, uint32_t width, uint32_t height, FlipMode flipMode)
+    {
+        if (!m_device || !sourceTexture || width == 0 || height == 0)
+        {
+            return false;
+        }
+
+        // Surfaces are keyed by size: a resize invalidates all of them
+        if (width != m_width || height != m_height)
+        {
+            Reset();
+            m_width = width;
+            m_height = height;
+        }
+
+        RetireReads();
+
+        Entry* entry = FindEntryForPublish();
+        if (!entry)
+        {
+            return false;
+        }
+
+        if (!entry->surface)
+        {
+            entry->surface = m_device->CreateSharedSurface(width, height);
+            if (!entry->surface)
+            {
+                entry->state = SurfaceState::Free;
+                return false;
+            }
+            m_stats.surfacesCreated++;
+        }
+
+        m_device->ProducerCopy(entry->surface, sourceTexture, flipMode);
+        m_device->ProducerSignal(++m_producerValue);
+
+        entry->state = SurfaceState::Published;
+        entry->frame = m_nextFrame++;
+        entry->producerValue = m_producerValue;
+        m_stats.published++;
+        return true;
+    }
+
+    bool SharedSurfaceSync::ConsumeLatest(void* destinationTexture)
+    {
+        if (!m_device || !destinationTexture)
+        {
+            return false;
+        }
+
+        Entry* newest = nullptr;
+        for (auto& entry : m_entries)
+        {
+            if (entry.state == SurfaceState::Published && (!newest || entry.frame > newest->frame))
+            {
+                newest = &entry;
+            }
+        }
+
+        if (!newest)
+        {
+            return false;
+        }
+
+        // Older unconsumed frames will never be shown
+        for (auto& entry : m_entries)
+        {
+            if (entry.state == SurfaceState::Published && &entry != newest)
+            {
+                entry.state = SurfaceState::Free;
+                m_stats.dropped++;
+            }
+        }
+
+        m_device->ConsumerWait(newest->producerValue);
+        m_device->ConsumerCopy(newest->surface, destinationTexture);
+        m_device->ConsumerSignal(++m_consumerValue);
+
+        newest->state = SurfaceState::Reading;
+        newest->consumerValue = m_consumerValue;
+        m_stats.consumed++;
+        return true;
+    }
+
+    bool SharedSurfaceSync::HasPendingFrame() const
+    {
+        return std::any_of(m_entries.begin(), m_entries.end(),
+            [](const Entry& entry) { return entry.state == SurfaceState::Published; });
+    }
+
+} // namespace WebViewToolkit
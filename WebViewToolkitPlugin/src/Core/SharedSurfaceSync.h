@@ -0,0 +1,155 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Shared Surface Synchronization
+// ============================================================================
+// GPU-only frame transfer between two devices: the producer (capture device)
+// copies each frame into a surface both devices can access, the consumer
+// (render device) copies it into the destination. Two fence timelines order
+// the work without any CPU wait:
+//
+//   producer: [wait consumer >= C] copy -> signal P
+//   consumer: wait producer >= P -> copy -> signal C
+//
+// A small ring of surfaces lets the producer write frame N+1 while the
+// consumer still reads frame N. This class only tracks surface states and
+// fence values; all device work goes through ISharedSurfaceDevice, which the
+// DX12 backend implements and the unit tests provide in software.
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Device Abstraction
+    // ========================================================================
+    class ISharedSurfaceDevice
+    {
+    public:
+        virtual ~ISharedSurfaceDevice() = default;
+
+        /// @brief Create a surface both devices can access
+        /// @return Opaque surface handle, or nullptr on failure
+        virtual void* CreateSharedSurface(uint32_t width, uint32_t height) = 0;
+
+        /// @brief Destroy a surface created by CreateSharedSurface
+        virtual void DestroySharedSurface(void* surface) = 0;
+
+        // Producer queue (capture device)
+
+        /// @brief Make later producer work wait until the consumer timeline reaches value
+        virtual void ProducerWait(uint64_t consumerValue) = 0;
+
+        /// @brief Record a copy of sourceTexture into surface, applying flipMode
+        /// @note sourceTexture may be larger; its top-left part is copied
+        virtual void ProducerCopy(void* surface, void* sourceTexture, FlipMode flipMode) = 0;
+
+        /// @brief Advance the producer timeline to value once prior producer work retires
+        virtual void ProducerSignal(uint64_t producerValue) = 0;
+
+        // Consumer queue (render device)
+
+        /// @brief Make later consumer work wait until the producer timeline reaches value
+        virtual void ConsumerWait(uint64_t producerValue) = 0;
+
+        /// @brief Record a copy of surface into destinationTexture
+        virtual void ConsumerCopy(void* surface, void* destinationTexture) = 0;
+
+        /// @brief Advance the consumer timeline to value once prior consumer work retires
+        virtual void ConsumerSignal(uint64_t consumerValue) = 0;
+
+        /// @brief Non-blocking read of the consumer timeline
+        virtual uint64_t GetConsumerCompletedValue() = 0;
+    };
+
+    // ========================================================================
+    // Sync Types
+    // ========================================================================
+    struct SharedSurfaceStats
+    {
+        uint64_t published = 0;         // Frames copied into a surface
+        uint64_t consumed = 0;          // Frames copied out to a destination
+        uint64_t dropped = 0;           // Published frames superseded before being consumed
+        uint64_t producerWaits = 0;     // Publishes queued behind a consumer read (GPU wait)
+        uint64_t surfacesCreated = 0;   // Grows only on resize
+    };
+
+    // ========================================================================
+    // Shared Surface Sync
+    // ========================================================================
+    class SharedSurfaceSync
+    {
+    public:
+        static constexpr uint32_t DefaultDepth = 2;
+
+        /// @param device Device pair used for surfaces, copies and fences (weak ref)
+        /// @param depth Number of shared surfaces (clamped to >= 1)
+        explicit SharedSurfaceSync(ISharedSurfaceDevice* device, uint32_t depth = DefaultDepth);
+        ~SharedSurfaceSync();
+
+        // Non-copyable
+        SharedSurfaceSync(const SharedSurfaceSync&) = delete;
+        SharedSurfaceSync& operator=(const SharedSurfaceSync&) = delete;
+
+        /// @brief Producer side: copy sourceTexture into a surface
+        /// @note Prefers a surface nobody reads; otherwise reuses an unconsumed one
+        ///       (dropping its frame) or, as a last resort, queues behind the
+        ///       consumer's read on the GPU. Never blocks the CPU.
+        /// @return false if no surface could be created
+        bool Publish(void* sourceTexture, uint32_t width, uint32_t height, FlipMode flipMode);
+
+        /// @brief Consumer side: copy the newest published frame into destinationTexture
+        /// @return false if nothing was published since the last call
+        bool ConsumeLatest(void* destinationTexture);
+
+        /// @brief Destroy all surfaces. The caller must have drained both devices.
+        void Reset();
+
+        /// @brief Whether a published frame is waiting for ConsumeLatest()
+        bool HasPendingFrame() const;
+
+        uint32_t GetDepth() const { return m_depth; }
+        uint32_t GetWidth() const { return m_width; }
+        uint32_t GetHeight() const { return m_height; }
+        uint64_t GetProducerValue() const { return m_producerValue; }
+        uint64_t GetConsumerValue() const { return m_consumerValue; }
+        const SharedSurfaceStats& GetStats() const { return m_stats; }
+
+    private:
+        enum class SurfaceState : uint8_t
+        {
+            Free,       // Not read by the consumer, contents unneeded
+            Published,  // Holds an unconsumed frame
+            Reading,    // Consumer copy in flight until consumerValue completes
+        };
+
+        struct Entry
+        {
+            void* surface = nullptr;
+            SurfaceState state = SurfaceState::Free;
+            uint64_t frame = 0;             // Publish order
+            uint64_t producerValue = 0;     // Producer timeline value after the copy in
+            uint64_t consumerValue = 0;     // Consumer timeline value after the copy out
+        };
+
+        void RetireReads();
+        Entry* FindEntryForPublish();
+
+        ISharedSurfaceDevice* m_device; // Weak ref
+        uint32_t m_depth;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+
+        uint64_t m_nextFrame = 1;
+        uint64_t m_producerValue = 0;
+        uint64_t m_consumerValue = 0;
+
+        std::vector<Entry> m_entries;
+        SharedSurfaceStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,196 @@
+// ============================================================================
+// WebViewToolkit - Shared Texture Pool Implementation
+// ============================================================================
+
+#include "Core/SharedTexturePool.h"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace WebViewToolkit
+{
+    SharedTexturePool::SharedTexturePool(ISharedTextureFactory* factory, const SharedTexturePoolSettings& settings)
+        : m_factory(factory)
+        , m_settings(settings)
+    {
+        m_settings.bucket = std::max<uint32_t>(m_settings.bucket, 1);
+        m_settings.largeBucket = std::max<uint32_t>(m_settings.largeBucket, 1);
+    }
+
+    SharedTexturePool::~SharedTexturePool()
+    {
+        Trim();
+    }
+
+    uint32_t SharedTexturePool::RoundUp(uint32_t size) const
+    {
+        const uint32_t bucket = size > m_settings.largeThreshold ? m_settings.largeBucket : m_settings.bucket;
+        const uint32_t buckets = (std::max<uint32_t>(size, 1) + bucket - 1) / bucket;
+        return buckets * bucket;
+    }
+
+    bool SharedTexturePool::Fits(const Allocation& allocation, uint32_t width, uint32_t height) const
+    {
+        if (width > allocation.width || height > allocation.height)
+        {
+            return false;
+        }
+
+        // Within the slack of the size it would be allocated at
+        const uint32_t roundedWidth = RoundUp(width);
+        const uint32_t roundedHeight = RoundUp(height);
+        return allocation.width <= roundedWidth + m_settings.shrinkSlack &&
+            allocation.height <= roundedHeight + m_settings.shrinkSlack;
+    }
+
+    SharedTexturePool::Allocation* SharedTexturePool::FindLive(void* texture)
+    {
+        for (auto& allocation : m_live)
+        {
+            if (allocation.texture == texture)
+            {
+                return &allocation;
+            }
+        }
+        return nullptr;
+    }
+
+    // ========================================================================
+    // Acquire / Release
+    // ========================================================================
+
+    void* SharedTexturePool::Acquire(uint32_t width, uint32_t height)
+    {
+        // Smallest idle texture that fits; the most recently released on ties
+        size_t best = m_idle.size();
+        for (size_t i = 0; i < m_idle.size(); ++i)
+        {
+            if (Fits(m_idle[i], width, height) &&
+                (best == m_idle.size() || m_idle[i].Bytes() <= m_idle[best].Bytes()))
+            {
+                best = i;
+            }
+        }
+
+        if (best != m_idle.size())
+        {
+            const Allocation allocation = m_idle[best];
+            m_idle.erase(m_idle.begin() + static_cast<ptrdiff_t>(best));
+            m_live.push_back(allocation);
+
+            m_stats.reused++;
+            m_stats.idleBytes -= allocation.Bytes();
+            m_stats.idleCount--;
+            m_stats.liveCount++;
+            return allocation.texture;
+        }
+
+        if (!m_factory)
+        {
+            return nullptr;
+        }
+
+        Allocation allocation;
+        allocation.width = RoundUp(width);
+        allocation.height = RoundUp(height);
+        allocation.texture = m_factory->CreateTexture(allocation.width, allocation.height);
+        if (!allocation.texture && !m_idle.empty())
+        {
+            // Possibly out of memory: give the idle textures back and retry once
+            Trim();
+            allocation.texture = m_factory->CreateTexture(allocation.width, allocation.height);
+        }
+        if (!allocation.texture)
+        {
+            return nullptr;
+        }
+
+        m_live.push_back(allocation);
+        m_stats.created++;
+        m_stats.liveCount++;
+        return allocation.texture;
+    }
+
+    bool SharedTexturePool::ResizeInPlace(void* texture, uint32_t width, uint32_t height)
+    {
+        const Allocation* allocation = FindLive(texture);
+        if (!allocation || !Fits(*allocation, width, height))
+        {
+            return false;
+        }
+
+        m_stats.resizedInPlace++;
+        return true;
+    }
+
+    bool SharedTexturePool::Release(void* texture)
+    {
+        Allocation* allocation = FindLive(texture);
+        if (!allocation)
+        {
+            return false;
+        }
+
+        m_idle.push_back(*allocation);
+        *allocation = m_live.back();
+        m_live.pop_back();
+
+        m_stats.released++;
+        m_stats.idleBytes += m_idle.back().Bytes();
+        m_stats.idleCount++;
+        m_stats.liveCount--;
+
+        EvictIdle(m_settings.maxIdleBytes);
+        return true;
+    }
+
+    bool SharedTexturePool::GetAllocatedSize(void* texture, uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        for (const auto& allocation : m_live)
+        {
+            if (allocation.texture == texture)
+            {
+                outWidth = allocation.width;
+                outHeight = allocation.height;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // ========================================================================
+    // Eviction
+    // ========================================================================
+
+    void SharedTexturePool::EvictIdle(uint64_t maxBytes)
+    {
+        size_t evicted = 0;
+        while (evicted < m_idle.size() && m_stats.idleBytes > maxBytes)
+        {
+            const Allocation& allocation = m_idle[evicted++];
+            if (m_factory)
+            {
+                m_factory->DestroyTexture(allocation.texture);
+            }
+
+            m_stats.destroyed++;
+            m_stats.idleBytes -= allocation.Bytes();
+            m_stats.idleCount--;
+        }
+
+        m_idle.erase(m_idle.begin(), m_idle.begin() + static_cast<ptrdiff_t>(evicted));
+    }
+
+    void SharedTexturePool::Trim()
+    {
+        EvictIdle(0);
+    }
+
+    void SharedTexturePool::Reset()
+    {
+        Trim();
+        m_live.clear();
+        m_stats.liveCount = 0;
+    }
+
+} // namespace WebViewToolkit
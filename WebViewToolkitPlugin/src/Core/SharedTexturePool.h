@@ -0,0 +1,136 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Shared Texture Pool
+// ============================================================================
+// Shared textures are allocated in size buckets (multiples of 64 texels, of
+// 128 above 1024) and returned to the pool instead of being destroyed. A view
+// whose size animates keeps its texture while the new size fits it, and takes
+// an idle one when it does not; only the top-left part the view was last
+// sized for holds content.
+//
+// A texture is kept (or reused) only while it is at most ShrinkSlack texels
+// larger than the rounded size in either dimension, so shrinking views give
+// memory back but a size oscillating around a bucket edge does not
+// reallocate. Idle textures beyond a byte cap are destroyed oldest first.
+//
+// The pool is platform-neutral: all device work goes through
+// ISharedTextureFactory, which the D3D backends implement and the unit tests
+// fake. It is not thread-safe; the backend serializes calls.
+// ============================================================================
+
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Device Abstraction
+    // ========================================================================
+    class ISharedTextureFactory
+    {
+    public:
+        virtual ~ISharedTextureFactory() = default;
+
+        /// @brief Create a shared texture of exactly this size
+        /// @return Opaque texture handle, or nullptr on failure
+        virtual void* CreateTexture(uint32_t width, uint32_t height) = 0;
+
+        /// @brief Destroy a texture created by CreateTexture
+        virtual void DestroyTexture(void* texture) = 0;
+    };
+
+    // ========================================================================
+    // Pool Types
+    // ========================================================================
+
+    struct SharedTexturePoolSettings
+    {
+        uint32_t bucket = 64;                   // Allocation granularity
+        uint32_t largeBucket = 128;             // Granularity of dimensions above largeThreshold
+        uint32_t largeThreshold = 1024;
+        uint32_t shrinkSlack = 256;             // Texels a texture may exceed the rounded size by, per dimension
+        uint64_t maxIdleBytes = 64ull << 20;    // Idle textures kept for reuse
+    };
+
+    struct SharedTexturePoolStats
+    {
+        uint64_t created = 0;           // Textures allocated by the factory
+        uint64_t reused = 0;            // Acquires served by an idle texture
+        uint64_t resizedInPlace = 0;    // Resizes that kept their texture
+        uint64_t released = 0;          // Textures returned to the pool
+        uint64_t destroyed = 0;         // Idle textures evicted or trimmed
+        uint64_t idleBytes = 0;
+        uint32_t idleCount = 0;
+        uint32_t liveCount = 0;         // Textures handed out and not released
+    };
+
+    // ========================================================================
+    // Shared Texture Pool
+    // ========================================================================
+    class SharedTexturePool
+    {
+    public:
+        static constexpr uint32_t BytesPerTexel = 4; // BGRA8
+
+        /// @param factory Creates and destroys the textures (weak ref)
+        explicit SharedTexturePool(ISharedTextureFactory* factory, const SharedTexturePoolSettings& settings = {});
+        ~SharedTexturePool();
+
+        // Non-copyable
+        SharedTexturePool(const SharedTexturePool&) = delete;
+        SharedTexturePool& operator=(const SharedTexturePool&) = delete;
+
+        /// @brief Round a dimension up to its bucket
+        uint32_t RoundUp(uint32_t size) const;
+
+        /// @brief Get a texture that holds at least width x height
+        /// @note Prefers the smallest fitting idle texture; creates one at the
+        ///       rounded size otherwise
+        /// @return nullptr if the factory failed
+        void* Acquire(uint32_t width, uint32_t height);
+
+        /// @brief Keep a texture for a new size if its allocation fits it
+        /// @return false if the caller needs another texture; this one is unchanged
+        bool ResizeInPlace(void* texture, uint32_t width, uint32_t height);
+
+        /// @brief Return a texture for reuse, evicting idle textures beyond the cap
+        /// @return false if the texture is not in use from this pool
+        bool Release(void* texture);
+
+        /// @brief Allocated size of a texture in use from this pool
+        bool GetAllocatedSize(void* texture, uint32_t& outWidth, uint32_t& outHeight) const;
+
+        /// @brief Destroy every idle texture
+        void Trim();
+
+        /// @brief Trim, and forget the textures in use
+        /// @note For device loss: their owners drop them along with the device
+        void Reset();
+
+        const SharedTexturePoolSettings& GetSettings() const { return m_settings; }
+        const SharedTexturePoolStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Allocation
+        {
+            void* texture = nullptr;
+            uint32_t width = 0;
+            uint32_t height = 0;
+
+            uint64_t Bytes() const { return static_cast<uint64_t>(width) * height * BytesPerTexel; }
+        };
+
+        bool Fits(const Allocation& allocation, uint32_t width, uint32_t height) const;
+        void EvictIdle(uint64_t maxBytes);
+        Allocation* FindLive(void* texture);
+
+        ISharedTextureFactory* m_factory; // Weak ref
+        SharedTexturePoolSettings m_settings;
+
+        std::vector<Allocation> m_live;
+        std::vector<Allocation> m_idle;   // Oldest first
+        SharedTexturePoolStats m_stats;
+    };
+
+} // namespace WebViewToolkit
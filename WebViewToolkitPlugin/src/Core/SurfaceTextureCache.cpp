@@ -0,0 +1,78 @@
+// ============================================================================
+// WebViewToolkit - Surface Texture Cache Implementation
+// ============================================================================
+
+#include "Core/SurfaceTextureCache.h"
+
+namespace WebViewToolkit
+{
+    SurfaceTextureCache::SurfaceTextureCache(ISurfaceTextureResolver* resolver)
+        : m_resolver(resolver)
+    {
+    }
+
+    SurfaceTextureCache::~SurfaceTextureCache()
+    {
+        Clear();
+    }
+
+    void* SurfaceTextureCache::Get(void* surface)
+    {
+        if (!surface)
+        {
+            return nullptr;
+        }
+
+        for (const Entry& entry : m_entries)
+        {
+            if (entry.surface == surface)
+            {
+                m_stats.hits++;
+                return entry.texture;
+            }
+        }
+
+        void* texture = m_resolver->ResolveTexture(surface);
+        if (!texture)
+        {
+            return nullptr;
+        }
+        m_stats.misses++;
+
+        // Oldest first: a pool's surfaces come round in order
+        Entry& entry = m_entries[m_next];
+        m_next = (m_next + 1) % Capacity;
+        if (entry.surface)
+        {
+            m_resolver->ReleaseEntry(entry.surface, entry.texture);
+            m_stats.evictions++;
+        }
+        entry.surface = surface;
+        entry.texture = texture;
+        return texture;
+    }
+
+    void SurfaceTextureCache::Clear()
+    {
+        for (Entry& entry : m_entries)
+        {
+            if (entry.surface)
+            {
+                m_resolver->ReleaseEntry(entry.surface, entry.texture);
+                entry = Entry{};
+            }
+        }
+        m_next = 0;
+    }
+
+    size_t SurfaceTextureCache::GetCount() const
+    {
+        size_t count = 0;
+        for (const Entry& entry : m_entries)
+        {
+            count += entry.surface ? 1 : 0;
+        }
+        return count;
+    }
+
+} // namespace WebViewToolkit
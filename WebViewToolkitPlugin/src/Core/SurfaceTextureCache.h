@@ -0,0 +1,78 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Surface Texture Cache
+// ============================================================================
+// Remembers the texture behind each capture surface. A frame pool cycles
+// through the same few surfaces, so after the first lap every frame finds its
+// texture here instead of querying the surface for it (a QueryInterface and
+// a GetInterface per frame).
+//
+// Each entry holds a reference to its surface, so the surface cannot be
+// freed and another one created at its address while the entry lives, and a
+// reference to its texture. Entries are replaced oldest first; Clear drops
+// them all, e.g. when the frame pool is recreated.
+//
+// Surfaces and textures are opaque; ISurfaceTextureResolver does the device
+// work. Not thread-safe.
+// ============================================================================
+
+#include <cstddef>
+#include <cstdint>
+
+namespace WebViewToolkit
+{
+    class ISurfaceTextureResolver
+    {
+    public:
+        virtual ~ISurfaceTextureResolver() = default;
+
+        /// @brief Get the texture behind a surface and reference both
+        /// @return The texture, or nullptr (nothing referenced) on failure
+        virtual void* ResolveTexture(void* surface) = 0;
+
+        /// @brief Drop the references taken by ResolveTexture
+        virtual void ReleaseEntry(void* surface, void* texture) = 0;
+    };
+
+    struct SurfaceTextureCacheStats
+    {
+        uint64_t hits = 0;
+        uint64_t misses = 0;        // Resolved through the device
+        uint64_t evictions = 0;     // Entries replaced by a newer surface
+    };
+
+    class SurfaceTextureCache
+    {
+    public:
+        /// Frame pools have at most three buffers
+        static constexpr size_t Capacity = 4;
+
+        explicit SurfaceTextureCache(ISurfaceTextureResolver* resolver);
+        ~SurfaceTextureCache();
+
+        SurfaceTextureCache(const SurfaceTextureCache&) = delete;
+        SurfaceTextureCache& operator=(const SurfaceTextureCache&) = delete;
+
+        /// @return The surface's texture, owned by the cache; nullptr if it cannot be resolved
+        void* Get(void* surface);
+
+        void Clear();
+
+        size_t GetCount() const;
+        const SurfaceTextureCacheStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Entry
+        {
+            void* surface = nullptr;
+            void* texture = nullptr;
+        };
+
+        ISurfaceTextureResolver* m_resolver; // Weak ref
+        Entry m_entries[Capacity];
+        size_t m_next = 0;  // Entry replaced on the next miss
+        SurfaceTextureCacheStats m_stats;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,138 @@
+// ============================================================================
+// WebViewToolkit - Tile Change Detection Implementation
+// ============================================================================
+
+#include "Core/TileChangeDetector.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    TileChangeDetector::TileChangeDetector(uint32_t tileSize)
+        : m_tileSize((std::max<uint32_t>(tileSize, 1) + TileSignature::LaneCount - 1) / TileSignature::LaneCount * TileSignature::LaneCount)
+    {
+    }
+
+    void TileChangeDetector::Reset()
+    {
+        m_hasPrevious = false;
+    }
+
+    const std::vector<PixelRect>& TileChangeDetector::Detect(const uint8_t* pixels, size_t pitch, uint32_t width, uint32_t height)
+    {
+        m_changed.clear();
+        m_fullFrame = false;
+        m_changedTiles = 0;
+
+        if (!pixels || width == 0 || height == 0 || pitch < static_cast<size_t>(width) * 4)
+        {
+            Reset();
+            return m_changed;
+        }
+
+        if (width != m_width || height != m_height)
+        {
+            m_width = width;
+            m_height = height;
+            m_columns = (width + m_tileSize - 1) / m_tileSize;
+            m_rows = (height + m_tileSize - 1) / m_tileSize;
+            m_hasPrevious = false;
+
+            // The row buffers are swapped every tile row, so both need room
+            // for a full row up front or frames keep growing whichever is behind
+            m_changed.reserve(static_cast<size_t>(m_columns) * m_rows);
+            m_openRects.reserve(m_columns);
+            m_nextOpenRects.reserve(m_columns);
+        }
+
+        // Every image row feeds the signatures of its tile row
+        m_current.assign(static_cast<size_t>(m_columns) * m_rows, TileSignature::Seed());
+        TileSignature* tileRow = m_current.data();
+        const uint8_t* row = pixels;
+        for (uint32_t y = 0, rowInTile = 0; y < height; y++, row += pitch)
+        {
+            HashTileRow(row, width, m_tileSize, tileRow);
+            if (++rowInTile == m_tileSize)
+            {
+                rowInTile = 0;
+                tileRow += m_columns;
+            }
+        }
+
+        if (m_hasPrevious)
+        {
+            BuildChangedRects();
+        }
+        else
+        {
+            m_fullFrame = true;
+            m_changedTiles = GetTileCount();
+            m_changed.push_back(PixelRect{ 0, 0, static_cast<int32_t>(width), static_cast<int32_t>(height) });
+        }
+
+        m_current.swap(m_previous);
+        m_hasPrevious = true;
+        return m_changed;
+    }
+
+    void TileChangeDetector::BuildChangedRects()
+    {
+        const auto tileSize = static_cast<int32_t>(m_tileSize);
+        const auto width = static_cast<int32_t>(m_width);
+        const auto height = static_cast<int32_t>(m_height);
+
+        m_openRects.clear();
+
+        for (uint32_t tileY = 0; tileY < m_rows; tileY++)
+        {
+            const TileSignature* current = &m_current[static_cast<size_t>(tileY) * m_columns];
+            const TileSignature* previous = &m_previous[static_cast<size_t>(tileY) * m_columns];
+            const int32_t top = static_cast<int32_t>(tileY) * tileSize;
+            const int32_t bottom = std::min(top + tileSize, height);
+
+            m_nextOpenRects.clear();
+            size_t open = 0;
+
+            for (uint32_t tileX = 0; tileX < m_columns;)
+            {
+                if (current[tileX] == previous[tileX])
+                {
+                    tileX++;
+                    continue;
+                }
+
+                // Run of changed tiles [runStart, tileX)
+                const uint32_t runStart = tileX;
+                while (tileX < m_columns && !(current[tileX] == previous[tileX]))
+                {
+                    tileX++;
+                }
+                m_changedTiles += tileX - runStart;
+
+                const int32_t left = static_cast<int32_t>(runStart) * tileSize;
+                const int32_t right = std::min(static_cast<int32_t>(tileX) * tileSize, width);
+
+                // Open rectangles are sorted by x: stack onto one with the same span
+                while (open < m_openRects.size() && m_changed[m_openRects[open]].left < left)
+                {
+                    open++;
+                }
+
+                if (open < m_openRects.size() &&
+                    m_changed[m_openRects[open]].left == left && m_changed[m_openRects[open]].right == right)
+                {
+                    m_changed[m_openRects[open]].bottom = bottom;
+                    m_nextOpenRects.push_back(m_openRects[open]);
+                }
+                else
+                {
+                    m_nextOpenRects.push_back(m_changed.size());
+                    m_changed.push_back(PixelRect{ left, top, right, bottom });
+                }
+            }
+
+            m_openRects.swap(m_nextOpenRects);
+        }
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,69 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Tile Change Detection
+// ============================================================================
+// Fallback for frames without dirty-region metadata (Windows 10, pre-24H2
+// Windows 11): the mapped staging copy is split into square tiles, each tile
+// is hashed with the SIMD tile-signature kernel and compared with the same
+// tile of the previous frame. Only changed tiles need uploading, and a frame
+// with no changed tiles needs no upload at all.
+// ============================================================================
+
+#include "Core/PixelKernels.h"
+#include "WebViewToolkit/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    class TileChangeDetector
+    {
+    public:
+        static constexpr uint32_t DefaultTileSize = 64;
+
+        /// @param tileSize Tile edge in pixels, rounded up to a multiple of 8
+        explicit TileChangeDetector(uint32_t tileSize = DefaultTileSize);
+
+        /// @brief Hash a 32-bit-per-pixel frame and diff it against the previous one
+        /// @return Changed areas as tile-aligned rectangles clipped to the surface.
+        ///         Adjacent changed tiles of a tile row form one rectangle, and equal
+        ///         runs in consecutive tile rows are stacked. Empty if nothing changed
+        ///         or the input is invalid. The whole surface on the first frame, after
+        ///         Reset() and after a size change. Valid until the next call.
+        const std::vector<PixelRect>& Detect(const uint8_t* pixels, size_t pitch, uint32_t width, uint32_t height);
+
+        /// @brief Forget the previous frame, the next Detect() reports everything changed
+        void Reset();
+
+        /// @brief Whether the last result is the whole surface because there was no previous frame
+        bool IsFullFrame() const { return m_fullFrame; }
+
+        uint32_t GetChangedTileCount() const { return m_changedTiles; }
+        uint32_t GetTileCount() const { return m_columns * m_rows; }
+        uint32_t GetTileSize() const { return m_tileSize; }
+
+    private:
+        void BuildChangedRects();
+
+        uint32_t m_tileSize;
+        uint32_t m_width = 0;
+        uint32_t m_height = 0;
+        uint32_t m_columns = 0;
+        uint32_t m_rows = 0;
+
+        bool m_hasPrevious = false;
+        bool m_fullFrame = false;
+        uint32_t m_changedTiles = 0;
+
+        // Storage reused across frames
+        std::vector<TileSignature> m_current;
+        std::vector<TileSignature> m_previous;
+        std::vector<PixelRect> m_changed;
+        std::vector<size_t> m_openRects;        // Rectangles ending at the current tile row
+        std::vector<size_t> m_nextOpenRects;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,169 @@
+// ============================================================================
+// WebViewToolkit - Upload Ring Allocator Implementation
+// ============================================================================
+
+#include "Core/UploadRingAllocator.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    namespace
+    {
+        bool IsValidAlignment(uint64_t alignment)
+        {
+            return alignment != 0 && (alignment & (alignment - 1)) == 0;
+        }
+    }
+
+    UploadRingAllocator::UploadRingAllocator(IGpuFence* fence, uint64_t capacity)
+        : m_fence(fence)
+        , m_capacity(capacity)
+    {
+    }
+
+    uint64_t UploadRingAllocator::PlaceAt(uint64_t size, uint64_t alignment) const
+    {
+        const uint64_t offset = m_head % m_capacity;
+        const uint64_t aligned = (offset + alignment - 1) & ~(alignment - 1);
+        if (aligned + size > m_capacity)
+        {
+            // Skip the rest of the buffer
+            return m_head + (m_capacity - offset);
+        }
+        return m_head + (aligned - offset);
+    }
+
+    bool UploadRingAllocator::Fits(uint64_t size, uint64_t alignment) const
+    {
+        // An empty ring restarts at offset zero
+        return m_head == m_tail || PlaceAt(size, alignment) + size - m_tail <= m_capacity;
+    }
+
+    bool UploadRingAllocator::Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset)
+    {
+        if (size == 0 || size > m_capacity || !IsValidAlignment(alignment))
+        {
+            return false;
+        }
+
+        if (!Fits(size, alignment))
+        {
+            Reclaim();
+            if (!Fits(size, alignment))
+            {
+                m_stats.outOfSpace++;
+                return false;
+            }
+        }
+
+        if (m_head == m_tail && m_head % m_capacity != 0)
+        {
+            // Nothing in use: start over at offset zero so the whole buffer is free
+            m_head += m_capacity - m_head % m_capacity;
+            m_tail = m_head;
+            m_submitted = m_head;
+        }
+
+        const uint64_t start = PlaceAt(size, alignment);
+        if (start != m_head && start % m_capacity == 0)
+        {
+            m_stats.wraps++;
+        }
+        m_stats.paddingBytes += start - m_head;
+        m_stats.allocations++;
+        m_stats.allocatedBytes += size;
+
+        m_head = start + size;
+        m_stats.maxUsed = std::max(m_stats.maxUsed, GetUsed());
+        outOffset = start % m_capacity;
+        return true;
+    }
+
+    bool UploadRingAllocator::WaitForSpace(uint64_t size, uint64_t alignment)
+    {
+        if (size == 0 || size > m_capacity || !IsValidAlignment(alignment))
+        {
+            return false;
+        }
+
+        while (!Fits(size, alignment))
+        {
+            if (Reclaim() > 0)
+            {
+                continue;
+            }
+            if (m_submissions.empty())
+            {
+                // Allocations not yet submitted fill the ring
+                return false;
+            }
+
+            m_stats.waits++;
+            m_fence->Wait(m_submissions.front().fenceValue);
+        }
+        return true;
+    }
+
+    uint64_t UploadRingAllocator::Submit(bool executedWork)
+    {
+        if (m_head == m_submitted)
+        {
+            // Nothing of the ring to free, but the caller's work still needs a
+            // value it can tell completion by
+            return executedWork && m_fence ? m_fence->Signal() : 0;
+        }
+
+        m_stats.submissions++;
+        m_submitted = m_head;
+
+        const uint64_t fenceValue = m_fence ? m_fence->Signal() : 0;
+        if (fenceValue == 0)
+        {
+            // No timeline, so nothing can still be reading the buffer
+            m_submissions.clear();
+            m_tail = m_head;
+            return 0;
+        }
+
+        // Keep the submissions ordered even if the timeline went backwards
+        Submission submission;
+        submission.fenceValue = m_submissions.empty() ? fenceValue : std::max(fenceValue, m_submissions.back().fenceValue);
+        submission.end = m_head;
+        m_submissions.push_back(submission);
+        return submission.fenceValue;
+    }
+
+    size_t UploadRingAllocator::Reclaim()
+    {
+        if (m_submissions.empty())
+        {
+            return 0;
+        }
+
+        const uint64_t completed = m_fence ? m_fence->GetCompletedValue() : UINT64_MAX;
+
+        size_t count = 0;
+        while (count < m_submissions.size() && m_submissions[count].fenceValue <= completed)
+        {
+            count++;
+        }
+        if (count == 0)
+        {
+            return 0;
+        }
+
+        m_tail = m_submissions[count - 1].end;
+        m_submissions.erase(m_submissions.begin(), m_submissions.begin() + static_cast<ptrdiff_t>(count));
+        return count;
+    }
+
+    void UploadRingAllocator::Reset()
+    {
+        m_submissions.clear();
+        m_head = 0;
+        m_tail = 0;
+        m_submitted = 0;
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,110 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - Upload Ring Allocator
+// ============================================================================
+// Sub-allocates one persistently mapped upload buffer as a ring. Each frame's
+// pixels are written at the head; the space is handed back once the GPU has
+// executed the copies that read it, so a steady stream of uploads needs no
+// allocation at all.
+//
+// Allocations made since the last Submit() are tagged with the fence value
+// that Submit() signals behind them. The tail then moves forward over
+// submissions in order as the fence reaches them. An allocation that does not
+// fit before the end of the buffer skips the rest of it and starts at offset
+// zero. When the ring is full, Allocate() fails and the caller decides:
+// WaitForSpace() blocks until the oldest submissions that are in the way have
+// completed, or the frame can take another path.
+//
+// Offsets only: the backend owns the buffer. Not thread-safe; the backend
+// serializes calls.
+// ============================================================================
+
+#include "Core/GpuFence.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    struct UploadRingStats
+    {
+        uint64_t allocations = 0;
+        uint64_t allocatedBytes = 0;
+        uint64_t wraps = 0;             // Allocations moved to the start of the buffer
+        uint64_t paddingBytes = 0;      // Skipped at the end of the buffer or for alignment
+        uint64_t outOfSpace = 0;        // Allocations that failed because the ring was full
+        uint64_t waits = 0;             // Fence waits in WaitForSpace
+        uint64_t submissions = 0;
+        uint64_t maxUsed = 0;           // High-water mark of the bytes in use
+    };
+
+    // ========================================================================
+    // Ring
+    // ========================================================================
+    class UploadRingAllocator
+    {
+    public:
+        /// @param fence Timeline of the queue that reads the buffer (weak ref)
+        /// @param capacity Size of the buffer in bytes
+        UploadRingAllocator(IGpuFence* fence, uint64_t capacity);
+
+        // Non-copyable
+        UploadRingAllocator(const UploadRingAllocator&) = delete;
+        UploadRingAllocator& operator=(const UploadRingAllocator&) = delete;
+
+        /// @brief Reserve space at the head, after reclaiming completed submissions
+        /// @param alignment Power of two; offset zero satisfies any alignment
+        /// @return false if the ring is full or the size can never fit
+        bool Allocate(uint64_t size, uint64_t alignment, uint64_t& outOffset);
+
+        /// @brief Block until an allocation of this size fits
+        /// @return false if it cannot fit even once every submission has completed
+        bool WaitForSpace(uint64_t size, uint64_t alignment);
+
+        /// @brief Hand the allocations since the last submit to the GPU
+        /// @param executedWork Work was submitted whether or not it read the ring,
+        ///        e.g. a list of GPU-side copies only; signal for it even without allocations
+        /// @note Signals the fence, so call it after the copies reading them were submitted
+        /// @return The fence value that frees them, 0 if there was nothing to submit
+        ///         or no timeline (then they are free right away)
+        uint64_t Submit(bool executedWork = false);
+
+        /// @brief Free the submissions the fence has reached
+        /// @return Number of submissions freed
+        size_t Reclaim();
+
+        /// @brief Free everything, submitted or not
+        /// @note Only once the GPU is idle or gone, e.g. at device shutdown
+        void Reset();
+
+        uint64_t GetCapacity() const { return m_capacity; }
+        uint64_t GetUsed() const { return m_head - m_tail; }
+        size_t GetPendingCount() const { return m_submissions.size(); }
+        const UploadRingStats& GetStats() const { return m_stats; }
+
+    private:
+        struct Submission
+        {
+            uint64_t fenceValue = 0;
+            uint64_t end = 0;           // Head position when submitted
+        };
+
+        /// @brief Ring position an allocation would start at, wrapped if needed
+        uint64_t PlaceAt(uint64_t size, uint64_t alignment) const;
+        bool Fits(uint64_t size, uint64_t alignment) const;
+
+        IGpuFence* m_fence;             // Weak ref
+        uint64_t m_capacity;
+
+        // Positions only grow; the offset into the buffer is position % capacity
+        uint64_t m_head = 0;            // Next free byte
+        uint64_t m_tail = 0;            // Oldest byte still in use
+        uint64_t m_submitted = 0;       // Head position at the last submit
+
+        std::vector<Submission> m_submissions;  // Submission order, so fence values never decrease
+        UploadRingStats m_stats;
+    };
+
+} // namespace WebViewToolkit
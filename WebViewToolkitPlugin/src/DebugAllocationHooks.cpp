@@ -0,0 +1,52 @@
+// ============================================================================
+// WebViewToolkit - Debug Allocation Hooks
+// ============================================================================
+// Debug builds replace the global allocation functions of the plugin module
+// so heap allocations on the render thread show up in the per-frame resource
+// statistics (WebViewToolkit_GetFrameResourceStats). Release builds keep the
+// CRT's own.
+// ============================================================================
+
+#ifdef WEBVIEW_TOOLKIT_DEBUG
+
+#include "Core/FrameResourceCounters.h"
+
+#include <cstdlib>
+#include <new>
+
+void* operator new(std::size_t size)
+{
+    WebViewToolkit::FrameResourceCounters::CountAllocation();
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#endif // WEBVIEW_TOOLKIT_DEBUG
@@ -113,6 +113,15 @@ namespace WebViewToolkit
             }
             break;
 
+        case RenderEventType::LateLatchTextures:
+            if (g_webViewManager &&
+                !WebViewToolkit::WebViewManager::IsShuttingDown() &&
+                g_webViewManager->IsInitialized())
+            {
+                g_webViewManager->LatchAllTextures();
+            }
+            break;
+
         default:
             break;
         }
@@ -10,6 +10,7 @@
 #include "WebViewToolkit/RenderAPI.h"
 #include "WebViewToolkit/WebViewManager.h"
 #include "WebViewToolkit/WebView.h"
+#include "Core/FramePoolDepthController.h"
 
 // Unity Plugin API
 #include "IUnityInterface.h"
@@ -93,6 +94,19 @@ WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebView(
     const wchar_t* initialUrl,
     int32_t enableDevTools,
     uint32_t* outHandle)
+{
+    return WebViewToolkit_CreateWebViewEx(width, height, userDataFolder, initialUrl, enableDevTools,
+        WebViewToolkit::DefaultFramePoolDepth, outHandle);
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebViewEx(
+    uint32_t width,
+    uint32_t height,
+    const wchar_t* userDataFolder,
+    const wchar_t* initialUrl,
+    int32_t enableDevTools,
+    uint32_t framePoolDepth,
+    uint32_t* outHandle)
 {
     if (WebViewToolkit::WebViewManager::IsShuttingDown())
     {
@@ -105,12 +119,18 @@ WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebView(
         return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
     }
 
+    if (framePoolDepth > WebViewToolkit::MaxFramePoolDepth)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
     WebViewToolkit::WebViewCreateParams params = {};
     params.width = width;
     params.height = height;
     params.userDataFolder = userDataFolder;
     params.initialUrl = initialUrl;
     params.enableDevTools = enableDevTools != 0;
+    params.framePoolDepth = framePoolDepth;
 
     WebViewToolkit::WebViewHandle handle;
     auto result = manager->CreateWebView(params, handle);
@@ -123,6 +143,45 @@ WEBVIEW_EXPORT int32_t WebViewToolkit_CreateWebView(
     return static_cast<int32_t>(result);
 }
 
+WEBVIEW_EXPORT int32_t WebViewToolkit_CreateAtlasWebView(
+    uint32_t width,
+    uint32_t height,
+    const wchar_t* userDataFolder,
+    const wchar_t* initialUrl,
+    int32_t enableDevTools,
+    uint32_t* outHandle)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager || !outHandle)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    WebViewToolkit::WebViewCreateParams params = {};
+    params.width = width;
+    params.height = height;
+    params.userDataFolder = userDataFolder;
+    params.initialUrl = initialUrl;
+    params.enableDevTools = enableDevTools != 0;
+    params.framePoolDepth = WebViewToolkit::DefaultFramePoolDepth;
+    params.useCaptureAtlas = true;
+
+    WebViewToolkit::WebViewHandle handle;
+    auto result = manager->CreateWebView(params, handle);
+
+    if (result == WebViewToolkit::Result::Success)
+    {
+        *outHandle = handle;
+    }
+
+    return static_cast<int32_t>(result);
+}
+
 WEBVIEW_EXPORT int32_t WebViewToolkit_DestroyWebView(uint32_t handle)
 {
     if (WebViewToolkit::WebViewManager::IsShuttingDown())
@@ -172,6 +231,403 @@ WEBVIEW_EXPORT int32_t WebViewToolkit_Resize(uint32_t handle, uint32_t width, ui
     return static_cast<int32_t>(manager->ResizeWebView(handle, width, height));
 }
 
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetResizeInterval(uint32_t handle, uint32_t intervalMs)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetResizeInterval(handle, intervalMs));
+}
+
+WEBVIEW_EXPORT void WebViewToolkit_ApplyPendingResizes()
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return;
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (manager)
+    {
+        manager->ApplyPendingResizes();
+    }
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetResizeStats(uint32_t handle, WebViewToolkit::ResizeStats* outStats)
+{
+    if (!outStats)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetResizeStats(handle, *outStats));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetFlipMode(uint32_t handle, int32_t flipMode)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetFlipMode(handle, static_cast<WebViewToolkit::FlipMode>(flipMode)));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetFrameDrainMode(uint32_t handle, int32_t drainMode)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetFrameDrainMode(handle, static_cast<WebViewToolkit::FrameDrainMode>(drainMode)));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetPresentMode(uint32_t handle, int32_t presentMode)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetPresentMode(handle, static_cast<WebViewToolkit::PresentMode>(presentMode)));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetLateLatch(uint32_t handle, int32_t enabled)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetLateLatch(handle, enabled != 0));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetCaptureStats(uint32_t handle, WebViewToolkit::CaptureFrameStats* outStats)
+{
+    if (!outStats)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetCaptureStats(handle, *outStats));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameVersion(uint32_t handle, WebViewToolkit::FrameVersion* outVersion)
+{
+    if (!outVersion)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    // Read without the manager lock
+    const bool found = manager->GetFrameVersions().Read(handle, *outVersion);
+    return static_cast<int32_t>(found ? WebViewToolkit::Result::Success : WebViewToolkit::Result::ErrorInvalidHandle);
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameVersions(WebViewToolkit::FrameVersion* outVersions, uint32_t capacity, uint32_t* outCount)
+{
+    if (!outCount || (!outVersions && capacity > 0))
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+    *outCount = 0;
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    *outCount = static_cast<uint32_t>(manager->GetFrameVersions().ReadAll(outVersions, capacity));
+    return static_cast<int32_t>(WebViewToolkit::Result::Success);
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetFrameResourceStats(WebViewToolkit::FrameResourceStats* outStats)
+{
+    if (!outStats)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    *outStats = manager->GetFrameResourceStats();
+    return static_cast<int32_t>(WebViewToolkit::Result::Success);
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_AttachMirror(uint32_t handle, uint32_t width, uint32_t height, uint32_t* outMirrorId)
+{
+    if (!outMirrorId)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    WebViewToolkit::MirrorId mirrorId = WebViewToolkit::InvalidMirrorId;
+    const WebViewToolkit::Result result = manager->AttachMirror(handle, width, height, mirrorId);
+    *outMirrorId = mirrorId;
+    return static_cast<int32_t>(result);
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_DetachMirror(uint32_t handle, uint32_t mirrorId)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->DetachMirror(handle, mirrorId));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetMirrorTexture(uint32_t handle, uint32_t mirrorId, void** outTexture, uint32_t* outWidth, uint32_t* outHeight)
+{
+    if (!outTexture || !outWidth || !outHeight)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetMirrorTexture(handle, mirrorId, *outTexture, *outWidth, *outHeight));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetMirrorUVRect(uint32_t handle, uint32_t mirrorId, float* outUVRect)
+{
+    if (!outUVRect)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetMirrorUVRect(handle, mirrorId, outUVRect));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_SetRenderScale(uint32_t handle, float scale)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->SetRenderScale(handle, scale));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_EnableAutoRenderScale(uint32_t handle, float frameBudgetMs, float minScale)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->EnableAutoRenderScale(handle, frameBudgetMs, minScale));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_ReportRenderScaleSample(uint32_t handle, float frameTimeMs, float coverage)
+{
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->ReportRenderScaleSample(handle, frameTimeMs, coverage));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTextureSize(uint32_t handle, uint32_t* outWidth, uint32_t* outHeight)
+{
+    if (!outWidth || !outHeight)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetTextureSize(handle, *outWidth, *outHeight));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTexture(uint32_t handle, void** outTexture, uint32_t* outWidth, uint32_t* outHeight)
+{
+    if (!outTexture || !outWidth || !outHeight)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetTexture(handle, *outTexture, *outWidth, *outHeight));
+}
+
+WEBVIEW_EXPORT int32_t WebViewToolkit_GetTextureUVRect(uint32_t handle, float* outUVRect)
+{
+    if (!outUVRect)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorInvalidArgument);
+    }
+
+    if (WebViewToolkit::WebViewManager::IsShuttingDown())
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    auto manager = WebViewToolkit::GetWebViewManager();
+    if (!manager)
+    {
+        return static_cast<int32_t>(WebViewToolkit::Result::ErrorNotInitialized);
+    }
+
+    return static_cast<int32_t>(manager->GetTextureUVRect(handle, outUVRect));
+}
+
 // ============================================================================
 // Navigation
 // ============================================================================
@@ -0,0 +1,110 @@
+// ============================================================================
+// WebViewToolkit - D3D11 Readback Device Implementation
+// ============================================================================
+
+#include "ReadbackDevice_D3D11.h"
+
+#include "Core/FrameResourceCounters.h"
+namespace WebViewToolkit
+{
+    ReadbackDevice_D3D11::ReadbackDevice_D3D11(ID3D11Device* device, ID3D11DeviceContext* context)
+        : m_device(device)
+        , m_context(context)
+    {
+    }
+
+    void* ReadbackDevice_D3D11::CreateStagingTexture(uint32_t width, uint32_t height)
+    {
+        if (!m_device)
+        {
+            return nullptr;
+        }
+
+        D3D11_TEXTURE2D_DESC desc = {};
+        desc.Width = width;
+        desc.Height = height;
+        desc.MipLevels = 1;
+        desc.ArraySize = 1;
+        desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;  // Matches the capture frame pool format
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_STAGING;
+        desc.BindFlags = 0;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        desc.MiscFlags = 0;
+
+        ID3D11Texture2D* texture = nullptr;
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(m_device->CreateTexture2D(&desc, nullptr, &texture)))
+        {
+            return nullptr;
+        }
+
+        return texture;
+    }
+
+    void ReadbackDevice_D3D11::DestroyStagingTexture(void* stagingTexture)
+    {
+        if (stagingTexture)
+        {
+            static_cast<ID3D11Texture2D*>(stagingTexture)->Release();
+        }
+    }
+
+    void* ReadbackDevice_D3D11::CreateCompletionQuery()
+    {
+        if (!m_device)
+        {
+            return nullptr;
+        }
+
+        D3D11_QUERY_DESC desc = {};
+        desc.Query = D3D11_QUERY_EVENT;
+
+        ID3D11Query* query = nullptr;
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(m_device->CreateQuery(&desc, &query)))
+        {
+            return nullptr;
+        }
+
+        return query;
+    }
+
+    void ReadbackDevice_D3D11::DestroyCompletionQuery(void* query)
+    {
+        if (query)
+        {
+            static_cast<ID3D11Query*>(query)->Release();
+        }
+    }
+
+    void ReadbackDevice_D3D11::CopyToStaging(void* stagingTexture, void* sourceTexture, void* query)
+    {
+        if (!m_context)
+        {
+            return;
+        }
+
+        // The source may be larger (captured at the view's capacity); the
+        // staging texture has the size of its live top-left part
+        auto staging = static_cast<ID3D11Texture2D*>(stagingTexture);
+        D3D11_TEXTURE2D_DESC stagingDesc;
+        staging->GetDesc(&stagingDesc);
+        const D3D11_BOX srcBox = { 0, 0, 0, stagingDesc.Width, stagingDesc.Height, 1 };
+        m_context->CopySubresourceRegion(staging, 0, 0, 0, 0, static_cast<ID3D11Texture2D*>(sourceTexture), 0, &srcBox);
+        m_context->End(static_cast<ID3D11Query*>(query));
+    }
+
+    bool ReadbackDevice_D3D11::IsCopyComplete(void* query)
+    {
+        if (!m_context || !query)
+        {
+            return false;
+        }
+
+        // DONOTFLUSH: the caller flushes once per submit, polling must stay cheap
+        HRESULT hr = m_context->GetData(static_cast<ID3D11Query*>(query), nullptr, 0, D3D11_ASYNC_GETDATA_DONOTFLUSH);
+        return hr == S_OK;
+    }
+
+} // namespace WebViewToolkit
@@ -0,0 +1,37 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - D3D11 Readback Device
+// ============================================================================
+// IReadbackDevice backed by a D3D11 device: staging textures for readback and
+// D3D11_QUERY_EVENT queries to detect when a copy has retired.
+// ============================================================================
+
+#include "Core/ReadbackRing.h"
+
+#include <d3d11.h>
+#include <wrl/client.h>
+
+namespace WebViewToolkit
+{
+    class ReadbackDevice_D3D11 final : public IReadbackDevice
+    {
+    public:
+        ReadbackDevice_D3D11(ID3D11Device* device, ID3D11DeviceContext* context);
+        ~ReadbackDevice_D3D11() override = default;
+
+        void* CreateStagingTexture(uint32_t width, uint32_t height) override;
+        void DestroyStagingTexture(void* stagingTexture) override;
+
+        void* CreateCompletionQuery() override;
+        void DestroyCompletionQuery(void* query) override;
+
+        void CopyToStaging(void* stagingTexture, void* sourceTexture, void* query) override;
+        bool IsCopyComplete(void* query) override;
+
+    private:
+        Microsoft::WRL::ComPtr<ID3D11Device> m_device;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_context;
+    };
+
+} // namespace WebViewToolkit
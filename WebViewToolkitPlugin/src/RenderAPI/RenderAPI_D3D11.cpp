@@ -8,6 +8,7 @@
 #include <d3d11.h>
 #include <dxgi.h>
 
+#include "Core/FrameResourceCounters.h"
 #include "DebugLog.h"
 using WebViewToolkit::DebugLog;
 
@@ -16,11 +17,15 @@ using WebViewToolkit::DebugLog;
 #include "IUnityGraphics.h"
 #include "IUnityGraphicsD3D11.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace WebViewToolkit
 {
-    RenderAPI_D3D11::RenderAPI_D3D11() = default;
+    RenderAPI_D3D11::RenderAPI_D3D11()
+        : m_texturePool(this)
+    {
+    }
 
     RenderAPI_D3D11::~RenderAPI_D3D11()
     {
@@ -43,6 +48,7 @@ namespace WebViewToolkit
                     if (m_device)
                     {
                         m_device->GetImmediateContext(&m_context);
+                        m_copier = std::make_unique<TextureCopier_D3D11>(m_device.Get(), m_context.Get());
                         InitializeCompositionDevice();
                     }
                 }
@@ -99,6 +105,71 @@ namespace WebViewToolkit
             return Result::ErrorNotInitialized;
         }
 
+        std::lock_guard<std::mutex> lock(m_texturePoolMutex);
+        void* texture = m_texturePool.Acquire(width, height);
+        if (!texture)
+        {
+            return Result::ErrorTextureCreationFailed;
+        }
+
+        *outNativePtr = texture;
+        return Result::Success;
+    }
+
+    void RenderAPI_D3D11::DestroySharedTexture(void* nativePtr)
+    {
+        if (nativePtr)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_copyHistoryMutex);
+                m_copyHistory.erase(nativePtr);
+            }
+
+            std::lock_guard<std::mutex> lock(m_texturePoolMutex);
+            if (!m_texturePool.Release(nativePtr))
+            {
+                DestroyTexture(nativePtr);
+            }
+        }
+    }
+
+    Result RenderAPI_D3D11::ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr)
+    {
+        if (!outNewNativePtr)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        if (ResizeSharedTextureInPlace(nativePtr, newWidth, newHeight))
+        {
+            *outNewNativePtr = nativePtr;
+            return Result::Success;
+        }
+
+        // Return the old texture to the pool first, another size may reuse it
+        DestroySharedTexture(nativePtr);
+        return CreateSharedTexture(newWidth, newHeight, outNewNativePtr);
+    }
+
+    bool RenderAPI_D3D11::ResizeSharedTextureInPlace(void* nativePtr, uint32_t newWidth, uint32_t newHeight)
+    {
+        std::lock_guard<std::mutex> lock(m_texturePoolMutex);
+        return m_texturePool.ResizeInPlace(nativePtr, newWidth, newHeight);
+    }
+
+    bool RenderAPI_D3D11::GetSharedTextureSize(void* nativePtr, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        std::lock_guard<std::mutex> lock(m_texturePoolMutex);
+        return m_texturePool.GetAllocatedSize(nativePtr, outWidth, outHeight);
+    }
+
+    void* RenderAPI_D3D11::CreateTexture(uint32_t width, uint32_t height)
+    {
+        if (!m_device)
+        {
+            return nullptr;
+        }
+
         D3D11_TEXTURE2D_DESC desc = {};
         desc.Width = width;
         desc.Height = height;
@@ -114,37 +185,25 @@ namespace WebViewToolkit
 
         ComPtr<ID3D11Texture2D> texture;
         HRESULT hr = m_device->CreateTexture2D(&desc, nullptr, &texture);
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
         if (FAILED(hr))
         {
-            return Result::ErrorTextureCreationFailed;
+            DebugLog::Log("CreateTexture: ERROR - failed to create %ux%u shared texture: 0x%08X", width, height, hr);
+            return nullptr;
         }
 
-        // Return raw pointer - caller is responsible for AddRef/Release
-        *outNativePtr = texture.Detach();
-        return Result::Success;
+        // Raw pointer - released by DestroyTexture
+        return texture.Detach();
     }
 
-    void RenderAPI_D3D11::DestroySharedTexture(void* nativePtr)
+    void RenderAPI_D3D11::DestroyTexture(void* texture)
     {
-        if (nativePtr)
+        // The copier's cached render target view would keep it alive
+        if (m_copier)
         {
-            auto texture = static_cast<ID3D11Texture2D*>(nativePtr);
-            texture->Release();
+            m_copier->ReleaseViews(static_cast<ID3D11Texture2D*>(texture));
         }
-    }
-
-    Result RenderAPI_D3D11::ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr)
-    {
-        if (!outNewNativePtr)
-        {
-            return Result::ErrorInvalidHandle;
-        }
-
-        // Destroy old texture
-        DestroySharedTexture(nativePtr);
-
-        // Create new texture with new dimensions
-        return CreateSharedTexture(newWidth, newHeight, outNewNativePtr);
+        static_cast<ID3D11Texture2D*>(texture)->Release();
     }
 
     void RenderAPI_D3D11::BeginRenderToTexture(void* /*texturePtr*/)
@@ -154,12 +213,8 @@ namespace WebViewToolkit
 
     void RenderAPI_D3D11::EndRenderToTexture(void* /*texturePtr*/)
     {
-        // DX11: No special handling needed
-        // Optionally flush to ensure WebView content is visible
-        if (m_context)
-        {
-            m_context->Flush();
-        }
+        // DX11: No special handling needed. Unity renders on the same immediate
+        // context, so nothing needs to be flushed for it to see the content.
     }
 
     void RenderAPI_D3D11::WaitForGPU()
@@ -176,58 +231,90 @@ namespace WebViewToolkit
         // DX11: No explicit signaling needed
     }
 
-    void RenderAPI_D3D11::CopyCapturedTextureToUnityTexture(void* capturedTexture, void* unityTexturePtr, bool flipY)
+    void RenderAPI_D3D11::CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode flipMode)
     {
-        if (!capturedTexture || !unityTexturePtr || !m_context)
+        if (!frame.texture || !unityTexturePtr || !m_copier)
         {
             return;
         }
 
-        auto srcTexture = static_cast<ID3D11Texture2D*>(capturedTexture);
+        auto srcTexture = static_cast<ID3D11Texture2D*>(frame.texture);
         auto dstTexture = static_cast<ID3D11Texture2D*>(unityTexturePtr);
 
         D3D11_TEXTURE2D_DESC srcDesc, dstDesc;
         srcTexture->GetDesc(&srcDesc);
         dstTexture->GetDesc(&dstDesc);
 
-        // Validate dimensions match to prevent crashes during resize
-        // During resize, old-sized frames may still be in the pool, so skip mismatched frames
-        if (srcDesc.Width != dstDesc.Width || srcDesc.Height != dstDesc.Height)
+        // Frames are captured at the view's capacity; only the live part is copied
+        if (frame.width && frame.height)
+        {
+            srcDesc.Width = std::min<UINT>(srcDesc.Width, frame.width);
+            srcDesc.Height = std::min<UINT>(srcDesc.Height, frame.height);
+        }
+
+        // A frame from before a resize, stretched over the new content size; it
+        // need not fit the destination. The next frame is copied whole.
+        if (frame.scaledWidth && frame.scaledHeight &&
+            m_copier->CopyScaled(srcTexture, srcDesc, dstTexture, frame.scaledWidth, frame.scaledHeight, flipMode))
+        {
+            std::lock_guard<std::mutex> lock(m_copyHistoryMutex);
+            m_copyHistory[unityTexturePtr] = CopyHistory{};
+            return;
+        }
+
+        // Pooled textures may be larger than the frame, which then fills their top-left part.
+        // During resize, old-sized frames may still be in the pool, so skip frames that do not fit
+        if (srcDesc.Width > dstDesc.Width || srcDesc.Height > dstDesc.Height)
         {
             DebugLog::Log("CopyCapturedTextureToUnityTexture: Size mismatch (src=%dx%d, dst=%dx%d), skipping frame",
                 srcDesc.Width, srcDesc.Height, dstDesc.Width, dstDesc.Height);
             return;
         }
 
-        if (flipY)
+        // Dirty rectangles describe changes since the previous frame, so they
+        // only apply if that frame is what the destination currently holds
+        bool canCopyDirty;
         {
-            // Copy row by row in reverse to flip Y
-            for (UINT y = 0; y < std::min(srcDesc.Height, dstDesc.Height); y++)
-            {
-                D3D11_BOX srcBox;
-                srcBox.left = 0;
-                srcBox.right = std::min(srcDesc.Width, dstDesc.Width);
-                srcBox.top = srcDesc.Height - 1 - y;
-                srcBox.bottom = srcDesc.Height - y;
-                srcBox.front = 0;
-                srcBox.back = 1;
-
-                m_context->CopySubresourceRegion(
-                    dstTexture, 0,
-                    0, y, 0,
-                    srcTexture, 0,
-                    &srcBox
-                );
-            }
+            std::lock_guard<std::mutex> lock(m_copyHistoryMutex);
+            CopyHistory& history = m_copyHistory[unityTexturePtr];
+            canCopyDirty = frame.dirtyRects && history.serial != 0 &&
+                history.serial + 1 == frame.serial && history.flipMode == flipMode &&
+                history.width == srcDesc.Width && history.height == srcDesc.Height;
+            history.serial = frame.serial;
+            history.flipMode = flipMode;
+            history.width = srcDesc.Width;
+            history.height = srcDesc.Height;
         }
-        else
+
+        if (canCopyDirty)
         {
-            m_context->CopyResource(dstTexture, srcTexture);
+            const auto& boxes = m_dirtyCoalescer.Coalesce(frame.dirtyRects, frame.dirtyRectCount, srcDesc.Width, srcDesc.Height);
+            if (boxes.empty())
+            {
+                return; // Nothing changed
+            }
+            if (!m_dirtyCoalescer.IsFullFrame())
+            {
+                m_copier->Copy(srcTexture, srcDesc, dstTexture, flipMode, boxes.data(), boxes.size());
+                return;
+            }
         }
+
+        m_copier->Copy(srcTexture, srcDesc, dstTexture, flipMode, nullptr, 0);
     }
 
     void RenderAPI_D3D11::ReleaseResources()
     {
+        {
+            std::lock_guard<std::mutex> lock(m_copyHistoryMutex);
+            m_copyHistory.clear();
+        }
+        {
+            // Textures still in use are dropped by their views with the device
+            std::lock_guard<std::mutex> lock(m_texturePoolMutex);
+            m_texturePool.Reset();
+        }
+        m_copier.reset();
         m_compositionDevice.Reset();
         m_context.Reset();
         m_device.Reset();
@@ -5,16 +5,23 @@
 // ============================================================================
 
 #include "WebViewToolkit/RenderAPI.h"
+#include "Core/DirtyRegion.h"
+#include "Core/SharedTexturePool.h"
+#include "TextureCopier_D3D11.h"
 
 #include <d3d11.h>
 #include <dcomp.h>
 #include <wrl/client.h>
 
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 using Microsoft::WRL::ComPtr;
 
 namespace WebViewToolkit
 {
-    class RenderAPI_D3D11 final : public IRenderAPI
+    class RenderAPI_D3D11 final : public IRenderAPI, private ISharedTextureFactory
     {
     public:
         RenderAPI_D3D11();
@@ -28,6 +35,8 @@ namespace WebViewToolkit
         Result CreateSharedTexture(uint32_t width, uint32_t height, void** outNativePtr) override;
         void DestroySharedTexture(void* nativePtr) override;
         Result ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr) override;
+        bool ResizeSharedTextureInPlace(void* nativePtr, uint32_t newWidth, uint32_t newHeight) override;
+        bool GetSharedTextureSize(void* nativePtr, uint32_t& outWidth, uint32_t& outHeight) override;
 
         void BeginRenderToTexture(void* texturePtr) override;
         void EndRenderToTexture(void* texturePtr) override;
@@ -38,15 +47,42 @@ namespace WebViewToolkit
         void WaitForGPU() override;
         void SignalRenderComplete() override;
 
-        void CopyCapturedTextureToUnityTexture(void* capturedTexture, void* unityTexturePtr, bool flipY) override;
+        void CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode flipMode) override;
+        bool CanScaleFrames() const override { return true; }
 
     private:
         Result InitializeCompositionDevice();
         void ReleaseResources();
 
+        // ISharedTextureFactory: allocations behind the texture pool
+        void* CreateTexture(uint32_t width, uint32_t height) override;
+        void DestroyTexture(void* texture) override;
+
         ComPtr<ID3D11Device> m_device;
         ComPtr<ID3D11DeviceContext> m_context;
         ComPtr<IDCompositionDevice> m_compositionDevice;
+
+        // Shared textures in size buckets, so resizes and recreated views reuse them
+        std::mutex m_texturePoolMutex;
+        SharedTexturePool m_texturePool;
+
+        // Captured frame copies, including the Y-flip
+        std::unique_ptr<TextureCopier_D3D11> m_copier;
+
+        // Dirty-region copies: a destination can take a partial update only if it
+        // holds the previous frame of the same capture in the same orientation and size.
+        // Copies update it on the render thread, destroyed textures drop out of it on
+        // the main thread.
+        struct CopyHistory
+        {
+            uint64_t serial = 0;
+            FlipMode flipMode = FlipMode::None;
+            uint32_t width = 0;
+            uint32_t height = 0;
+        };
+        std::mutex m_copyHistoryMutex;
+        std::unordered_map<void*, CopyHistory> m_copyHistory;
+        DirtyRegionCoalescer m_dirtyCoalescer;
     };
 
 } // namespace WebViewToolkit
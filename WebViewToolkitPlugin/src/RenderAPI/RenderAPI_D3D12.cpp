@@ -12,6 +12,8 @@
 #include <d3d11.h>
 #include <dxgi1_2.h>
 
+#include "Core/FrameResourceCounters.h"
+#include "Core/PixelKernels.h"
 #include "DebugLog.h"
 using WebViewToolkit::DebugLog;
 
@@ -20,11 +22,17 @@ using WebViewToolkit::DebugLog;
 #include "IUnityGraphics.h"
 #include "IUnityGraphicsD3D12.h"
 
+#include <algorithm>
 #include <stdexcept>
 
 namespace WebViewToolkit
 {
-    RenderAPI_D3D12::RenderAPI_D3D12() = default;
+    RenderAPI_D3D12::RenderAPI_D3D12()
+        : m_timeline(this)
+        , m_deferredReleases(this, this)
+        , m_texturePool(this)
+    {
+    }
 
     RenderAPI_D3D12::~RenderAPI_D3D12()
     {
@@ -87,6 +95,8 @@ namespace WebViewToolkit
                             return;
                         }
                         DebugLog::Log("ProcessDeviceEvent: CreateFence succeeded");
+
+                        InitializeUploadDevice();
                         DebugLog::Log("ProcessDeviceEvent: All D3D12 initialization complete!");
                     }
                 }
@@ -248,6 +258,17 @@ namespace WebViewToolkit
         }
 
         DebugLog::Log("InitializeCaptureDevice: D3D11 device created successfully (Feature Level: 0x%X)", featureLevel);
+
+        m_readbackDevice = std::make_unique<ReadbackDevice_D3D11>(m_captureD3D11Device.Get(), m_captureD3D11Context.Get());
+
+        // Frames stay on the GPU when both devices can share fences, otherwise
+        // every frame goes through the staging readback ring
+        m_captureCopier = std::make_unique<TextureCopier_D3D11>(m_captureD3D11Device.Get(), m_captureD3D11Context.Get());
+        ComPtr<ID3D11Device5> captureDevice5;
+        m_sharedTransferEnabled = SUCCEEDED(m_captureD3D11Device.As(&captureDevice5));
+        DebugLog::Log("InitializeCaptureDevice: Frame transfer path: %s",
+            m_sharedTransferEnabled ? "GPU shared surfaces" : "CPU readback");
+
         DebugLog::Log("InitializeCaptureDevice: Success!");
         return Result::Success;
     }
@@ -309,6 +330,18 @@ namespace WebViewToolkit
         return Result::Success;
     }
 
+    void RenderAPI_D3D12::InitializeUploadDevice()
+    {
+        // Optional: without it, CPU-sourced frames go through D3D11On12
+        auto uploadDevice = std::make_unique<UploadDevice_D3D12>(m_d3d12Device.Get(), m_d3d12CommandQueue.Get(), &m_timeline);
+        if (uploadDevice->Initialize())
+        {
+            m_uploadDevice = std::move(uploadDevice);
+        }
+        DebugLog::Log("InitializeUploadDevice: CPU frame upload path: %s",
+            m_uploadDevice ? "D3D12 upload ring" : "D3D11On12 UpdateSubresource");
+    }
+
     Result RenderAPI_D3D12::CreateSharedTexture(uint32_t width, uint32_t height, void** outNativePtr)
     {
         if (!m_d3d12Device || !outNativePtr)
@@ -316,6 +349,173 @@ namespace WebViewToolkit
             return Result::ErrorNotInitialized;
         }
 
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        void* texture = m_texturePool.Acquire(width, height);
+        if (!texture)
+        {
+            return Result::ErrorTextureCreationFailed;
+        }
+
+        *outNativePtr = texture;
+        return Result::Success;
+    }
+
+    void RenderAPI_D3D12::DestroySharedTexture(void* nativePtr)
+    {
+        if (!nativePtr)
+        {
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        auto wrapped = m_wrappedResources.find(nativePtr);
+        if (wrapped != m_wrappedResources.end() && m_copyBatch.Contains(wrapped->second->d3d11Resource.Get()))
+        {
+            // Replaced on the main thread while the render event still copies into it
+            m_deferredDestroys.push_back(nativePtr);
+            return;
+        }
+
+        ReleaseSharedTexture(nativePtr);
+    }
+
+    void RenderAPI_D3D12::ReleaseSharedTexture(void* nativePtr)
+    {
+        // The readback history describes this owner's frames; the wrapped
+        // resource and shared surfaces stay valid for the next one
+        m_readbackTargets.erase(nativePtr);
+
+        if (!m_texturePool.Release(nativePtr))
+        {
+            DestroySharedTextureNow(nativePtr);
+        }
+    }
+
+    void RenderAPI_D3D12::DestroySharedTextureNow(void* nativePtr)
+    {
+        m_readbackTargets.erase(nativePtr);
+
+        // Queued copies may still write the texture through its wrapped
+        // resource and shared surfaces: all three go once the GPU is past them
+        RetireWrappedResource(nativePtr);
+        RetireSharedTransfer(nativePtr);
+        m_deferredReleases.Retire(nativePtr, ReleaseKindTexture);
+    }
+
+    void RenderAPI_D3D12::RetireWrappedResource(void* nativePtr)
+    {
+        auto it = m_wrappedResources.find(nativePtr);
+        if (it != m_wrappedResources.end())
+        {
+            m_timeline.Forget(it->second->d3d11Resource.Get());
+            m_deferredReleases.Retire(it->second.release(), ReleaseKindWrapped);
+            m_wrappedResources.erase(it);
+        }
+    }
+
+    void RenderAPI_D3D12::RetireSharedTransfer(void* nativePtr)
+    {
+        auto it = m_sharedTransfers.find(nativePtr);
+        if (it != m_sharedTransfers.end())
+        {
+            m_deferredReleases.Retire(new SharedTransfer(std::move(it->second)), ReleaseKindSharedTransfer);
+            m_sharedTransfers.erase(it);
+        }
+    }
+
+    uint64_t RenderAPI_D3D12::Signal()
+    {
+        // D3D11On12 work reaches the queue only when flushed
+        if (m_d3d11Context)
+        {
+            m_d3d11Context->Flush();
+        }
+
+        if (!m_d3d12CommandQueue || !m_fence)
+        {
+            return 0;
+        }
+
+        const uint64_t fenceValue = ++m_fenceValue;
+        if (FAILED(m_d3d12CommandQueue->Signal(m_fence.Get(), fenceValue)))
+        {
+            return 0;
+        }
+        return fenceValue;
+    }
+
+    uint64_t RenderAPI_D3D12::GetCompletedValue()
+    {
+        return m_fence ? m_fence->GetCompletedValue() : UINT64_MAX;
+    }
+
+    void RenderAPI_D3D12::Wait(uint64_t value)
+    {
+        if (!m_fence || !m_fenceEvent || m_fence->GetCompletedValue() >= value)
+        {
+            return;
+        }
+
+        if (SUCCEEDED(m_fence->SetEventOnCompletion(value, m_fenceEvent)))
+        {
+            WaitForSingleObject(m_fenceEvent, INFINITE);
+        }
+    }
+
+    void RenderAPI_D3D12::ReleaseNow(void* resource, uint32_t kind)
+    {
+        switch (kind)
+        {
+        case ReleaseKindTexture:
+            static_cast<ID3D12Resource*>(resource)->Release();
+            break;
+        case ReleaseKindWrapped:
+            delete static_cast<WrappedResource*>(resource);
+            break;
+        case ReleaseKindSharedTransfer:
+            delete static_cast<SharedTransfer*>(resource);
+            break;
+        }
+    }
+
+    Result RenderAPI_D3D12::ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr)
+    {
+        if (!outNewNativePtr)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        if (ResizeSharedTextureInPlace(nativePtr, newWidth, newHeight))
+        {
+            *outNewNativePtr = nativePtr;
+            return Result::Success;
+        }
+
+        // No GPU wait: a texture the open batch still copies into is only
+        // returned to the pool once the batch ends
+        DestroySharedTexture(nativePtr);
+        return CreateSharedTexture(newWidth, newHeight, outNewNativePtr);
+    }
+
+    bool RenderAPI_D3D12::ResizeSharedTextureInPlace(void* nativePtr, uint32_t newWidth, uint32_t newHeight)
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        return m_texturePool.ResizeInPlace(nativePtr, newWidth, newHeight);
+    }
+
+    bool RenderAPI_D3D12::GetSharedTextureSize(void* nativePtr, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        return m_texturePool.GetAllocatedSize(nativePtr, outWidth, outHeight);
+    }
+
+    void* RenderAPI_D3D12::CreateTexture(uint32_t width, uint32_t height)
+    {
+        if (!m_d3d12Device)
+        {
+            return nullptr;
+        }
+
         // Create D3D12 texture
         D3D12_RESOURCE_DESC desc = {};
         desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
@@ -341,78 +541,37 @@ namespace WebViewToolkit
             nullptr,
             IID_PPV_ARGS(&texture)
         );
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
 
         if (FAILED(hr))
         {
-            return Result::ErrorTextureCreationFailed;
+            DebugLog::Log("CreateTexture: ERROR - failed to create %ux%u shared texture: 0x%08X", width, height, hr);
+            return nullptr;
         }
 
-        // Return raw pointer - caller is responsible for AddRef/Release
-        *outNativePtr = texture.Detach();
-        return Result::Success;
+        // Raw pointer - released by DestroyTexture
+        return texture.Detach();
     }
 
-    void RenderAPI_D3D12::DestroySharedTexture(void* nativePtr)
+    void RenderAPI_D3D12::DestroyTexture(void* texture)
     {
-        if (nativePtr)
-        {
-            // Remove wrapped resource if it exists
-            m_wrappedResources.erase(nativePtr);
-
-            auto resource = static_cast<ID3D12Resource*>(nativePtr);
-            resource->Release();
-        }
-    }
-
-    Result RenderAPI_D3D12::ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr)
-    {
-        if (!outNewNativePtr)
-        {
-            return Result::ErrorInvalidHandle;
-        }
-
-        // Wait for GPU before destroying old texture
-        WaitForGPU();
-
-        // Destroy old texture
-        DestroySharedTexture(nativePtr);
-
-        // Create new texture with new dimensions
-        return CreateSharedTexture(newWidth, newHeight, outNewNativePtr);
+        DestroySharedTextureNow(texture);
     }
 
     RenderAPI_D3D12::WrappedResource* RenderAPI_D3D12::GetOrCreateWrappedResource(void* d3d12TexturePtr)
     {
-        // Check if Unity resized the texture - need to invalidate cache if dimensions changed
-        auto d3d12Resource = static_cast<ID3D12Resource*>(d3d12TexturePtr);
-        D3D12_RESOURCE_DESC currentDesc = d3d12Resource->GetDesc();
-
+        // The entry holds the D3D12 resource, so its address cannot be reused by
+        // a texture Unity recreated at another size, and its description never
+        // changes: a cached entry is always current
         auto it = m_wrappedResources.find(d3d12TexturePtr);
         if (it != m_wrappedResources.end())
         {
-            // Verify cached resource still has correct dimensions
-            ComPtr<ID3D11Texture2D> cachedTexture;
-            it->second->d3d11Resource.As(&cachedTexture);
-            if (cachedTexture)
-            {
-                D3D11_TEXTURE2D_DESC cachedDesc;
-                cachedTexture->GetDesc(&cachedDesc);
-
-                // If dimensions don't match, Unity resized the texture - invalidate cache
-                if (cachedDesc.Width != currentDesc.Width || cachedDesc.Height != currentDesc.Height)
-                {
-                    DebugLog::Log("GetOrCreateWrappedResource: Unity texture resized (%dx%d -> %dx%d), invalidating cached resource",
-                        cachedDesc.Width, cachedDesc.Height, (UINT)currentDesc.Width, (UINT)currentDesc.Height);
-                    m_wrappedResources.erase(it);
-                }
-                else
-                {
-                    // Dimensions match, use cached resource
-                    return it->second.get();
-                }
-            }
+            return it->second.get();
         }
 
+        auto d3d12Resource = static_cast<ID3D12Resource*>(d3d12TexturePtr);
+        const D3D12_RESOURCE_DESC currentDesc = d3d12Resource->GetDesc();
+
         if (!m_d3d11On12Device)
         {
             return nullptr;
@@ -430,15 +589,28 @@ namespace WebViewToolkit
             D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,  // Out state (for Unity)
             IID_PPV_ARGS(&d3d11Resource)
         );
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
 
         if (FAILED(hr))
         {
             return nullptr;
         }
 
+        ComPtr<ID3D11Texture2D> d3d11Texture;
+        hr = d3d11Resource.As(&d3d11Texture);
+        WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE();
+        if (FAILED(hr))
+        {
+            DebugLog::Log("GetOrCreateWrappedResource: ERROR - wrapped resource is not a 2D texture: 0x%08X", hr);
+            return nullptr;
+        }
+
         auto wrapped = std::make_unique<WrappedResource>();
         wrapped->d3d12Resource = d3d12Resource;
         wrapped->d3d11Resource = d3d11Resource;
+        wrapped->d3d11Texture = d3d11Texture;
+        wrapped->width = static_cast<UINT>(currentDesc.Width);
+        wrapped->height = static_cast<UINT>(currentDesc.Height);
 
         auto* result = wrapped.get();
         m_wrappedResources[d3d12TexturePtr] = std::move(wrapped);
@@ -484,162 +656,427 @@ namespace WebViewToolkit
         ID3D11Resource* resources[] = { wrapped->d3d11Resource.Get() };
         m_d3d11On12Device->ReleaseWrappedResources(resources, 1);
 
-        // Flush the D3D11 context to ensure commands are submitted
-        m_d3d11Context->Flush();
+        // Submit now, or with the open copy batch
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        m_timeline.MarkWritten(wrapped->d3d11Resource.Get());
+        m_copyBatch.RequestFlush(*this);
     }
 
     void RenderAPI_D3D12::WaitForGPU()
     {
-        if (!m_d3d12CommandQueue || !m_fence || !m_fenceEvent)
+        // Everything on Unity's queue so far, not just the toolkit's copies
+        const uint64_t value = Signal();
+        if (value != 0)
         {
-            return;
+            Wait(value);
         }
+    }
 
-        // Signal the fence with the next value
-        const uint64_t fenceValueToWait = ++m_fenceValue;
-        HRESULT hr = m_d3d12CommandQueue->Signal(m_fence.Get(), fenceValueToWait);
-        if (FAILED(hr))
+    void RenderAPI_D3D12::SignalRenderComplete()
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        m_timeline.Signal();
+    }
+
+    uint64_t RenderAPI_D3D12::GetLastWrittenFence(void* texturePtr)
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        auto it = m_wrappedResources.find(texturePtr);
+        return it != m_wrappedResources.end() ? m_timeline.GetLastWritten(it->second->d3d11Resource.Get()) : 0;
+    }
+
+    void RenderAPI_D3D12::WaitForTextureWrites(void* texturePtr)
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        auto it = m_wrappedResources.find(texturePtr);
+        if (it != m_wrappedResources.end())
         {
-            return;
+            m_timeline.WaitForWrites(it->second->d3d11Resource.Get());
         }
+    }
 
-        // Wait for the fence
-        if (m_fence->GetCompletedValue() < fenceValueToWait)
+    RenderAPI_D3D12::SharedTransfer* RenderAPI_D3D12::GetOrCreateSharedTransfer(void* unityTexturePtr)
+    {
+        auto it = m_sharedTransfers.find(unityTexturePtr);
+        if (it != m_sharedTransfers.end())
         {
-            hr = m_fence->SetEventOnCompletion(fenceValueToWait, m_fenceEvent);
-            if (SUCCEEDED(hr))
-            {
-                WaitForSingleObject(m_fenceEvent, INFINITE);
-            }
+            return &it->second;
+        }
+
+        SharedTransfer transfer;
+        transfer.device = std::make_unique<SharedSurfaceDevice_D3D12>(m_captureD3D11Device.Get(), m_captureD3D11Context.Get(),
+            m_captureCopier.get(), m_d3d12Device.Get(), m_d3d12CommandQueue.Get(), m_d3d11On12Device.Get(), m_d3d11Context.Get());
+        if (!transfer.device->Initialize())
+        {
+            return nullptr;
         }
+
+        transfer.sync = std::make_unique<SharedSurfaceSync>(transfer.device.get());
+        return &m_sharedTransfers.emplace(unityTexturePtr, std::move(transfer)).first->second;
     }
 
-    void RenderAPI_D3D12::SignalRenderComplete()
+    bool RenderAPI_D3D12::CopyThroughSharedSurface(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc,
+        void* unityTexturePtr, FlipMode flipMode)
     {
-        if (m_d3d11Context)
+        auto* wrapped = GetOrCreateWrappedResource(unityTexturePtr);
+        if (!wrapped)
         {
-            m_d3d11Context->Flush();
+            DebugLog::Log("CopyThroughSharedSurface: ERROR - failed to wrap Unity texture");
+            return false;
+        }
+
+        auto* transfer = GetOrCreateSharedTransfer(unityTexturePtr);
+        if (!transfer)
+        {
+            return false;
+        }
+
+        // Capture device copies (and flips) into a shared surface, Unity's queue
+        // copies it out once the producer fence says so. No CPU wait on either side.
+        if (!transfer->sync->Publish(srcTexture, srcDesc.Width, srcDesc.Height, flipMode))
+        {
+            return false;
+        }
+
+        if (transfer->sync->ConsumeLatest(wrapped->d3d11Resource.Get()))
+        {
+            CopyBatchEntry entry;
+            entry.source = transfer->device->GetPendingConsumerSource();
+            entry.destination = wrapped->d3d11Resource.Get();
+            entry.payload = transfer->device.get();
+            entry.kind = CopyKindSharedSurface;
+            m_copyBatch.Submit(entry, *this);
         }
+        return true;
     }
 
-    void RenderAPI_D3D12::CopyCapturedTextureToUnityTexture(void* capturedTexture, void* unityTexturePtr, bool flipY)
+    RenderAPI_D3D12::ReadbackTarget* RenderAPI_D3D12::GetOrCreateReadbackTarget(void* unityTexturePtr)
     {
-        HRESULT hr; // Declare once for entire function
+        auto it = m_readbackTargets.find(unityTexturePtr);
+        if (it != m_readbackTargets.end())
+        {
+            return &it->second;
+        }
+
+        if (!m_readbackDevice)
+        {
+            return nullptr;
+        }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Start (capturedTexture=%p, unityTexture=%p, flipY=%d)",
-            capturedTexture, unityTexturePtr, flipY);
+        ReadbackTarget target;
+        target.ring = std::make_unique<ReadbackRing>(m_readbackDevice.get());
+        return &m_readbackTargets.emplace(unityTexturePtr, std::move(target)).first->second;
+    }
 
-        if (!capturedTexture || !unityTexturePtr)
+    void RenderAPI_D3D12::CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode flipMode)
+    {
+        if (!frame.texture || !unityTexturePtr)
         {
             DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - null pointer");
             return;
         }
 
-        auto srcTexture = static_cast<ID3D11Texture2D*>(capturedTexture);
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        FinishCopiesInto(unityTexturePtr);
+
+        auto srcTexture = static_cast<ID3D11Texture2D*>(frame.texture);
 
         // Get source texture description
         D3D11_TEXTURE2D_DESC srcDesc;
         srcTexture->GetDesc(&srcDesc);
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Source texture %dx%d", srcDesc.Width, srcDesc.Height);
-
-        // Unity's texture is a D3D12 resource, need to wrap it
-        // GetOrCreateWrappedResource will automatically handle dimension changes and invalidate cache if needed
-        // Get the D3D12 resource to check its actual size
-        auto* d3d12Resource = static_cast<ID3D12Resource*>(unityTexturePtr);
-        D3D12_RESOURCE_DESC d3d12Desc = d3d12Resource->GetDesc();
-        UINT d3d12Width = static_cast<UINT>(d3d12Desc.Width);
-        UINT d3d12Height = static_cast<UINT>(d3d12Desc.Height);
 
-        // Check if Unity's D3D12 texture size matches the captured size
-        // If not, Unity might be in the middle of resizing - skip this frame
-        if (srcDesc.Width != d3d12Width || srcDesc.Height != d3d12Height)
+        // Frames are captured at the view's capacity; only the live part is copied
+        if (frame.width && frame.height)
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: Unity D3D12 texture size mismatch (captured=%dx%d, Unity D3D12=%dx%d), skipping frame",
-                srcDesc.Width, srcDesc.Height, d3d12Width, d3d12Height);
-            return;
+            srcDesc.Width = std::min<UINT>(srcDesc.Width, frame.width);
+            srcDesc.Height = std::min<UINT>(srcDesc.Height, frame.height);
         }
 
-        auto* wrapped = GetOrCreateWrappedResource(unityTexturePtr);
+        // Unity's texture is a D3D12 resource; both copy paths write it through
+        // its wrapped resource, which also caches its size
+        const WrappedResource* wrapped = GetOrCreateWrappedResource(unityTexturePtr);
         if (!wrapped)
         {
             DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - failed to wrap Unity texture");
             return;
         }
+        const UINT d3d12Width = wrapped->width;
+        const UINT d3d12Height = wrapped->height;
 
-        ComPtr<ID3D11Texture2D> dstTexture;
-        hr = wrapped->d3d11Resource.As(&dstTexture);
-        if (FAILED(hr) || !dstTexture)
+        // Pooled textures may be larger than the frame, which then fills their top-left part.
+        // A larger frame is from before a resize - skip it
+        if (srcDesc.Width > d3d12Width || srcDesc.Height > d3d12Height)
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - failed to cast wrapped resource to ID3D11Texture2D: 0x%08X", hr);
+            DebugLog::Log("CopyCapturedTextureToUnityTexture: Captured frame does not fit Unity D3D12 texture (captured=%dx%d, Unity D3D12=%dx%d), skipping frame",
+                srcDesc.Width, srcDesc.Height, d3d12Width, d3d12Height);
             return;
         }
 
-        D3D11_TEXTURE2D_DESC dstDesc;
-        dstTexture->GetDesc(&dstDesc);
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Destination texture %dx%d", dstDesc.Width, dstDesc.Height);
+        // srcTexture is from the capture device, dstTexture from the D3D11On12 device.
+        // Prefer a GPU copy through a shared surface; the whole frame is copied,
+        // which on the GPU costs less than finding the dirty part of it.
+        if (m_sharedTransferEnabled)
+        {
+            if (CopyThroughSharedSurface(srcTexture, srcDesc, unityTexturePtr, flipMode))
+            {
+                return;
+            }
+
+            DebugLog::Log("CopyCapturedTextureToUnityTexture: Shared surface transfer failed, falling back to CPU readback");
+            m_sharedTransferEnabled = false;
+            m_copyBatch.Execute(*this);
+            while (!m_sharedTransfers.empty())
+            {
+                RetireSharedTransfer(m_sharedTransfers.begin()->first);
+            }
+        }
 
-        // Check if sizes match - if not, skip this frame
-        // This happens during resize when we get an old-sized frame for a new-sized Unity texture
-        if (srcDesc.Width != dstDesc.Width || srcDesc.Height != dstDesc.Height)
+        // CPU fallback via a ring of staging textures: the GPU copy into
+        // staging is recorded now and mapped on a later call once it has retired,
+        // so the render thread never waits in Map()
+        auto* target = GetOrCreateReadbackTarget(unityTexturePtr);
+        if (!target)
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: Size mismatch (src=%dx%d, dst=%dx%d), skipping frame",
-                srcDesc.Width, srcDesc.Height, dstDesc.Width, dstDesc.Height);
+            DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - readback device not initialized");
+            return;
+        }
+        if (target->flipMode != flipMode)
+        {
+            // The destination holds the other orientation, next upload must be whole
+            target->flipMode = flipMode;
+            target->lastUploadedSequence = 0;
+        }
+        if (target->ring->GetWidth() != srcDesc.Width || target->ring->GetHeight() != srcDesc.Height)
+        {
+            // Resized in place: the destination holds frames of the old size
+            target->lastUploadedSequence = 0;
+        }
+
+        // The staging copy is always whole: which rows get uploaded is only
+        // known once the slot is presented
+        if (!target->ring->Submit(srcTexture, srcDesc.Width, srcDesc.Height))
+        {
+            DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - failed to submit staging copy");
             return;
         }
 
-        // Problem: srcTexture is from capture device, dstTexture is from D3D11On12 device
-        // We need to copy via CPU or shared texture
-        // For now, use CPU copy via staging texture
+        // Dirty rectangles are relative to the previous capture frame, so they
+        // are unknown if the previous frame never reached this ring
+        const bool contiguous = target->lastSubmittedSerial != 0 && frame.serial == target->lastSubmittedSerial + 1;
+        target->dirtyHistory.Record(target->ring->GetLastSubmittedSequence(),
+            contiguous ? frame.dirtyRects : nullptr, frame.dirtyRectCount);
+        target->lastSubmittedSerial = frame.serial;
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Creating staging texture on capture device...");
+        // Kick the copy and its completion query off to the GPU
+        m_captureD3D11Context->Flush();
 
-        // Create staging texture on capture device
-        D3D11_TEXTURE2D_DESC stagingDesc = srcDesc;
-        stagingDesc.Usage = D3D11_USAGE_STAGING;
-        stagingDesc.BindFlags = 0;
-        stagingDesc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
-        stagingDesc.MiscFlags = 0;
+        ResolveReadback(unityTexturePtr);
+    }
 
-        ComPtr<ID3D11Texture2D> stagingTexture;
-        hr = m_captureD3D11Device->CreateTexture2D(&stagingDesc, nullptr, &stagingTexture);
-        if (FAILED(hr))
+    bool RenderAPI_D3D12::ResolvePendingCopies(void* unityTexturePtr)
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        FinishCopiesInto(unityTexturePtr);
+        return ResolveReadback(unityTexturePtr);
+    }
+
+    bool RenderAPI_D3D12::ResolveReadback(void* unityTexturePtr)
+    {
+        auto it = m_readbackTargets.find(unityTexturePtr);
+        if (it == m_readbackTargets.end())
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - failed to create staging texture: 0x%08X", hr);
-            return;
+            return false;
+        }
+
+        ReadbackTarget& target = it->second;
+        ReadbackRing& ring = *target.ring;
+        const ReadbackSlot* slot = ring.AcquireLatest();
+        if (slot)
+        {
+            if (PrepareReadbackUpload(unityTexturePtr, *slot, target))
+            {
+                if (RecordNativeUpload(unityTexturePtr, target))
+                {
+                    // Recorded outside the batch, submitted with it
+                    m_copyBatch.RequestFlush(*this);
+                    return ring.GetPendingCount() > 0;
+                }
+
+                // The slot is released once the upload is recorded
+                CopyBatchEntry entry;
+                entry.destination = m_wrappedResources[unityTexturePtr]->d3d11Resource.Get();
+                entry.payload = &target;
+                entry.kind = CopyKindReadbackUpload;
+                m_copyBatch.Submit(entry, *this);
+            }
+            else
+            {
+                ring.Release(slot);
+            }
         }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Copying captured texture to staging...");
-        // Copy captured texture to staging
-        m_captureD3D11Context->CopyResource(stagingTexture.Get(), srcTexture);
+        return ring.GetPendingCount() > 0;
+    }
+
+    bool RenderAPI_D3D12::PrepareReadbackUpload(void* unityTexturePtr, const ReadbackSlot& slot, ReadbackTarget& target)
+    {
+        HRESULT hr; // Declare once for entire function
+
+        auto* wrapped = GetOrCreateWrappedResource(unityTexturePtr);
+        if (!wrapped)
+        {
+            DebugLog::Log("PrepareReadbackUpload: ERROR - failed to wrap Unity texture");
+            return false;
+        }
+
+        // The frame must fit - a larger one is from before a resize, skip it.
+        // A smaller one fills the top-left part of a pooled texture.
+        if (slot.width > wrapped->width || slot.height > wrapped->height)
+        {
+            DebugLog::Log("PrepareReadbackUpload: Size mismatch (src=%ux%u, dst=%ux%u), skipping frame",
+                slot.width, slot.height, wrapped->width, wrapped->height);
+            return false;
+        }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Mapping staging texture...");
-        // Map staging texture
+        // The slot's copy has already retired, so this Map does not stall
+        auto stagingTexture = static_cast<ID3D11Texture2D*>(slot.stagingTexture);
         D3D11_MAPPED_SUBRESOURCE mapped;
-        hr = m_captureD3D11Context->Map(stagingTexture.Get(), 0, D3D11_MAP_READ, 0, &mapped);
+        hr = m_captureD3D11Context->Map(stagingTexture, 0, D3D11_MAP_READ, 0, &mapped);
         if (FAILED(hr))
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: ERROR - failed to map staging texture: 0x%08X", hr);
-            return;
+            DebugLog::Log("PrepareReadbackUpload: ERROR - failed to map staging texture: 0x%08X", hr);
+            return false;
         }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Acquiring wrapped resource...");
-        // Acquire the wrapped resource for D3D11 use
-        ID3D11Resource* resources[] = { wrapped->d3d11Resource.Get() };
-        m_d3d11On12Device->AcquireWrappedResources(resources, 1);
+        // Partial upload when the destination holds an earlier frame of this ring
+        // and every frame in between reported its dirty rectangles
+        const std::vector<PixelRect>* boxes = nullptr;
+        const std::vector<ScrollMove>* moves = nullptr;
+        if (target.lastUploadedSequence == 0)
+        {
+            target.tileDetector.Reset();
+            target.scrollDetector.Reset();
+        }
+
+        // Every frame is hashed for scrolls, whichever way it is uploaded. The
+        // moves run on Unity's queue, so only with the native upload path.
+        const auto* pixels = static_cast<const uint8_t*>(mapped.pData);
+        const bool scrolled = m_uploadDevice && target.scrollDetector.Detect(pixels, mapped.RowPitch, slot.width, slot.height);
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Updating destination texture via CPU...");
-        // Update destination texture via UpdateSubresource or Map/Unmap
-        UINT minWidth = std::min(srcDesc.Width, dstDesc.Width);
-        UINT minHeight = std::min(srcDesc.Height, dstDesc.Height);
+        if (target.dirtyHistory.Collect(target.lastUploadedSequence, slot.sequence, m_dirtyScratch))
+        {
+            const auto& coalesced = m_dirtyCoalescer.Coalesce(m_dirtyScratch.data(), m_dirtyScratch.size(), slot.width, slot.height);
+            if (!m_dirtyCoalescer.IsFullFrame())
+            {
+                boxes = &coalesced;
+            }
+
+            // This upload bypasses the tile hashes, so they no longer match the destination
+            target.tileDetector.Reset();
+        }
+        else
+        {
+            // No usable metadata: find the changed tiles ourselves
+            const auto& tiles = target.tileDetector.Detect(pixels, mapped.RowPitch, slot.width, slot.height);
+            if (!target.tileDetector.IsFullFrame())
+            {
+                const auto& coalesced = m_dirtyCoalescer.Coalesce(tiles.data(), tiles.size(), slot.width, slot.height);
+                if (!m_dirtyCoalescer.IsFullFrame())
+                {
+                    boxes = &coalesced;
+                }
+            }
+        }
+
+        // A scroll invalidates most of the frame: moving it and patching the
+        // exposed lines wins whenever that uploads less
+        if (scrolled)
+        {
+            int64_t boxArea = static_cast<int64_t>(slot.width) * slot.height;
+            if (boxes)
+            {
+                boxArea = 0;
+                for (const PixelRect& box : *boxes)
+                {
+                    boxArea += RectArea(box);
+                }
+            }
 
-        if (flipY)
+            if (target.scrollDetector.GetPatchArea() < boxArea)
+            {
+                boxes = &target.scrollDetector.GetPatches();
+                moves = &target.scrollDetector.GetMoves();
+            }
+        }
+
+        if (boxes && boxes->empty() && !moves)
+        {
+            // Identical to what the destination already holds
+            m_captureD3D11Context->Unmap(stagingTexture, 0);
+            target.lastUploadedSequence = slot.sequence;
+            target.dirtyHistory.DiscardThrough(slot.sequence);
+            return false;
+        }
+
+        // Recorded with the copy batch. The boxes point into scratch shared by
+        // every view, so the target keeps its own copy.
+        target.pendingSlot = &slot;
+        target.pendingMapped = mapped;
+        target.pendingDestination = wrapped->d3d11Texture;
+        target.pendingPartial = boxes != nullptr;
+        target.pendingBoxes.clear();
+        if (boxes)
+        {
+            target.pendingBoxes.insert(target.pendingBoxes.end(), boxes->begin(), boxes->end());
+        }
+        target.pendingMoves.clear();
+        if (moves)
+        {
+            target.pendingMoves.insert(target.pendingMoves.end(), moves->begin(), moves->end());
+        }
+        return true;
+    }
+
+    void RenderAPI_D3D12::RecordReadbackUpload(ReadbackTarget& target)
+    {
+        const ReadbackSlot& slot = *target.pendingSlot;
+        const D3D11_MAPPED_SUBRESOURCE& mapped = target.pendingMapped;
+        ID3D11Texture2D* dstTexture = target.pendingDestination.Get();
+
+        D3D11_TEXTURE2D_DESC dstDesc;
+        dstTexture->GetDesc(&dstDesc);
+
+        // Moves are only recorded natively, the patches alone would leave the
+        // moved lines stale. Any moves already recorded run first on the queue.
+        if (!target.pendingMoves.empty())
+        {
+            target.pendingMoves.clear();
+            target.pendingPartial = false;
+        }
+
+        // Update destination texture via UpdateSubresource, into its top-left part
+        UINT minWidth = std::min(slot.width, dstDesc.Width);
+        UINT minHeight = std::min(slot.height, dstDesc.Height);
+        const D3D11_BOX frameBox = { 0, 0, 0, minWidth, minHeight, 1 };
+
+        if (target.pendingPartial)
+        {
+            UploadBoxes(dstTexture, mapped, slot, target, target.pendingBoxes.data(), target.pendingBoxes.size());
+        }
+        else if (target.flipMode == FlipMode::SinglePass)
+        {
+            // Flip into the persistent CPU buffer, then upload it in one call
+            size_t pitch = TransformPixelsIntoBuffer(static_cast<const uint8_t*>(mapped.pData), mapped.RowPitch,
+                minWidth, minHeight, PixelOps::None, true, target.flipBuffer);
+            m_d3d11Context->UpdateSubresource(dstTexture, 0, &frameBox, target.flipBuffer.data(), static_cast<UINT>(pitch), 0);
+        }
+        else if (target.flipMode == FlipMode::RowCopy)
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: Copying with Y-flip...");
             // Copy row by row with Y-flip
             for (UINT y = 0; y < minHeight; y++)
             {
                 // For Y-flip: destination row y gets source row (Height - 1 - y)
-                UINT srcY = srcDesc.Height - 1 - y;
+                UINT srcY = slot.height - 1 - y;
                 BYTE* srcRow = (BYTE*)mapped.pData + srcY * mapped.RowPitch;
 
                 // Destination box - where we're writing in the destination texture
@@ -651,34 +1088,254 @@ namespace WebViewToolkit
                 dstBox.front = 0;
                 dstBox.back = 1;
 
-                m_d3d11Context->UpdateSubresource(dstTexture.Get(), 0, &dstBox, srcRow, mapped.RowPitch, 0);
+                m_d3d11Context->UpdateSubresource(dstTexture, 0, &dstBox, srcRow, mapped.RowPitch, 0);
             }
         }
         else
         {
-            DebugLog::Log("CopyCapturedTextureToUnityTexture: Copying without flip...");
-            m_d3d11Context->UpdateSubresource(dstTexture.Get(), 0, nullptr, mapped.pData, mapped.RowPitch, 0);
+            m_d3d11Context->UpdateSubresource(dstTexture, 0, &frameBox, mapped.pData, mapped.RowPitch, 0);
         }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Unmapping staging texture...");
-        m_captureD3D11Context->Unmap(stagingTexture.Get(), 0);
+        // UpdateSubresource has taken its own copy of the pixels
+        FinishReadbackUpload(target);
+    }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Releasing wrapped resource...");
-        // Release the wrapped resource back to D3D12
-        m_d3d11On12Device->ReleaseWrappedResources(resources, 1);
-        m_d3d11Context->Flush();
+    bool RenderAPI_D3D12::RecordNativeUpload(void* unityTexturePtr, ReadbackTarget& target)
+    {
+        auto it = m_wrappedResources.find(unityTexturePtr);
+        if (!m_uploadDevice || it == m_wrappedResources.end())
+        {
+            return false;
+        }
+
+        const ReadbackSlot& slot = *target.pendingSlot;
+        const auto* pixels = static_cast<const uint8_t*>(target.pendingMapped.pData);
+        const size_t pitch = target.pendingMapped.RowPitch;
+        ID3D12Resource* destination = it->second->d3d12Resource.Get();
+
+        D3D11_TEXTURE2D_DESC dstDesc;
+        target.pendingDestination->GetDesc(&dstDesc);
+
+        // One copy per box; the flip is applied while writing the ring, so
+        // RowCopy and SinglePass record the same copies
+        const bool flipY = target.flipMode != FlipMode::None;
+        const PixelRect frameRect = { 0, 0, static_cast<int32_t>(std::min(slot.width, dstDesc.Width)),
+            static_cast<int32_t>(std::min(slot.height, dstDesc.Height)) };
+        const PixelRect* rects = target.pendingPartial ? target.pendingBoxes.data() : &frameRect;
+        const size_t rectCount = target.pendingPartial ? target.pendingBoxes.size() : 1;
+
+        // Marked up front so the submit signals even if a later box fails
+        m_timeline.MarkWritten(it->second->d3d11Resource.Get());
+
+        // Scrolled content moves within the destination before the patches land
+        for (const ScrollMove& move : target.pendingMoves)
+        {
+            const PixelRect moved = { move.source.left + move.dx, move.source.top + move.dy,
+                move.source.right + move.dx, move.source.bottom + move.dy };
+            const PixelRect source = flipY ? RectFlipY(move.source, slot.height) : move.source;
+            const PixelRect placed = flipY ? RectFlipY(moved, slot.height) : moved;
+            if (!m_uploadDevice->RecordMove(destination, source, static_cast<uint32_t>(placed.left),
+                static_cast<uint32_t>(placed.top)))
+            {
+                DebugLog::Log("RecordNativeUpload: Move failed, frame %llu goes through D3D11On12", slot.sequence);
+                return false;
+            }
+        }
+
+        for (size_t i = 0; i < rectCount; i++)
+        {
+            const PixelRect placed = flipY ? RectFlipY(rects[i], slot.height) : rects[i];
+            if (!m_uploadDevice->RecordUpload(destination, pixels, pitch, rects[i],
+                static_cast<uint32_t>(placed.left), static_cast<uint32_t>(placed.top), flipY))
+            {
+                // Ring full: the D3D11On12 upload rewrites the boxes recorded so far
+                DebugLog::Log("RecordNativeUpload: Upload ring full, frame %llu goes through D3D11On12", slot.sequence);
+                return false;
+            }
+        }
+
+        // The ring holds its own copy of the pixels
+        FinishReadbackUpload(target);
+        return true;
+    }
+
+    void RenderAPI_D3D12::FinishReadbackUpload(ReadbackTarget& target)
+    {
+        const ReadbackSlot& slot = *target.pendingSlot;
+        m_captureD3D11Context->Unmap(static_cast<ID3D11Texture2D*>(slot.stagingTexture), 0);
+
+        target.lastUploadedSequence = slot.sequence;
+        target.dirtyHistory.DiscardThrough(slot.sequence);
+
+        target.ring->Release(target.pendingSlot);
+        target.pendingSlot = nullptr;
+        target.pendingDestination.Reset();
+        target.pendingMoves.clear();
+    }
+
+    void RenderAPI_D3D12::UploadBoxes(ID3D11Texture2D* dstTexture, const D3D11_MAPPED_SUBRESOURCE& mapped, const ReadbackSlot& slot,
+        ReadbackTarget& target, const PixelRect* boxes, size_t boxCount)
+    {
+        const auto* pixels = static_cast<const uint8_t*>(mapped.pData);
+
+        for (size_t i = 0; i < boxCount; i++)
+        {
+            const PixelRect& rect = boxes[i];
+            const uint8_t* boxPixels = pixels + static_cast<size_t>(rect.top) * mapped.RowPitch + static_cast<size_t>(rect.left) * 4;
+            const auto boxWidth = static_cast<uint32_t>(rect.right - rect.left);
+            const auto boxHeight = static_cast<uint32_t>(rect.bottom - rect.top);
+
+            if (target.flipMode == FlipMode::SinglePass)
+            {
+                // Flip just this box, then upload it to its mirrored position
+                size_t pitch = TransformPixelsIntoBuffer(boxPixels, mapped.RowPitch, boxWidth, boxHeight,
+                    PixelOps::None, true, target.flipBuffer);
+                const PixelRect flipped = RectFlipY(rect, slot.height);
+                const D3D11_BOX dstBox = { static_cast<UINT>(flipped.left), static_cast<UINT>(flipped.top), 0,
+                    static_cast<UINT>(flipped.right), static_cast<UINT>(flipped.bottom), 1 };
+                m_d3d11Context->UpdateSubresource(dstTexture, 0, &dstBox, target.flipBuffer.data(), static_cast<UINT>(pitch), 0);
+            }
+            else if (target.flipMode == FlipMode::RowCopy)
+            {
+                for (int32_t y = rect.top; y < rect.bottom; y++)
+                {
+                    const UINT dstY = slot.height - 1 - static_cast<UINT>(y);
+                    const D3D11_BOX dstBox = { static_cast<UINT>(rect.left), dstY, 0, static_cast<UINT>(rect.right), dstY + 1, 1 };
+                    m_d3d11Context->UpdateSubresource(dstTexture, 0, &dstBox,
+                        boxPixels + static_cast<size_t>(y - rect.top) * mapped.RowPitch, mapped.RowPitch, 0);
+                }
+            }
+            else
+            {
+                const D3D11_BOX dstBox = { static_cast<UINT>(rect.left), static_cast<UINT>(rect.top), 0,
+                    static_cast<UINT>(rect.right), static_cast<UINT>(rect.bottom), 1 };
+                m_d3d11Context->UpdateSubresource(dstTexture, 0, &dstBox, boxPixels, mapped.RowPitch, 0);
+            }
+        }
+    }
+
+    // ========================================================================
+    // Copy Batch
+    // ========================================================================
+
+    void RenderAPI_D3D12::BeginCopyBatch()
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        m_copyBatch.Begin();
+    }
 
-        DebugLog::Log("CopyCapturedTextureToUnityTexture: Success!");
+    void RenderAPI_D3D12::EndCopyBatch()
+    {
+        std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+        m_copyBatch.End(*this);
+        if (m_copyBatch.IsOpen())
+        {
+            return;
+        }
+
+        for (void* nativePtr : m_deferredDestroys)
+        {
+            ReleaseSharedTexture(nativePtr);
+        }
+        m_deferredDestroys.clear();
+
+        m_deferredReleases.Poll();
+    }
+
+    void RenderAPI_D3D12::FinishCopiesInto(void* unityTexturePtr)
+    {
+        auto it = m_wrappedResources.find(unityTexturePtr);
+        if (it != m_wrappedResources.end() && m_copyBatch.Contains(it->second->d3d11Resource.Get()))
+        {
+            m_copyBatch.Execute(*this);
+        }
+    }
+
+    void RenderAPI_D3D12::PrepareCopy(const CopyBatchEntry& entry)
+    {
+        if (entry.kind == CopyKindSharedSurface)
+        {
+            static_cast<SharedSurfaceDevice_D3D12*>(entry.payload)->SubmitConsumerWait();
+        }
+    }
+
+    void RenderAPI_D3D12::BeginAccess(void* const* resources, uint32_t count)
+    {
+        // One transition barrier batch for every view of the event
+        m_batchResources.clear();
+        for (uint32_t i = 0; i < count; i++)
+        {
+            m_batchResources.push_back(static_cast<ID3D11Resource*>(resources[i]));
+        }
+        m_d3d11On12Device->AcquireWrappedResources(m_batchResources.data(), count);
+    }
+
+    void RenderAPI_D3D12::RecordCopy(const CopyBatchEntry& entry)
+    {
+        m_timeline.MarkWritten(entry.destination);
+        if (entry.kind == CopyKindSharedSurface)
+        {
+            static_cast<SharedSurfaceDevice_D3D12*>(entry.payload)->RecordConsumerCopy();
+        }
+        else
+        {
+            RecordReadbackUpload(*static_cast<ReadbackTarget*>(entry.payload));
+        }
+    }
+
+    void RenderAPI_D3D12::EndAccess(void* const* /*resources*/, uint32_t count)
+    {
+        m_d3d11On12Device->ReleaseWrappedResources(m_batchResources.data(), count);
+    }
+
+    void RenderAPI_D3D12::Flush()
+    {
+        // Native uploads reach the queue first, then the signal covers them
+        // and the D3D11On12 work behind the next timeline value
+        if (m_uploadDevice)
+        {
+            m_uploadDevice->Submit();
+        }
+        m_timeline.Signal();
+    }
+
+    void RenderAPI_D3D12::FinishCopy(const CopyBatchEntry& entry)
+    {
+        if (entry.kind == CopyKindSharedSurface)
+        {
+            static_cast<SharedSurfaceDevice_D3D12*>(entry.payload)->SubmitConsumerSignal();
+        }
     }
 
     void RenderAPI_D3D12::ReleaseResources()
     {
-        // Wait for GPU to finish all work
-        WaitForGPU();
+        {
+            // Wait for the toolkit's own copies, then for the signal behind each
+            // retired resource: Unity may have used those since, and keeps
+            // running across a device reset. Both are no-ops once completed.
+            // Textures still in use are dropped by their views with the device.
+            std::lock_guard<std::mutex> lock(m_copyBatchMutex);
+            m_timeline.WaitForIdle();
+            m_uploadDevice.reset();
+            m_texturePool.Reset();
+            m_deferredReleases.WaitForAll();
+            m_deferredReleases.ReleaseAll();
+            for (const auto& pair : m_wrappedResources)
+            {
+                m_timeline.Forget(pair.second->d3d11Resource.Get());
+            }
+        }
 
         // Clear wrapped resources
         m_wrappedResources.clear();
 
+        // Release staging rings and shared surfaces while the capture device is still alive
+        m_readbackTargets.clear();
+        m_readbackDevice.reset();
+        m_sharedTransfers.clear();
+        m_captureCopier.reset();
+        m_sharedTransferEnabled = false;
+
         // Release fence event
         if (m_fenceEvent)
         {
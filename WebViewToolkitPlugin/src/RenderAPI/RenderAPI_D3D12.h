@@ -10,18 +10,36 @@
 
 #ifdef WEBVIEW_TOOLKIT_DX12_SUPPORT
 
+#include "Core/CopyBatch.h"
+#include "Core/DeferredReleaseQueue.h"
+#include "Core/DirtyRegion.h"
+#include "Core/FrameTimeline.h"
+#include "Core/ReadbackRing.h"
+#include "Core/ScrollDetector.h"
+#include "Core/TileChangeDetector.h"
+#include "Core/SharedSurfaceSync.h"
+#include "Core/SharedTexturePool.h"
+#include "ReadbackDevice_D3D11.h"
+#include "SharedSurfaceDevice_D3D12.h"
+#include "TextureCopier_D3D11.h"
+#include "UploadDevice_D3D12.h"
+
 #include <d3d12.h>
 #include <d3d11on12.h>
 #include <d3d11.h>
 #include <dcomp.h>
 #include <wrl/client.h>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
+#include <vector>
 
 using Microsoft::WRL::ComPtr;
 
 namespace WebViewToolkit
 {
-    class RenderAPI_D3D12 final : public IRenderAPI
+    class RenderAPI_D3D12 final : public IRenderAPI, private ICopyBatchRecorder, private ISharedTextureFactory,
+        private IGpuFence, private IDeferredReleaser
     {
     public:
         RenderAPI_D3D12();
@@ -35,6 +53,8 @@ namespace WebViewToolkit
         Result CreateSharedTexture(uint32_t width, uint32_t height, void** outNativePtr) override;
         void DestroySharedTexture(void* nativePtr) override;
         Result ResizeSharedTexture(void* nativePtr, uint32_t newWidth, uint32_t newHeight, void** outNewNativePtr) override;
+        bool ResizeSharedTextureInPlace(void* nativePtr, uint32_t newWidth, uint32_t newHeight) override;
+        bool GetSharedTextureSize(void* nativePtr, uint32_t& outWidth, uint32_t& outHeight) override;
 
         void BeginRenderToTexture(void* texturePtr) override;
         void EndRenderToTexture(void* texturePtr) override;
@@ -45,25 +65,129 @@ namespace WebViewToolkit
 
         void WaitForGPU() override;
         void SignalRenderComplete() override;
+        uint64_t GetLastWrittenFence(void* texturePtr) override;
+        void WaitForTextureWrites(void* texturePtr) override;
+
+        void CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode flipMode) override;
+        bool ResolvePendingCopies(void* unityTexturePtr) override;
 
-        void CopyCapturedTextureToUnityTexture(void* capturedTexture, void* unityTexturePtr, bool flipY) override;
+        void BeginCopyBatch() override;
+        void EndCopyBatch() override;
 
     private:
         Result InitializeD3D11On12();
         Result InitializeCaptureDevice();
         Result InitializeCompositionDevice();
         Result CreateFence();
+        void InitializeUploadDevice();
         void ReleaseResources();
 
-        // Track wrapped resources for state transitions
+        // Track wrapped resources for state transitions. The texture interface
+        // and size are queried once at wrap time, not on every frame.
         struct WrappedResource
         {
             ComPtr<ID3D12Resource> d3d12Resource;
             ComPtr<ID3D11Resource> d3d11Resource;
+            ComPtr<ID3D11Texture2D> d3d11Texture;
+            UINT width = 0;
+            UINT height = 0;
         };
 
         WrappedResource* GetOrCreateWrappedResource(void* d3d12TexturePtr);
 
+        // Per-destination readback state for the CPU copy path
+        struct ReadbackTarget
+        {
+            std::unique_ptr<ReadbackRing> ring;
+            FlipMode flipMode = FlipMode::SinglePass;
+            std::vector<uint8_t> flipBuffer;    // Persistent upload buffer for FlipMode::SinglePass
+
+            // Slots are presented late and may be skipped, so partial uploads need
+            // the dirty rectangles of every frame since the last uploaded one
+            DirtyRegionHistory dirtyHistory;    // Keyed by ring sequence
+            uint64_t lastSubmittedSerial = 0;   // Capture serial of the last submitted frame
+            uint64_t lastUploadedSequence = 0;  // Ring sequence the destination holds, 0 = none
+
+            // Without dirty rectangles, diff each mapped frame against the last
+            // upload tile by tile. Only valid while every upload goes through it.
+            TileChangeDetector tileDetector;
+
+            // A mapped frame that is the last upload scrolled becomes moves within
+            // the destination plus patches. Same validity as the tile hashes.
+            ScrollDetector scrollDetector;
+
+            // Upload waiting in the copy batch; its slot stays acquired and
+            // mapped until the upload is recorded
+            const ReadbackSlot* pendingSlot = nullptr;
+            D3D11_MAPPED_SUBRESOURCE pendingMapped = {};
+            ComPtr<ID3D11Texture2D> pendingDestination;
+            std::vector<PixelRect> pendingBoxes;
+            std::vector<ScrollMove> pendingMoves;   // Recorded before the boxes, natively only
+            bool pendingPartial = false;
+        };
+
+        // Per-destination state for the GPU shared-surface path. Each target has
+        // its own fence pair because the sync numbers its timelines from zero.
+        struct SharedTransfer
+        {
+            std::unique_ptr<SharedSurfaceDevice_D3D12> device;
+            std::unique_ptr<SharedSurfaceSync> sync;
+        };
+
+        SharedTransfer* GetOrCreateSharedTransfer(void* unityTexturePtr);
+        bool CopyThroughSharedSurface(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc,
+            void* unityTexturePtr, FlipMode flipMode);
+
+        ReadbackTarget* GetOrCreateReadbackTarget(void* unityTexturePtr);
+        bool ResolveReadback(void* unityTexturePtr);
+        bool PrepareReadbackUpload(void* unityTexturePtr, const ReadbackSlot& slot, ReadbackTarget& target);
+        void RecordReadbackUpload(ReadbackTarget& target);
+        bool RecordNativeUpload(void* unityTexturePtr, ReadbackTarget& target);
+        void FinishReadbackUpload(ReadbackTarget& target);
+        void UploadBoxes(ID3D11Texture2D* dstTexture, const D3D11_MAPPED_SUBRESOURCE& mapped, const ReadbackSlot& slot,
+            ReadbackTarget& target, const PixelRect* boxes, size_t boxCount);
+
+        // Copy batch: all copies of a render event share one acquire, release and flush
+        enum CopyKind : uint32_t
+        {
+            CopyKindSharedSurface,  // payload: SharedSurfaceDevice_D3D12
+            CopyKindReadbackUpload, // payload: ReadbackTarget
+        };
+
+        void PrepareCopy(const CopyBatchEntry& entry) override;
+        void BeginAccess(void* const* resources, uint32_t count) override;
+        void RecordCopy(const CopyBatchEntry& entry) override;
+        void EndAccess(void* const* resources, uint32_t count) override;
+        void Flush() override;
+        void FinishCopy(const CopyBatchEntry& entry) override;
+
+        /// @brief Execute the open batch if it already copies into this texture,
+        ///        so a second copy in the same event lands in order
+        void FinishCopiesInto(void* unityTexturePtr);
+        void ReleaseSharedTexture(void* nativePtr);
+        void DestroySharedTextureNow(void* nativePtr);
+
+        // ISharedTextureFactory: allocations behind the texture pool
+        void* CreateTexture(uint32_t width, uint32_t height) override;
+        void DestroyTexture(void* texture) override;
+
+        // Deferred release: resources retired while queued GPU work may still use them
+        enum ReleaseKind : uint32_t
+        {
+            ReleaseKindTexture,         // ID3D12Resource, one reference
+            ReleaseKindWrapped,         // WrappedResource, heap-allocated
+            ReleaseKindSharedTransfer,  // SharedTransfer, heap-allocated
+        };
+
+        void RetireWrappedResource(void* nativePtr);
+        void RetireSharedTransfer(void* nativePtr);
+
+        // IGpuFence on m_fence, behind m_timeline and m_deferredReleases
+        uint64_t Signal() override;
+        uint64_t GetCompletedValue() override;
+        void Wait(uint64_t value) override;
+        void ReleaseNow(void* resource, uint32_t kind) override;
+
         // D3D12 resources (from Unity)
         ComPtr<ID3D12Device> m_d3d12Device;
         ComPtr<ID3D12CommandQueue> m_d3d12CommandQueue;
@@ -77,6 +201,23 @@ namespace WebViewToolkit
         ComPtr<ID3D11Device> m_captureD3D11Device;
         ComPtr<ID3D11DeviceContext> m_captureD3D11Context;
 
+        // Staging readback rings on the capture device, keyed by Unity texture
+        std::unique_ptr<ReadbackDevice_D3D11> m_readbackDevice;
+        std::unordered_map<void*, ReadbackTarget> m_readbackTargets;
+        DirtyRegionCoalescer m_dirtyCoalescer;
+        std::vector<PixelRect> m_dirtyScratch;
+
+        // Readback uploads recorded natively on Unity's queue through an
+        // upload-heap ring; D3D11On12 UpdateSubresource if unavailable or full.
+        // Guarded by m_copyBatchMutex.
+        std::unique_ptr<UploadDevice_D3D12> m_uploadDevice;
+
+        // GPU shared-surface transfer, keyed by Unity texture. Cleared on the
+        // first failure; the CPU readback path above then takes over.
+        bool m_sharedTransferEnabled = false;
+        std::unique_ptr<TextureCopier_D3D11> m_captureCopier;
+        std::unordered_map<void*, SharedTransfer> m_sharedTransfers;
+
         // DirectComposition
         ComPtr<IDCompositionDevice> m_compositionDevice;
 
@@ -87,6 +228,31 @@ namespace WebViewToolkit
 
         // Resource tracking
         std::unordered_map<void*, std::unique_ptr<WrappedResource>> m_wrappedResources;
+
+        // Copies of the current render event. The mutex also covers textures
+        // destroyed from the main thread while a batch still writes them; those
+        // are destroyed when the batch ends.
+        std::mutex m_copyBatchMutex;
+        CopyBatch m_copyBatch;
+        std::vector<ID3D11Resource*> m_batchResources;
+        std::vector<void*> m_deferredDestroys;
+
+        // Each flush of D3D11On12 work signals the next m_fence value on Unity's
+        // queue, which then runs after it; the timeline records the value per
+        // wrapped destination. Guarded by m_copyBatchMutex.
+        FrameTimeline m_timeline;
+
+        // Resources dropped while the GPU may still use them, released once
+        // m_fence passes a value signaled when they were retired. Not behind
+        // m_timeline: it skips the signal while no copy was recorded, and work
+        // Unity submitted since then may still use the resources. Polled at
+        // the end of each render event; guarded by m_copyBatchMutex.
+        DeferredReleaseQueue m_deferredReleases;
+
+        // Shared textures in size buckets, so resizes and recreated views reuse
+        // them along with their wrapped resources. Guarded by m_copyBatchMutex:
+        // evicting a texture drops the state the batch keys by it.
+        SharedTexturePool m_texturePool;
     };
 
 } // namespace WebViewToolkit
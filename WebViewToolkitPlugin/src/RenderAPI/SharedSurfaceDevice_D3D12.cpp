@@ -0,0 +1,278 @@
+// ============================================================================
+// WebViewToolkit - D3D12 Shared Surface Device Implementation
+// ============================================================================
+
+#include "SharedSurfaceDevice_D3D12.h"
+
+#ifdef WEBVIEW_TOOLKIT_DX12_SUPPORT
+
+#include "TextureCopier_D3D11.h"
+#include "Core/FrameResourceCounters.h"
+#include "DebugLog.h"
+
+#include <dxgi1_2.h>
+
+#include <algorithm>
+#include <memory>
+
+namespace WebViewToolkit
+{
+    SharedSurfaceDevice_D3D12::SharedSurfaceDevice_D3D12(ID3D11Device* captureDevice, ID3D11DeviceContext* captureContext,
+        TextureCopier_D3D11* captureCopier, ID3D12Device* d3d12Device, ID3D12CommandQueue* commandQueue,
+        ID3D11On12Device* d3d11On12Device, ID3D11DeviceContext* d3d11Context)
+        : m_captureDevice(captureDevice)
+        , m_captureContext(captureContext)
+        , m_captureCopier(captureCopier)
+        , m_d3d12Device(d3d12Device)
+        , m_commandQueue(commandQueue)
+        , m_d3d11On12Device(d3d11On12Device)
+        , m_d3d11Context(d3d11Context)
+    {
+    }
+
+    SharedSurfaceDevice_D3D12::~SharedSurfaceDevice_D3D12()
+    {
+        // The owner drains the queue before destroying the device
+        for (auto& retired : m_retired)
+        {
+            delete retired.surface;
+        }
+        m_retired.clear();
+    }
+
+    bool SharedSurfaceDevice_D3D12::Initialize()
+    {
+        if (!m_captureDevice || !m_captureContext || !m_captureCopier || !m_d3d12Device || !m_commandQueue ||
+            !m_d3d11On12Device || !m_d3d11Context)
+        {
+            return false;
+        }
+
+        // Shared fences need the Creators Update interfaces on the capture device
+        if (FAILED(m_captureDevice.As(&m_captureDevice5)) || FAILED(m_captureContext.As(&m_captureContext4)))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ID3D11Device5 unavailable, shared fences not supported");
+            return false;
+        }
+
+        // Producer fence: created on the capture device, opened on D3D12
+        HRESULT hr = m_captureDevice5->CreateFence(0, D3D11_FENCE_FLAG_SHARED, IID_PPV_ARGS(&m_producerFence));
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to create producer fence: 0x%08X", hr);
+            return false;
+        }
+
+        HANDLE handle = nullptr;
+        hr = m_producerFence->CreateSharedHandle(nullptr, GENERIC_ALL, nullptr, &handle);
+        if (SUCCEEDED(hr))
+        {
+            hr = m_d3d12Device->OpenSharedHandle(handle, IID_PPV_ARGS(&m_producerFenceOnQueue));
+            CloseHandle(handle);
+        }
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to share producer fence: 0x%08X", hr);
+            return false;
+        }
+
+        // Consumer fence: created on D3D12, opened on the capture device
+        hr = m_d3d12Device->CreateFence(0, D3D12_FENCE_FLAG_SHARED, IID_PPV_ARGS(&m_consumerFence));
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to create consumer fence: 0x%08X", hr);
+            return false;
+        }
+
+        handle = nullptr;
+        hr = m_d3d12Device->CreateSharedHandle(m_consumerFence.Get(), nullptr, GENERIC_ALL, nullptr, &handle);
+        if (SUCCEEDED(hr))
+        {
+            hr = m_captureDevice5->OpenSharedFence(handle, IID_PPV_ARGS(&m_consumerFenceOnCapture));
+            CloseHandle(handle);
+        }
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to share consumer fence: 0x%08X", hr);
+            return false;
+        }
+
+        return true;
+    }
+
+    void SharedSurfaceDevice_D3D12::CollectRetiredSurfaces()
+    {
+        if (m_retired.empty())
+        {
+            return;
+        }
+
+        // Retired in consumer order, so stop at the first one still in use
+        const uint64_t completed = m_consumerFence->GetCompletedValue();
+        while (!m_retired.empty() && m_retired.front().consumerValue <= completed)
+        {
+            delete m_retired.front().surface;
+            m_retired.pop_front();
+        }
+    }
+
+    void* SharedSurfaceDevice_D3D12::CreateSharedSurface(uint32_t width, uint32_t height)
+    {
+        CollectRetiredSurfaces();
+
+        D3D11_TEXTURE2D_DESC desc = {};
+        desc.Width = width;
+        desc.Height = height;
+        desc.MipLevels = 1;
+        desc.ArraySize = 1;
+        desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;  // Matches the capture frame pool format
+        desc.SampleDesc.Count = 1;
+        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE | D3D11_BIND_RENDER_TARGET;  // Flip blit target
+        desc.CPUAccessFlags = 0;
+        desc.MiscFlags = D3D11_RESOURCE_MISC_SHARED | D3D11_RESOURCE_MISC_SHARED_NTHANDLE;
+
+        auto surface = std::make_unique<Surface>();
+        HRESULT hr = m_captureDevice->CreateTexture2D(&desc, nullptr, &surface->captureTexture);
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to create shared texture %ux%u: 0x%08X", width, height, hr);
+            return nullptr;
+        }
+
+        Microsoft::WRL::ComPtr<IDXGIResource1> dxgiResource;
+        HANDLE handle = nullptr;
+        hr = surface->captureTexture.As(&dxgiResource);
+        if (SUCCEEDED(hr))
+        {
+            hr = dxgiResource->CreateSharedHandle(nullptr, DXGI_SHARED_RESOURCE_READ | DXGI_SHARED_RESOURCE_WRITE, nullptr, &handle);
+        }
+        if (SUCCEEDED(hr))
+        {
+            hr = m_d3d12Device->OpenSharedHandle(handle, IID_PPV_ARGS(&surface->d3d12Resource));
+            CloseHandle(handle);
+        }
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to open shared texture on D3D12: 0x%08X", hr);
+            return nullptr;
+        }
+
+        // Shared resources cross devices in the COMMON state
+        D3D11_RESOURCE_FLAGS d3d11Flags = {};
+        d3d11Flags.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+        hr = m_d3d11On12Device->CreateWrappedResource(
+            surface->d3d12Resource.Get(),
+            &d3d11Flags,
+            D3D12_RESOURCE_STATE_COMMON,
+            D3D12_RESOURCE_STATE_COMMON,
+            IID_PPV_ARGS(&surface->wrapped)
+        );
+        if (FAILED(hr))
+        {
+            DebugLog::Log("SharedSurfaceDevice_D3D12: ERROR - failed to wrap shared texture: 0x%08X", hr);
+            return nullptr;
+        }
+
+        return surface.release();
+    }
+
+    void SharedSurfaceDevice_D3D12::DestroySharedSurface(void* surface)
+    {
+        if (!surface)
+        {
+            return;
+        }
+
+        // No producer copy writes it again, so its cached view can go now
+        m_captureCopier->ReleaseViews(static_cast<Surface*>(surface)->captureTexture.Get());
+
+        // A resize may drop surfaces the queue still copies from; keep them
+        // alive until every consumer copy signaled so far has retired
+        m_retired.push_back({ static_cast<Surface*>(surface), m_lastConsumerSignal });
+        CollectRetiredSurfaces();
+    }
+
+    void SharedSurfaceDevice_D3D12::ProducerWait(uint64_t consumerValue)
+    {
+        m_captureContext4->Wait(m_consumerFenceOnCapture.Get(), consumerValue);
+    }
+
+    void SharedSurfaceDevice_D3D12::ProducerCopy(void* surface, void* sourceTexture, FlipMode flipMode)
+    {
+        auto srcTexture = static_cast<ID3D11Texture2D*>(sourceTexture);
+        auto dstTexture = static_cast<Surface*>(surface)->captureTexture.Get();
+        D3D11_TEXTURE2D_DESC srcDesc, dstDesc;
+        srcTexture->GetDesc(&srcDesc);
+        dstTexture->GetDesc(&dstDesc);
+
+        // Surfaces are sized to the live part of frames captured at a larger capacity
+        srcDesc.Width = std::min(srcDesc.Width, dstDesc.Width);
+        srcDesc.Height = std::min(srcDesc.Height, dstDesc.Height);
+
+        m_captureCopier->Copy(srcTexture, srcDesc, dstTexture, flipMode, nullptr, 0);
+    }
+
+    void SharedSurfaceDevice_D3D12::ProducerSignal(uint64_t producerValue)
+    {
+        m_captureContext4->Signal(m_producerFence.Get(), producerValue);
+
+        // The queue waits on this value, so it must reach the GPU now
+        m_captureContext->Flush();
+    }
+
+    void SharedSurfaceDevice_D3D12::ConsumerWait(uint64_t producerValue)
+    {
+        m_pendingCopy.producerValue = producerValue;
+    }
+
+    void SharedSurfaceDevice_D3D12::ConsumerCopy(void* surface, void* destinationTexture)
+    {
+        m_pendingCopy.surface = static_cast<Surface*>(surface);
+        m_pendingCopy.destination = static_cast<ID3D11Resource*>(destinationTexture);
+    }
+
+    void SharedSurfaceDevice_D3D12::ConsumerSignal(uint64_t consumerValue)
+    {
+        m_pendingCopy.consumerValue = consumerValue;
+
+        // Surfaces destroyed from now on wait for this copy, even before it is submitted
+        m_lastConsumerSignal = consumerValue;
+    }
+
+    ID3D11Resource* SharedSurfaceDevice_D3D12::GetPendingConsumerSource() const
+    {
+        return m_pendingCopy.surface ? m_pendingCopy.surface->wrapped.Get() : nullptr;
+    }
+
+    void SharedSurfaceDevice_D3D12::SubmitConsumerWait()
+    {
+        // Issued on the queue ahead of the batch's 11On12 work, which is only
+        // submitted by the batch's flush
+        m_commandQueue->Wait(m_producerFenceOnQueue.Get(), m_pendingCopy.producerValue);
+    }
+
+    void SharedSurfaceDevice_D3D12::RecordConsumerCopy()
+    {
+        if (m_pendingCopy.surface && m_pendingCopy.destination)
+        {
+            // Surfaces have the frame's size; a pooled destination may be larger
+            m_d3d11Context->CopySubresourceRegion(m_pendingCopy.destination, 0, 0, 0, 0, m_pendingCopy.surface->wrapped.Get(), 0, nullptr);
+        }
+    }
+
+    void SharedSurfaceDevice_D3D12::SubmitConsumerSignal()
+    {
+        m_commandQueue->Signal(m_consumerFence.Get(), m_pendingCopy.consumerValue);
+        m_pendingCopy = {};
+    }
+
+    uint64_t SharedSurfaceDevice_D3D12::GetConsumerCompletedValue()
+    {
+        return m_consumerFence->GetCompletedValue();
+    }
+
+} // namespace WebViewToolkit
+
+#endif // WEBVIEW_TOOLKIT_DX12_SUPPORT
@@ -0,0 +1,125 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - D3D12 Shared Surface Device
+// ============================================================================
+// ISharedSurfaceDevice between the standalone capture device (producer) and
+// Unity's D3D12 queue through D3D11On12 (consumer). Surfaces are NT-handle
+// shared textures; the two timelines are shared fences, so neither side ever
+// waits on the CPU. Requires ID3D11Device5 (Windows 10 1703+).
+//
+// Consumer calls only record the copy. The owner submits it as part of its
+// copy batch (SubmitConsumerWait / RecordConsumerCopy / SubmitConsumerSignal),
+// so the copies of several views share one acquire, release and flush.
+// ============================================================================
+
+#include "Core/SharedSurfaceSync.h"
+
+#ifdef WEBVIEW_TOOLKIT_DX12_SUPPORT
+
+#include <d3d12.h>
+#include <d3d11on12.h>
+#include <d3d11_4.h>
+#include <wrl/client.h>
+
+#include <deque>
+
+namespace WebViewToolkit
+{
+    class TextureCopier_D3D11;
+
+    class SharedSurfaceDevice_D3D12 final : public ISharedSurfaceDevice
+    {
+    public:
+        /// @param captureCopier Copier on the capture device, used for producer copies (weak ref)
+        SharedSurfaceDevice_D3D12(ID3D11Device* captureDevice, ID3D11DeviceContext* captureContext,
+            TextureCopier_D3D11* captureCopier, ID3D12Device* d3d12Device, ID3D12CommandQueue* commandQueue,
+            ID3D11On12Device* d3d11On12Device, ID3D11DeviceContext* d3d11Context);
+        ~SharedSurfaceDevice_D3D12() override;
+
+        /// @brief Create and cross-open the two shared fences
+        /// @return false if the drivers cannot share fences; use the CPU path instead
+        bool Initialize();
+
+        void* CreateSharedSurface(uint32_t width, uint32_t height) override;
+        void DestroySharedSurface(void* surface) override;
+
+        void ProducerWait(uint64_t consumerValue) override;
+        void ProducerCopy(void* surface, void* sourceTexture, FlipMode flipMode) override;
+        void ProducerSignal(uint64_t producerValue) override;
+
+        void ConsumerWait(uint64_t producerValue) override;
+        void ConsumerCopy(void* surface, void* destinationTexture) override;
+        void ConsumerSignal(uint64_t consumerValue) override;
+        uint64_t GetConsumerCompletedValue() override;
+
+        // Submission of the recorded consumer copy. One copy per submission:
+        // the owner submits before consuming into the same destination again.
+
+        /// @brief Wrapped shared surface the recorded copy reads, nullptr if none is recorded
+        ID3D11Resource* GetPendingConsumerSource() const;
+
+        /// @brief Queue wait on the producer fence, before the batch records anything
+        void SubmitConsumerWait();
+
+        /// @brief Record the copy; both wrapped resources must be acquired
+        void RecordConsumerCopy();
+
+        /// @brief Queue signal of the consumer fence, after the batch was flushed
+        void SubmitConsumerSignal();
+
+    private:
+        struct Surface
+        {
+            Microsoft::WRL::ComPtr<ID3D11Texture2D> captureTexture;     // Producer view
+            Microsoft::WRL::ComPtr<ID3D12Resource> d3d12Resource;       // Same memory on Unity's device
+            Microsoft::WRL::ComPtr<ID3D11Resource> wrapped;             // 11On12 view for the consumer copy
+        };
+
+        // Destroyed surfaces may still be read by a queued consumer copy
+        struct RetiredSurface
+        {
+            Surface* surface;
+            uint64_t consumerValue;
+        };
+
+        // Consumer copy recorded by SharedSurfaceSync, waiting for submission
+        struct PendingConsumerCopy
+        {
+            Surface* surface = nullptr;
+            ID3D11Resource* destination = nullptr;
+            uint64_t producerValue = 0;
+            uint64_t consumerValue = 0;
+        };
+
+        void CollectRetiredSurfaces();
+
+        // Producer (capture device)
+        Microsoft::WRL::ComPtr<ID3D11Device> m_captureDevice;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_captureContext;
+        Microsoft::WRL::ComPtr<ID3D11Device5> m_captureDevice5;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext4> m_captureContext4;
+        TextureCopier_D3D11* m_captureCopier; // Weak ref
+
+        // Consumer (Unity's queue via D3D11On12)
+        Microsoft::WRL::ComPtr<ID3D12Device> m_d3d12Device;
+        Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_commandQueue;
+        Microsoft::WRL::ComPtr<ID3D11On12Device> m_d3d11On12Device;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_d3d11Context;
+
+        // Producer timeline: signaled by the capture device, waited on by the queue
+        Microsoft::WRL::ComPtr<ID3D11Fence> m_producerFence;
+        Microsoft::WRL::ComPtr<ID3D12Fence> m_producerFenceOnQueue;
+
+        // Consumer timeline: signaled by the queue, waited on by the capture device
+        Microsoft::WRL::ComPtr<ID3D12Fence> m_consumerFence;
+        Microsoft::WRL::ComPtr<ID3D11Fence> m_consumerFenceOnCapture;
+        uint64_t m_lastConsumerSignal = 0;
+        PendingConsumerCopy m_pendingCopy;
+
+        std::deque<RetiredSurface> m_retired;
+    };
+
+} // namespace WebViewToolkit
+
+#endif // WEBVIEW_TOOLKIT_DX12_SUPPORT
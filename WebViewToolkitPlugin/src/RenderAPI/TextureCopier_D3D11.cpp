@@ -0,0 +1,597 @@
+// ============================================================================
+// WebViewToolkit - D3D11 Texture Copier Implementation
+// ============================================================================
+
+#include "TextureCopier_D3D11.h"
+
+#include <d3dcompiler.h>
+
+#include <algorithm>
+
+#include "Core/DirtyRegion.h"
+#include "Core/FrameResourceCounters.h"
+#include "DebugLog.h"
+
+namespace WebViewToolkit
+{
+    // ========================================================================
+    // Blit Shaders
+    // ========================================================================
+    // Fullscreen triangle from SV_VertexID, no vertex buffer or input layout.
+    // Flip: texel-exact, the pixel shader Loads (no filtering) the mirrored
+    // row. Rows are mirrored within the copied part, which may be smaller
+    // than the source texture.
+    // Scale: bilinear, the copied part of the source stretched over the
+    // viewport, optionally upside down.
+    static const char s_flipBlitShaderSource[] = R"(
+Texture2D<float4> Source : register(t0);
+SamplerState LinearClamp : register(s0);
+
+cbuffer FlipParams : register(b0)
+{
+    uint SourceHeight;
+};
+
+cbuffer ScaleParams : register(b1)
+{
+    float2 SourceScale;     // Copied part of the source, in UV
+    float2 TargetSize;      // Viewport in pixels
+    uint FlipY;
+};
+
+float4 VSMain(uint id : SV_VertexID) : SV_Position
+{
+    float2 uv = float2((id << 1) & 2, id & 2);
+    return float4(uv * float2(2.0, -2.0) + float2(-1.0, 1.0), 0.0, 1.0);
+}
+
+float4 PSMain(float4 position : SV_Position) : SV_Target
+{
+    int2 texel = int2(position.xy);
+    return Source.Load(int3(texel.x, int(SourceHeight) - 1 - texel.y, 0));
+}
+
+float4 PSScale(float4 position : SV_Position) : SV_Target
+{
+    float2 uv = position.xy / TargetSize;
+    if (FlipY != 0)
+    {
+        uv.y = 1.0 - uv.y;
+    }
+    return Source.SampleLevel(LinearClamp, uv * SourceScale, 0);
+}
+)";
+
+    namespace
+    {
+        // Preserves the bits of Unity's pipeline state a blit touches
+        class SavedPipelineState
+        {
+        public:
+            explicit SavedPipelineState(ID3D11DeviceContext* context)
+                : m_context(context)
+            {
+                m_context->OMGetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, m_rtvs, &m_dsv);
+                m_context->RSGetViewports(&m_viewportCount, m_viewports);
+                m_context->RSGetState(&m_rasterizer);
+                m_context->OMGetBlendState(&m_blend, m_blendFactor, &m_sampleMask);
+                m_context->OMGetDepthStencilState(&m_depthStencil, &m_stencilRef);
+                m_context->IAGetInputLayout(&m_layout);
+                m_context->IAGetPrimitiveTopology(&m_topology);
+                m_context->VSGetShader(&m_vs, nullptr, nullptr);
+                m_context->PSGetShader(&m_ps, nullptr, nullptr);
+                m_context->PSGetShaderResources(0, 1, &m_srv);
+                m_context->PSGetConstantBuffers(0, 2, m_constants);
+                m_context->PSGetSamplers(0, 1, &m_sampler);
+                m_context->RSGetScissorRects(&m_scissorCount, m_scissors);
+            }
+
+            ~SavedPipelineState()
+            {
+                // Restoring the source slot also unbinds the blit's source, so
+                // later copies into it do not hit read/write hazards
+                ID3D11ShaderResourceView* restoreSRV[] = { m_srv.Get() };
+                m_context->PSSetShaderResources(0, 1, restoreSRV);
+                m_context->PSSetConstantBuffers(0, 2, m_constants);
+                m_context->PSSetSamplers(0, 1, m_sampler.GetAddressOf());
+                m_context->PSSetShader(m_ps.Get(), nullptr, 0);
+                m_context->VSSetShader(m_vs.Get(), nullptr, 0);
+                m_context->IASetPrimitiveTopology(m_topology);
+                m_context->IASetInputLayout(m_layout.Get());
+                m_context->RSSetViewports(m_viewportCount, m_viewports);
+                m_context->RSSetScissorRects(m_scissorCount, m_scissors);
+                m_context->RSSetState(m_rasterizer.Get());
+                m_context->OMSetDepthStencilState(m_depthStencil.Get(), m_stencilRef);
+                m_context->OMSetBlendState(m_blend.Get(), m_blendFactor, m_sampleMask);
+                m_context->OMSetRenderTargets(D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT, m_rtvs, m_dsv.Get());
+
+                for (auto* view : m_rtvs)
+                {
+                    if (view)
+                    {
+                        view->Release();
+                    }
+                }
+                for (auto* buffer : m_constants)
+                {
+                    if (buffer)
+                    {
+                        buffer->Release();
+                    }
+                }
+            }
+
+            SavedPipelineState(const SavedPipelineState&) = delete;
+            SavedPipelineState& operator=(const SavedPipelineState&) = delete;
+
+        private:
+            ID3D11DeviceContext* m_context;
+            ID3D11RenderTargetView* m_rtvs[D3D11_SIMULTANEOUS_RENDER_TARGET_COUNT] = {};
+            Microsoft::WRL::ComPtr<ID3D11DepthStencilView> m_dsv;
+            UINT m_viewportCount = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+            D3D11_VIEWPORT m_viewports[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+            Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_rasterizer;
+            Microsoft::WRL::ComPtr<ID3D11BlendState> m_blend;
+            FLOAT m_blendFactor[4];
+            UINT m_sampleMask = 0;
+            Microsoft::WRL::ComPtr<ID3D11DepthStencilState> m_depthStencil;
+            UINT m_stencilRef = 0;
+            Microsoft::WRL::ComPtr<ID3D11InputLayout> m_layout;
+            D3D11_PRIMITIVE_TOPOLOGY m_topology = D3D11_PRIMITIVE_TOPOLOGY_UNDEFINED;
+            Microsoft::WRL::ComPtr<ID3D11VertexShader> m_vs;
+            Microsoft::WRL::ComPtr<ID3D11PixelShader> m_ps;
+            Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> m_srv;
+            ID3D11Buffer* m_constants[2] = {};
+            Microsoft::WRL::ComPtr<ID3D11SamplerState> m_sampler;
+            UINT m_scissorCount = D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE;
+            D3D11_RECT m_scissors[D3D11_VIEWPORT_AND_SCISSORRECT_OBJECT_COUNT_PER_PIPELINE];
+        };
+    }
+
+    TextureCopier_D3D11::TextureCopier_D3D11(ID3D11Device* device, ID3D11DeviceContext* context)
+        : m_device(device)
+        , m_context(context)
+    {
+    }
+
+    void TextureCopier_D3D11::ReleaseViews(ID3D11Texture2D* texture)
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+        const auto isTexture = [texture](const auto& entry) { return entry.texture == texture; };
+        m_sourceViews.erase(std::remove_if(m_sourceViews.begin(), m_sourceViews.end(), isTexture), m_sourceViews.end());
+        m_targetViews.erase(std::remove_if(m_targetViews.begin(), m_targetViews.end(), isTexture), m_targetViews.end());
+    }
+
+    template <typename View, typename CreateView>
+    Microsoft::WRL::ComPtr<View> TextureCopier_D3D11::GetView(std::vector<CachedView<View>>& cache,
+        ID3D11Texture2D* texture, CreateView createView)
+    {
+        std::lock_guard<std::mutex> lock(m_viewMutex);
+
+        // Most recently used last
+        const auto found = std::find_if(cache.begin(), cache.end(),
+            [texture](const CachedView<View>& entry) { return entry.texture == texture; });
+        if (found != cache.end())
+        {
+            std::rotate(found, found + 1, cache.end());
+            return cache.back().view;
+        }
+
+        Microsoft::WRL::ComPtr<View> view;
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(createView(texture, &view)))
+        {
+            return nullptr;
+        }
+
+        if (cache.size() >= MaxCachedViews)
+        {
+            cache.erase(cache.begin());
+        }
+        cache.push_back({ texture, view });
+        return view;
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> TextureCopier_D3D11::GetShaderResourceView(ID3D11Texture2D* texture)
+    {
+        return GetView(m_sourceViews, texture, [this](ID3D11Texture2D* resource, ID3D11ShaderResourceView** view)
+        {
+            return m_device->CreateShaderResourceView(resource, nullptr, view);
+        });
+    }
+
+    Microsoft::WRL::ComPtr<ID3D11RenderTargetView> TextureCopier_D3D11::GetRenderTargetView(ID3D11Texture2D* texture)
+    {
+        return GetView(m_targetViews, texture, [this](ID3D11Texture2D* resource, ID3D11RenderTargetView** view)
+        {
+            return m_device->CreateRenderTargetView(resource, nullptr, view);
+        });
+    }
+
+    void TextureCopier_D3D11::Copy(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+        FlipMode flipMode, const PixelRect* boxes, size_t boxCount)
+    {
+        if (boxes)
+        {
+            CopyBoxes(srcTexture, srcDesc, dstTexture, flipMode, boxes, boxCount);
+            return;
+        }
+
+        if (flipMode == FlipMode::SinglePass && FlipBlit(srcTexture, srcDesc, dstTexture, nullptr, 0))
+        {
+            return;
+        }
+
+        if (flipMode != FlipMode::None)
+        {
+            // Copy row by row in reverse to flip Y
+            // (also the fallback when the flip blit is unavailable)
+            const PixelRect whole = { 0, 0, static_cast<int32_t>(srcDesc.Width), static_cast<int32_t>(srcDesc.Height) };
+            CopyBoxes(srcTexture, srcDesc, dstTexture, FlipMode::RowCopy, &whole, 1);
+        }
+        else
+        {
+            // The copied part of the source goes to the top-left of a
+            // destination that may be larger
+            const D3D11_BOX srcBox = { 0, 0, 0, srcDesc.Width, srcDesc.Height, 1 };
+            m_context->CopySubresourceRegion(dstTexture, 0, 0, 0, 0, srcTexture, 0, &srcBox);
+        }
+    }
+
+    bool TextureCopier_D3D11::CreateFlipBlitResources()
+    {
+        if (m_flipVertexShader && m_flipPixelShader && m_flipParams)
+        {
+            return true;
+        }
+
+        if (m_flipBlitUnavailable || !m_device)
+        {
+            return false;
+        }
+
+        Microsoft::WRL::ComPtr<ID3DBlob> vsBlob, psBlob, errors;
+        HRESULT hr = D3DCompile(s_flipBlitShaderSource, sizeof(s_flipBlitShaderSource) - 1, "FlipBlit",
+            nullptr, nullptr, "VSMain", "vs_4_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &vsBlob, &errors);
+        if (SUCCEEDED(hr))
+        {
+            hr = D3DCompile(s_flipBlitShaderSource, sizeof(s_flipBlitShaderSource) - 1, "FlipBlit",
+                nullptr, nullptr, "PSMain", "ps_4_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &psBlob, &errors);
+        }
+        if (SUCCEEDED(hr))
+        {
+            hr = m_device->CreateVertexShader(vsBlob->GetBufferPointer(), vsBlob->GetBufferSize(), nullptr, &m_flipVertexShader);
+        }
+        if (SUCCEEDED(hr))
+        {
+            hr = m_device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &m_flipPixelShader);
+        }
+        if (SUCCEEDED(hr))
+        {
+            D3D11_BUFFER_DESC paramsDesc = {};
+            paramsDesc.ByteWidth = 16;  // Constant buffers come in 16-byte units
+            paramsDesc.Usage = D3D11_USAGE_DEFAULT;
+            paramsDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+            hr = m_device->CreateBuffer(&paramsDesc, nullptr, &m_flipParams);
+            m_flipParamsHeight = 0;
+        }
+
+        if (FAILED(hr))
+        {
+            DebugLog::Log("CreateFlipBlitResources: ERROR - 0x%08X %s, falling back to row copies",
+                hr, errors ? static_cast<const char*>(errors->GetBufferPointer()) : "");
+            m_flipVertexShader.Reset();
+            m_flipPixelShader.Reset();
+            m_flipParams.Reset();
+            m_flipBlitUnavailable = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    ID3D11Texture2D* TextureCopier_D3D11::GetShaderSource(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc,
+        const PixelRect* boxes, size_t boxCount)
+    {
+        // Capture surfaces are not guaranteed to be shader-readable; bounce through
+        // a persistent intermediate with one CopyResource when they are not
+        if (srcDesc.BindFlags & D3D11_BIND_SHADER_RESOURCE)
+        {
+            return srcTexture;
+        }
+
+        D3D11_TEXTURE2D_DESC intermediateDesc = {};
+        if (m_flipIntermediate)
+        {
+            m_flipIntermediate->GetDesc(&intermediateDesc);
+        }
+
+        if (!m_flipIntermediate || intermediateDesc.Width != srcDesc.Width ||
+            intermediateDesc.Height != srcDesc.Height || intermediateDesc.Format != srcDesc.Format)
+        {
+            intermediateDesc = {};
+            intermediateDesc.Width = srcDesc.Width;
+            intermediateDesc.Height = srcDesc.Height;
+            intermediateDesc.MipLevels = 1;
+            intermediateDesc.ArraySize = 1;
+            intermediateDesc.Format = srcDesc.Format;
+            intermediateDesc.SampleDesc.Count = 1;
+            intermediateDesc.Usage = D3D11_USAGE_DEFAULT;
+            intermediateDesc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
+
+            if (m_flipIntermediate)
+            {
+                ReleaseViews(m_flipIntermediate.Get());
+                m_flipIntermediate.Reset();
+            }
+            WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+            if (FAILED(m_device->CreateTexture2D(&intermediateDesc, nullptr, &m_flipIntermediate)))
+            {
+                return nullptr;
+            }
+        }
+
+        if (boxes)
+        {
+            // Each box only samples its own (mirrored) rows, so refreshing
+            // just the boxes in the shared intermediate is enough
+            for (size_t i = 0; i < boxCount; i++)
+            {
+                const D3D11_BOX box = { static_cast<UINT>(boxes[i].left), static_cast<UINT>(boxes[i].top), 0,
+                    static_cast<UINT>(boxes[i].right), static_cast<UINT>(boxes[i].bottom), 1 };
+                m_context->CopySubresourceRegion(m_flipIntermediate.Get(), 0, box.left, box.top, 0, srcTexture, 0, &box);
+            }
+        }
+        else
+        {
+            const D3D11_BOX srcBox = { 0, 0, 0, srcDesc.Width, srcDesc.Height, 1 };
+            m_context->CopySubresourceRegion(m_flipIntermediate.Get(), 0, 0, 0, 0, srcTexture, 0, &srcBox);
+        }
+        return m_flipIntermediate.Get();
+    }
+
+    bool TextureCopier_D3D11::FlipBlit(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+        const PixelRect* boxes, size_t boxCount)
+    {
+        D3D11_TEXTURE2D_DESC dstDesc;
+        dstTexture->GetDesc(&dstDesc);
+        if (!(dstDesc.BindFlags & D3D11_BIND_RENDER_TARGET) || !CreateFlipBlitResources())
+        {
+            return false;
+        }
+
+        if (boxes && !m_flipScissorState)
+        {
+            D3D11_RASTERIZER_DESC rasterizerDesc = {};
+            rasterizerDesc.FillMode = D3D11_FILL_SOLID;
+            rasterizerDesc.CullMode = D3D11_CULL_NONE;
+            rasterizerDesc.DepthClipEnable = TRUE;
+            rasterizerDesc.ScissorEnable = TRUE;
+            if (FAILED(m_device->CreateRasterizerState(&rasterizerDesc, &m_flipScissorState)))
+            {
+                return false;
+            }
+        }
+
+        ID3D11Texture2D* shaderSource = GetShaderSource(srcTexture, srcDesc, boxes, boxCount);
+        if (!shaderSource)
+        {
+            return false;
+        }
+
+        const Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> srv = GetShaderResourceView(shaderSource);
+        const Microsoft::WRL::ComPtr<ID3D11RenderTargetView> rtv = GetRenderTargetView(dstTexture);
+        if (!srv || !rtv)
+        {
+            return false;
+        }
+
+        // Only the frame's own part of a larger destination
+        D3D11_VIEWPORT viewport = { 0.0f, 0.0f, static_cast<FLOAT>(srcDesc.Width), static_cast<FLOAT>(srcDesc.Height), 0.0f, 1.0f };
+        ID3D11RenderTargetView* targets[] = { rtv.Get() };
+        ID3D11ShaderResourceView* sources[] = { srv.Get() };
+
+        if (m_flipParamsHeight != srcDesc.Height)
+        {
+            const UINT params[4] = { srcDesc.Height, 0, 0, 0 };
+            m_context->UpdateSubresource(m_flipParams.Get(), 0, nullptr, params, 0, 0);
+            m_flipParamsHeight = srcDesc.Height;
+        }
+        ID3D11Buffer* constants[] = { m_flipParams.Get() };
+
+        SavedPipelineState saved(m_context.Get());
+        m_context->OMSetRenderTargets(1, targets, nullptr);
+        m_context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+        m_context->OMSetDepthStencilState(nullptr, 0);
+        m_context->RSSetState(boxes ? m_flipScissorState.Get() : nullptr);
+        m_context->RSSetViewports(1, &viewport);
+        m_context->IASetInputLayout(nullptr);
+        m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        m_context->VSSetShader(m_flipVertexShader.Get(), nullptr, 0);
+        m_context->PSSetShader(m_flipPixelShader.Get(), nullptr, 0);
+        m_context->PSSetShaderResources(0, 1, sources);
+        m_context->PSSetConstantBuffers(0, 1, constants);
+
+        if (boxes)
+        {
+            // Scissor to each box's mirrored position in the destination
+            for (size_t i = 0; i < boxCount; i++)
+            {
+                const PixelRect flipped = RectFlipY(boxes[i], srcDesc.Height);
+                const D3D11_RECT scissor = { flipped.left, flipped.top, flipped.right, flipped.bottom };
+                m_context->RSSetScissorRects(1, &scissor);
+                m_context->Draw(3, 0);
+            }
+        }
+        else
+        {
+            m_context->Draw(3, 0);
+        }
+
+        return true;
+    }
+
+    bool TextureCopier_D3D11::CreateScaleBlitResources()
+    {
+        if (m_scalePixelShader && m_scaleParams && m_scaleSampler)
+        {
+            return true;
+        }
+
+        // Shares the flip blit's vertex shader
+        if (m_scaleBlitUnavailable || !CreateFlipBlitResources())
+        {
+            return false;
+        }
+
+        Microsoft::WRL::ComPtr<ID3DBlob> psBlob, errors;
+        HRESULT hr = D3DCompile(s_flipBlitShaderSource, sizeof(s_flipBlitShaderSource) - 1, "ScaleBlit",
+            nullptr, nullptr, "PSScale", "ps_4_0", D3DCOMPILE_OPTIMIZATION_LEVEL3, 0, &psBlob, &errors);
+        if (SUCCEEDED(hr))
+        {
+            hr = m_device->CreatePixelShader(psBlob->GetBufferPointer(), psBlob->GetBufferSize(), nullptr, &m_scalePixelShader);
+        }
+        if (SUCCEEDED(hr))
+        {
+            D3D11_BUFFER_DESC paramsDesc = {};
+            paramsDesc.ByteWidth = 32;  // float2, float2, uint, padded to 16-byte units
+            paramsDesc.Usage = D3D11_USAGE_DEFAULT;
+            paramsDesc.BindFlags = D3D11_BIND_CONSTANT_BUFFER;
+            hr = m_device->CreateBuffer(&paramsDesc, nullptr, &m_scaleParams);
+        }
+        if (SUCCEEDED(hr))
+        {
+            D3D11_SAMPLER_DESC samplerDesc = {};
+            samplerDesc.Filter = D3D11_FILTER_MIN_MAG_MIP_LINEAR;
+            samplerDesc.AddressU = D3D11_TEXTURE_ADDRESS_CLAMP;
+            samplerDesc.AddressV = D3D11_TEXTURE_ADDRESS_CLAMP;
+            samplerDesc.AddressW = D3D11_TEXTURE_ADDRESS_CLAMP;
+            samplerDesc.ComparisonFunc = D3D11_COMPARISON_NEVER;
+            samplerDesc.MaxLOD = D3D11_FLOAT32_MAX;
+            hr = m_device->CreateSamplerState(&samplerDesc, &m_scaleSampler);
+        }
+
+        if (FAILED(hr))
+        {
+            DebugLog::Log("CreateScaleBlitResources: ERROR - 0x%08X %s",
+                hr, errors ? static_cast<const char*>(errors->GetBufferPointer()) : "");
+            m_scalePixelShader.Reset();
+            m_scaleParams.Reset();
+            m_scaleSampler.Reset();
+            m_scaleBlitUnavailable = true;
+            return false;
+        }
+
+        return true;
+    }
+
+    bool TextureCopier_D3D11::CopyScaled(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+        uint32_t dstWidth, uint32_t dstHeight, FlipMode flipMode)
+    {
+        D3D11_TEXTURE2D_DESC dstDesc;
+        dstTexture->GetDesc(&dstDesc);
+        if (!(dstDesc.BindFlags & D3D11_BIND_RENDER_TARGET) || dstWidth == 0 || dstHeight == 0 ||
+            dstWidth > dstDesc.Width || dstHeight > dstDesc.Height || !CreateScaleBlitResources())
+        {
+            return false;
+        }
+
+        ID3D11Texture2D* shaderSource = GetShaderSource(srcTexture, srcDesc, nullptr, 0);
+        if (!shaderSource)
+        {
+            return false;
+        }
+
+        const Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> srv = GetShaderResourceView(shaderSource);
+        const Microsoft::WRL::ComPtr<ID3D11RenderTargetView> rtv = GetRenderTargetView(dstTexture);
+        if (!srv || !rtv)
+        {
+            return false;
+        }
+
+        // Only used while a resize is in flight, so the parameters are uploaded per copy
+        D3D11_TEXTURE2D_DESC sourceDesc;
+        shaderSource->GetDesc(&sourceDesc);
+        struct
+        {
+            float sourceScale[2];
+            float targetSize[2];
+            uint32_t flipY;
+            uint32_t padding[3];
+        } params = {
+            { static_cast<float>(srcDesc.Width) / sourceDesc.Width, static_cast<float>(srcDesc.Height) / sourceDesc.Height },
+            { static_cast<float>(dstWidth), static_cast<float>(dstHeight) },
+            flipMode != FlipMode::None ? 1u : 0u,
+            {}
+        };
+        m_context->UpdateSubresource(m_scaleParams.Get(), 0, nullptr, &params, 0, 0);
+
+        // The part of the destination the stretched content covers
+        D3D11_VIEWPORT viewport = { 0.0f, 0.0f, static_cast<FLOAT>(dstWidth), static_cast<FLOAT>(dstHeight), 0.0f, 1.0f };
+        ID3D11RenderTargetView* targets[] = { rtv.Get() };
+        ID3D11ShaderResourceView* sources[] = { srv.Get() };
+        ID3D11Buffer* constants[] = { m_scaleParams.Get() };
+        ID3D11SamplerState* samplers[] = { m_scaleSampler.Get() };
+
+        SavedPipelineState saved(m_context.Get());
+        m_context->OMSetRenderTargets(1, targets, nullptr);
+        m_context->OMSetBlendState(nullptr, nullptr, 0xFFFFFFFF);
+        m_context->OMSetDepthStencilState(nullptr, 0);
+        m_context->RSSetState(nullptr);
+        m_context->RSSetViewports(1, &viewport);
+        m_context->IASetInputLayout(nullptr);
+        m_context->IASetPrimitiveTopology(D3D11_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+        m_context->VSSetShader(m_flipVertexShader.Get(), nullptr, 0);
+        m_context->PSSetShader(m_scalePixelShader.Get(), nullptr, 0);
+        m_context->PSSetShaderResources(0, 1, sources);
+        m_context->PSSetConstantBuffers(1, 1, constants);
+        m_context->PSSetSamplers(0, 1, samplers);
+        m_context->Draw(3, 0);
+
+        return true;
+    }
+
+    void TextureCopier_D3D11::CopyBoxes(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+        FlipMode flipMode, const PixelRect* boxes, size_t boxCount)
+    {
+        if (flipMode == FlipMode::SinglePass && FlipBlit(srcTexture, srcDesc, dstTexture, boxes, boxCount))
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < boxCount; i++)
+        {
+            const PixelRect& rect = boxes[i];
+            D3D11_BOX srcBox;
+            srcBox.left = static_cast<UINT>(rect.left);
+            srcBox.right = static_cast<UINT>(rect.right);
+            srcBox.front = 0;
+            srcBox.back = 1;
+
+            if (flipMode != FlipMode::None)
+            {
+                // Reversed rows of this box only
+                for (int32_t y = rect.top; y < rect.bottom; y++)
+                {
+                    srcBox.top = static_cast<UINT>(y);
+                    srcBox.bottom = static_cast<UINT>(y + 1);
+
+                    m_context->CopySubresourceRegion(
+                        dstTexture, 0,
+                        srcBox.left, srcDesc.Height - 1 - static_cast<UINT>(y), 0,
+                        srcTexture, 0,
+                        &srcBox
+                    );
+                }
+            }
+            else
+            {
+                srcBox.top = static_cast<UINT>(rect.top);
+                srcBox.bottom = static_cast<UINT>(rect.bottom);
+
+                m_context->CopySubresourceRegion(dstTexture, 0, srcBox.left, srcBox.top, 0, srcTexture, 0, &srcBox);
+            }
+        }
+    }
+
+} // namespace WebViewToolkit
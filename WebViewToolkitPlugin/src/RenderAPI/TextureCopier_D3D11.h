@@ -0,0 +1,110 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - D3D11 Texture Copier
+// ============================================================================
+// GPU copies of captured frames on one D3D11 device, whole or limited to a set
+// of boxes, with the Y-flip strategies of FlipMode. Shared by the DX11
+// backend (Unity's device) and the DX12 shared-surface path (capture device).
+// ============================================================================
+
+#include "WebViewToolkit/Types.h"
+
+#include <d3d11.h>
+#include <wrl/client.h>
+
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    class TextureCopier_D3D11
+    {
+    public:
+        TextureCopier_D3D11(ID3D11Device* device, ID3D11DeviceContext* context);
+
+        /// @brief Copy a texture into the top-left part of a destination at least as large
+        /// @param srcDesc Description of srcTexture; a smaller Width and Height copy
+        ///        only its top-left part
+        /// @param boxes Source boxes (top-down) to copy, nullptr for the whole texture
+        /// @note SinglePass needs a render-target destination and falls back to row
+        ///       copies otherwise or if the shaders cannot be created
+        void Copy(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+            FlipMode flipMode, const PixelRect* boxes, size_t boxCount);
+
+        /// @brief Stretch the top-left part of a texture over the top-left part of a destination
+        /// @param srcDesc Description of srcTexture; Width and Height give the part to stretch
+        /// @param dstWidth, dstHeight Part of the destination to cover, bilinear filtered
+        /// @return false if the destination is not a render target or the shaders
+        ///         cannot be created; nothing is copied then
+        bool CopyScaled(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+            uint32_t dstWidth, uint32_t dstHeight, FlipMode flipMode);
+
+        /// @brief Drop the cached views of a texture, before its owner destroys it
+        /// @note May be called from any thread
+        void ReleaseViews(ID3D11Texture2D* texture);
+
+    private:
+        // Views of recently used textures, so steady-state blits create none.
+        // A view holds its texture alive, so a cached pointer never names a
+        // newer texture at the same address; the least recently used one goes
+        // once the cache is full.
+        template <typename View>
+        struct CachedView
+        {
+            ID3D11Texture2D* texture;
+            Microsoft::WRL::ComPtr<View> view;
+        };
+
+        static constexpr size_t MaxCachedViews = 8;
+
+        template <typename View, typename CreateView>
+        Microsoft::WRL::ComPtr<View> GetView(std::vector<CachedView<View>>& cache, ID3D11Texture2D* texture,
+            CreateView createView);
+        Microsoft::WRL::ComPtr<ID3D11ShaderResourceView> GetShaderResourceView(ID3D11Texture2D* texture);
+        Microsoft::WRL::ComPtr<ID3D11RenderTargetView> GetRenderTargetView(ID3D11Texture2D* texture);
+
+        // Single-pass Y-flip: fullscreen triangle sampling the source upside down,
+        // scissored to the given source boxes (nullptr = whole surface)
+        bool CreateFlipBlitResources();
+        bool FlipBlit(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+            const PixelRect* boxes, size_t boxCount);
+
+        // Linear-filtered stretch, sharing the flip blit's vertex shader
+        bool CreateScaleBlitResources();
+
+        // The source itself, or a shader-readable copy of the given boxes
+        // (nullptr = whole surface) in m_flipIntermediate; nullptr on failure
+        ID3D11Texture2D* GetShaderSource(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc,
+            const PixelRect* boxes, size_t boxCount);
+
+        // Copy only the given source boxes into the destination
+        void CopyBoxes(ID3D11Texture2D* srcTexture, const D3D11_TEXTURE2D_DESC& srcDesc, ID3D11Texture2D* dstTexture,
+            FlipMode flipMode, const PixelRect* boxes, size_t boxCount);
+
+        Microsoft::WRL::ComPtr<ID3D11Device> m_device;
+        Microsoft::WRL::ComPtr<ID3D11DeviceContext> m_context;
+
+        // Flip blit resources (created lazily on first use)
+        Microsoft::WRL::ComPtr<ID3D11VertexShader> m_flipVertexShader;
+        Microsoft::WRL::ComPtr<ID3D11PixelShader> m_flipPixelShader;
+        Microsoft::WRL::ComPtr<ID3D11Texture2D> m_flipIntermediate;   // For sources created without SHADER_RESOURCE binding
+        Microsoft::WRL::ComPtr<ID3D11RasterizerState> m_flipScissorState;
+        Microsoft::WRL::ComPtr<ID3D11Buffer> m_flipParams;              // Height of the copied part, mirrored around
+        UINT m_flipParamsHeight = 0;
+        bool m_flipBlitUnavailable = false;
+
+        // Scale blit resources (created lazily on first use)
+        Microsoft::WRL::ComPtr<ID3D11PixelShader> m_scalePixelShader;
+        Microsoft::WRL::ComPtr<ID3D11Buffer> m_scaleParams;
+        Microsoft::WRL::ComPtr<ID3D11SamplerState> m_scaleSampler;
+        bool m_scaleBlitUnavailable = false;
+
+        // Guarded by m_viewMutex: owners release views from other threads
+        std::mutex m_viewMutex;
+        std::vector<CachedView<ID3D11ShaderResourceView>> m_sourceViews;
+        std::vector<CachedView<ID3D11RenderTargetView>> m_targetViews;
+    };
+
+} // namespace WebViewToolkit
@@ -0,0 +1,353 @@
+// ============================================================================
+// WebViewToolkit - D3D12 Upload Device Implementation
+// ============================================================================
+
+#include "UploadDevice_D3D12.h"
+
+#ifdef WEBVIEW_TOOLKIT_DX12_SUPPORT
+
+#include "Core/FrameResourceCounters.h"
+#include "Core/PixelKernels.h"
+#include "DebugLog.h"
+
+#include <algorithm>
+
+namespace WebViewToolkit
+{
+    UploadDevice_D3D12::UploadDevice_D3D12(ID3D12Device* device, ID3D12CommandQueue* commandQueue, IGpuFence* fence)
+        : m_device(device)
+        , m_commandQueue(commandQueue)
+        , m_fence(fence)
+    {
+    }
+
+    UploadDevice_D3D12::~UploadDevice_D3D12()
+    {
+        // The owner drains the queue before destroying the device
+        Reset();
+        if (m_mapped)
+        {
+            m_uploadBuffer->Unmap(0, nullptr);
+            m_mapped = nullptr;
+        }
+    }
+
+    bool UploadDevice_D3D12::Initialize(uint64_t capacity)
+    {
+        if (!m_device || !m_commandQueue || capacity == 0)
+        {
+            return false;
+        }
+
+        D3D12_RESOURCE_DESC desc = {};
+        desc.Dimension = D3D12_RESOURCE_DIMENSION_BUFFER;
+        desc.Width = capacity;
+        desc.Height = 1;
+        desc.DepthOrArraySize = 1;
+        desc.MipLevels = 1;
+        desc.Format = DXGI_FORMAT_UNKNOWN;
+        desc.SampleDesc.Count = 1;
+        desc.Layout = D3D12_TEXTURE_LAYOUT_ROW_MAJOR;
+
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = D3D12_HEAP_TYPE_UPLOAD;
+
+        HRESULT hr = m_device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+            D3D12_RESOURCE_STATE_GENERIC_READ, nullptr, IID_PPV_ARGS(&m_uploadBuffer));
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(hr))
+        {
+            DebugLog::Log("UploadDevice_D3D12: ERROR - failed to create %llu byte upload buffer: 0x%08X", capacity, hr);
+            return false;
+        }
+
+        // The CPU never reads it back
+        const D3D12_RANGE noRead = { 0, 0 };
+        void* mapped = nullptr;
+        hr = m_uploadBuffer->Map(0, &noRead, &mapped);
+        if (FAILED(hr))
+        {
+            DebugLog::Log("UploadDevice_D3D12: ERROR - failed to map upload buffer: 0x%08X", hr);
+            m_uploadBuffer.Reset();
+            return false;
+        }
+
+        m_mapped = static_cast<uint8_t*>(mapped);
+        m_ring = std::make_unique<UploadRingAllocator>(m_fence, capacity);
+        return true;
+    }
+
+    bool UploadDevice_D3D12::BeginRecording()
+    {
+        // Reuse the first allocator whose lists have completed
+        const uint64_t completed = m_fence ? m_fence->GetCompletedValue() : UINT64_MAX;
+        auto it = std::find_if(m_allocators.begin(), m_allocators.end(),
+            [completed](const CommandAllocator& entry) { return entry.fenceValue <= completed; });
+        if (it == m_allocators.end())
+        {
+            CommandAllocator entry;
+            if (FAILED(m_device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&entry.allocator))))
+            {
+                DebugLog::Log("UploadDevice_D3D12: ERROR - failed to create command allocator");
+                return false;
+            }
+            m_allocators.push_back(entry);
+            it = m_allocators.end() - 1;
+        }
+
+        HRESULT hr = it->allocator->Reset();
+        if (SUCCEEDED(hr))
+        {
+            hr = m_commandList
+                ? m_commandList->Reset(it->allocator.Get(), nullptr)
+                : m_device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, it->allocator.Get(), nullptr,
+                    IID_PPV_ARGS(&m_commandList));
+        }
+        if (FAILED(hr))
+        {
+            DebugLog::Log("UploadDevice_D3D12: ERROR - failed to open command list: 0x%08X", hr);
+            return false;
+        }
+
+        // In use until the list's submission completes
+        it->fenceValue = UINT64_MAX;
+        m_activeAllocator = static_cast<size_t>(it - m_allocators.begin());
+        m_recording = true;
+        return true;
+    }
+
+    bool UploadDevice_D3D12::RecordUpload(ID3D12Resource* destination, const uint8_t* pixels, size_t pitch,
+        const PixelRect& rect, uint32_t dstX, uint32_t dstY, bool flipY)
+    {
+        if (!m_ring || !destination || !pixels || RectIsEmpty(rect))
+        {
+            return false;
+        }
+        if (!m_recording && !BeginRecording())
+        {
+            return false;
+        }
+
+        const auto width = static_cast<uint32_t>(rect.right - rect.left);
+        const auto height = static_cast<uint32_t>(rect.bottom - rect.top);
+        const uint64_t rowPitch = (static_cast<uint64_t>(width) * 4 + D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1) &
+            ~static_cast<uint64_t>(D3D12_TEXTURE_DATA_PITCH_ALIGNMENT - 1);
+        const uint64_t size = rowPitch * height;
+
+        uint64_t offset = 0;
+        if (!m_ring->Allocate(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, offset))
+        {
+            // Backpressure: wait for the oldest uploads in the way rather than drop the frame
+            if (!m_ring->WaitForSpace(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT) ||
+                !m_ring->Allocate(size, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT, offset))
+            {
+                return false;
+            }
+        }
+
+        PixelTransform transform;
+        transform.src = pixels + static_cast<size_t>(rect.top) * pitch + static_cast<size_t>(rect.left) * 4;
+        transform.srcPitch = pitch;
+        transform.dst = m_mapped + offset;
+        transform.dstPitch = static_cast<size_t>(rowPitch);
+        transform.width = width;
+        transform.height = height;
+        transform.flipY = flipY;
+        TransformPixels(transform);
+
+        if (std::find(m_destinations.begin(), m_destinations.end(), destination) == m_destinations.end())
+        {
+            Transition(destination, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+            m_destinations.push_back(destination);
+        }
+
+        D3D12_TEXTURE_COPY_LOCATION src = {};
+        src.pResource = m_uploadBuffer.Get();
+        src.Type = D3D12_TEXTURE_COPY_TYPE_PLACED_FOOTPRINT;
+        src.PlacedFootprint.Offset = offset;
+        src.PlacedFootprint.Footprint.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+        src.PlacedFootprint.Footprint.Width = width;
+        src.PlacedFootprint.Footprint.Height = height;
+        src.PlacedFootprint.Footprint.Depth = 1;
+        src.PlacedFootprint.Footprint.RowPitch = static_cast<UINT>(rowPitch);
+
+        D3D12_TEXTURE_COPY_LOCATION dst = {};
+        dst.pResource = destination;
+        dst.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        dst.SubresourceIndex = 0;
+
+        m_commandList->CopyTextureRegion(&dst, dstX, dstY, 0, &src, nullptr);
+        return true;
+    }
+
+    bool UploadDevice_D3D12::EnsureScratch(uint32_t width, uint32_t height)
+    {
+        if (m_scratch && width <= m_scratchWidth && height <= m_scratchHeight)
+        {
+            return true;
+        }
+
+        // The open list already copies through the current one
+        if (m_scratchRecorded)
+        {
+            return false;
+        }
+        if (m_scratch && m_fence && m_scratchFenceValue > m_fence->GetCompletedValue())
+        {
+            m_fence->Wait(m_scratchFenceValue);
+        }
+
+        D3D12_RESOURCE_DESC desc = {};
+        desc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
+        desc.Width = std::max(width, m_scratchWidth);
+        desc.Height = std::max(height, m_scratchHeight);
+        desc.DepthOrArraySize = 1;
+        desc.MipLevels = 1;
+        desc.Format = DXGI_FORMAT_B8G8R8A8_UNORM;
+        desc.SampleDesc.Count = 1;
+        desc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
+
+        D3D12_HEAP_PROPERTIES heapProps = {};
+        heapProps.Type = D3D12_HEAP_TYPE_DEFAULT;
+
+        Microsoft::WRL::ComPtr<ID3D12Resource> scratch;
+        HRESULT hr = m_device->CreateCommittedResource(&heapProps, D3D12_HEAP_FLAG_NONE, &desc,
+            D3D12_RESOURCE_STATE_COPY_DEST, nullptr, IID_PPV_ARGS(&scratch));
+        WEBVIEW_TOOLKIT_COUNT_OBJECT_CREATION();
+        if (FAILED(hr))
+        {
+            DebugLog::Log("UploadDevice_D3D12: ERROR - failed to create %llux%u move scratch: 0x%08X",
+                desc.Width, desc.Height, hr);
+            return false;
+        }
+
+        m_scratch = scratch;
+        m_scratchWidth = static_cast<uint32_t>(desc.Width);
+        m_scratchHeight = desc.Height;
+        return true;
+    }
+
+    bool UploadDevice_D3D12::RecordMove(ID3D12Resource* destination, const PixelRect& source, uint32_t dstX, uint32_t dstY)
+    {
+        if (!m_ring || !destination || RectIsEmpty(source))
+        {
+            return false;
+        }
+
+        const auto width = static_cast<uint32_t>(source.right - source.left);
+        const auto height = static_cast<uint32_t>(source.bottom - source.top);
+        if (!EnsureScratch(width, height))
+        {
+            return false;
+        }
+        if (!m_recording && !BeginRecording())
+        {
+            return false;
+        }
+
+        // Unity's resting state, or COPY_DEST once this list has written it
+        const bool written = std::find(m_destinations.begin(), m_destinations.end(), destination) != m_destinations.end();
+        Transition(destination, written ? D3D12_RESOURCE_STATE_COPY_DEST : D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE,
+            D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+        D3D12_TEXTURE_COPY_LOCATION target = {};
+        target.pResource = destination;
+        target.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        target.SubresourceIndex = 0;
+
+        D3D12_TEXTURE_COPY_LOCATION scratch = {};
+        scratch.pResource = m_scratch.Get();
+        scratch.Type = D3D12_TEXTURE_COPY_TYPE_SUBRESOURCE_INDEX;
+        scratch.SubresourceIndex = 0;
+
+        const D3D12_BOX sourceBox = { static_cast<UINT>(source.left), static_cast<UINT>(source.top), 0,
+            static_cast<UINT>(source.right), static_cast<UINT>(source.bottom), 1 };
+        m_commandList->CopyTextureRegion(&scratch, 0, 0, 0, &target, &sourceBox);
+
+        Transition(destination, D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+        Transition(m_scratch.Get(), D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_COPY_SOURCE);
+
+        const D3D12_BOX scratchBox = { 0, 0, 0, width, height, 1 };
+        m_commandList->CopyTextureRegion(&target, dstX, dstY, 0, &scratch, &scratchBox);
+
+        Transition(m_scratch.Get(), D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_COPY_DEST);
+
+        if (!written)
+        {
+            m_destinations.push_back(destination);
+        }
+        m_scratchRecorded = true;
+        return true;
+    }
+
+    void UploadDevice_D3D12::Submit()
+    {
+        if (!m_recording)
+        {
+            return;
+        }
+
+        for (ID3D12Resource* destination : m_destinations)
+        {
+            Transition(destination, D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_PIXEL_SHADER_RESOURCE);
+        }
+        m_destinations.clear();
+        m_recording = false;
+
+        HRESULT hr = m_commandList->Close();
+        if (SUCCEEDED(hr))
+        {
+            ID3D12CommandList* lists[] = { m_commandList.Get() };
+            m_commandQueue->ExecuteCommandLists(1, lists);
+        }
+        else
+        {
+            DebugLog::Log("UploadDevice_D3D12: ERROR - failed to close command list: 0x%08X", hr);
+        }
+
+        // Signals the timeline behind the list: the ring space, the allocator
+        // and the scratch come back once it has executed. A list of moves only
+        // allocates nothing but still needs a real signal.
+        const uint64_t fenceValue = m_ring->Submit(true);
+        m_allocators[m_activeAllocator].fenceValue = fenceValue;
+        if (m_scratchRecorded)
+        {
+            m_scratchFenceValue = fenceValue;
+            m_scratchRecorded = false;
+        }
+    }
+
+    void UploadDevice_D3D12::Reset()
+    {
+        if (m_recording)
+        {
+            m_commandList->Close();
+            m_destinations.clear();
+            m_recording = false;
+        }
+        for (auto& entry : m_allocators)
+        {
+            entry.fenceValue = 0;
+        }
+        m_scratchFenceValue = 0;
+        m_scratchRecorded = false;
+        if (m_ring)
+        {
+            m_ring->Reset();
+        }
+    }
+
+    void UploadDevice_D3D12::Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after)
+    {
+        D3D12_RESOURCE_BARRIER barrier = {};
+        barrier.Type = D3D12_RESOURCE_BARRIER_TYPE_TRANSITION;
+        barrier.Transition.pResource = resource;
+        barrier.Transition.Subresource = D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES;
+        barrier.Transition.StateBefore = before;
+        barrier.Transition.StateAfter = after;
+        m_commandList->ResourceBarrier(1, &barrier);
+    }
+
+} // namespace WebViewToolkit
+
+#endif // WEBVIEW_TOOLKIT_DX12_SUPPORT
@@ -0,0 +1,119 @@
+#pragma once
+
+// ============================================================================
+// WebViewToolkit - D3D12 Upload Device
+// ============================================================================
+// Native D3D12 path for CPU-sourced pixels. Each upload is written straight
+// into a persistently mapped upload-heap buffer, sub-allocated as a ring, and
+// a CopyTextureRegion into Unity's resource is recorded. This avoids the
+// staging copy and driver-side allocation behind a D3D11On12
+// UpdateSubresource.
+//
+// The copies are recorded on a direct command list and executed on Unity's
+// queue. Unity's textures rest in PIXEL_SHADER_RESOURCE, which a copy queue
+// cannot transition. The ring and the command allocators are released
+// behind the owner's fence timeline, so the same Signal() covers the copies
+// and the D3D11On12 work of the event.
+//
+// Scrolled frames also move part of a destination within itself. A copy may
+// not overlap its own source, so moves go through one scratch texture.
+// ============================================================================
+
+#include "Core/DirtyRegion.h"
+#include "Core/UploadRingAllocator.h"
+
+#ifdef WEBVIEW_TOOLKIT_DX12_SUPPORT
+
+#include <d3d12.h>
+#include <wrl/client.h>
+
+#include <memory>
+#include <vector>
+
+namespace WebViewToolkit
+{
+    class UploadDevice_D3D12
+    {
+    public:
+        /// Enough for three 1080p frames in flight; larger frames take the D3D11On12 path
+        static constexpr uint64_t DefaultCapacity = 32ull * 1024 * 1024;
+
+        /// @param fence Timeline of the command queue (weak ref)
+        UploadDevice_D3D12(ID3D12Device* device, ID3D12CommandQueue* commandQueue, IGpuFence* fence);
+        ~UploadDevice_D3D12();
+
+        // Non-copyable
+        UploadDevice_D3D12(const UploadDevice_D3D12&) = delete;
+        UploadDevice_D3D12& operator=(const UploadDevice_D3D12&) = delete;
+
+        /// @brief Create and map the upload buffer and the command list
+        bool Initialize(uint64_t capacity = DefaultCapacity);
+
+        /// @brief Copy a rectangle of 32-bit pixels into the ring and record its upload
+        /// @param pixels Source image, rect in its coordinates
+        /// @param dstX, dstY Top-left corner of the copy in the destination
+        /// @param flipY Write the rows bottom-up
+        /// @return false if the ring cannot take it even after waiting for the GPU;
+        ///         nothing is recorded then
+        bool RecordUpload(ID3D12Resource* destination, const uint8_t* pixels, size_t pitch,
+            const PixelRect& rect, uint32_t dstX, uint32_t dstY, bool flipY);
+
+        /// @brief Record a copy of a rectangle of the destination to another place in it
+        /// @param source Rectangle in the destination, may overlap the target
+        /// @param dstX, dstY Top-left corner of the target
+        /// @note Record moves before the uploads that patch around them
+        /// @return false if the scratch texture cannot hold the rectangle; nothing
+        ///         is recorded then
+        bool RecordMove(ID3D12Resource* destination, const PixelRect& source, uint32_t dstX, uint32_t dstY);
+
+        bool HasRecordedUploads() const { return m_recording; }
+
+        /// @brief Execute the recorded uploads on the queue and hand their ring space
+        ///        to the timeline. Signals the fence if anything was recorded.
+        /// @note The owner marks the destinations written on its timeline first,
+        ///       so the signal is not skipped as idle
+        void Submit();
+
+        /// @brief Free all ring space and command allocators
+        /// @note Only once the queue is idle
+        void Reset();
+
+    private:
+        struct CommandAllocator
+        {
+            Microsoft::WRL::ComPtr<ID3D12CommandAllocator> allocator;
+            uint64_t fenceValue = 0;    // Reusable once the timeline reaches it
+        };
+
+        bool BeginRecording();
+        bool EnsureScratch(uint32_t width, uint32_t height);
+        void Transition(ID3D12Resource* resource, D3D12_RESOURCE_STATES before, D3D12_RESOURCE_STATES after);
+
+        Microsoft::WRL::ComPtr<ID3D12Device> m_device;
+        Microsoft::WRL::ComPtr<ID3D12CommandQueue> m_commandQueue;
+        IGpuFence* m_fence; // Weak ref
+
+        Microsoft::WRL::ComPtr<ID3D12Resource> m_uploadBuffer;
+        uint8_t* m_mapped = nullptr;    // Mapped for the buffer's lifetime
+        std::unique_ptr<UploadRingAllocator> m_ring;
+
+        std::vector<CommandAllocator> m_allocators;
+        size_t m_activeAllocator = 0;
+        Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> m_commandList;
+        bool m_recording = false;
+
+        // Destinations of the recorded list, each transitioned to COPY_DEST once
+        std::vector<ID3D12Resource*> m_destinations;
+
+        // Intermediate of every move, resting in COPY_DEST. Grown to the largest
+        // move; the old one is replaced once the last list using it has run.
+        Microsoft::WRL::ComPtr<ID3D12Resource> m_scratch;
+        uint32_t m_scratchWidth = 0;
+        uint32_t m_scratchHeight = 0;
+        uint64_t m_scratchFenceValue = 0;
+        bool m_scratchRecorded = false;     // Used by the open list
+    };
+
+} // namespace WebViewToolkit
+
+#endif // WEBVIEW_TOOLKIT_DX12_SUPPORT
@@ -1,6 +1,7 @@
 #include "WebViewToolkit/WebView.h"
 #include "WebViewToolkit/WebViewManager.h"
 #include "WebViewToolkit/WebViewCapture.h"
+#include "WebViewToolkit/CaptureAtlas.h"
 
 // Windows headers
 // Windows headers
@@ -13,7 +14,9 @@
 #include <WebView2EnvironmentOptions.h>
 #include <wrl.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 #pragma comment(lib, "dwmapi.lib")
 #pragma comment(lib, "shcore.lib")
@@ -55,6 +58,10 @@ namespace WebViewToolkit
         , m_width(params.width)
         , m_height(params.height)
         , m_devToolsEnabled(params.enableDevTools)
+        , m_framePoolDepth(params.framePoolDepth)
+        , m_atlas(params.useCaptureAtlas && manager ? manager->GetCaptureAtlas() : nullptr)
+        , m_renderWidth(params.width)
+        , m_renderHeight(params.height)
     {
         if (params.userDataFolder)
         {
@@ -93,16 +100,34 @@ namespace WebViewToolkit
             m_capture->Shutdown();
             m_capture.reset();
         }
+        if (m_atlas)
+        {
+            m_atlas->RemoveView(m_handle);
+            m_hostWindow = nullptr;     // Borrowed from the atlas
+        }
 
-        // 1. Release Texture (must happen before RenderAPI shutdown, but after Capture)
-        if (m_texturePtr && m_manager)
+        // 1. Release Textures (must happen before RenderAPI shutdown, but after Capture)
         {
-            IRenderAPI* api = m_manager->GetRenderAPI();
-            if (api)
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            IRenderAPI* api = m_manager ? m_manager->GetRenderAPI() : nullptr;
+            for (void** texture : { &m_texturePtr, &m_pendingTexture, &m_retiredTexture })
             {
-                api->DestroySharedTexture(m_texturePtr);
+                if (*texture && api)
+                {
+                    api->DestroySharedTexture(*texture);
+                }
+                *texture = nullptr;
+            }
+
+            std::vector<void*> mirrorTextures;
+            m_mirrors.Clear(mirrorTextures);
+            for (void* texture : mirrorTextures)
+            {
+                if (api)
+                {
+                    api->DestroySharedTexture(texture);
+                }
             }
-            m_texturePtr = nullptr;
         }
 
         // 2. Close Controller
@@ -187,15 +212,28 @@ namespace WebViewToolkit
 
     Result WebView::Initialize()
     {
-        m_hostWindow = CreateHostWindow(m_width, m_height);
+        if (m_atlas)
+        {
+            // Everything but the WebView2 controller is shared
+            Result result = m_atlas->AddView(m_handle, m_renderWidth, m_renderHeight);
+            if (result != Result::Success) return result;
+            m_hostWindow = m_atlas->GetHostWindow();
+            return InitializeWebViewEnvironment();
+        }
+
+        m_captureCapacity.Update(m_renderWidth, m_renderHeight);
+        m_hostWindow = CreateHostWindow(m_captureCapacity.GetCapacityWidth(), m_captureCapacity.GetCapacityHeight());
         if (!m_hostWindow) return Result::ErrorUnknown;
 
         // Create shared texture
         IRenderAPI* renderAPI = m_manager ? m_manager->GetRenderAPI() : nullptr;
         if (!renderAPI) return Result::ErrorNotInitialized; // Should not happen
 
-        Result result = renderAPI->CreateSharedTexture(m_width, m_height, &m_texturePtr);
+        Result result = renderAPI->CreateSharedTexture(m_renderWidth, m_renderHeight, &m_texturePtr);
         if (result != Result::Success) return result;
+        m_textureWidth = m_contentWidth = m_renderWidth;
+        m_textureHeight = m_contentHeight = m_renderHeight;
+        renderAPI->GetSharedTextureSize(m_texturePtr, m_textureWidth, m_textureHeight);
 
         return InitializeWebViewEnvironment();
     }
@@ -306,15 +344,27 @@ namespace WebViewToolkit
             settings->put_IsStatusBarEnabled(FALSE);
         }
 
-        RECT bounds = { 0, 0, static_cast<LONG>(m_width), static_cast<LONG>(m_height) };
+        RECT bounds = { 0, 0, static_cast<LONG>(m_renderWidth), static_cast<LONG>(m_renderHeight) };
         controller->put_Bounds(bounds);
         controller->put_IsVisible(TRUE);
+        ApplyRasterizationScale();
 
         m_state = WebViewState::Ready;
 
         // Initialize Capture
-        m_capture = std::make_unique<WebViewCapture>(this, m_manager->GetRenderAPI());
-        m_capture->Initialize();
+        if (m_atlas)
+        {
+            m_atlas->AttachView(m_handle, m_compositionController);
+        }
+        else
+        {
+            // Zero-copy holds up to three frames open for Unity
+            const bool zeroCopy = m_presentMode.load(std::memory_order_relaxed) == PresentMode::ZeroCopy;
+            m_capture = std::make_unique<WebViewCapture>(this, m_manager->GetRenderAPI(),
+                zeroCopy ? MaxFramePoolDepth : m_framePoolDepth);
+            m_capture->Initialize();
+            m_capture->SetLateLatch(IsLateLatched());
+        }
 
         // Register events
         EventRegistrationToken token;
@@ -428,52 +478,318 @@ namespace WebViewToolkit
         if (!m_controller) return Result::ErrorNotInitialized;
         m_width = width;
         m_height = height;
+        return ApplyRenderSize();
+    }
 
-        // Resize texture
-        if (m_texturePtr && m_manager)
+    Result WebView::ApplyRenderSize()
+    {
+        const uint32_t width = ScaleDimension(m_width, m_renderScale);
+        const uint32_t height = ScaleDimension(m_height, m_renderScale);
+        if (!m_controller)
         {
-            IRenderAPI* api = m_manager->GetRenderAPI();
-            if (api)
+            m_renderWidth = width;
+            m_renderHeight = height;
+            return Result::ErrorNotInitialized;
+        }
+
+        // A drag-resize asks for a new size every frame; apply at most one
+        // per interval and leave the rest to ApplyPendingResize
+        if (!m_resizeCoalescer.Request(width, height, GetTickCount64()))
+        {
+            return Result::Success;
+        }
+        return ApplyRenderSize(width, height);
+    }
+
+    Result WebView::ApplyPendingResize()
+    {
+        if (!m_controller) return Result::ErrorNotInitialized;
+
+        uint32_t width = 0;
+        uint32_t height = 0;
+        if (!m_resizeCoalescer.Poll(GetTickCount64(), width, height))
+        {
+            return Result::Success;
+        }
+        return ApplyRenderSize(width, height);
+    }
+
+    Result WebView::SetResizeInterval(uint32_t intervalMs)
+    {
+        m_resizeCoalescer.SetInterval(intervalMs);
+        return Result::Success;
+    }
+
+    Result WebView::GetResizeStats(ResizeStats& outStats) const
+    {
+        outStats = m_resizeCoalescer.GetStats();
+
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        if (m_capture)
+        {
+            const ResizeTransactionStats& transactions = m_capture->GetResizeTransactionStats();
+            outStats.stretchedFrames = transactions.stretchedFrames;
+            outStats.heldFrames = transactions.heldFrames;
+            outStats.timedOut = transactions.timedOut;
+            outStats.lastFirstFrameMs = transactions.lastLatencyMs;
+            outStats.maxFirstFrameMs = transactions.maxLatencyMs;
+        }
+        return Result::Success;
+    }
+
+    Result WebView::AttachMirror(uint32_t width, uint32_t height, MirrorId& outId)
+    {
+        // Atlas views share one capture
+        if (width == 0 || height == 0 || m_atlas)
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        IRenderAPI* api = m_manager ? m_manager->GetRenderAPI() : nullptr;
+        if (!api || !m_capture)
+        {
+            return Result::ErrorNotInitialized;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            outId = m_mirrors.AddRef(width, height);
+            if (outId != InvalidMirrorId)
             {
-                void* newTexture = nullptr;
-                // Note: ResizeSharedTexture destroys the old one
-                Result res = api->ResizeSharedTexture(m_texturePtr, width, height, &newTexture);
-                if (res == Result::Success)
-                {
-                    m_texturePtr = newTexture;
-                }
+                return Result::Success;
             }
         }
 
+        // Only the main thread adds mirrors, so none of this size can appear meanwhile
+        void* texture = nullptr;
+        if (api->CreateSharedTexture(width, height, &texture) != Result::Success)
+        {
+            return Result::ErrorTextureCreationFailed;
+        }
+        uint32_t textureWidth = width;
+        uint32_t textureHeight = height;
+        api->GetSharedTextureSize(texture, textureWidth, textureHeight);
+
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            outId = m_mirrors.Add(texture, width, height, textureWidth, textureHeight);
+        }
+        if (outId == InvalidMirrorId)
+        {
+            api->DestroySharedTexture(texture);
+            return Result::ErrorInvalidArgument;
+        }
+
+        // The mirror holds nothing until the next frame
+        m_capture->RequestUpdate();
+        return Result::Success;
+    }
+
+    Result WebView::DetachMirror(MirrorId id)
+    {
+        void* texture = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            if (!m_mirrors.Release(id, texture))
+            {
+                return Result::ErrorInvalidArgument;
+            }
+        }
+
+        // No longer planned by the render thread
+        IRenderAPI* api = m_manager ? m_manager->GetRenderAPI() : nullptr;
+        if (texture && api)
+        {
+            api->DestroySharedTexture(texture);
+        }
+        return Result::Success;
+    }
+
+    Result WebView::GetMirrorTexture(MirrorId id, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        outTexture = m_mirrors.GetTexture(id);
+        if (!outTexture || !m_mirrors.GetTextureSize(id, outWidth, outHeight))
+        {
+            return Result::ErrorInvalidArgument;
+        }
+        return Result::Success;
+    }
+
+    Result WebView::GetMirrorUVRect(MirrorId id, float outUVRect[4]) const
+    {
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        return m_mirrors.GetUVRect(id, outUVRect) ? Result::Success : Result::ErrorInvalidArgument;
+    }
+
+    Result WebView::ApplyRenderSize(uint32_t width, uint32_t height)
+    {
+        // An atlas view needs room before its content may grow into it
+        if (m_atlas)
+        {
+            Result result = m_atlas->ResizeView(m_handle, width, height);
+            if (result != Result::Success)
+            {
+                m_resizeCoalescer.ForgetAppliedSize();
+                return result;
+            }
+        }
+        m_renderWidth = width;
+        m_renderHeight = height;
+
         // Resize WebView2 Controller
         RECT bounds = { 0, 0, static_cast<LONG>(width), static_cast<LONG>(height) };
         static_cast<ICoreWebView2Controller*>(m_controller)->put_Bounds(bounds);
+        ApplyRasterizationScale();
+        if (m_atlas) return Result::Success;
 
         // Resize the HWND host window
-        // Windows Graphics Capture captures the window's client area,
-        // so the window itself must be resized to match the new dimensions
-        if (m_hostWindow)
+        // Windows Graphics Capture captures the window's client area, so the
+        // window is sized to the capacity and only resized when the new size
+        // no longer fits it; the content fills its top-left part
+        const bool capacityChanged = m_captureCapacity.Update(width, height);
+        const uint32_t capacityWidth = m_captureCapacity.GetCapacityWidth();
+        const uint32_t capacityHeight = m_captureCapacity.GetCapacityHeight();
+        if (m_hostWindow && capacityChanged)
         {
             HWND hwnd = static_cast<HWND>(m_hostWindow);
             SetWindowPos(
                 hwnd,
                 nullptr,
                 0, 0,  // Position (we only care about size)
-                static_cast<int>(width),
-                static_cast<int>(height),
+                static_cast<int>(capacityWidth),
+                static_cast<int>(capacityHeight),
                 SWP_NOMOVE | SWP_NOZORDER | SWP_NOACTIVATE
             );
         }
 
-        // Resize Capture (Visuals & FramePool)
-        if (m_capture)
+        // Keep the newest texture if its allocation fits the new size. Otherwise
+        // render into a new one while Unity keeps sampling the current one, so
+        // the view does not show an empty texture until the next capture.
+        IRenderAPI* api = m_manager ? m_manager->GetRenderAPI() : nullptr;
+        void* current = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            current = m_pendingTexture ? m_pendingTexture : m_texturePtr;
+        }
+
+        void* newTexture = nullptr;
+        uint32_t newWidth = width;
+        uint32_t newHeight = height;
+        if (current && api && !api->ResizeSharedTextureInPlace(current, width, height))
+        {
+            if (api->CreateSharedTexture(width, height, &newTexture) == Result::Success)
+            {
+                api->GetSharedTextureSize(newTexture, newWidth, newHeight);
+            }
+            else
+            {
+                newTexture = nullptr;
+            }
+        }
+
+        void* superseded = nullptr;
+        void* retired = nullptr;
+        {
+            // The render thread waits out the pool recreation, so it never
+            // copies an old-sized frame into the new texture
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            if (newTexture)
+            {
+                superseded = m_pendingTexture;
+                retired = m_retiredTexture;
+                m_pendingTexture = newTexture;
+                m_pendingWidth = newWidth;
+                m_pendingHeight = newHeight;
+                m_retiredTexture = nullptr;
+            }
+            m_pendingContentWidth = width;
+            m_pendingContentHeight = height;
+            m_resizePending = true;
+
+            // Resize Capture (Visuals & FramePool)
+            if (m_capture)
+            {
+                m_capture->Resize(width, height, capacityWidth, capacityHeight);
+            }
+        }
+
+        // Neither is referenced by the render thread any more
+        if (superseded) api->DestroySharedTexture(superseded);
+        if (retired) api->DestroySharedTexture(retired);
+
+        return Result::Success;
+    }
+
+    void WebView::ApplyRasterizationScale()
+    {
+        // Bounds are in pixels; scaling the rasterization by the same factor
+        // keeps the page layout at the logical size
+        if (!m_controller || (m_renderScale == 1.0f && m_baseRasterizationScale == 0.0))
+        {
+            return;
+        }
+
+        Microsoft::WRL::ComPtr<ICoreWebView2Controller3> controller3;
+        if (FAILED(static_cast<ICoreWebView2Controller*>(m_controller)->QueryInterface(IID_PPV_ARGS(&controller3))))
+        {
+            return;
+        }
+
+        if (m_baseRasterizationScale == 0.0)
+        {
+            // Monitor DPI changes would overwrite the scale from now on
+            controller3->get_RasterizationScale(&m_baseRasterizationScale);
+            controller3->put_ShouldDetectMonitorScaleChanges(FALSE);
+        }
+        controller3->put_RasterizationScale(m_baseRasterizationScale * m_renderScale);
+    }
+
+    Result WebView::SetRenderScale(float scale)
+    {
+        if (!(scale >= MinRenderScale && scale <= MaxRenderScale))
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        m_autoRenderScale = false;
+        return ApplyRenderScale(scale);
+    }
+
+    Result WebView::EnableAutoRenderScale(float frameBudgetMs, float minScale)
+    {
+        if (!(frameBudgetMs >= 0.0f) || !(minScale >= MinRenderScale && minScale <= MaxRenderScale))
         {
-            m_capture->Resize(width, height);
+            return Result::ErrorInvalidArgument;
         }
 
+        RenderScaleSettings settings;
+        settings.frameBudgetMs = frameBudgetMs;
+        settings.minScale = minScale;
+        m_scaleController = RenderScaleController(settings, m_renderScale);
+        m_autoRenderScale = true;
         return Result::Success;
     }
 
+    Result WebView::ReportRenderScaleSample(float frameTimeMs, float coverage)
+    {
+        if (!m_controller) return Result::ErrorNotInitialized;
+        if (!m_autoRenderScale || !m_scaleController.OnFrame(frameTimeMs, coverage))
+        {
+            return Result::Success;
+        }
+        return ApplyRenderScale(m_scaleController.GetScale());
+    }
+
+    Result WebView::ApplyRenderScale(float scale)
+    {
+        if (!m_controller) return Result::ErrorNotInitialized;
+        if (scale == m_renderScale) return Result::Success;
+
+        m_renderScale = scale;
+        return ApplyRenderSize();
+    }
+
     Result WebView::SendMouseEvent(const MouseEventParams& params)
     {
         if (!m_compositionController) return Result::ErrorNotInitialized;
@@ -482,8 +798,8 @@ namespace WebViewToolkit
         
         // Convert normalized coordinates to pixel coordinates
         POINT point;
-        point.x = static_cast<LONG>(params.x * m_width);
-        point.y = static_cast<LONG>(params.y * m_height);
+        point.x = static_cast<LONG>(params.x * m_renderWidth);
+        point.y = static_cast<LONG>(params.y * m_renderHeight);
 
         COREWEBVIEW2_MOUSE_EVENT_VIRTUAL_KEYS virtualKeys = COREWEBVIEW2_MOUSE_EVENT_VIRTUAL_KEYS_NONE;
 
@@ -555,15 +871,240 @@ namespace WebViewToolkit
         return Result::Success;
     }
 
-    void WebView::UpdateTexture()
+    bool WebView::UpdateTexture()
     {
         // Must happen on render thread
-        if (m_capture && m_texturePtr)
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        void* target = m_pendingTexture ? m_pendingTexture : m_texturePtr;
+        if (!m_capture || !target)
+        {
+            return false;
+        }
+
+        const uint64_t presented = m_capture->GetFrameStats().presented;
+        const bool visitAgain = m_capture->UpdateTexture(target, m_flipMode.load(std::memory_order_relaxed),
+            m_drainMode.load(std::memory_order_relaxed), m_presentMode.load(std::memory_order_relaxed), m_mirrors);
+        OnTextureUpdated(m_capture->GetFrameStats().presented != presented);
+        return visitAgain;
+    }
+
+    void WebView::LatchTexture()
+    {
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        void* target = m_pendingTexture ? m_pendingTexture : m_texturePtr;
+        if (!m_capture || !target)
         {
-            m_capture->UpdateTexture(m_texturePtr);
+            return;
+        }
+
+        const uint64_t presented = m_capture->GetFrameStats().presented;
+        m_capture->LatchTexture(target, m_flipMode.load(std::memory_order_relaxed), m_mirrors);
+        OnTextureUpdated(m_capture->GetFrameStats().presented != presented);
+    }
+
+    void WebView::OnTextureUpdated(bool newFrame)
+    {
+        if (newFrame && m_manager)
+        {
+            m_manager->GetFrameVersions().Publish(m_handle, GetTickCount64());
+        }
+
+        // Hand the resized texture or content to Unity once it holds a frame
+        if (m_resizePending && newFrame)
+        {
+            if (m_pendingTexture)
+            {
+                m_retiredTexture = m_texturePtr;
+                m_texturePtr = m_pendingTexture;
+                m_textureWidth = m_pendingWidth;
+                m_textureHeight = m_pendingHeight;
+                m_pendingTexture = nullptr;
+            }
+            m_contentWidth = m_pendingContentWidth;
+            m_contentHeight = m_pendingContentHeight;
+            m_resizePending = false;
         }
     }
 
+    void WebView::RequestTextureUpdate()
+    {
+        if (m_capture)
+        {
+            m_capture->RequestUpdate();
+        }
+    }
+
+    void* WebView::GetTexturePtr() const
+    {
+        void* texture = nullptr;
+        uint32_t width = 0;
+        uint32_t height = 0;
+        GetTexture(texture, width, height);
+        return texture;
+    }
+
+    void WebView::GetTexture(void*& outTexture, uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        if (m_atlas)
+        {
+            m_atlas->GetTexture(outTexture, outWidth, outHeight);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        // A new captured frame each time one arrives; the shared texture until the first
+        if (m_capture)
+        {
+            m_sampledFrame = m_presentMode.load(std::memory_order_relaxed) == PresentMode::ZeroCopy ?
+                m_capture->AcquirePresentedFrame() : m_capture->EndPresentingFrames();
+        }
+        else
+        {
+            m_sampledFrame = HandoffTexture{};
+        }
+        outTexture = m_sampledFrame.texture ? m_sampledFrame.texture : m_texturePtr;
+        outWidth = m_sampledFrame.texture ? m_sampledFrame.width : m_textureWidth;
+        outHeight = m_sampledFrame.texture ? m_sampledFrame.height : m_textureHeight;
+    }
+
+    void WebView::GetTextureSize(uint32_t& outWidth, uint32_t& outHeight) const
+    {
+        if (m_atlas)
+        {
+            m_atlas->GetTextureSize(outWidth, outHeight);
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        outWidth = m_sampledFrame.texture ? m_sampledFrame.width : m_textureWidth;
+        outHeight = m_sampledFrame.texture ? m_sampledFrame.height : m_textureHeight;
+    }
+
+    void WebView::GetTextureUVRect(float outUVRect[4]) const
+    {
+        if (m_atlas && m_atlas->GetUVRect(m_handle, outUVRect))
+        {
+            return;
+        }
+
+        // Content starts at row 0, which Unity samples at v = 0. Zero-copy
+        // frames have the capture capacity size, with the content at the same place.
+        std::lock_guard<std::mutex> lock(m_textureMutex);
+        const uint32_t textureWidth = m_sampledFrame.texture ? m_sampledFrame.width : m_textureWidth;
+        const uint32_t textureHeight = m_sampledFrame.texture ? m_sampledFrame.height : m_textureHeight;
+        outUVRect[0] = 0.0f;
+        outUVRect[1] = 0.0f;
+        outUVRect[2] = textureWidth ? static_cast<float>(std::min(m_contentWidth, textureWidth)) / textureWidth : 1.0f;
+        outUVRect[3] = textureHeight ? static_cast<float>(std::min(m_contentHeight, textureHeight)) / textureHeight : 1.0f;
+    }
+
+    Result WebView::SetFlipMode(FlipMode mode)
+    {
+        switch (mode)
+        {
+        case FlipMode::None:
+        case FlipMode::RowCopy:
+        case FlipMode::SinglePass:
+            // Read by the render thread on the next UpdateTexture
+            m_flipMode.store(mode, std::memory_order_relaxed);
+            return Result::Success;
+        default:
+            return Result::ErrorInvalidArgument;
+        }
+    }
+
+    Result WebView::SetFrameDrainMode(FrameDrainMode mode)
+    {
+        switch (mode)
+        {
+        case FrameDrainMode::Single:
+        case FrameDrainMode::Latest:
+            // Read by the render thread on the next UpdateTexture
+            m_drainMode.store(mode, std::memory_order_relaxed);
+            return Result::Success;
+        default:
+            return Result::ErrorInvalidArgument;
+        }
+    }
+
+    Result WebView::SetPresentMode(PresentMode mode)
+    {
+        if (mode != PresentMode::Copy && mode != PresentMode::ZeroCopy)
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        if (mode == PresentMode::ZeroCopy)
+        {
+            // Unity can only sample frames of its own device, which captures on DX11
+            IRenderAPI* renderAPI = m_manager ? m_manager->GetRenderAPI() : nullptr;
+            if (!renderAPI || renderAPI->GetAPIType() != GraphicsAPI::Direct3D11)
+            {
+                return Result::ErrorUnsupportedGraphicsAPI;
+            }
+            if (m_atlas)
+            {
+                return Result::ErrorInvalidArgument;
+            }
+        }
+
+        // Read by the render thread on the next UpdateTexture and by GetTexturePtr
+        if (m_presentMode.exchange(mode, std::memory_order_relaxed) == mode || !m_capture)
+        {
+            return Result::Success;
+        }
+
+        // Handed-off frames keep buffers out of the frame pool
+        const uint32_t depth = mode == PresentMode::ZeroCopy ? MaxFramePoolDepth : m_framePoolDepth;
+        if (depth != AdaptiveFramePoolDepth)
+        {
+            m_capture->SetFramePoolDepth(depth);
+        }
+        m_capture->SetLateLatch(IsLateLatched());
+        m_capture->RequestUpdate();
+        return Result::Success;
+    }
+
+    Result WebView::SetLateLatch(bool enabled)
+    {
+        if (m_atlas)
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        // Applied to a capture created later too
+        m_lateLatch.store(enabled, std::memory_order_relaxed);
+        if (m_capture)
+        {
+            m_capture->SetLateLatch(IsLateLatched());
+        }
+        return Result::Success;
+    }
+
+    bool WebView::IsLateLatched() const
+    {
+        // Zero-copy frames are sampled, not copied, so there is no copy to latch
+        return m_lateLatch.load(std::memory_order_relaxed) &&
+            m_presentMode.load(std::memory_order_relaxed) == PresentMode::Copy;
+    }
+
+    Result WebView::GetCaptureStats(CaptureFrameStats& outStats) const
+    {
+        if (m_atlas)
+        {
+            outStats = m_atlas->GetFrameStats();    // Shared by every atlas view
+            return Result::Success;
+        }
+
+        if (!m_capture)
+        {
+            return Result::ErrorNotInitialized;
+        }
+
+        outStats = m_capture->GetFrameStats();
+        return Result::Success;
+    }
+
     void WebView::OnDeviceLost()
     {
         // 1. Stop capture
@@ -572,9 +1113,15 @@ namespace WebViewToolkit
             m_capture->Shutdown();
         }
 
-        // 2. Release texture pointer
+        // 2. Release texture pointers
         // We don't call DestroySharedTexture because the device is already gone/released
-        m_texturePtr = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            m_texturePtr = nullptr;
+            m_pendingTexture = nullptr;
+            m_retiredTexture = nullptr;
+            m_resizePending = false;
+        }
 
         m_state = WebViewState::Error;
     }
@@ -583,12 +1130,25 @@ namespace WebViewToolkit
     {
         if (m_state == WebViewState::Destroyed) return;
 
+        // The manager restores the atlas
+        if (m_atlas)
+        {
+            m_state = WebViewState::Ready;
+            return;
+        }
+
         // 1. Recreate shared texture
         IRenderAPI* renderAPI = m_manager ? m_manager->GetRenderAPI() : nullptr;
         if (!renderAPI || !renderAPI->IsInitialized()) return;
 
-        Result result = renderAPI->CreateSharedTexture(m_width, m_height, &m_texturePtr);
-        if (result != Result::Success) return;
+        {
+            std::lock_guard<std::mutex> lock(m_textureMutex);
+            Result result = renderAPI->CreateSharedTexture(m_renderWidth, m_renderHeight, &m_texturePtr);
+            if (result != Result::Success) return;
+            m_textureWidth = m_contentWidth = m_renderWidth;
+            m_textureHeight = m_contentHeight = m_renderHeight;
+            renderAPI->GetSharedTextureSize(m_texturePtr, m_textureWidth, m_textureHeight);
+        }
 
         // 2. Restart capture with new device
         m_state = WebViewState::Ready;
@@ -1,5 +1,6 @@
 #include "WebViewToolkit/WebViewCapture.h"
 #include "WebViewToolkit/WebView.h"
+#include "WebViewToolkit/WebViewManager.h"
 
 // Windows headers
 #include <Windows.h>
@@ -10,11 +11,14 @@
 #include <DispatcherQueue.h> // Move up
 
 #include "RenderAPI/DebugLog.h"
+#include "Core/FrameResourceCounters.h"
 using WebViewToolkit::DebugLog;
 
 // WinRT headers
 #include <winrt/base.h>
 #include <winrt/Windows.Foundation.h>
+#include <winrt/Windows.Foundation.Collections.h>
+#include <winrt/Windows.Foundation.Metadata.h>
 #include <winrt/Windows.System.h>
 #include <winrt/Windows.UI.Composition.h>
 #include <winrt/Windows.UI.Composition.Desktop.h>
@@ -26,6 +30,13 @@ using WebViewToolkit::DebugLog;
 
 #include <d3d11.h>
 
+#include <algorithm>
+
+// Capture dirty regions ship in UniversalApiContract 19 (Windows SDK 10.0.26100)
+#if defined(WINDOWS_FOUNDATION_UNIVERSALAPICONTRACT_VERSION) && WINDOWS_FOUNDATION_UNIVERSALAPICONTRACT_VERSION >= 0x130000
+#define WEBVIEW_TOOLKIT_CAPTURE_DIRTY_REGIONS 1
+#endif
+
 namespace WebViewToolkit
 {
     namespace winrt_impl
@@ -41,13 +52,47 @@ namespace WebViewToolkit
 
     struct WindowTargetWrapper { winrt_impl::DesktopWindowTarget Value{ nullptr }; };
     struct CaptureItemWrapper { winrt_impl::GraphicsCaptureItem Value{ nullptr }; };
-    struct FramePoolWrapper { winrt_impl::Direct3D11CaptureFramePool Value{ nullptr }; };
+    struct FramePoolWrapper
+    {
+        winrt_impl::Direct3D11CaptureFramePool Value{ nullptr };
+        winrt::event_token FrameArrivedToken{};
+    };
     struct SessionWrapper { winrt_impl::GraphicsCaptureSession Value{ nullptr }; };
 
+    // Frame times are SystemRelativeTime: the QPC clock in 100 ns units
+    static uint64_t GetCaptureAgeUs(int64_t captureTime)
+    {
+        LARGE_INTEGER counter;
+        LARGE_INTEGER frequency;
+        QueryPerformanceCounter(&counter);
+        QueryPerformanceFrequency(&frequency);
+        const int64_t now = counter.QuadPart / frequency.QuadPart * 10000000 +
+            counter.QuadPart % frequency.QuadPart * 10000000 / frequency.QuadPart;
+        return now > captureTime ? static_cast<uint64_t>(now - captureTime) / 10 : 0;
+    }
 
-    WebViewCapture::WebViewCapture(WebView* webView, IRenderAPI* renderAPI)
+    // A fixed depth is a controller whose range holds a single value
+    static FramePoolDepthSettings MakeDepthSettings(uint32_t framePoolDepth)
+    {
+        FramePoolDepthSettings settings;
+        if (framePoolDepth != AdaptiveFramePoolDepth)
+        {
+            settings.minDepth = framePoolDepth;
+            settings.maxDepth = framePoolDepth;
+        }
+        return settings;
+    }
+
+    WebViewCapture::WebViewCapture(WebView* webView, IRenderAPI* renderAPI, uint32_t framePoolDepth)
         : m_webView(webView)
         , m_renderAPI(renderAPI)
+        , m_adaptivePoolDepth(framePoolDepth == AdaptiveFramePoolDepth)
+        , m_depthController(framePoolDepth == AdaptiveFramePoolDepth ? DefaultFramePoolDepth : framePoolDepth,
+            MakeDepthSettings(framePoolDepth))
+        , m_poolDepth(m_depthController.GetDepth())
+        , m_handoff(this)
+        , m_surfaceTextures(this)
+        , m_latestFrames(this)
     {
     }
 
@@ -56,6 +101,157 @@ namespace WebViewToolkit
         Shutdown();
     }
 
+    void* WebViewCapture::WrapFramePool(winrt_impl::Direct3D11CaptureFramePool const& framePool)
+    {
+        auto wrapper = new FramePoolWrapper{ framePool };
+        try
+        {
+            // Raised on this (the main) thread's dispatcher queue
+            wrapper->FrameArrivedToken = framePool.FrameArrived(
+                [this](winrt_impl::Direct3D11CaptureFramePool const&, winrt::Windows::Foundation::IInspectable const&)
+                {
+                    if (m_lateLatching.load(std::memory_order_relaxed))
+                    {
+                        LatchArrivedFrames();
+                    }
+                    else
+                    {
+                        RequestUpdate();
+                    }
+                });
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("WrapFramePool: FrameArrived unavailable (0x%08X), polling every render event", ex.code());
+            m_frameEventsEnabled = false;
+        }
+        return wrapper;
+    }
+
+    void WebViewCapture::CloseFramePool()
+    {
+        auto wrapper = static_cast<FramePoolWrapper*>(m_framePool);
+        if (wrapper->FrameArrivedToken)
+        {
+            wrapper->Value.FrameArrived(wrapper->FrameArrivedToken);
+        }
+        wrapper->Value.Close();
+        delete wrapper;
+        m_framePool = nullptr;
+
+        // The next pool brings its own surfaces
+        m_surfaceTextures.Clear();
+    }
+
+    WebViewCapture::FrameSlot* WebViewCapture::AcquireFrameSlot()
+    {
+        for (FrameSlot& slot : m_frameSlots)
+        {
+            if (!slot.inUse)
+            {
+                slot.inUse = true;
+                return &slot;
+            }
+        }
+
+        auto slot = new FrameSlot();
+        slot->inUse = true;
+        return slot;
+    }
+
+    void WebViewCapture::ReleaseFrame(void* frame, void* texture)
+    {
+        static_cast<ID3D11Texture2D*>(texture)->Release();
+
+        auto slot = static_cast<FrameSlot*>(frame);
+        try
+        {
+            slot->frame.Close();
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("ReleaseFrame: ERROR - WinRT exception: 0x%08X", ex.code());
+        }
+        slot->frame = nullptr;
+        slot->inUse = false;
+
+        const bool pooled = slot >= m_frameSlots.data() && slot < m_frameSlots.data() + m_frameSlots.size();
+        if (!pooled)
+        {
+            delete slot;
+        }
+    }
+
+    void* WebViewCapture::ResolveTexture(void* surface)
+    {
+        // The cache holds the surface, so its address is not reused while cached
+        winrt_impl::IDirect3DSurface captureSurface{ nullptr };
+        winrt::copy_from_abi(captureSurface, surface);
+
+        ID3D11Texture2D* texture = nullptr;
+        auto access = captureSurface.try_as<::Windows::Graphics::DirectX::Direct3D11::IDirect3DDxgiInterfaceAccess>();
+        WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE();
+        if (!access || FAILED(access->GetInterface(IID_PPV_ARGS(&texture))))
+        {
+            return nullptr;
+        }
+        WEBVIEW_TOOLKIT_COUNT_QUERY_INTERFACE();
+
+        captureSurface.detach();
+        return texture;
+    }
+
+    void WebViewCapture::ReleaseEntry(void* surface, void* texture)
+    {
+        static_cast<ID3D11Texture2D*>(texture)->Release();
+        static_cast<::IUnknown*>(surface)->Release();
+    }
+
+    HandoffTexture WebViewCapture::AcquirePresentedFrame()
+    {
+        const uint64_t previous = m_handoff.GetAcquired().version;
+        HandoffTexture texture = m_handoff.Acquire();
+
+        // The retired frame is released by the render thread on a later visit
+        if (texture.version != previous)
+        {
+            m_presentedFrameCopied = false;
+            if (m_handoff.HasRetired())
+            {
+                RequestUpdate();
+            }
+        }
+        return texture;
+    }
+
+    HandoffTexture WebViewCapture::EndPresentingFrames()
+    {
+        const HandoffTexture& acquired = m_handoff.GetAcquired();
+        if (acquired.texture && !m_presentedFrameCopied)
+        {
+            RequestUpdate();
+            return acquired;
+        }
+
+        // Released by the render thread on a later visit
+        m_handoff.RetireAll();
+        if (m_handoff.HasRetired())
+        {
+            RequestUpdate();
+        }
+        return HandoffTexture{};
+    }
+
+    void WebViewCapture::RequestUpdate()
+    {
+        // Only the caller that raises the flag queues the view; the render
+        // thread clears it when it looks at the pool
+        if (m_updateRequested.Raise())
+        {
+            m_webView->m_manager->QueueTextureUpdate(m_webView->GetHandle());
+        }
+    }
+
     void WebViewCapture::Shutdown()
     {
         try
@@ -70,14 +266,15 @@ namespace WebViewToolkit
                 m_session = nullptr;
             }
 
-            // 2. Close Frame Pool
+            // 2. Close frames handed to Unity, then the Frame Pool
+            m_handoff.ReleaseAll();
+            m_latestFrames.ReleaseAll();
+            m_resizeTransaction.Cancel();
             if (m_framePool)
             {
-                auto wrapper = static_cast<FramePoolWrapper*>(m_framePool);
-                wrapper->Value.Close();
-                delete wrapper;
-                m_framePool = nullptr;
+                CloseFramePool();
             }
+            m_surfaceTextures.Clear();
 
             // 3. Clear Item
             if (m_captureItem)
@@ -210,8 +407,8 @@ namespace WebViewToolkit
             // Get IVisual interface to setting size
             auto rootVisualAsVisual = rootVisual.as<ABI::Windows::UI::Composition::IVisual>();
             ABI::Windows::Foundation::Numerics::Vector2 size{ 
-                static_cast<float>(m_webView->GetWidth()), 
-                static_cast<float>(m_webView->GetHeight()) 
+                static_cast<float>(m_webView->GetRenderWidth()), 
+                static_cast<float>(m_webView->GetRenderHeight()) 
             };
             rootVisualAsVisual->put_Size(size);
             rootVisualAsVisual->put_IsVisible(true);
@@ -335,14 +532,21 @@ namespace WebViewToolkit
             winrt_impl::SizeInt32 size = captureItem.Size();
 
             // Ensure minimum size
-            if (size.Width <= 0) size.Width = static_cast<int32_t>(m_webView->GetWidth());
-            if (size.Height <= 0) size.Height = static_cast<int32_t>(m_webView->GetHeight());
+            if (size.Width <= 0) size.Width = static_cast<int32_t>(m_webView->GetRenderWidth());
+            if (size.Height <= 0) size.Height = static_cast<int32_t>(m_webView->GetRenderHeight());
 
-            DebugLog::Log("InitializeGraphicsCapture: Creating frame pool (size: %dx%d, buffers: 2)...", size.Width, size.Height);
+            m_capacityWidth = static_cast<uint32_t>(size.Width);
+            m_capacityHeight = static_cast<uint32_t>(size.Height);
+            m_contentWidth = m_webView->GetRenderWidth();
+            m_contentHeight = m_webView->GetRenderHeight();
+
+            const uint32_t poolDepth = m_poolDepth.load(std::memory_order_relaxed);
+            DebugLog::Log("InitializeGraphicsCapture: Creating frame pool (size: %dx%d, buffers: %u%s)...",
+                size.Width, size.Height, poolDepth, m_adaptivePoolDepth ? ", adaptive" : "");
             auto framePool = winrt_impl::Direct3D11CaptureFramePool::Create(
                 rtDevice,
                 pixelFormat,
-                2,
+                static_cast<int32_t>(poolDepth),
                 size
             );
             DebugLog::Log("InitializeGraphicsCapture: Frame pool created");
@@ -354,14 +558,19 @@ namespace WebViewToolkit
 
             // Store objects
             m_captureItem = new CaptureItemWrapper{ captureItem };
-            m_framePool = new FramePoolWrapper{ framePool };
+            m_framePool = WrapFramePool(framePool);
             m_session = new SessionWrapper{ session };
             DebugLog::Log("InitializeGraphicsCapture: Objects stored");
 
+            ConfigureDirtyRegions();
+
             // Start capture - this is where crashes often occur
             DebugLog::Log("InitializeGraphicsCapture: Starting capture session...");
             session.StartCapture();
             DebugLog::Log("InitializeGraphicsCapture: Capture session started successfully!");
+
+            // Visit once even if FrameArrived could not be subscribed
+            RequestUpdate();
         }
         catch (winrt::hresult_error const& ex)
         {
@@ -377,70 +586,252 @@ namespace WebViewToolkit
         }
     }
 
-    void WebViewCapture::UpdateTexture(void* unityTexturePtr)
+    void WebViewCapture::ConfigureDirtyRegions()
     {
-        static bool firstCall = true;
-        if (firstCall)
+        // A new session shares no history with the previous one: skip a
+        // serial so its first frame is copied whole
+        m_frameSerial++;
+        m_dirtyRegionsEnabled = false;
+
+#ifdef WEBVIEW_TOOLKIT_CAPTURE_DIRTY_REGIONS
+        try
+        {
+            // ReportOnly keeps delivering full frames; the regions are advisory
+            if (winrt::Windows::Foundation::Metadata::ApiInformation::IsPropertyPresent(
+                    L"Windows.Graphics.Capture.GraphicsCaptureSession", L"DirtyRegionMode"))
+            {
+                auto session = static_cast<SessionWrapper*>(m_session)->Value;
+                session.DirtyRegionMode(winrt_impl::GraphicsCaptureDirtyRegionMode::ReportOnly);
+                m_dirtyRegionsEnabled = true;
+                DebugLog::Log("ConfigureDirtyRegions: Dirty region reporting enabled");
+            }
+        }
+        catch (winrt::hresult_error const& ex)
         {
-            DebugLog::Log("UpdateTexture: First call");
-            firstCall = false;
+            DebugLog::Log("ConfigureDirtyRegions: Not available (0x%08X), copying whole frames", ex.code());
         }
+#endif
+    }
 
-        if (!m_framePool || !unityTexturePtr)
+    void WebViewCapture::PresentFrame(winrt_impl::Direct3D11CaptureFrame const& frame, void* unityTexturePtr, FlipMode flipMode,
+        PresentMode presentMode, MirrorRegistry& mirrors, const std::vector<PixelRect>* dirtyRects)
+    {
+        auto surface = frame.Surface();
+        if (!surface)
         {
-            DebugLog::Log("UpdateTexture: Early return (framePool=%p, texturePtr=%p)", m_framePool, unityTexturePtr);
+            DebugLog::Log("PresentFrame: No surface");
+            frame.Close();  // Explicitly close frame before returning
             return;
         }
 
-        try
+        // D3D11 texture behind the surface; the cache holds the reference
+        auto capturedTexture = static_cast<ID3D11Texture2D*>(m_surfaceTextures.Get(winrt::get_abi(surface)));
+
+        if (capturedTexture)
         {
-            auto wrapper = static_cast<FramePoolWrapper*>(m_framePool);
-            auto framePool = wrapper->Value;
+            // Unity can only sample a surface it can bind as a shader resource;
+            // capture surfaces are not guaranteed to allow it, so copy those
+            D3D11_TEXTURE2D_DESC desc;
+            capturedTexture->GetDesc(&desc);
+            if (presentMode == PresentMode::ZeroCopy && !(desc.BindFlags & D3D11_BIND_SHADER_RESOURCE))
+            {
+                if (!m_zeroCopyUnsupportedLogged)
+                {
+                    DebugLog::Log("PresentFrame: Capture surface is not shader-readable (bind flags 0x%X), copying instead of zero-copy",
+                        desc.BindFlags);
+                    m_zeroCopyUnsupportedLogged = true;
+                }
+                presentMode = PresentMode::Copy;
+            }
 
-            DebugLog::Log("UpdateTexture: Calling TryGetNextFrame...");
-            auto frame = framePool.TryGetNextFrame();
+            CapturedFrame captured;
+            captured.texture = capturedTexture;
+            captured.width = m_contentWidth;
+            captured.height = m_contentHeight;
+            captured.serial = ++m_frameSerial;
 
-            if (!frame)
+            if (dirtyRects)
+            {
+                captured.dirtyRects = dirtyRects->data();
+                captured.dirtyRectCount = static_cast<uint32_t>(dirtyRects->size());
+            }
+
+            // A frame of the window size from before a resize holds the old
+            // content at its top-left
+            const auto frameSize = frame.ContentSize();
+            const ResizeFrameAction action = m_resizeTransaction.OnFrame(static_cast<uint32_t>(frameSize.Width),
+                static_cast<uint32_t>(frameSize.Height), GetTickCount64(),
+                presentMode == PresentMode::Copy && m_renderAPI->CanScaleFrames());
+            if (action == ResizeFrameAction::Hold)
             {
-                DebugLog::Log("UpdateTexture: No frame available");
+                // Not presented, so Unity keeps sampling the previous frame;
+                // the skipped serial makes the next copy a whole one
+                if (!m_resizeHoldLogged)
+                {
+                    DebugLog::Log("PresentFrame: Holding %dx%d frames until the resize reaches the capture",
+                        frameSize.Width, frameSize.Height);
+                    m_resizeHoldLogged = true;
+                }
+                frame.Close();
                 return;
             }
-            DebugLog::Log("UpdateTexture: Got frame");
+            if (action == ResizeFrameAction::Stretch)
+            {
+                captured.width = std::min(m_resizeTransaction.GetSourceWidth(), static_cast<uint32_t>(frameSize.Width));
+                captured.height = std::min(m_resizeTransaction.GetSourceHeight(), static_cast<uint32_t>(frameSize.Height));
+                captured.scaledWidth = m_contentWidth;
+                captured.scaledHeight = m_contentHeight;
+                captured.dirtyRects = nullptr;
+                captured.dirtyRectCount = 0;
+            }
+
+            // Mirrors are copies in either present mode
+            if (!mirrors.IsEmpty())
+            {
+                CopyToMirrors(captured, mirrors, flipMode);
+            }
 
-            auto surface = frame.Surface();
-            if (!surface)
+            if (presentMode == PresentMode::ZeroCopy)
             {
-                DebugLog::Log("UpdateTexture: No surface");
-                frame.Close();  // Explicitly close frame before returning
+                // Unity samples the frame itself; it stays open, and the
+                // texture referenced, until Unity has moved past it
+                capturedTexture->AddRef();
+                FrameSlot* slot = AcquireFrameSlot();
+                slot->frame = frame;
+                m_handoff.Publish(slot, capturedTexture, desc.Width, desc.Height);
+                m_frameCounters.RecordPresented();
                 return;
             }
-            DebugLog::Log("UpdateTexture: Got surface");
 
-            // Get D3D11 texture from surface
-            DebugLog::Log("UpdateTexture: Getting texture interface...");
-            auto access = surface.as<::Windows::Graphics::DirectX::Direct3D11::IDirect3DDxgiInterfaceAccess>();
-            ID3D11Texture2D* capturedTexture = nullptr;
-            access->GetInterface(IID_PPV_ARGS(&capturedTexture));
+            // Use RenderAPI to handle the copy (handles D3D12 wrapping complexity)
+            m_renderAPI->CopyCapturedTextureToUnityTexture(captured, unityTexturePtr, flipMode);
+            m_frameCounters.RecordPresented();
+            m_frameCounters.RecordCopyAge(GetCaptureAgeUs(frame.SystemRelativeTime().count()));
+        }
+        else
+        {
+            DebugLog::Log("PresentFrame: ERROR - Failed to get captured texture interface");
+        }
+
+        // Explicitly close frame to release it immediately
+        frame.Close();
+    }
+
+    bool WebViewCapture::UpdateTexture(void* unityTexturePtr, FlipMode flipMode, FrameDrainMode drainMode, PresentMode presentMode,
+        MirrorRegistry& mirrors)
+    {
+        m_updateRequested.Clear();
+
+        // Frames Unity moved past before this event are no longer sampled
+        m_handoff.Collect();
+
+        // Back from zero-copy: Unity switches to the texture once it holds the
+        // frame it sampled, even if no new frame ever arrives
+        const HandoffTexture& handedOff = m_handoff.GetAcquired();
+        if (presentMode == PresentMode::Copy && handedOff.texture && !m_presentedFrameCopied && unityTexturePtr)
+        {
+            CapturedFrame held;
+            held.texture = handedOff.texture;
+            held.width = m_contentWidth;
+            held.height = m_contentHeight;
+            held.serial = ++m_frameSerial;
+            m_renderAPI->CopyCapturedTextureToUnityTexture(held, unityTexturePtr, flipMode);
+            m_presentedFrameCopied = true;
+        }
+
+        // Late-latched frames are copied by LatchTexture
+        if (m_lateLatching.load(std::memory_order_relaxed))
+        {
+            return m_handoff.HasRetired();
+        }
+
+        if (!m_framePool || !unityTexturePtr)
+        {
+            return false;
+        }
+
+        try
+        {
+            auto wrapper = static_cast<FramePoolWrapper*>(m_framePool);
+            auto framePool = wrapper->Value;
+
+            // Dirty rectangles are relative to the previous frame, so those of
+            // discarded frames are kept to describe the change since the last
+            // presented one
+            m_dirtyRects.clear();
+            auto collectDirtyRects = [this](winrt_impl::Direct3D11CaptureFrame const& capturedFrame)
+            {
+#ifdef WEBVIEW_TOOLKIT_CAPTURE_DIRTY_REGIONS
+                if (m_dirtyRegionsEnabled)
+                {
+                    for (auto const& region : capturedFrame.DirtyRegions())
+                    {
+                        m_dirtyRects.push_back(PixelRect{ region.X, region.Y, region.X + region.Width, region.Y + region.Height });
+                    }
+                }
+#else
+                (void)capturedFrame;
+#endif
+            };
 
-            if (capturedTexture)
+            uint32_t framesTaken = 0;
+            auto frame = DrainFrames(drainMode,
+                [&framePool]() { return framePool.TryGetNextFrame(); },
+                [&collectDirtyRects](winrt_impl::Direct3D11CaptureFrame& staleFrame)
+                {
+                    collectDirtyRects(staleFrame);
+                    staleFrame.Close();     // Return the buffer to the pool right away
+                },
+                m_frameCounters,
+                &framesTaken);
+
+            // Left over from late latching; anything in the pool is newer. Its
+            // dirty rectangles are relative to a frame that was never presented.
+            bool dirtyRectsKnown = m_dirtyRegionsEnabled;
+            LatchedFrame leftover;
+            if (m_latestFrames.Take(leftover))
             {
-                DebugLog::Log("UpdateTexture: Got captured texture %p", capturedTexture);
+                winrt_impl::Direct3D11CaptureFrame latched{ nullptr };
+                winrt::attach_abi(latched, leftover.frame);
+                if (frame)
+                {
+                    latched.Close();
+                }
+                else
+                {
+                    frame = std::move(latched);
+                    dirtyRectsKnown = false;
+                }
+            }
 
-                // Use RenderAPI to handle the copy (handles D3D12 wrapping complexity)
-                DebugLog::Log("UpdateTexture: Calling CopyCapturedTextureToUnityTexture...");
-                m_renderAPI->CopyCapturedTextureToUnityTexture(capturedTexture, unityTexturePtr, true);
-                DebugLog::Log("UpdateTexture: Copy completed");
+            // Handed-off frames keep buffers out of the pool, which would read as starvation
+            if (m_adaptivePoolDepth && drainMode == FrameDrainMode::Latest && presentMode == PresentMode::Copy)
+            {
+                AdaptFramePoolDepth(framesTaken);
+            }
 
-                capturedTexture->Release();
+            if (!frame)
+            {
+                // Asynchronous backends may still have an earlier frame in flight.
+                // Retired frames are released on the next visit.
+                bool inFlight = presentMode == PresentMode::Copy && m_renderAPI->ResolvePendingCopies(unityTexturePtr);
+                mirrors.GetTextures(m_mirrorTextures);
+                for (void* mirrorTexture : m_mirrorTextures)
+                {
+                    inFlight |= m_renderAPI->ResolvePendingCopies(mirrorTexture);
+                }
+                return inFlight || m_handoff.HasRetired() || !m_frameEventsEnabled;
             }
-            else
+
+            if (dirtyRectsKnown)
             {
-                DebugLog::Log("UpdateTexture: ERROR - Failed to get captured texture interface");
+                collectDirtyRects(frame);
             }
+            PresentFrame(frame, unityTexturePtr, flipMode, presentMode, mirrors, dirtyRectsKnown ? &m_dirtyRects : nullptr);
 
-            // Explicitly close frame to release it immediately
-            frame.Close();
-            DebugLog::Log("UpdateTexture: Frame closed");
+            // Look again next event: asynchronous backends present this frame
+            // then, and a Single drain may have left frames queued
+            return true;
         }
         catch (winrt::hresult_error const& ex)
         {
@@ -454,11 +845,144 @@ namespace WebViewToolkit
         {
             DebugLog::Log("UpdateTexture: ERROR - Unknown exception!");
         }
+        return false;
+    }
+
+    void WebViewCapture::LatchTexture(void* unityTexturePtr, FlipMode flipMode, MirrorRegistry& mirrors)
+    {
+        if (!m_framePool || !unityTexturePtr)
+        {
+            return;
+        }
+
+        try
+        {
+            // Without FrameArrived nothing fills the mailbox in between
+            if (!m_frameEventsEnabled)
+            {
+                LatchArrivedFrames();
+            }
+
+            LatchedFrame latched;
+            if (!m_latestFrames.Take(latched))
+            {
+                // Asynchronous backends may still have an earlier frame in flight
+                m_frameCounters.RecordNoNewFrame();
+                m_renderAPI->ResolvePendingCopies(unityTexturePtr);
+                mirrors.GetTextures(m_mirrorTextures);
+                for (void* mirrorTexture : m_mirrorTextures)
+                {
+                    m_renderAPI->ResolvePendingCopies(mirrorTexture);
+                }
+                return;
+            }
+
+            // Superseded frames were dropped unseen, so the copy is a whole one
+            winrt_impl::Direct3D11CaptureFrame frame{ nullptr };
+            winrt::attach_abi(frame, latched.frame);
+            PresentFrame(frame, unityTexturePtr, flipMode, PresentMode::Copy, mirrors, nullptr);
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("LatchTexture: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+        }
+        catch (...)
+        {
+            DebugLog::Log("LatchTexture: ERROR - Unknown exception!");
+        }
+    }
+
+    void WebViewCapture::LatchArrivedFrames()
+    {
+        if (!m_framePool)
+        {
+            return;
+        }
+
+        try
+        {
+            // Keep the pool empty so the capture never waits for a buffer; the
+            // render thread takes whichever frame is newest when it copies
+            auto framePool = static_cast<FramePoolWrapper*>(m_framePool)->Value;
+            for (uint32_t taken = 0; taken < MaxFramesPerDrain; ++taken)
+            {
+                auto frame = framePool.TryGetNextFrame();
+                if (!frame)
+                {
+                    break;
+                }
+
+                const uint64_t captureTime = frame.SystemRelativeTime().count();
+                const bool superseded = m_latestFrames.Publish(winrt::detach_abi(frame), captureTime);
+                m_frameCounters.RecordDrain(1, superseded ? 1 : 0);
+            }
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("LatchArrivedFrames: ERROR - WinRT exception: 0x%08X", ex.code());
+        }
+    }
+
+    void WebViewCapture::ReleaseLatestFrame(void* frame)
+    {
+        winrt_impl::Direct3D11CaptureFrame latched{ nullptr };
+        winrt::attach_abi(latched, frame);
+        try
+        {
+            latched.Close();
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("ReleaseLatestFrame: ERROR - WinRT exception: 0x%08X", ex.code());
+        }
+    }
+
+    void WebViewCapture::SetLateLatch(bool enabled)
+    {
+        if (m_lateLatching.exchange(enabled, std::memory_order_relaxed) == enabled)
+        {
+            return;
+        }
+
+        if (enabled && m_frameEventsEnabled)
+        {
+            // Frames already queued; later ones come with FrameArrived.
+            // Without the event LatchTexture takes them on the render thread.
+            LatchArrivedFrames();
+        }
+        else
+        {
+            // The render thread presents what the mailbox still holds
+            RequestUpdate();
+        }
+    }
+
+    void WebViewCapture::CopyToMirrors(const CapturedFrame& captured, MirrorRegistry& mirrors, FlipMode flipMode)
+    {
+        // A stretched frame shows its content at the new size
+        const uint32_t contentWidth = captured.scaledWidth ? captured.scaledWidth : captured.width;
+        const uint32_t contentHeight = captured.scaledHeight ? captured.scaledHeight : captured.height;
+        mirrors.PlanFanOut(contentWidth, contentHeight, m_renderAPI->CanScaleFrames(), m_mirrorCopies);
+
+        // Each mirror keeps its own copy history, so 1:1 copies still only
+        // touch the dirty rectangles
+        for (const MirrorCopy& copy : m_mirrorCopies)
+        {
+            CapturedFrame mirrored = captured;
+            if (copy.scaled || captured.scaledWidth)
+            {
+                mirrored.scaledWidth = copy.width;
+                mirrored.scaledHeight = copy.height;
+                mirrored.dirtyRects = nullptr;
+                mirrored.dirtyRectCount = 0;
+            }
+            m_renderAPI->CopyCapturedTextureToUnityTexture(mirrored, copy.texture, flipMode);
+        }
     }
 
-    Result WebViewCapture::Resize(uint32_t width, uint32_t height)
+    Result WebViewCapture::Resize(uint32_t width, uint32_t height, uint32_t capacityWidth, uint32_t capacityHeight)
     {
-        DebugLog::Log("Resize: Starting resize to %ux%u", width, height);
+        DebugLog::Log("Resize: Starting resize to %ux%u (capacity %ux%u)", width, height, capacityWidth, capacityHeight);
 
         try
         {
@@ -488,73 +1012,16 @@ namespace WebViewToolkit
             // Setting explicit size here would ADD to the RelativeSizeAdjustment, making it too large
             // No action needed here - the RelativeSizeAdjustment automatically tracks parent size
 
-            // Recreate capture setup from scratch
-            // Note: framePool.Recreate() doesn't work reliably - it crashes when called while session is active
-            // Solution: Destroy everything and recreate from scratch
-            if (m_framePool && m_captureItem && m_d3dDevice)
-            {
-                DebugLog::Log("Resize: Recreating capture setup from scratch");
+            // Frames keep the old window size until the compositor catches up
+            m_resizeTransaction.Begin(m_contentWidth, m_contentHeight, capacityWidth, capacityHeight, GetTickCount64());
+            m_resizeHoldLogged = false;
+            m_contentWidth = width;
+            m_contentHeight = height;
 
-                // Step 1: Close and destroy existing session
-                if (m_session)
-                {
-                    DebugLog::Log("Resize: Closing existing session...");
-                    auto sessionWrapper = static_cast<SessionWrapper*>(m_session);
-                    sessionWrapper->Value.Close();
-                    delete sessionWrapper;
-                    m_session = nullptr;
-                    DebugLog::Log("Resize: Session closed and deleted");
-                }
-
-                // Step 2: Close and destroy existing frame pool
-                DebugLog::Log("Resize: Closing existing frame pool...");
-                auto oldFramePoolWrapper = static_cast<FramePoolWrapper*>(m_framePool);
-                oldFramePoolWrapper->Value.Close();
-                delete oldFramePoolWrapper;
-                m_framePool = nullptr;
-                DebugLog::Log("Resize: Frame pool closed and deleted");
-
-                // Step 3: Get the stored WinRT device
-                auto inspectable = static_cast<::IInspectable*>(m_d3dDevice);
-                winrt::com_ptr<::IInspectable> devicePtr;
-                devicePtr.copy_from(inspectable);
-                auto rtDevice = devicePtr.as<winrt_impl::IDirect3DDevice>();
-
-                // Step 4: Get the capture item
-                auto captureItemWrapper = static_cast<CaptureItemWrapper*>(m_captureItem);
-                auto captureItem = captureItemWrapper->Value;
-
-                // Step 5: Create new frame pool with new size
-                winrt_impl::SizeInt32 newSize;
-                newSize.Width = static_cast<int32_t>(width);
-                newSize.Height = static_cast<int32_t>(height);
-                DebugLog::Log("Resize: Creating new frame pool (size: %dx%d)...", newSize.Width, newSize.Height);
-
-                auto pixelFormat = winrt_impl::DirectXPixelFormat::B8G8R8A8UIntNormalized;
-                auto newFramePool = winrt_impl::Direct3D11CaptureFramePool::Create(
-                    rtDevice,
-                    pixelFormat,
-                    2,
-                    newSize
-                );
-                m_framePool = new FramePoolWrapper{ newFramePool };
-                DebugLog::Log("Resize: New frame pool created");
-
-                // Step 6: Create new session from new frame pool
-                DebugLog::Log("Resize: Creating new capture session...");
-                auto newSession = newFramePool.CreateCaptureSession(captureItem);
-                m_session = new SessionWrapper{ newSession };
-                DebugLog::Log("Resize: New session created");
-
-                // Step 7: Start the new session
-                DebugLog::Log("Resize: Starting new capture session...");
-                newSession.StartCapture();
-                DebugLog::Log("Resize: Capture setup recreated successfully");
-            }
-            else
-            {
-                DebugLog::Log("Resize: Skipping capture recreation (framePool=%p, captureItem=%p, d3dDevice=%p)",
-                    m_framePool, m_captureItem, m_d3dDevice);
+            // Within the capacity the frames keep their size; only the cropped part changes
+            if (capacityWidth != m_capacityWidth || capacityHeight != m_capacityHeight)
+            {
+                RecreateCaptureSession(capacityWidth, capacityHeight);
             }
 
             DebugLog::Log("Resize: Resize completed successfully");
@@ -577,4 +1044,135 @@ namespace WebViewToolkit
         }
     }
 
+    void WebViewCapture::RecreateCaptureSession(uint32_t width, uint32_t height)
+    {
+        // Recreate capture setup from scratch
+        // Note: framePool.Recreate() doesn't work reliably - it crashes when called while session is active
+        // Solution: Destroy everything and recreate from scratch
+        if (!m_framePool || !m_captureItem || !m_d3dDevice)
+        {
+            DebugLog::Log("RecreateCaptureSession: Skipping capture recreation (framePool=%p, captureItem=%p, d3dDevice=%p)",
+                m_framePool, m_captureItem, m_d3dDevice);
+            return;
+        }
+
+        DebugLog::Log("RecreateCaptureSession: Recreating capture setup from scratch");
+        m_capacityWidth = width;
+        m_capacityHeight = height;
+
+        // Step 1: Close and destroy existing session
+        if (m_session)
+        {
+            DebugLog::Log("RecreateCaptureSession: Closing existing session...");
+            auto sessionWrapper = static_cast<SessionWrapper*>(m_session);
+            sessionWrapper->Value.Close();
+            delete sessionWrapper;
+            m_session = nullptr;
+            DebugLog::Log("RecreateCaptureSession: Session closed and deleted");
+        }
+
+        // Step 2: Close and destroy existing frame pool
+        DebugLog::Log("RecreateCaptureSession: Closing existing frame pool...");
+        CloseFramePool();
+        DebugLog::Log("RecreateCaptureSession: Frame pool closed and deleted");
+
+        // Step 3: Get the stored WinRT device
+        auto inspectable = static_cast<::IInspectable*>(m_d3dDevice);
+        winrt::com_ptr<::IInspectable> devicePtr;
+        devicePtr.copy_from(inspectable);
+        auto rtDevice = devicePtr.as<winrt_impl::IDirect3DDevice>();
+
+        // Step 4: Get the capture item
+        auto captureItemWrapper = static_cast<CaptureItemWrapper*>(m_captureItem);
+        auto captureItem = captureItemWrapper->Value;
+
+        // Step 5: Create new frame pool with new size
+        winrt_impl::SizeInt32 newSize;
+        newSize.Width = static_cast<int32_t>(width);
+        newSize.Height = static_cast<int32_t>(height);
+        const uint32_t poolDepth = m_poolDepth.load(std::memory_order_relaxed);
+        DebugLog::Log("RecreateCaptureSession: Creating new frame pool (size: %dx%d, buffers: %u)...",
+            newSize.Width, newSize.Height, poolDepth);
+
+        auto pixelFormat = winrt_impl::DirectXPixelFormat::B8G8R8A8UIntNormalized;
+        auto newFramePool = winrt_impl::Direct3D11CaptureFramePool::Create(
+            rtDevice,
+            pixelFormat,
+            static_cast<int32_t>(poolDepth),
+            newSize
+        );
+        m_framePool = WrapFramePool(newFramePool);
+        DebugLog::Log("RecreateCaptureSession: New frame pool created");
+
+        // Step 6: Create new session from new frame pool
+        DebugLog::Log("RecreateCaptureSession: Creating new capture session...");
+        auto newSession = newFramePool.CreateCaptureSession(captureItem);
+        m_session = new SessionWrapper{ newSession };
+        DebugLog::Log("RecreateCaptureSession: New session created");
+        ConfigureDirtyRegions();
+
+        // Step 7: Start the new session
+        DebugLog::Log("RecreateCaptureSession: Starting new capture session...");
+        newSession.StartCapture();
+        DebugLog::Log("RecreateCaptureSession: Capture setup recreated successfully");
+    }
+
+    void WebViewCapture::AdaptFramePoolDepth(uint32_t framesTaken)
+    {
+        // Every frame but the presented one was stale in Latest mode
+        const uint32_t framesDiscarded = framesTaken ? framesTaken - 1 : 0;
+        if (!m_depthController.OnRenderEvent(framesTaken, framesDiscarded))
+        {
+            return;
+        }
+
+        const uint32_t depth = m_depthController.GetDepth();
+        DebugLog::Log("AdaptFramePoolDepth: Frame pool depth %u -> %u",
+            m_poolDepth.load(std::memory_order_relaxed), depth);
+
+        // The pool and session must be rebuilt on the thread that owns them;
+        // look the view up again in case it was destroyed in the meantime
+        WebViewManager* manager = m_webView->m_manager;
+        const WebViewHandle handle = m_webView->GetHandle();
+        WebViewManager::PostToMainThread([manager, handle, depth]()
+        {
+            WebView* webView = manager->GetWebView(handle);
+            if (webView && webView->m_capture)
+            {
+                // Keep the render thread out of the pool while it is rebuilt
+                std::lock_guard<std::mutex> lock(webView->m_textureMutex);
+                webView->m_capture->SetFramePoolDepth(depth);
+            }
+        });
+    }
+
+    Result WebViewCapture::SetFramePoolDepth(uint32_t depth)
+    {
+        if (depth < MinFramePoolDepth || depth > MaxFramePoolDepth)
+        {
+            return Result::ErrorInvalidArgument;
+        }
+
+        if (m_poolDepth.exchange(depth, std::memory_order_relaxed) == depth)
+        {
+            return Result::Success;
+        }
+
+        try
+        {
+            RecreateCaptureSession(m_capacityWidth, m_capacityHeight);
+            return Result::Success;
+        }
+        catch (winrt::hresult_error const& ex)
+        {
+            DebugLog::Log("SetFramePoolDepth: ERROR - WinRT exception: 0x%08X - %ls", ex.code(), ex.message().c_str());
+            return Result::ErrorUnknown;
+        }
+        catch (...)
+        {
+            DebugLog::Log("SetFramePoolDepth: ERROR - Unknown exception!");
+            return Result::ErrorUnknown;
+        }
+    }
+
 } // namespace WebViewToolkit
@@ -4,6 +4,7 @@
 
 #include "WebViewToolkit/WebViewManager.h"
 #include "WebViewToolkit/WebView.h"
+#include "WebViewToolkit/CaptureAtlas.h"
 
 // Windows headers
 #include <Windows.h>
@@ -54,6 +55,31 @@ namespace WebViewToolkit
         return s_isShuttingDown.load(std::memory_order_acquire);
     }
 
+    bool WebViewManager::PostToMainThread(std::function<void()> task)
+    {
+        if (!s_dispatcherQueueController || IsShuttingDown())
+        {
+            return false;
+        }
+
+        try
+        {
+            winrt::Windows::System::DispatcherQueueController controller{ nullptr };
+            winrt::copy_from_abi(controller, s_dispatcherQueueController);
+            return controller.DispatcherQueue().TryEnqueue([task = std::move(task)]()
+            {
+                if (!IsShuttingDown())
+                {
+                    task();
+                }
+            });
+        }
+        catch (...)
+        {
+            return false;
+        }
+    }
+
     void WebViewManager::SignalShuttingDown()
     {
         s_isShuttingDown.store(true, std::memory_order_release);
@@ -165,7 +191,12 @@ namespace WebViewToolkit
         std::lock_guard<std::mutex> lock(m_mutex);
 
         // Abandonment strategy for stability
+        for (const auto& pair : m_instances)
+        {
+            m_frameVersions.Unregister(pair.first);
+        }
         m_instances.clear(); // Destructors of WebView will handle cleanup/abandonment logic
+        m_captureAtlas.reset();
         
         m_initialized = false;
         m_shutdownComplete = true;
@@ -189,6 +220,11 @@ namespace WebViewToolkit
         std::lock_guard<std::mutex> lock(m_mutex);
         if (!m_initialized) return Result::ErrorNotInitialized;
 
+        if (params.useCaptureAtlas && !m_captureAtlas)
+        {
+            m_captureAtlas = std::make_unique<CaptureAtlas>(m_renderAPI);
+        }
+
         WebViewHandle handle = GenerateHandle();
         outHandle = handle;
 
@@ -201,6 +237,10 @@ namespace WebViewToolkit
         }
 
         m_instances[handle] = std::move(webView);
+        if (!m_frameVersions.Register(handle))
+        {
+            Log(1, "WebViewManager: Frame version table full, view has no frame version");
+        }
         
         Log(0, "WebViewManager: WebView created");
         return Result::Success;
@@ -213,6 +253,7 @@ namespace WebViewToolkit
         if (it == m_instances.end()) return Result::ErrorInvalidHandle;
 
         m_instances.erase(it); // unique_ptr destructor calls data.Shutdown()
+        m_frameVersions.Unregister(handle);
         Log(0, "WebViewManager: WebView destroyed");
         return Result::Success;
     }
@@ -227,6 +268,148 @@ namespace WebViewToolkit
         return webView ? webView->Resize(width, height) : Result::ErrorInvalidHandle;
     }
 
+    Result WebViewManager::SetFlipMode(WebViewHandle handle, FlipMode mode)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetFlipMode(mode) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::SetFrameDrainMode(WebViewHandle handle, FrameDrainMode mode)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetFrameDrainMode(mode) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::SetPresentMode(WebViewHandle handle, PresentMode mode)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetPresentMode(mode) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::SetLateLatch(WebViewHandle handle, bool enabled)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetLateLatch(enabled) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::GetCaptureStats(WebViewHandle handle, CaptureFrameStats& outStats)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->GetCaptureStats(outStats) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::AttachMirror(WebViewHandle handle, uint32_t width, uint32_t height, MirrorId& outId)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->AttachMirror(width, height, outId) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::DetachMirror(WebViewHandle handle, MirrorId id)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->DetachMirror(id) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::GetMirrorTexture(WebViewHandle handle, MirrorId id, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->GetMirrorTexture(id, outTexture, outWidth, outHeight) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::GetMirrorUVRect(WebViewHandle handle, MirrorId id, float outUVRect[4])
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->GetMirrorUVRect(id, outUVRect) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::SetRenderScale(WebViewHandle handle, float scale)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetRenderScale(scale) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::EnableAutoRenderScale(WebViewHandle handle, float frameBudgetMs, float minScale)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->EnableAutoRenderScale(frameBudgetMs, minScale) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::ReportRenderScaleSample(WebViewHandle handle, float frameTimeMs, float coverage)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->ReportRenderScaleSample(frameTimeMs, coverage) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::SetResizeInterval(WebViewHandle handle, uint32_t intervalMs)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->SetResizeInterval(intervalMs) : Result::ErrorInvalidHandle;
+    }
+
+    Result WebViewManager::GetResizeStats(WebViewHandle handle, ResizeStats& outStats)
+    {
+        auto webView = GetWebView(handle);
+        return webView ? webView->GetResizeStats(outStats) : Result::ErrorInvalidHandle;
+    }
+
+    void WebViewManager::ApplyPendingResizes()
+    {
+        std::vector<WebView*> pending;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for (auto& pair : m_instances)
+            {
+                if (pair.second->HasPendingResize())
+                {
+                    pending.push_back(pair.second.get());
+                }
+            }
+        }
+
+        // Resized without the lock so render events go on meanwhile; views
+        // are only destroyed on this thread
+        for (WebView* webView : pending)
+        {
+            webView->ApplyPendingResize();
+        }
+    }
+
+    Result WebViewManager::GetTextureSize(WebViewHandle handle, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        auto webView = GetWebView(handle);
+        if (!webView)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        webView->GetTextureSize(outWidth, outHeight);
+        return Result::Success;
+    }
+
+    Result WebViewManager::GetTexture(WebViewHandle handle, void*& outTexture, uint32_t& outWidth, uint32_t& outHeight)
+    {
+        auto webView = GetWebView(handle);
+        if (!webView)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        webView->GetTexture(outTexture, outWidth, outHeight);
+        return Result::Success;
+    }
+
+    Result WebViewManager::GetTextureUVRect(WebViewHandle handle, float outUVRect[4])
+    {
+        auto webView = GetWebView(handle);
+        if (!webView)
+        {
+            return Result::ErrorInvalidHandle;
+        }
+
+        webView->GetTextureUVRect(outUVRect);
+        return Result::Success;
+    }
+
     Result WebViewManager::Navigate(WebViewHandle handle, const wchar_t* url)
     {
         auto webView = GetWebView(handle);
@@ -284,9 +467,9 @@ namespace WebViewToolkit
     void WebViewManager::UpdateTexture(WebViewHandle handle)
     {
         auto webView = GetWebView(handle);
-        if (webView)
+        if (webView && webView->UpdateTexture())
         {
-            webView->UpdateTexture();
+            webView->RequestTextureUpdate();
         }
     }
 
@@ -295,10 +478,74 @@ namespace WebViewToolkit
         std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
         if (!lock.owns_lock()) return;
 
+        // Steady-state frames should neither allocate nor create or query objects
+        m_frameResources.BeginFrame();
+
+        // Every view's copy goes out in one submission at the end
+        if (m_renderAPI) m_renderAPI->BeginCopyBatch();
+
+        if (m_pendingUpdates.TakeOverflow())
+        {
+            // A request was lost: visit everyone once, which resets every flag
+            for (auto& pair : m_instances)
+            {
+                if (pair.second->UpdateTexture())
+                {
+                    m_revisits.push_back(pair.second.get());
+                }
+            }
+        }
+
+        WebViewHandle handle;
+        while (m_pendingUpdates.TryPop(handle))
+        {
+            auto it = m_instances.find(handle);
+            if (it != m_instances.end() && it->second->UpdateTexture())
+            {
+                m_revisits.push_back(it->second.get());
+            }
+        }
+
+        // One copy for every atlas view
+        const bool revisitAtlas = m_captureAtlas && m_captureAtlas->IsUpdateRequested() && m_captureAtlas->UpdateTexture(m_frameVersions);
+
+        if (m_renderAPI) m_renderAPI->EndCopyBatch();
+
+        // Queued only now so the loop above cannot visit a view twice
+        for (WebView* webView : m_revisits)
+        {
+            webView->RequestTextureUpdate();
+        }
+        m_revisits.clear();
+        if (revisitAtlas)
+        {
+            m_captureAtlas->RequestUpdate();
+        }
+
+        m_frameResources.EndFrame();
+    }
+
+    void WebViewManager::LatchAllTextures()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex, std::try_to_lock);
+        if (!lock.owns_lock()) return;
+
+        // Late-latched views are few and cheap to look at without a new frame,
+        // so every one is visited; their copies share one submission
+        if (m_renderAPI) m_renderAPI->BeginCopyBatch();
         for (auto& pair : m_instances)
         {
-             pair.second->UpdateTexture(); 
+            if (pair.second->IsLateLatched())
+            {
+                pair.second->LatchTexture();
+            }
         }
+        if (m_renderAPI) m_renderAPI->EndCopyBatch();
+    }
+
+    void WebViewManager::QueueTextureUpdate(WebViewHandle handle)
+    {
+        m_pendingUpdates.Push(handle);
     }
     
     void WebViewManager::OnDeviceLost()
@@ -309,6 +556,10 @@ namespace WebViewToolkit
         {
             pair.second->OnDeviceLost();
         }
+        if (m_captureAtlas)
+        {
+            m_captureAtlas->OnDeviceLost();
+        }
 
         if (m_deviceEventCallback)
         {
@@ -320,6 +571,10 @@ namespace WebViewToolkit
     {
         std::lock_guard<std::mutex> lock(m_mutex);
         Log(0, "WebViewManager: Device restored, notifying instances");
+        if (m_captureAtlas)
+        {
+            m_captureAtlas->OnDeviceRestored();
+        }
         for (auto& pair : m_instances)
         {
             pair.second->OnDeviceRestored();
@@ -0,0 +1,327 @@
+// ============================================================================
+// WebViewToolkit - AtlasPacker Tests
+// ============================================================================
+
+#include "Core/AtlasPacker.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    AtlasRect RectOf(const AtlasPacker& packer, uint32_t id)
+    {
+        AtlasRect rect;
+        EXPECT_TRUE(packer.GetRect(id, rect)) << "id " << id;
+        return rect;
+    }
+
+    void ExpectRect(const AtlasRect& rect, uint32_t x, uint32_t y, uint32_t width, uint32_t height)
+    {
+        EXPECT_EQ(rect.x, x);
+        EXPECT_EQ(rect.y, y);
+        EXPECT_EQ(rect.width, width);
+        EXPECT_EQ(rect.height, height);
+    }
+
+    // Every texel must be exactly one of: placed, a free rectangle, past the skyline
+    ::testing::AssertionResult CoversAtlasExactlyOnce(const AtlasPacker& packer, const std::vector<uint32_t>& ids)
+    {
+        const uint32_t width = packer.GetWidth();
+        const uint32_t height = packer.GetHeight();
+        std::vector<uint8_t> cover(static_cast<size_t>(width) * height, 0);
+        auto mark = [&](const AtlasRect& rect)
+        {
+            for (uint32_t y = rect.y; y < rect.Bottom() && y < height; ++y)
+            {
+                for (uint32_t x = rect.x; x < rect.Right() && x < width; ++x)
+                {
+                    cover[static_cast<size_t>(y) * width + x]++;
+                }
+            }
+        };
+
+        for (uint32_t id : ids)
+        {
+            AtlasRect rect;
+            if (!packer.GetRect(id, rect))
+            {
+                return ::testing::AssertionFailure() << "id " << id << " lost";
+            }
+            if (rect.Right() > width || rect.Bottom() > height)
+            {
+                return ::testing::AssertionFailure() << "id " << id << " out of bounds";
+            }
+            mark(rect);
+        }
+        for (const auto& hole : packer.GetFreeRects())
+        {
+            mark(hole);
+        }
+        for (uint32_t x = 0; x < width; ++x)
+        {
+            mark({ x, packer.GetSkylineHeight(x), 1, height - std::min(height, packer.GetSkylineHeight(x)) });
+        }
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const uint8_t count = cover[static_cast<size_t>(y) * width + x];
+                if (count != 1)
+                {
+                    return ::testing::AssertionFailure() << "texel (" << x << ", " << y << ") covered " << int(count) << " times";
+                }
+            }
+        }
+        return ::testing::AssertionSuccess();
+    }
+}
+
+TEST(AtlasPackerTests, PlacesBottomLeftOnTheSkyline)
+{
+    AtlasPacker packer(100, 100);
+    ASSERT_TRUE(packer.Add(1, 60, 30));
+    ASSERT_TRUE(packer.Add(2, 40, 50));
+    ASSERT_TRUE(packer.Add(3, 60, 20));
+
+    ExpectRect(RectOf(packer, 1), 0, 0, 60, 30);
+    ExpectRect(RectOf(packer, 2), 60, 0, 40, 50);
+    ExpectRect(RectOf(packer, 3), 0, 30, 60, 20);
+    EXPECT_EQ(packer.GetUsedArea(), 60u * 30 + 40 * 50 + 60 * 20);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 2, 3 }));
+}
+
+TEST(AtlasPackerTests, RejectsWhatCannotBePlaced)
+{
+    AtlasPacker packer(64, 64);
+    EXPECT_FALSE(packer.Add(1, 65, 10));
+    EXPECT_FALSE(packer.Add(1, 0, 10));
+    ASSERT_TRUE(packer.Add(1, 64, 40));
+    EXPECT_FALSE(packer.Add(1, 8, 8));      // Id taken
+    EXPECT_FALSE(packer.Add(2, 64, 25));    // 40 + 25 > 64
+    EXPECT_FALSE(packer.Remove(2));
+
+    EXPECT_EQ(packer.GetCount(), 1u);
+    EXPECT_EQ(packer.GetStats().failed, 4u);
+}
+
+TEST(AtlasPackerTests, SteppedOverGapsAreReused)
+{
+    AtlasPacker packer(100, 100);
+    ASSERT_TRUE(packer.Add(1, 50, 10));
+    ASSERT_TRUE(packer.Add(2, 50, 40));
+    ASSERT_TRUE(packer.Add(3, 100, 10));   // Leaves a 50x30 gap under view 1
+
+    ExpectRect(RectOf(packer, 3), 0, 40, 100, 10);
+    ASSERT_EQ(packer.GetFreeRects().size(), 1u);
+    ExpectRect(packer.GetFreeRects()[0], 0, 10, 50, 30);
+
+    ASSERT_TRUE(packer.Add(4, 20, 30));
+    ExpectRect(RectOf(packer, 4), 0, 10, 20, 30);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 2, 3, 4 }));
+}
+
+TEST(AtlasPackerTests, RemovedViewLeavesAReusableHole)
+{
+    AtlasPacker packer(100, 100);
+    for (uint32_t id = 1; id <= 3; ++id)
+    {
+        ASSERT_TRUE(packer.Add(id, 30, 30));
+    }
+    ASSERT_TRUE(packer.Add(4, 100, 10));
+    ASSERT_TRUE(packer.Remove(2));
+
+    // Same size goes back where the removed view was
+    ASSERT_TRUE(packer.Add(5, 30, 30));
+    ExpectRect(RectOf(packer, 5), 30, 0, 30, 30);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 3, 4, 5 }));
+}
+
+TEST(AtlasPackerTests, RemovingTheTopViewLowersTheSkyline)
+{
+    AtlasPacker packer(100, 100);
+    ASSERT_TRUE(packer.Add(1, 100, 20));
+    ASSERT_TRUE(packer.Add(2, 40, 30));
+    EXPECT_EQ(packer.GetSkylineHeight(10), 50u);
+
+    ASSERT_TRUE(packer.Remove(2));
+    EXPECT_EQ(packer.GetSkylineHeight(10), 20u);
+    EXPECT_TRUE(packer.GetFreeRects().empty());
+
+    ASSERT_TRUE(packer.Remove(1));
+    EXPECT_EQ(packer.GetSkylineHeight(10), 0u);
+    EXPECT_TRUE(packer.Add(3, 100, 100));
+}
+
+TEST(AtlasPackerTests, ResizeKeepsThePositionWhenItFits)
+{
+    AtlasPacker packer(100, 100);
+    ASSERT_TRUE(packer.Add(1, 40, 40));
+    ASSERT_TRUE(packer.Add(2, 40, 40));
+    ASSERT_TRUE(packer.Add(3, 100, 20));
+
+    // Shrink, then grow back into the space just given up
+    ASSERT_TRUE(packer.Resize(1, 20, 30));
+    ExpectRect(RectOf(packer, 1), 0, 0, 20, 30);
+    ASSERT_TRUE(packer.Resize(1, 40, 40));
+    ExpectRect(RectOf(packer, 1), 0, 0, 40, 40);
+
+    // Grow to the right into free space next to view 2
+    ASSERT_TRUE(packer.Resize(2, 60, 40));
+    ExpectRect(RectOf(packer, 2), 40, 0, 60, 40);
+
+    EXPECT_EQ(packer.GetStats().resizedInPlace, 3u);
+    EXPECT_EQ(packer.GetStats().relocated, 0u);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 2, 3 }));
+}
+
+TEST(AtlasPackerTests, BlockedResizeMovesAndFailedResizeKeepsTheView)
+{
+    AtlasPacker packer(100, 100);
+    ASSERT_TRUE(packer.Add(1, 50, 50));
+    ASSERT_TRUE(packer.Add(2, 50, 50));
+
+    // View 2 is in the way to the right, so view 1 moves below
+    ASSERT_TRUE(packer.Resize(1, 60, 40));
+    ExpectRect(RectOf(packer, 1), 0, 50, 60, 40);
+    EXPECT_EQ(packer.GetStats().relocated, 1u);
+
+    EXPECT_FALSE(packer.Resize(1, 100, 80));
+    ExpectRect(RectOf(packer, 1), 0, 50, 60, 40);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 2 }));
+}
+
+TEST(AtlasPackerTests, GrowKeepsEveryPlacement)
+{
+    AtlasPacker packer(64, 64);
+    ASSERT_TRUE(packer.Add(1, 64, 48));
+    ASSERT_FALSE(packer.Add(2, 32, 32));
+
+    EXPECT_FALSE(packer.Grow(32, 128));
+    ASSERT_TRUE(packer.Grow(128, 64));
+    ASSERT_TRUE(packer.Add(2, 32, 32));
+    ExpectRect(RectOf(packer, 1), 0, 0, 64, 48);
+    ExpectRect(RectOf(packer, 2), 64, 0, 32, 32);
+
+    ASSERT_TRUE(packer.Grow(128, 128));
+    ASSERT_TRUE(packer.Add(3, 128, 64));
+    ExpectRect(RectOf(packer, 3), 0, 48, 128, 64);
+    EXPECT_TRUE(CoversAtlasExactlyOnce(packer, { 1, 2, 3 }));
+}
+
+TEST(AtlasPackerTests, UVRectMatchesTheTextureOrientation)
+{
+    float uv[4];
+    const AtlasRect rect{ 256, 128, 512, 256 };
+
+    ComputeAtlasUVRect(rect, 1024, 1024, 1024, false, uv);
+    EXPECT_FLOAT_EQ(uv[0], 0.25f);
+    EXPECT_FLOAT_EQ(uv[1], 0.125f);
+    EXPECT_FLOAT_EQ(uv[2], 0.5f);
+    EXPECT_FLOAT_EQ(uv[3], 0.25f);
+
+    // Bottom-up texture: the view's bottom edge is 640 rows from the top
+    ComputeAtlasUVRect(rect, 1024, 1024, 1024, true, uv);
+    EXPECT_FLOAT_EQ(uv[1], 0.625f);
+    EXPECT_FLOAT_EQ(uv[3], 0.25f);
+}
+
+TEST(AtlasPackerTests, UVRectInALargerPooledTexture)
+{
+    float uv[4];
+    const AtlasRect rect{ 256, 128, 512, 256 };
+
+    // A 1024x1024 atlas in the top-left of a 1280x1152 texture
+    ComputeAtlasUVRect(rect, 1024, 1280, 1152, false, uv);
+    EXPECT_FLOAT_EQ(uv[0], 256.0f / 1280.0f);
+    EXPECT_FLOAT_EQ(uv[1], 128.0f / 1152.0f);
+    EXPECT_FLOAT_EQ(uv[2], 512.0f / 1280.0f);
+    EXPECT_FLOAT_EQ(uv[3], 256.0f / 1152.0f);
+
+    // Only the atlas rows are mirrored: the bottom edge is still 640 rows from the top
+    ComputeAtlasUVRect(rect, 1024, 1280, 1152, true, uv);
+    EXPECT_FLOAT_EQ(uv[1], 640.0f / 1152.0f);
+    EXPECT_FLOAT_EQ(uv[3], 256.0f / 1152.0f);
+}
+
+TEST(AtlasPackerTests, RandomChurnKeepsTheAtlasConsistent)
+{
+    for (uint32_t seed = 1; seed <= 8; ++seed)
+    {
+        std::mt19937 rng(seed);
+        std::uniform_int_distribution<uint32_t> size(1, 40);
+        std::uniform_int_distribution<int> operation(0, 9);
+
+        AtlasPacker packer(128, 128);
+        std::map<uint32_t, AtlasRect> expected;
+        uint32_t nextId = 1;
+
+        for (int step = 0; step < 1500; ++step)
+        {
+            const int op = operation(rng);
+            if (op < 4 || expected.empty())
+            {
+                const uint32_t w = size(rng);
+                const uint32_t h = size(rng);
+                if (packer.Add(nextId, w, h))
+                {
+                    expected[nextId] = RectOf(packer, nextId);
+                }
+                nextId++;
+            }
+            else
+            {
+                auto it = expected.begin();
+                std::advance(it, std::uniform_int_distribution<size_t>(0, expected.size() - 1)(rng));
+                const uint32_t id = it->first;
+
+                if (op < 7)
+                {
+                    ASSERT_TRUE(packer.Remove(id));
+                    expected.erase(it);
+                }
+                else
+                {
+                    const uint32_t w = size(rng);
+                    const uint32_t h = size(rng);
+                    const AtlasRect before = it->second;
+                    const bool resized = packer.Resize(id, w, h);
+                    it->second = RectOf(packer, id);
+                    ASSERT_EQ(it->second.width, resized ? w : before.width);
+                    ASSERT_EQ(it->second.height, resized ? h : before.height);
+                }
+            }
+
+            // Nobody else moved
+            for (const auto& pair : expected)
+            {
+                const AtlasRect rect = RectOf(packer, pair.first);
+                ASSERT_EQ(rect.x, pair.second.x) << "seed " << seed << " step " << step;
+                ASSERT_EQ(rect.y, pair.second.y) << "seed " << seed << " step " << step;
+            }
+
+            std::vector<uint32_t> ids;
+            for (const auto& pair : expected)
+            {
+                ids.push_back(pair.first);
+            }
+            ASSERT_TRUE(CoversAtlasExactlyOnce(packer, ids)) << "seed " << seed << " step " << step;
+            ASSERT_EQ(packer.GetCount(), expected.size());
+        }
+
+        // Emptied out, the atlas is whole again
+        for (const auto& pair : expected)
+        {
+            ASSERT_TRUE(packer.Remove(pair.first));
+        }
+        EXPECT_TRUE(packer.GetFreeRects().empty()) << "seed " << seed;
+        EXPECT_EQ(packer.GetSkylineHeight(0), 0u);
+        EXPECT_TRUE(packer.Add(nextId, 128, 128));
+    }
+}
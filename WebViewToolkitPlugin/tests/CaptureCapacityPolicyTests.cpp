@@ -0,0 +1,154 @@
+// ============================================================================
+// WebViewToolkit - CaptureCapacityPolicy Tests
+// ============================================================================
+
+#include "Core/CaptureCapacityPolicy.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+using namespace WebViewToolkit;
+
+TEST(CaptureCapacityPolicyTests, RoundsUpToQuarterOctaveSteps)
+{
+    CaptureCapacityPolicy policy;
+
+    EXPECT_EQ(policy.RoundUp(0), 256u);
+    EXPECT_EQ(policy.RoundUp(100), 256u);
+    EXPECT_EQ(policy.RoundUp(257), 320u);
+    EXPECT_EQ(policy.RoundUp(512), 512u);
+    EXPECT_EQ(policy.RoundUp(800), 896u);
+    EXPECT_EQ(policy.RoundUp(1025), 1280u);
+    EXPECT_EQ(policy.RoundUp(1920), 2048u);
+    EXPECT_EQ(policy.RoundUp(2049), 2560u);
+}
+
+TEST(CaptureCapacityPolicyTests, OneStepPerOctaveGivesPowersOfTwo)
+{
+    CaptureCapacitySettings settings;
+    settings.stepsPerOctave = 1;
+    CaptureCapacityPolicy policy(settings);
+
+    EXPECT_EQ(policy.RoundUp(300), 512u);
+    EXPECT_EQ(policy.RoundUp(1024), 1024u);
+    EXPECT_EQ(policy.RoundUp(1025), 2048u);
+}
+
+TEST(CaptureCapacityPolicyTests, SizesAtTheLimitGetNoHeadroom)
+{
+    CaptureCapacitySettings settings;
+    settings.maxCapacity = 4096;
+    CaptureCapacityPolicy policy(settings);
+
+    EXPECT_EQ(policy.RoundUp(3900), 4096u);
+    EXPECT_EQ(policy.RoundUp(4096), 4096u);
+    EXPECT_EQ(policy.RoundUp(5000), 5000u);
+}
+
+TEST(CaptureCapacityPolicyTests, FirstUpdateAllocates)
+{
+    CaptureCapacityPolicy policy;
+
+    EXPECT_TRUE(policy.Update(800, 600));
+    EXPECT_EQ(policy.GetCapacityWidth(), 896u);
+    EXPECT_EQ(policy.GetCapacityHeight(), 640u);
+    EXPECT_EQ(policy.GetStats().grown, 1u);
+}
+
+TEST(CaptureCapacityPolicyTests, SmallChangesStayWithinTheCapacity)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(800, 600);
+
+    for (uint32_t width = 800; width <= 896; width++)
+    {
+        EXPECT_FALSE(policy.Update(width, 601)) << width;
+    }
+    EXPECT_FALSE(policy.Update(500, 400));
+    EXPECT_EQ(policy.GetCapacityWidth(), 896u);
+    EXPECT_EQ(policy.GetStats().absorbed, 98u);
+}
+
+TEST(CaptureCapacityPolicyTests, OutgrowingEitherDimensionReallocates)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(800, 600);
+
+    EXPECT_TRUE(policy.Update(897, 600));
+    EXPECT_EQ(policy.GetCapacityWidth(), 1024u);
+    EXPECT_TRUE(policy.Update(897, 700));
+    EXPECT_EQ(policy.GetCapacityHeight(), 768u);
+    EXPECT_EQ(policy.GetStats().grown, 3u);
+}
+
+TEST(CaptureCapacityPolicyTests, ShrinkingFarBelowReallocates)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(1920, 1080);  // 2048 x 1280
+
+    EXPECT_FALSE(policy.Update(1024, 1080));
+    EXPECT_TRUE(policy.Update(1000, 1080));
+    EXPECT_EQ(policy.GetCapacityWidth(), 1024u);
+    EXPECT_EQ(policy.GetCapacityHeight(), 1280u);
+    EXPECT_EQ(policy.GetStats().shrunk, 1u);
+}
+
+TEST(CaptureCapacityPolicyTests, MinimumCapacityNeverShrinks)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(200, 200);
+
+    EXPECT_FALSE(policy.Update(1, 1));
+    EXPECT_EQ(policy.GetCapacityWidth(), 256u);
+}
+
+TEST(CaptureCapacityPolicyTests, ResetReallocatesOnTheNextUpdate)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(800, 600);
+    policy.Reset();
+
+    EXPECT_EQ(policy.GetCapacityWidth(), 0u);
+    EXPECT_TRUE(policy.Update(800, 600));
+}
+
+TEST(CaptureCapacityPolicyTests, CapacityAlwaysHoldsTheSizeWithBoundedWaste)
+{
+    CaptureCapacityPolicy policy;
+    std::mt19937 rng(15);
+    std::uniform_int_distribution<uint32_t> size(1, 4000);
+
+    uint64_t reallocations = 0;
+    for (int step = 0; step < 5000; step++)
+    {
+        const uint32_t width = size(rng);
+        const uint32_t height = size(rng);
+        reallocations += policy.Update(width, height) ? 1 : 0;
+
+        ASSERT_GE(policy.GetCapacityWidth(), width);
+        ASSERT_GE(policy.GetCapacityHeight(), height);
+        // Never more than an octave of waste, beyond the minimum capacity
+        ASSERT_LE(policy.GetCapacityWidth(), std::max(2 * width, 256u));
+        ASSERT_LE(policy.GetCapacityHeight(), std::max(2 * height, 256u));
+    }
+
+    const auto& stats = policy.GetStats();
+    EXPECT_EQ(stats.grown + stats.shrunk, reallocations);
+    EXPECT_EQ(stats.grown + stats.shrunk + stats.absorbed, 5000u);
+}
+
+TEST(CaptureCapacityPolicyTests, DragResizeRarelyReallocates)
+{
+    CaptureCapacityPolicy policy;
+    policy.Update(640, 480);
+
+    // A drag from 640 to 1280 px wide, one pixel at a time
+    uint64_t reallocations = 0;
+    for (uint32_t width = 641; width <= 1280; width++)
+    {
+        reallocations += policy.Update(width, 480) ? 1 : 0;
+    }
+    EXPECT_LE(reallocations, 5u);
+}
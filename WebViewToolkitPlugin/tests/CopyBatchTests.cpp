@@ -0,0 +1,252 @@
+// ============================================================================
+// WebViewToolkit - CopyBatch Tests
+// ============================================================================
+
+#include "Core/CopyBatch.h"
+#include "WebViewToolkit/RenderAPI.h"
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // Render API that batches like the D3D12 backend and logs what reaches the device.
+    // Captured textures stand in for shared surfaces, Unity textures for wrapped resources.
+    class RecordingRenderAPI final : public IRenderAPI, private ICopyBatchRecorder
+    {
+    public:
+        std::vector<std::string> log;
+
+        void ProcessDeviceEvent(int, IUnityInterfaces*) override {}
+        bool IsInitialized() const override { return true; }
+        GraphicsAPI GetAPIType() const override { return GraphicsAPI::Direct3D12; }
+
+        Result CreateSharedTexture(uint32_t, uint32_t, void**) override { return Result::Success; }
+        void DestroySharedTexture(void*) override {}
+        Result ResizeSharedTexture(void*, uint32_t, uint32_t, void**) override { return Result::Success; }
+
+        void BeginRenderToTexture(void*) override {}
+        void EndRenderToTexture(void*) override { m_batch.RequestFlush(*this); }
+        void* GetCompositionDevice() const override { return nullptr; }
+        void* GetD3D11Device() const override { return nullptr; }
+
+        void WaitForGPU() override {}
+        void SignalRenderComplete() override {}
+
+        void CopyCapturedTextureToUnityTexture(const CapturedFrame& frame, void* unityTexturePtr, FlipMode) override
+        {
+            // A second copy into the same texture must not be reordered with the first
+            if (m_batch.Contains(unityTexturePtr))
+            {
+                m_batch.Execute(*this);
+            }
+
+            CopyBatchEntry entry;
+            entry.source = frame.texture;
+            entry.destination = unityTexturePtr;
+            m_batch.Submit(entry, *this);
+        }
+
+        void BeginCopyBatch() override { m_batch.Begin(); }
+        void EndCopyBatch() override { m_batch.End(*this); }
+
+        const CopyBatch& GetBatch() const { return m_batch; }
+
+    private:
+        void PrepareCopy(const CopyBatchEntry& entry) override { log.push_back("wait " + Name(entry.source)); }
+
+        void BeginAccess(void* const* resources, uint32_t count) override
+        {
+            log.push_back("acquire" + List(resources, count));
+        }
+
+        void RecordCopy(const CopyBatchEntry& entry) override
+        {
+            log.push_back("copy " + Name(entry.source) + ">" + Name(entry.destination));
+        }
+
+        void EndAccess(void* const* resources, uint32_t count) override
+        {
+            log.push_back("release" + List(resources, count));
+        }
+
+        void Flush() override { log.push_back("flush"); }
+
+        void FinishCopy(const CopyBatchEntry& entry) override { log.push_back("signal " + Name(entry.source)); }
+
+        static std::string Name(const void* resource) { return resource ? static_cast<const char*>(resource) : "-"; }
+
+        static std::string List(void* const* resources, uint32_t count)
+        {
+            std::string names;
+            for (uint32_t i = 0; i < count; ++i)
+            {
+                names += " " + Name(resources[i]);
+            }
+            return names;
+        }
+
+        CopyBatch m_batch;
+    };
+
+    // Names double as resource identities
+    char frameA[] = "fa";
+    char frameB[] = "fb";
+    char frameC[] = "fc";
+    char textureA[] = "ta";
+    char textureB[] = "tb";
+    char textureC[] = "tc";
+
+    void Copy(IRenderAPI& api, char* frame, char* texture)
+    {
+        CapturedFrame captured;
+        captured.texture = frame;
+        api.CopyCapturedTextureToUnityTexture(captured, texture, FlipMode::None);
+    }
+
+    size_t Count(const std::vector<std::string>& log, const std::string& prefix)
+    {
+        size_t count = 0;
+        for (const auto& line : log)
+        {
+            count += line.compare(0, prefix.size(), prefix) == 0 ? 1 : 0;
+        }
+        return count;
+    }
+}
+
+TEST(CopyBatchTests, WithoutBatchEachCopySubmitsOnItsOwn)
+{
+    RecordingRenderAPI api;
+    Copy(api, frameA, textureA);
+    Copy(api, frameB, textureB);
+
+    const std::vector<std::string> expected = {
+        "wait fa", "acquire fa ta", "copy fa>ta", "release fa ta", "flush", "signal fa",
+        "wait fb", "acquire fb tb", "copy fb>tb", "release fb tb", "flush", "signal fb",
+    };
+    EXPECT_EQ(api.log, expected);
+}
+
+TEST(CopyBatchTests, BatchAcquiresOnceAndFlushesOnce)
+{
+    RecordingRenderAPI api;
+    api.BeginCopyBatch();
+    Copy(api, frameA, textureA);
+    Copy(api, frameB, textureB);
+    Copy(api, frameC, textureC);
+
+    // Nothing reaches the device before the render event ends
+    EXPECT_TRUE(api.log.empty());
+    EXPECT_EQ(api.GetBatch().GetPendingCount(), 3u);
+
+    api.EndCopyBatch();
+    const std::vector<std::string> expected = {
+        "wait fa", "wait fb", "wait fc",
+        "acquire fa ta fb tb fc tc",
+        "copy fa>ta", "copy fb>tb", "copy fc>tc",
+        "release fa ta fb tb fc tc",
+        "flush",
+        "signal fa", "signal fb", "signal fc",
+    };
+    EXPECT_EQ(api.log, expected);
+
+    const CopyBatchStats& stats = api.GetBatch().GetStats();
+    EXPECT_EQ(stats.batches, 1u);
+    EXPECT_EQ(stats.copies, 3u);
+    EXPECT_EQ(stats.flushes, 1u);
+}
+
+TEST(CopyBatchTests, SharedResourcesAreAcquiredOnce)
+{
+    RecordingRenderAPI api;
+    api.BeginCopyBatch();
+    Copy(api, frameA, textureA);
+    Copy(api, frameA, textureB);
+    api.EndCopyBatch();
+
+    EXPECT_EQ(Count(api.log, "acquire"), 1u);
+    EXPECT_EQ(api.log[2], "acquire fa ta tb");
+    EXPECT_EQ(Count(api.log, "copy"), 2u);
+}
+
+TEST(CopyBatchTests, SecondCopyIntoATextureSplitsTheBatch)
+{
+    RecordingRenderAPI api;
+    api.BeginCopyBatch();
+    Copy(api, frameA, textureA);
+    Copy(api, frameB, textureB);
+    EXPECT_TRUE(api.GetBatch().Contains(textureA));
+
+    // The earlier copies go out first, the batch stays open for the rest
+    Copy(api, frameC, textureA);
+    EXPECT_EQ(Count(api.log, "flush"), 1u);
+    EXPECT_EQ(api.GetBatch().GetPendingCount(), 1u);
+    EXPECT_TRUE(api.GetBatch().IsOpen());
+
+    api.EndCopyBatch();
+    EXPECT_EQ(Count(api.log, "flush"), 2u);
+    EXPECT_EQ(api.log.back(), "signal fc");
+    EXPECT_FALSE(api.GetBatch().Contains(textureA));
+}
+
+TEST(CopyBatchTests, EmptyBatchDoesNothing)
+{
+    RecordingRenderAPI api;
+    api.BeginCopyBatch();
+    api.EndCopyBatch();
+
+    EXPECT_TRUE(api.log.empty());
+    EXPECT_EQ(api.GetBatch().GetStats().flushes, 0u);
+}
+
+TEST(CopyBatchTests, FlushRequestsJoinTheBatch)
+{
+    RecordingRenderAPI api;
+
+    // Outside a batch the request flushes right away
+    api.EndRenderToTexture(textureA);
+    EXPECT_EQ(Count(api.log, "flush"), 1u);
+
+    api.BeginCopyBatch();
+    api.EndRenderToTexture(textureA);
+    api.EndRenderToTexture(textureB);
+    Copy(api, frameA, textureC);
+    EXPECT_EQ(Count(api.log, "flush"), 1u);
+
+    api.EndCopyBatch();
+    EXPECT_EQ(Count(api.log, "flush"), 2u);
+
+    // A request alone still flushes at the end of the batch
+    api.BeginCopyBatch();
+    api.EndRenderToTexture(textureA);
+    api.EndCopyBatch();
+    EXPECT_EQ(Count(api.log, "flush"), 3u);
+    EXPECT_EQ(Count(api.log, "acquire"), 1u);
+}
+
+TEST(CopyBatchTests, NestedBatchesExecuteAtTheOutermostEnd)
+{
+    RecordingRenderAPI api;
+    api.BeginCopyBatch();
+    Copy(api, frameA, textureA);
+    api.BeginCopyBatch();
+    Copy(api, frameB, textureB);
+    api.EndCopyBatch();
+
+    EXPECT_TRUE(api.log.empty());
+    EXPECT_TRUE(api.GetBatch().IsOpen());
+
+    api.EndCopyBatch();
+    EXPECT_EQ(Count(api.log, "acquire"), 1u);
+    EXPECT_EQ(Count(api.log, "flush"), 1u);
+    EXPECT_FALSE(api.GetBatch().IsOpen());
+
+    // Unbalanced ends are ignored
+    api.EndCopyBatch();
+    EXPECT_FALSE(api.GetBatch().IsOpen());
+}
@@ -0,0 +1,236 @@
+// ============================================================================
+// WebViewToolkit - DeferredReleaseQueue Tests
+// ============================================================================
+
+#include "Core/DeferredReleaseQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // GPU timeline the test advances by hand
+    class FakeTimeline : public IGpuFence
+    {
+    public:
+        uint64_t Signal() override { return ++submitted; }
+        uint64_t GetCompletedValue() override { reads++; return completed; }
+        void Wait(uint64_t value) override { completed = value; }
+
+        void CompleteAll() { completed = submitted; }
+
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        int reads = 0;
+    };
+
+    class RecordingReleaser : public IDeferredReleaser
+    {
+    public:
+        void ReleaseNow(void* resource, uint32_t kind) override
+        {
+            released.push_back(resource);
+            kinds.push_back(kind);
+        }
+
+        std::vector<void*> released;
+        std::vector<uint32_t> kinds;
+    };
+
+    void* Resource(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(id);
+    }
+}
+
+TEST(DeferredReleaseQueueTests, ReleasesOnlyOnceTheFenceCompletes)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    queue.Retire(Resource(1), 7);
+    EXPECT_EQ(queue.Poll(), 0u);
+    EXPECT_TRUE(releaser.released.empty());
+
+    timeline.CompleteAll();
+    EXPECT_EQ(queue.Poll(), 1u);
+    ASSERT_EQ(releaser.released.size(), 1u);
+    EXPECT_EQ(releaser.released[0], Resource(1));
+    EXPECT_EQ(releaser.kinds[0], 7u);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+}
+
+TEST(DeferredReleaseQueueTests, ReleasesInRetirementOrderUpToTheCompletedValue)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    queue.Retire(Resource(1), 0);
+    queue.Retire(Resource(2), 0);
+    queue.Retire(Resource(3), 0);
+
+    timeline.completed = 2;
+    EXPECT_EQ(queue.Poll(), 2u);
+    EXPECT_EQ(releaser.released, (std::vector<void*>{ Resource(1), Resource(2) }));
+    EXPECT_EQ(queue.GetPendingCount(), 1u);
+
+    timeline.completed = 3;
+    EXPECT_EQ(queue.Poll(), 1u);
+    EXPECT_EQ(releaser.released.back(), Resource(3));
+}
+
+TEST(DeferredReleaseQueueTests, EmptyPollDoesNotReadTheFence)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_EQ(queue.Poll(), 0u);
+    }
+    EXPECT_EQ(timeline.reads, 0);
+    EXPECT_EQ(queue.GetStats().polls, 0u);
+}
+
+TEST(DeferredReleaseQueueTests, ReleaseAllIgnoresTheFence)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    queue.Retire(Resource(1), 0);
+    queue.Retire(Resource(2), 0);
+    queue.ReleaseAll();
+
+    EXPECT_EQ(releaser.released.size(), 2u);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+    EXPECT_EQ(timeline.reads, 0);
+}
+
+TEST(DeferredReleaseQueueTests, WaitForAllWaitsForTheNewestEntry)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    // Empty: nothing to wait for
+    queue.WaitForAll();
+    EXPECT_EQ(timeline.completed, 0u);
+
+    queue.Retire(Resource(1), 0);
+    timeline.Signal();              // Other work on the timeline
+    queue.Retire(Resource(2), 0);
+    queue.WaitForAll();
+
+    EXPECT_EQ(timeline.completed, 3u);
+    EXPECT_TRUE(releaser.released.empty());
+    EXPECT_EQ(queue.Poll(), 2u);
+}
+
+TEST(DeferredReleaseQueueTests, ReleasesRightAwayWithoutAFence)
+{
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(nullptr, &releaser);
+
+    queue.Retire(Resource(1), 0);
+    EXPECT_EQ(releaser.released.size(), 1u);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+}
+
+TEST(DeferredReleaseQueueTests, ReleasesRightAwayWhenSignalFails)
+{
+    class DeadFence : public IGpuFence
+    {
+    public:
+        uint64_t Signal() override { return 0; }
+        uint64_t GetCompletedValue() override { return 0; }
+        void Wait(uint64_t /*value*/) override {}
+    } fence;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&fence, &releaser);
+
+    queue.Retire(Resource(1), 0);
+    EXPECT_EQ(releaser.released.size(), 1u);
+    EXPECT_EQ(queue.GetStats().released, 1u);
+}
+
+TEST(DeferredReleaseQueueTests, RemovedDeviceReleasesEverything)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    queue.Retire(Resource(1), 0);
+    queue.Retire(Resource(2), 0);
+
+    // D3D12 reports UINT64_MAX once the device is removed
+    timeline.completed = UINT64_MAX;
+    EXPECT_EQ(queue.Poll(), 2u);
+}
+
+TEST(DeferredReleaseQueueTests, IgnoresNullResources)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    queue.Retire(nullptr, 0);
+    EXPECT_EQ(queue.GetPendingCount(), 0u);
+    EXPECT_EQ(timeline.submitted, 0u);
+    EXPECT_EQ(queue.GetStats().retired, 0u);
+}
+
+TEST(DeferredReleaseQueueTests, ChurnReleasesEverythingExactlyOnceAfterItsFence)
+{
+    FakeTimeline timeline;
+    RecordingReleaser releaser;
+    DeferredReleaseQueue queue(&timeline, &releaser);
+    std::mt19937 rng(16);
+
+    std::vector<uint64_t> retiredAt(1);
+    uintptr_t next = 1;
+    for (int frame = 0; frame < 2000; frame++)
+    {
+        const int retires = static_cast<int>(rng() % 4);
+        for (int i = 0; i < retires; i++)
+        {
+            retiredAt.push_back(timeline.submitted + 1);
+            queue.Retire(Resource(next++), 0);
+        }
+
+        // The GPU runs up to three signals behind
+        if (timeline.submitted > timeline.completed + 3 || rng() % 2)
+        {
+            timeline.completed = timeline.submitted - std::min<uint64_t>(timeline.submitted, rng() % 3);
+        }
+
+        const size_t before = releaser.released.size();
+        queue.Poll();
+        for (size_t i = before; i < releaser.released.size(); i++)
+        {
+            const auto id = reinterpret_cast<uintptr_t>(releaser.released[i]);
+            ASSERT_LE(retiredAt[id], timeline.completed);
+        }
+        ASSERT_LE(queue.GetPendingCount(), 16u);
+    }
+
+    timeline.CompleteAll();
+    queue.Poll();
+
+    const std::set<void*> unique(releaser.released.begin(), releaser.released.end());
+    EXPECT_EQ(releaser.released.size(), next - 1);
+    EXPECT_EQ(unique.size(), next - 1);
+
+    const auto& stats = queue.GetStats();
+    EXPECT_EQ(stats.retired, stats.released);
+    EXPECT_EQ(stats.pending, 0u);
+    EXPECT_GT(stats.maxPending, 0u);
+}
@@ -0,0 +1,209 @@
+// ============================================================================
+// WebViewToolkit - DirtyRegion Tests
+// ============================================================================
+
+#include "Core/DirtyRegion.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    bool Covers(const std::vector<PixelRect>& boxes, int32_t x, int32_t y)
+    {
+        for (const PixelRect& box : boxes)
+        {
+            if (x >= box.left && x < box.right && y >= box.top && y < box.bottom)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool operator==(const PixelRect& a, const PixelRect& b)
+    {
+        return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+    }
+}
+
+TEST(DirtyRegionTests, NoDirtyRectsProducesNoBoxes)
+{
+    DirtyRegionCoalescer coalescer;
+    EXPECT_TRUE(coalescer.Coalesce(nullptr, 0, 800, 600).empty());
+
+    PixelRect outside{ 900, 700, 950, 750 };
+    EXPECT_TRUE(coalescer.Coalesce(&outside, 1, 800, 600).empty());
+    EXPECT_FALSE(coalescer.IsFullFrame());
+}
+
+TEST(DirtyRegionTests, SingleRectPassesThroughClipped)
+{
+    DirtyRegionCoalescer coalescer;
+    PixelRect caret{ -4, 10, 6, 30 };
+
+    const auto& boxes = coalescer.Coalesce(&caret, 1, 800, 600);
+
+    ASSERT_EQ(boxes.size(), 1u);
+    EXPECT_TRUE(boxes[0] == (PixelRect{ 0, 10, 6, 30 }));
+    EXPECT_EQ(coalescer.GetCoveredArea(), 6 * 20);
+}
+
+TEST(DirtyRegionTests, TouchingRectsMergeForFree)
+{
+    DirtyRegionCoalescer coalescer;
+    PixelRect rects[] = { { 0, 0, 50, 10 }, { 0, 10, 50, 20 }, { 0, 20, 50, 30 } };
+
+    const auto& boxes = coalescer.Coalesce(rects, 3, 1000, 1000);
+
+    ASSERT_EQ(boxes.size(), 1u);
+    EXPECT_TRUE(boxes[0] == (PixelRect{ 0, 0, 50, 30 }));
+}
+
+TEST(DirtyRegionTests, DistantRectsStaySeparateWithinBudget)
+{
+    DirtyRegionCoalescer coalescer;
+    PixelRect rects[] = { { 0, 0, 10, 10 }, { 900, 900, 910, 910 } };
+
+    const auto& boxes = coalescer.Coalesce(rects, 2, 1000, 1000);
+
+    EXPECT_EQ(boxes.size(), 2u);
+    EXPECT_EQ(coalescer.GetCoveredArea(), 200);
+}
+
+TEST(DirtyRegionTests, BoxCountIsBoundedAndEveryDirtyPixelIsCovered)
+{
+    DirtyRegionSettings settings;
+    settings.maxBoxes = 3;
+    settings.fullFrameFraction = 2.0f;  // Never collapse, we want to inspect the boxes
+    DirtyRegionCoalescer coalescer(settings);
+
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> pos(0, 250);
+    std::uniform_int_distribution<int32_t> extent(1, 12);
+
+    for (int trial = 0; trial < 50; trial++)
+    {
+        std::vector<PixelRect> rects;
+        for (int i = 0; i < 20; i++)
+        {
+            const int32_t x = pos(rng), y = pos(rng);
+            rects.push_back(PixelRect{ x, y, x + extent(rng), y + extent(rng) });
+        }
+
+        const auto& boxes = coalescer.Coalesce(rects.data(), rects.size(), 256, 256);
+        ASSERT_LE(boxes.size(), 3u);
+
+        for (const PixelRect& rect : rects)
+        {
+            for (int32_t y = rect.top; y < std::min(rect.bottom, 256); y++)
+            {
+                for (int32_t x = rect.left; x < std::min(rect.right, 256); x++)
+                {
+                    ASSERT_TRUE(Covers(boxes, x, y)) << "trial " << trial << " pixel " << x << "," << y;
+                }
+            }
+        }
+    }
+}
+
+TEST(DirtyRegionTests, MostlyDirtySurfaceBecomesFullFrame)
+{
+    DirtyRegionCoalescer coalescer;
+    PixelRect rects[] = { { 0, 0, 100, 70 } };
+
+    const auto& boxes = coalescer.Coalesce(rects, 1, 100, 100);
+
+    ASSERT_EQ(boxes.size(), 1u);
+    EXPECT_TRUE(coalescer.IsFullFrame());
+    EXPECT_TRUE(boxes[0] == (PixelRect{ 0, 0, 100, 100 }));
+}
+
+TEST(DirtyRegionTests, TooManyInputsCollapseToBoundingBox)
+{
+    DirtyRegionSettings settings;
+    settings.maxInputRects = 4;
+    settings.fullFrameFraction = 2.0f;
+    DirtyRegionCoalescer coalescer(settings);
+
+    std::vector<PixelRect> rects;
+    for (int32_t i = 0; i < 10; i++)
+    {
+        rects.push_back(PixelRect{ i * 20, i * 10, i * 20 + 5, i * 10 + 5 });
+    }
+
+    const auto& boxes = coalescer.Coalesce(rects.data(), rects.size(), 1000, 1000);
+
+    ASSERT_EQ(boxes.size(), 1u);
+    EXPECT_TRUE(boxes[0] == (PixelRect{ 0, 0, 185, 95 }));
+}
+
+TEST(DirtyRegionTests, FlipMirrorsVertically)
+{
+    PixelRect flipped = RectFlipY(PixelRect{ 5, 10, 15, 30 }, 100);
+    EXPECT_TRUE(flipped == (PixelRect{ 5, 70, 15, 90 }));
+}
+
+TEST(DirtyRegionTests, HistoryCollectsEveryFrameSincePresented)
+{
+    DirtyRegionHistory history;
+    PixelRect a{ 0, 0, 1, 1 }, b{ 1, 1, 2, 2 }, c{ 2, 2, 3, 3 };
+    history.Record(1, &a, 1);
+    history.Record(2, &b, 1);
+    history.Record(3, &c, 1);
+
+    std::vector<PixelRect> rects;
+    ASSERT_TRUE(history.Collect(1, 3, rects));
+    ASSERT_EQ(rects.size(), 2u);
+    EXPECT_TRUE(rects[0] == b);
+    EXPECT_TRUE(rects[1] == c);
+}
+
+TEST(DirtyRegionTests, HistoryRequiresFullUpdateWhenUnknown)
+{
+    DirtyRegionHistory history;
+    PixelRect a{ 0, 0, 1, 1 };
+    history.Record(1, &a, 1);
+    history.Record(2, nullptr, 0);     // Frame without dirty info
+    history.Record(3, &a, 1);
+
+    std::vector<PixelRect> rects;
+    EXPECT_FALSE(history.Collect(0, 1, rects));     // Nothing presented yet
+    EXPECT_FALSE(history.Collect(1, 3, rects));     // Range includes an unknown frame
+    EXPECT_TRUE(history.Collect(2, 3, rects));
+    EXPECT_FALSE(history.Collect(3, 3, rects));     // Empty range is not a valid request
+}
+
+TEST(DirtyRegionTests, HistoryForgetsOldAndDiscardedFrames)
+{
+    DirtyRegionHistory history;
+    PixelRect a{ 0, 0, 1, 1 };
+    for (uint64_t serial = 1; serial <= DirtyRegionHistory::MaxFrames + 2; serial++)
+    {
+        history.Record(serial, &a, 1);
+    }
+
+    std::vector<PixelRect> rects;
+    EXPECT_FALSE(history.Collect(1, 3, rects));     // Overwritten by newer frames
+    EXPECT_TRUE(history.Collect(5, 6, rects));
+
+    history.DiscardThrough(6);
+    EXPECT_FALSE(history.Collect(5, 6, rects));
+    EXPECT_TRUE(history.Collect(6, 7, rects));
+}
+
+TEST(DirtyRegionTests, EmptyFrameIsKnownAndClean)
+{
+    DirtyRegionHistory history;
+    history.Record(1, nullptr, 0);
+    PixelRect none[1] = {};
+    history.Record(2, none, 0);
+
+    std::vector<PixelRect> rects;
+    ASSERT_TRUE(history.Collect(1, 2, rects));
+    EXPECT_TRUE(rects.empty());
+}
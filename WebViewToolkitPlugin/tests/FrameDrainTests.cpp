@@ -0,0 +1,181 @@
+// ============================================================================
+// WebViewToolkit - Frame Drain Tests
+// ============================================================================
+
+#include "Core/FrameDrain.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // Frame pool stand-in: ids queue up as the capture produces them, 0 means
+    // "no frame" like a null WinRT frame
+    struct FakeFrame
+    {
+        int id = 0;
+        explicit operator bool() const { return id != 0; }
+    };
+
+    class FakeFramePool
+    {
+    public:
+        void Produce(int count)
+        {
+            for (int i = 0; i < count; ++i)
+            {
+                m_queue.push_back(FakeFrame{ ++m_lastId });
+            }
+        }
+
+        FakeFrame TryGetNextFrame()
+        {
+            polls++;
+            if (m_queue.empty())
+            {
+                return FakeFrame{};
+            }
+
+            FakeFrame frame = m_queue.front();
+            m_queue.pop_front();
+            return frame;
+        }
+
+        FakeFrame Drain(FrameDrainMode mode, CaptureFrameCounters& counters)
+        {
+            return DrainFrames(mode,
+                [this]() { return TryGetNextFrame(); },
+                [this](FakeFrame& frame) { discarded.push_back(frame.id); },
+                counters);
+        }
+
+        size_t Queued() const { return m_queue.size(); }
+
+        std::vector<int> discarded;
+        int polls = 0;
+
+    private:
+        std::deque<FakeFrame> m_queue;
+        int m_lastId = 0;
+    };
+}
+
+TEST(FrameDrainTests, EmptyPoolCountsNoNewFrame)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+
+    EXPECT_FALSE(pool.Drain(FrameDrainMode::Latest, counters));
+    EXPECT_FALSE(pool.Drain(FrameDrainMode::Single, counters));
+
+    const CaptureFrameStats stats = counters.Snapshot();
+    EXPECT_EQ(stats.noNewFrame, 2u);
+    EXPECT_EQ(stats.arrived, 0u);
+    EXPECT_EQ(stats.droppedStale, 0u);
+}
+
+TEST(FrameDrainTests, LatestReturnsNewestAndDiscardsOlderInOrder)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+    pool.Produce(3);
+
+    uint32_t arrived = 0;
+    const FakeFrame frame = DrainFrames(FrameDrainMode::Latest,
+        [&pool]() { return pool.TryGetNextFrame(); },
+        [&pool](FakeFrame& stale) { pool.discarded.push_back(stale.id); },
+        counters, &arrived);
+    EXPECT_EQ(frame.id, 3);
+    EXPECT_EQ(arrived, 3u);
+    EXPECT_EQ(pool.discarded, (std::vector<int>{ 1, 2 }));
+    EXPECT_EQ(pool.Queued(), 0u);
+
+    const CaptureFrameStats stats = counters.Snapshot();
+    EXPECT_EQ(stats.arrived, 3u);
+    EXPECT_EQ(stats.droppedStale, 2u);
+    EXPECT_EQ(stats.noNewFrame, 0u);
+}
+
+TEST(FrameDrainTests, SingleTakesOldestAndLeavesTheRestQueued)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+    pool.Produce(2);
+
+    EXPECT_EQ(pool.Drain(FrameDrainMode::Single, counters).id, 1);
+    EXPECT_EQ(pool.Queued(), 1u);
+    EXPECT_EQ(pool.polls, 1);
+    EXPECT_TRUE(pool.discarded.empty());
+
+    // The queued frame is shown one event late
+    EXPECT_EQ(pool.Drain(FrameDrainMode::Single, counters).id, 2);
+    EXPECT_EQ(counters.Snapshot().arrived, 2u);
+    EXPECT_EQ(counters.Snapshot().droppedStale, 0u);
+}
+
+TEST(FrameDrainTests, SingleFrameIsNotDropped)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+    pool.Produce(1);
+
+    EXPECT_EQ(pool.Drain(FrameDrainMode::Latest, counters).id, 1);
+    EXPECT_TRUE(pool.discarded.empty());
+    EXPECT_EQ(pool.polls, 2);
+    EXPECT_EQ(counters.Snapshot().droppedStale, 0u);
+}
+
+TEST(FrameDrainTests, DrainIsBoundedWhenFramesKeepArriving)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+    pool.Produce(static_cast<int>(MaxFramesPerDrain) + 5);
+
+    const FakeFrame frame = pool.Drain(FrameDrainMode::Latest, counters);
+    EXPECT_EQ(frame.id, static_cast<int>(MaxFramesPerDrain));
+    EXPECT_EQ(pool.Queued(), 5u);
+    EXPECT_EQ(counters.Snapshot().arrived, MaxFramesPerDrain);
+    EXPECT_EQ(counters.Snapshot().droppedStale, MaxFramesPerDrain - 1);
+}
+
+TEST(FrameDrainTests, CountersAccumulateAcrossEvents)
+{
+    FakeFramePool pool;
+    CaptureFrameCounters counters;
+
+    // Capture at twice the render rate: every other frame is stale
+    for (int event = 0; event < 10; ++event)
+    {
+        pool.Produce(2);
+        if (pool.Drain(FrameDrainMode::Latest, counters))
+        {
+            counters.RecordPresented();
+        }
+    }
+    pool.Drain(FrameDrainMode::Latest, counters);
+
+    const CaptureFrameStats stats = counters.Snapshot();
+    EXPECT_EQ(stats.arrived, 20u);
+    EXPECT_EQ(stats.presented, 10u);
+    EXPECT_EQ(stats.droppedStale, 10u);
+    EXPECT_EQ(stats.noNewFrame, 1u);
+    EXPECT_EQ(stats.arrived, stats.presented + stats.droppedStale);
+}
+
+TEST(FrameDrainTests, CopyAgesKeepLastMaxAndTotal)
+{
+    CaptureFrameCounters counters;
+    counters.RecordCopyAge(9000);
+    counters.RecordCopyAge(16000);
+    counters.RecordCopyAge(2000);
+
+    const CaptureFrameStats stats = counters.Snapshot();
+    EXPECT_EQ(stats.lastCopyAgeUs, 2000u);
+    EXPECT_EQ(stats.maxCopyAgeUs, 16000u);
+    EXPECT_EQ(stats.totalCopyAgeUs, 27000u);
+    EXPECT_EQ(stats.copyAgeSamples, 3u);
+}
@@ -0,0 +1,205 @@
+// ============================================================================
+// WebViewToolkit - FrameHandoff Tests
+// ============================================================================
+
+#include "Core/FrameHandoff.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    class RecordingReleaser : public IFrameReleaser
+    {
+    public:
+        void ReleaseFrame(void* frame, void* texture) override
+        {
+            released.push_back(frame);
+            textures.push_back(texture);
+        }
+
+        bool WasReleased(void* frame) const
+        {
+            for (void* released : released)
+            {
+                if (released == frame) return true;
+            }
+            return false;
+        }
+
+        std::vector<void*> released;
+        std::vector<void*> textures;
+    };
+
+    void* Frame(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(id);
+    }
+
+    void* Texture(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(0x1000 + id);
+    }
+}
+
+TEST(FrameHandoffTests, NothingToSampleBeforeTheFirstFrame)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser);
+
+    const HandoffTexture texture = handoff.Acquire();
+    EXPECT_EQ(texture.texture, nullptr);
+    EXPECT_EQ(texture.version, 0u);
+    EXPECT_EQ(handoff.GetHeldCount(), 0u);
+}
+
+TEST(FrameHandoffTests, AcquireReturnsTheNewestFrameAndItsVersion)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser);
+
+    EXPECT_EQ(handoff.Publish(Frame(1), Texture(1), 800, 600), 1u);
+    const HandoffTexture texture = handoff.Acquire();
+    EXPECT_EQ(texture.texture, Texture(1));
+    EXPECT_EQ(texture.width, 800u);
+    EXPECT_EQ(texture.height, 600u);
+    EXPECT_EQ(texture.version, 1u);
+
+    // Nothing newer: the same frame again, still held
+    EXPECT_EQ(handoff.Acquire().version, 1u);
+    EXPECT_EQ(handoff.GetAcquired().texture, Texture(1));
+    EXPECT_TRUE(releaser.released.empty());
+}
+
+TEST(FrameHandoffTests, FrameNeverAcquiredIsReleasedWhenSuperseded)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser);
+
+    handoff.Publish(Frame(1), Texture(1), 8, 8);
+    handoff.Publish(Frame(2), Texture(2), 8, 8);
+    ASSERT_EQ(releaser.released.size(), 1u);
+    EXPECT_EQ(releaser.released[0], Frame(1));
+    EXPECT_EQ(releaser.textures[0], Texture(1));
+
+    EXPECT_EQ(handoff.Acquire().version, 2u);
+    EXPECT_EQ(handoff.GetStats().superseded, 1u);
+}
+
+TEST(FrameHandoffTests, AcquiredFrameIsReleasedOnlyAfterTheDelay)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser, 2);
+
+    handoff.Publish(Frame(1), Texture(1), 8, 8);
+    handoff.Acquire();
+    handoff.Collect();
+    handoff.Collect();
+    EXPECT_TRUE(releaser.released.empty());
+
+    // Moving to frame 2 retires frame 1; Unity may still sample it for two events
+    handoff.Publish(Frame(2), Texture(2), 8, 8);
+    handoff.Acquire();
+    EXPECT_EQ(handoff.GetHeldCount(), 2u);
+    EXPECT_TRUE(handoff.HasRetired());
+    handoff.Collect();
+    EXPECT_TRUE(releaser.released.empty());
+    handoff.Collect();
+    EXPECT_EQ(releaser.released, std::vector<void*>{ Frame(1) });
+    EXPECT_EQ(handoff.GetHeldCount(), 1u);
+}
+
+TEST(FrameHandoffTests, ZeroDelayReleasesOnAcquire)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser, 0);
+
+    handoff.Publish(Frame(1), Texture(1), 8, 8);
+    handoff.Acquire();
+    handoff.Publish(Frame(2), Texture(2), 8, 8);
+    handoff.Acquire();
+    EXPECT_EQ(releaser.released, std::vector<void*>{ Frame(1) });
+}
+
+TEST(FrameHandoffTests, RetireAllKeepsTheAcquiredFrameForTheDelay)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser);
+
+    handoff.Publish(Frame(1), Texture(1), 8, 8);
+    handoff.Acquire();
+    handoff.Publish(Frame(2), Texture(2), 8, 8);
+    handoff.RetireAll();
+
+    EXPECT_EQ(releaser.released, std::vector<void*>{ Frame(2) });
+    handoff.Collect();
+    EXPECT_TRUE(releaser.WasReleased(Frame(1)));
+    EXPECT_EQ(handoff.GetHeldCount(), 0u);
+
+    // The consumer still reads the last version rather than a released texture
+    EXPECT_EQ(handoff.Acquire().texture, nullptr);
+}
+
+TEST(FrameHandoffTests, ReleaseAllAndDestructionReleaseEverything)
+{
+    RecordingReleaser releaser;
+    {
+        FrameHandoff handoff(&releaser);
+        handoff.Publish(Frame(1), Texture(1), 8, 8);
+        handoff.Acquire();
+        handoff.Publish(Frame(2), Texture(2), 8, 8);
+        handoff.Acquire();
+        handoff.Publish(Frame(3), Texture(3), 8, 8);
+        EXPECT_EQ(handoff.GetHeldCount(), 3u);
+    }
+    EXPECT_EQ(releaser.released.size(), 3u);
+}
+
+TEST(FrameHandoffTests, SteadyStateHoldsThreeFramesAndNeverReleasesOneInUse)
+{
+    RecordingReleaser releaser;
+    FrameHandoff handoff(&releaser);
+    std::mt19937 rng(18);
+
+    // Render thread: Collect, then maybe a new frame. Main thread: maybe an
+    // acquire; the commands it queued before that still sample the previous
+    // frame until the next event has run.
+    uintptr_t next = 1;
+    void* sampled = nullptr;
+    for (int event = 0; event < 5000; event++)
+    {
+        handoff.Collect();
+        ASSERT_FALSE(sampled && releaser.WasReleased(sampled));
+        ASSERT_LE(handoff.GetHeldCount(), 2u);
+
+        if (rng() % 3 != 0)
+        {
+            const uintptr_t id = next++;
+            handoff.Publish(Frame(id), Texture(id), 8, 8);
+        }
+        ASSERT_LE(handoff.GetHeldCount(), 3u);
+
+        if (rng() % 4 != 0)
+        {
+            void* previous = sampled;
+            const HandoffTexture texture = handoff.Acquire();
+            sampled = texture.texture ? Frame(reinterpret_cast<uintptr_t>(texture.texture) - 0x1000) : nullptr;
+            ASSERT_FALSE(previous && releaser.WasReleased(previous));
+        }
+    }
+
+    handoff.ReleaseAll();
+    const std::set<void*> unique(releaser.released.begin(), releaser.released.end());
+    EXPECT_EQ(releaser.released.size(), next - 1);
+    EXPECT_EQ(unique.size(), next - 1);
+
+    const auto& stats = handoff.GetStats();
+    EXPECT_EQ(stats.published, next - 1);
+    EXPECT_EQ(stats.released, stats.published);
+    EXPECT_GT(stats.superseded, 0u);
+}
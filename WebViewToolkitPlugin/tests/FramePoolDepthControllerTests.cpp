@@ -0,0 +1,180 @@
+// ============================================================================
+// WebViewToolkit - FramePoolDepthController Tests
+// ============================================================================
+
+#include "Core/FramePoolDepthController.h"
+
+#include <gtest/gtest.h>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    FramePoolDepthSettings SmallWindows()
+    {
+        FramePoolDepthSettings settings;
+        settings.windowEvents = 10;
+        settings.calmWindowsToLower = 2;
+        return settings;
+    }
+
+    // Feed whole windows of identical events, returns how often the depth changed
+    int RunWindows(FramePoolDepthController& controller, int windows, uint32_t taken, uint32_t discarded)
+    {
+        int changes = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(windows) * controller.GetSettings().windowEvents; ++i)
+        {
+            changes += controller.OnRenderEvent(taken, discarded) ? 1 : 0;
+        }
+        return changes;
+    }
+
+    // Render hitches on intermittent content: every hitchInterval-th event
+    // drains a full pool (Latest mode keeps the newest), the others find none
+    int RunHitches(FramePoolDepthController& controller, int windows, uint32_t hitchInterval)
+    {
+        int changes = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(windows) * controller.GetSettings().windowEvents; ++i)
+        {
+            const uint32_t depth = controller.GetDepth();
+            const bool hitch = i % hitchInterval == 0;
+            changes += controller.OnRenderEvent(hitch ? depth : 0, hitch ? depth - 1 : 0) ? 1 : 0;
+        }
+        return changes;
+    }
+}
+
+TEST(FramePoolDepthControllerTests, InitialDepthIsClamped)
+{
+    EXPECT_EQ(FramePoolDepthController(0).GetDepth(), MinFramePoolDepth);
+    EXPECT_EQ(FramePoolDepthController(9).GetDepth(), MaxFramePoolDepth);
+    EXPECT_EQ(FramePoolDepthController().GetDepth(), DefaultFramePoolDepth);
+}
+
+TEST(FramePoolDepthControllerTests, DecidesOnlyAtWindowEnd)
+{
+    FramePoolDepthController controller(1, SmallWindows());
+
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_FALSE(controller.OnRenderEvent(i % 2, 0));
+    }
+    EXPECT_TRUE(controller.OnRenderEvent(0, 0));
+    EXPECT_EQ(controller.GetDepth(), 2u);
+    EXPECT_EQ(controller.GetStats().windows, 1u);
+}
+
+TEST(FramePoolDepthControllerTests, HitchesRaiseUpToMax)
+{
+    FramePoolDepthController controller(1, SmallWindows());
+
+    EXPECT_EQ(RunHitches(controller, 5, 5), 2);
+    EXPECT_EQ(controller.GetDepth(), MaxFramePoolDepth);
+    EXPECT_EQ(controller.GetStats().raised, 2u);
+}
+
+TEST(FramePoolDepthControllerTests, RareHitchesBelowThresholdHold)
+{
+    FramePoolDepthSettings settings = SmallWindows();
+    settings.raiseDropRate = 0.25f;
+    FramePoolDepthController controller(2, settings);
+
+    // One hitch per window: 10% of events find the pool full
+    EXPECT_EQ(RunHitches(controller, 3, 10), 0);
+    EXPECT_EQ(controller.GetDepth(), 2u);
+}
+
+TEST(FramePoolDepthControllerTests, SteadyFullPoolDoesNotRaise)
+{
+    FramePoolDepthController controller(1, SmallWindows());
+
+    // A frame on every event fills a single buffer every time: capture keeps
+    // pace with rendering, more buffers would not present anything newer
+    EXPECT_EQ(RunWindows(controller, 4, 1, 0), 0);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+}
+
+TEST(FramePoolDepthControllerTests, MostlyStaleFramesLowerDepth)
+{
+    FramePoolDepthController controller(3, SmallWindows());
+
+    // Capture at three times the render rate: two stale frames per event
+    EXPECT_EQ(RunWindows(controller, 1, 3, 2), 1);
+    EXPECT_EQ(controller.GetDepth(), 2u);
+
+    // Still one stale frame per event: lower again rather than raise
+    EXPECT_EQ(RunWindows(controller, 1, 2, 1), 1);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+
+    // A single buffer can no longer hold stale frames, and the steady full
+    // pool is not mistaken for hitches
+    EXPECT_EQ(RunWindows(controller, 3, 1, 0), 0);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+}
+
+TEST(FramePoolDepthControllerTests, CalmWindowsLowerDepth)
+{
+    FramePoolDepthController controller(3, SmallWindows());
+
+    // One frame per event never fills a 3-buffer pool
+    EXPECT_EQ(RunWindows(controller, 1, 1, 0), 0);
+    EXPECT_EQ(RunWindows(controller, 1, 1, 0), 1);
+    EXPECT_EQ(controller.GetDepth(), 2u);
+
+    EXPECT_EQ(RunWindows(controller, 2, 0, 0), 1);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+
+    // Never below the minimum
+    EXPECT_EQ(RunWindows(controller, 8, 0, 0), 0);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+}
+
+TEST(FramePoolDepthControllerTests, RaisesBackOffLowering)
+{
+    FramePoolDepthController controller(1, SmallWindows());
+
+    EXPECT_EQ(RunHitches(controller, 1, 2), 1);
+    EXPECT_EQ(controller.GetDepth(), 2u);
+
+    // The raise doubled the calm requirement from 2 to 4 windows
+    EXPECT_EQ(RunWindows(controller, 3, 0, 0), 0);
+    EXPECT_EQ(RunWindows(controller, 1, 0, 0), 1);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+
+    // And again: 8 windows
+    EXPECT_EQ(RunHitches(controller, 1, 2), 1);
+    EXPECT_EQ(RunWindows(controller, 7, 0, 0), 0);
+    EXPECT_EQ(controller.GetDepth(), 2u);
+    EXPECT_EQ(RunWindows(controller, 1, 0, 0), 1);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+}
+
+TEST(FramePoolDepthControllerTests, FixedRangeNeverChanges)
+{
+    FramePoolDepthSettings settings = SmallWindows();
+    settings.minDepth = 1;
+    settings.maxDepth = 1;
+    FramePoolDepthController controller(3, settings);
+
+    EXPECT_EQ(controller.GetDepth(), 1u);
+    EXPECT_EQ(RunHitches(controller, 4, 2), 0);
+    EXPECT_EQ(RunWindows(controller, 4, 4, 3), 0);
+    EXPECT_EQ(controller.GetDepth(), 1u);
+}
+
+TEST(FramePoolDepthControllerTests, RestartWindowDropsPartialCounts)
+{
+    FramePoolDepthController controller(1, SmallWindows());
+
+    for (int i = 0; i < 9; ++i)
+    {
+        controller.OnRenderEvent(i % 2, 0);
+    }
+    controller.RestartWindow();
+
+    for (int i = 0; i < 9; ++i)
+    {
+        EXPECT_FALSE(controller.OnRenderEvent(0, 0));
+    }
+    EXPECT_EQ(controller.GetStats().windows, 0u);
+}
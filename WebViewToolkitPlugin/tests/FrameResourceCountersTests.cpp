@@ -0,0 +1,75 @@
+// ============================================================================
+// WebViewToolkit - FrameResourceCounters Tests
+// ============================================================================
+
+#include "Core/FrameResourceCounters.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace WebViewToolkit;
+
+TEST(FrameResourceCountersTests, MonitorReportsTheCountsOfEachFrame)
+{
+    FrameResourceMonitor monitor;
+
+    monitor.BeginFrame();
+    FrameResourceCounters::CountQueryInterface();
+    FrameResourceCounters::CountQueryInterface();
+    FrameResourceCounters::CountObjectCreation();
+    monitor.EndFrame();
+
+    FrameResourceStats stats = monitor.GetStats();
+    EXPECT_EQ(stats.frames, 1u);
+    EXPECT_EQ(stats.framesOverBudget, 1u);
+    EXPECT_EQ(stats.lastQueryInterfaces, 2u);
+    EXPECT_EQ(stats.lastObjectCreations, 1u);
+
+    monitor.BeginFrame();
+    FrameResourceCounters::CountQueryInterface();
+    monitor.EndFrame();
+
+    stats = monitor.GetStats();
+    EXPECT_EQ(stats.frames, 2u);
+    EXPECT_EQ(stats.framesOverBudget, 2u);
+    EXPECT_EQ(stats.lastQueryInterfaces, 1u);
+    EXPECT_EQ(stats.lastObjectCreations, 0u);
+    EXPECT_EQ(stats.totalQueryInterfaces, 3u);
+    EXPECT_EQ(stats.totalObjectCreations, 1u);
+}
+
+TEST(FrameResourceCountersTests, EmptyFrameIsWithinBudget)
+{
+    FrameResourceMonitor monitor;
+    monitor.BeginFrame();
+    monitor.EndFrame();
+
+    const FrameResourceStats stats = monitor.GetStats();
+    EXPECT_EQ(stats.frames, 1u);
+    EXPECT_EQ(stats.framesOverBudget, 0u);
+    EXPECT_EQ(stats.lastAllocations + stats.lastQueryInterfaces + stats.lastObjectCreations, 0u);
+}
+
+TEST(FrameResourceCountersTests, OtherThreadsDoNotCount)
+{
+    // Started outside the frame: creating a thread allocates on this one
+    std::atomic<bool> go{ false };
+    std::thread other([&go]()
+    {
+        while (!go.load())
+        {
+            std::this_thread::yield();
+        }
+        FrameResourceCounters::CountQueryInterface();
+        FrameResourceCounters::CountObjectCreation();
+    });
+
+    FrameResourceMonitor monitor;
+    monitor.BeginFrame();
+    go.store(true);
+    other.join();
+    monitor.EndFrame();
+    EXPECT_EQ(monitor.GetStats().framesOverBudget, 0u);
+}
@@ -0,0 +1,227 @@
+// ============================================================================
+// WebViewToolkit - FrameTimeline Tests
+// ============================================================================
+
+#include "Core/DeferredReleaseQueue.h"
+#include "Core/FrameTimeline.h"
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // GPU queue the test advances by hand
+    class FakeFence : public IGpuFence
+    {
+    public:
+        uint64_t Signal() override { return ++submitted; }
+        uint64_t GetCompletedValue() override { reads++; return completed; }
+        void Wait(uint64_t value) override { waits++; completed = value; }
+
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        int reads = 0;
+        int waits = 0;
+    };
+
+    void* Resource(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(id);
+    }
+}
+
+TEST(FrameTimelineTests, SignalWithoutRecordedWorkIsSkipped)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    EXPECT_EQ(timeline.Signal(), 0u);
+    timeline.MarkWritten(Resource(1));
+    EXPECT_EQ(timeline.Signal(), 1u);
+    EXPECT_EQ(timeline.Signal(), 1u);
+    EXPECT_EQ(timeline.Signal(), 1u);
+
+    EXPECT_EQ(fence.submitted, 1u);
+    EXPECT_EQ(timeline.GetStats().signals, 1u);
+    EXPECT_EQ(timeline.GetStats().signalsSkipped, 3u);
+}
+
+TEST(FrameTimelineTests, TracksTheLastWriteOfEachResource)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.MarkWritten(Resource(1));
+    timeline.MarkWritten(Resource(2));
+    timeline.Signal();
+    timeline.MarkWritten(Resource(2));
+    timeline.Signal();
+
+    EXPECT_EQ(timeline.GetLastWritten(Resource(1)), 1u);
+    EXPECT_EQ(timeline.GetLastWritten(Resource(2)), 2u);
+    EXPECT_EQ(timeline.GetLastWritten(Resource(3)), 0u);
+}
+
+TEST(FrameTimelineTests, QueryingAnUnsignaledWriteSignalsIt)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.MarkWritten(Resource(1));
+    timeline.MarkWritten(Resource(1));
+    EXPECT_EQ(fence.submitted, 0u);
+
+    EXPECT_EQ(timeline.GetLastWritten(Resource(1)), 1u);
+    EXPECT_EQ(fence.submitted, 1u);
+}
+
+TEST(FrameTimelineTests, WaitBlocksOnlyForWritesInFlight)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.MarkWritten(Resource(1));
+    timeline.Signal();
+    timeline.MarkWritten(Resource(2));
+    timeline.Signal();
+
+    fence.completed = 1;
+    timeline.WaitForWrites(Resource(1));
+    EXPECT_EQ(fence.waits, 0);
+
+    timeline.WaitForWrites(Resource(2));
+    EXPECT_EQ(fence.waits, 1);
+
+    timeline.WaitForWrites(Resource(2));
+    timeline.WaitForWrites(Resource(3));
+    EXPECT_EQ(fence.waits, 1);
+    EXPECT_EQ(timeline.GetStats().waits, 1u);
+    EXPECT_EQ(timeline.GetStats().waitsSkipped, 3u);
+}
+
+TEST(FrameTimelineTests, CompletedValueIsCached)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.MarkWritten(Resource(1));
+    timeline.Signal();
+    fence.completed = 1;
+
+    EXPECT_TRUE(timeline.IsComplete(1));
+    const int reads = fence.reads;
+    for (int i = 0; i < 10; i++)
+    {
+        EXPECT_TRUE(timeline.IsComplete(1));
+        EXPECT_TRUE(timeline.IsComplete(0));
+    }
+    EXPECT_EQ(fence.reads, reads);
+}
+
+TEST(FrameTimelineTests, WaitForIdleSignalsPendingWork)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.WaitForIdle();
+    EXPECT_EQ(fence.waits, 0);
+
+    timeline.MarkWritten(nullptr);
+    timeline.WaitForIdle();
+    EXPECT_EQ(fence.submitted, 1u);
+    EXPECT_EQ(fence.waits, 1);
+    EXPECT_TRUE(timeline.IsComplete(timeline.GetLastSignaled()));
+}
+
+TEST(FrameTimelineTests, ForgottenResourcesAreNotSignaledForOrTracked)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+
+    timeline.MarkWritten(Resource(1));
+    timeline.MarkWritten(Resource(2));
+    timeline.Forget(Resource(1));
+    timeline.Signal();
+
+    EXPECT_EQ(timeline.GetLastWritten(Resource(1)), 0u);
+    EXPECT_EQ(timeline.GetLastWritten(Resource(2)), 1u);
+    timeline.Forget(Resource(2));
+    timeline.Forget(Resource(3));
+    EXPECT_EQ(timeline.GetLastWritten(Resource(2)), 0u);
+}
+
+TEST(FrameTimelineTests, WithoutAFenceNothingBlocks)
+{
+    FrameTimeline timeline(nullptr);
+
+    timeline.MarkWritten(Resource(1));
+    EXPECT_EQ(timeline.Signal(), 0u);
+    EXPECT_EQ(timeline.GetLastWritten(Resource(1)), 0u);
+    EXPECT_TRUE(timeline.IsComplete(5));
+    timeline.WaitForWrites(Resource(1));
+    EXPECT_EQ(timeline.GetStats().waits, 0u);
+}
+
+TEST(FrameTimelineTests, DeferredReleasesShareOneSignalPerBatch)
+{
+    class CountingReleaser : public IDeferredReleaser
+    {
+    public:
+        void ReleaseNow(void* /*resource*/, uint32_t /*kind*/) override { released++; }
+        int released = 0;
+    } releaser;
+
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+    DeferredReleaseQueue queue(&timeline, &releaser);
+
+    // A batch writes the resources, then three are dropped together
+    timeline.MarkWritten(Resource(1));
+    timeline.Signal();
+    queue.Retire(Resource(1), 0);
+    queue.Retire(Resource(2), 0);
+    queue.Retire(Resource(3), 0);
+    EXPECT_EQ(fence.submitted, 1u);
+
+    EXPECT_EQ(queue.Poll(), 0u);
+    fence.completed = 1;
+    EXPECT_EQ(queue.Poll(), 3u);
+    EXPECT_EQ(releaser.released, 3);
+}
+
+TEST(FrameTimelineTests, RandomFramesNeverReportIncompleteWritesAsDone)
+{
+    FakeFence fence;
+    FrameTimeline timeline(&fence);
+    std::mt19937 rng(17);
+
+    // Reference: the submitted value that covers each resource's last write
+    std::vector<uint64_t> lastWrite(8, 0);
+    for (int frame = 0; frame < 3000; frame++)
+    {
+        const uint32_t writes = rng() % 3;
+        for (uint32_t i = 0; i < writes; i++)
+        {
+            const uint32_t id = rng() % 8;
+            timeline.MarkWritten(Resource(id + 1));
+            lastWrite[id] = fence.submitted + 1;
+        }
+        if (rng() % 4 != 0)
+        {
+            timeline.Signal();
+        }
+        if (rng() % 3 == 0 && fence.completed < fence.submitted)
+        {
+            fence.completed += 1 + rng() % (fence.submitted - fence.completed);
+        }
+
+        const uint32_t id = rng() % 8;
+        const uint64_t value = timeline.GetLastWritten(Resource(id + 1));
+        ASSERT_EQ(value, lastWrite[id]);
+        ASSERT_EQ(timeline.IsComplete(value), lastWrite[id] <= fence.completed);
+    }
+}
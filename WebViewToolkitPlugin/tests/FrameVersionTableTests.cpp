@@ -0,0 +1,166 @@
+// ============================================================================
+// WebViewToolkit - FrameVersionTable Tests
+// ============================================================================
+
+#include "Core/FrameVersionTable.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+TEST(FrameVersionTableTests, RegisteredViewStartsAtZero)
+{
+    FrameVersionTable table;
+    ASSERT_TRUE(table.Register(7));
+
+    FrameVersion version{};
+    ASSERT_TRUE(table.Read(7, version));
+    EXPECT_EQ(version.handle, 7u);
+    EXPECT_EQ(version.sequence, 0u);
+    EXPECT_EQ(version.timestampMs, 0u);
+}
+
+TEST(FrameVersionTableTests, PublishBumpsTheSequenceAndTimestamp)
+{
+    FrameVersionTable table;
+    table.Register(1);
+    table.Register(2);
+
+    table.Publish(1, 100);
+    table.Publish(1, 116);
+    table.Publish(2, 120);
+
+    FrameVersion version{};
+    ASSERT_TRUE(table.Read(1, version));
+    EXPECT_EQ(version.sequence, 2u);
+    EXPECT_EQ(version.timestampMs, 116u);
+
+    ASSERT_TRUE(table.Read(2, version));
+    EXPECT_EQ(version.sequence, 1u);
+    EXPECT_EQ(version.timestampMs, 120u);
+}
+
+TEST(FrameVersionTableTests, UnknownViewsAreNotFound)
+{
+    FrameVersionTable table;
+    FrameVersion version{};
+    EXPECT_FALSE(table.Register(InvalidWebViewHandle));
+    EXPECT_FALSE(table.Read(3, version));
+
+    // Publishing for an unregistered view is ignored
+    table.Publish(3, 100);
+    EXPECT_FALSE(table.Read(3, version));
+}
+
+TEST(FrameVersionTableTests, ReusedSlotStartsOver)
+{
+    FrameVersionTable table;
+    table.Register(1);
+    table.Publish(1, 100);
+    table.Unregister(1);
+
+    FrameVersion version{};
+    EXPECT_FALSE(table.Read(1, version));
+
+    // Same home slot as handle 1
+    const WebViewHandle next = 1 + FrameVersionTable::Capacity;
+    ASSERT_TRUE(table.Register(next));
+    ASSERT_TRUE(table.Read(next, version));
+    EXPECT_EQ(version.sequence, 0u);
+}
+
+TEST(FrameVersionTableTests, CollidingHandlesProbeToTheNextSlot)
+{
+    FrameVersionTable table;
+    const WebViewHandle first = 5;
+    const WebViewHandle second = 5 + FrameVersionTable::Capacity;
+    ASSERT_TRUE(table.Register(first));
+    ASSERT_TRUE(table.Register(second));
+
+    table.Publish(second, 50);
+
+    FrameVersion version{};
+    ASSERT_TRUE(table.Read(first, version));
+    EXPECT_EQ(version.sequence, 0u);
+    ASSERT_TRUE(table.Read(second, version));
+    EXPECT_EQ(version.sequence, 1u);
+
+    // The second stays reachable once the first is gone
+    table.Unregister(first);
+    ASSERT_TRUE(table.Read(second, version));
+    EXPECT_EQ(version.sequence, 1u);
+}
+
+TEST(FrameVersionTableTests, FullTableRejectsMoreViews)
+{
+    auto table = std::make_unique<FrameVersionTable>();
+    for (WebViewHandle handle = 1; handle <= FrameVersionTable::Capacity; handle++)
+    {
+        ASSERT_TRUE(table->Register(handle));
+    }
+    EXPECT_FALSE(table->Register(FrameVersionTable::Capacity + 1));
+
+    table->Unregister(10);
+    EXPECT_TRUE(table->Register(FrameVersionTable::Capacity + 1));
+}
+
+TEST(FrameVersionTableTests, ReadAllReturnsEveryRegisteredView)
+{
+    FrameVersionTable table;
+    table.Register(1);
+    table.Register(2);
+    table.Register(3);
+    table.Unregister(2);
+    table.Publish(3, 42);
+
+    FrameVersion versions[4] = {};
+    ASSERT_EQ(table.ReadAll(versions, 4), 2u);
+    EXPECT_EQ(versions[0].handle, 1u);
+    EXPECT_EQ(versions[0].sequence, 0u);
+    EXPECT_EQ(versions[1].handle, 3u);
+    EXPECT_EQ(versions[1].sequence, 1u);
+    EXPECT_EQ(versions[1].timestampMs, 42u);
+
+    // Capacity limits the entries written
+    EXPECT_EQ(table.ReadAll(versions, 1), 1u);
+}
+
+TEST(FrameVersionTableTests, ReadersSeeMatchingSequenceAndTimestamp)
+{
+    FrameVersionTable table;
+    table.Register(1);
+
+    // The publisher stores timestamp = 10 * sequence; a torn read would break that
+    std::atomic<bool> done{ false };
+    std::thread publisher([&]()
+    {
+        for (uint64_t sequence = 1; sequence <= 200000; sequence++)
+        {
+            table.Publish(1, sequence * 10);
+        }
+        done.store(true);
+    });
+
+    uint64_t last = 0;
+    bool consistent = true;
+    bool monotonic = true;
+    while (!done.load())
+    {
+        FrameVersion version{};
+        if (table.Read(1, version))
+        {
+            consistent &= version.timestampMs == version.sequence * 10;
+            monotonic &= version.sequence >= last;
+            last = version.sequence;
+        }
+    }
+    publisher.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_TRUE(monotonic);
+}
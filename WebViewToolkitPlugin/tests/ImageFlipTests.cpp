@@ -0,0 +1,88 @@
+// ============================================================================
+// WebViewToolkit - ImageFlip Tests
+// ============================================================================
+
+#include "Core/ImageFlip.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // BGRA image whose every byte encodes (row, column, channel)
+    std::vector<uint8_t> MakeImage(uint32_t width, uint32_t height, size_t pitch)
+    {
+        std::vector<uint8_t> image(pitch * height, 0xEE);
+        for (uint32_t y = 0; y < height; y++)
+        {
+            for (uint32_t x = 0; x < width * 4; x++)
+            {
+                image[y * pitch + x] = static_cast<uint8_t>(y * 31 + x);
+            }
+        }
+        return image;
+    }
+}
+
+TEST(ImageFlipTests, FlipRowsReversesRowOrder)
+{
+    const uint32_t width = 5, height = 7;
+    const size_t pitch = width * 4;
+    auto src = MakeImage(width, height, pitch);
+    std::vector<uint8_t> dst(pitch * height);
+
+    FlipRows(src.data(), pitch, dst.data(), pitch, pitch, height);
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        EXPECT_EQ(0, std::memcmp(&dst[y * pitch], &src[(height - 1 - y) * pitch], pitch)) << "row " << y;
+    }
+}
+
+TEST(ImageFlipTests, FlipRowsHonorsPitchesAndLeavesPaddingUntouched)
+{
+    const uint32_t width = 3, height = 4;
+    const size_t rowBytes = width * 4;
+    const size_t srcPitch = 64;     // Mapped staging textures pad rows
+    const size_t dstPitch = 20;
+    auto src = MakeImage(width, height, srcPitch);
+    std::vector<uint8_t> dst(dstPitch * height, 0xAB);
+
+    FlipRows(src.data(), srcPitch, dst.data(), dstPitch, rowBytes, height);
+
+    for (uint32_t y = 0; y < height; y++)
+    {
+        EXPECT_EQ(0, std::memcmp(&dst[y * dstPitch], &src[(height - 1 - y) * srcPitch], rowBytes)) << "row " << y;
+        for (size_t pad = rowBytes; pad < dstPitch; pad++)
+        {
+            EXPECT_EQ(dst[y * dstPitch + pad], 0xAB);
+        }
+    }
+}
+
+TEST(ImageFlipTests, FlipIsAnInvolution)
+{
+    const uint32_t width = 9, height = 6;
+    const size_t pitch = width * 4;
+    auto src = MakeImage(width, height, pitch);
+    std::vector<uint8_t> once(src.size()), twice(src.size());
+
+    FlipRows(src.data(), pitch, once.data(), pitch, pitch, height);
+    FlipRows(once.data(), pitch, twice.data(), pitch, pitch, height);
+
+    EXPECT_EQ(src, twice);
+}
+
+TEST(ImageFlipTests, SingleRowIsCopiedVerbatim)
+{
+    auto src = MakeImage(4, 1, 16);
+    std::vector<uint8_t> dst(16);
+
+    FlipRows(src.data(), 16, dst.data(), 16, 16, 1);
+
+    EXPECT_EQ(src, dst);
+}
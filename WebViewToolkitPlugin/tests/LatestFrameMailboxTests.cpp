@@ -0,0 +1,186 @@
+// ============================================================================
+// WebViewToolkit - LatestFrameMailbox Tests
+// ============================================================================
+
+#include "Core/LatestFrameMailbox.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    class RecordingReleaser : public ILatestFrameReleaser
+    {
+    public:
+        void ReleaseLatestFrame(void* frame) override
+        {
+            released.push_back(frame);
+        }
+
+        std::vector<void*> released;
+    };
+
+    // Thread-safe, for frames released by the producer while the test reads
+    class CountingReleaser : public ILatestFrameReleaser
+    {
+    public:
+        void ReleaseLatestFrame(void* frame) override
+        {
+            (void)frame;
+            released.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        std::atomic<uint64_t> released{ 0 };
+    };
+
+    void* Frame(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(id);
+    }
+}
+
+TEST(LatestFrameMailboxTests, NothingToTakeBeforeThePublish)
+{
+    RecordingReleaser releaser;
+    LatestFrameMailbox mailbox(&releaser);
+
+    LatchedFrame frame;
+    EXPECT_FALSE(mailbox.Take(frame));
+    EXPECT_EQ(frame.frame, nullptr);
+}
+
+TEST(LatestFrameMailboxTests, FrameIsTakenOnce)
+{
+    RecordingReleaser releaser;
+    LatestFrameMailbox mailbox(&releaser);
+
+    EXPECT_FALSE(mailbox.Publish(Frame(1), 100));
+
+    LatchedFrame frame;
+    ASSERT_TRUE(mailbox.Take(frame));
+    EXPECT_EQ(frame.frame, Frame(1));
+    EXPECT_EQ(frame.captureTime, 100u);
+    EXPECT_FALSE(mailbox.Take(frame));
+
+    // Taken frames belong to the consumer
+    EXPECT_TRUE(releaser.released.empty());
+}
+
+TEST(LatestFrameMailboxTests, NewerFrameReleasesTheUntakenOne)
+{
+    RecordingReleaser releaser;
+    LatestFrameMailbox mailbox(&releaser);
+
+    mailbox.Publish(Frame(1), 100);
+    EXPECT_TRUE(mailbox.Publish(Frame(2), 200));
+    EXPECT_TRUE(mailbox.Publish(Frame(3), 300));
+    ASSERT_EQ(releaser.released.size(), 2u);
+    EXPECT_EQ(releaser.released[0], Frame(1));
+    EXPECT_EQ(releaser.released[1], Frame(2));
+
+    LatchedFrame frame;
+    ASSERT_TRUE(mailbox.Take(frame));
+    EXPECT_EQ(frame.frame, Frame(3));
+    EXPECT_EQ(frame.captureTime, 300u);
+
+    // A publish after the take has nothing to supersede
+    EXPECT_FALSE(mailbox.Publish(Frame(4), 400));
+    ASSERT_TRUE(mailbox.Take(frame));
+    EXPECT_EQ(frame.frame, Frame(4));
+
+    const LatestFrameMailboxStats stats = mailbox.GetStats();
+    EXPECT_EQ(stats.published, 4u);
+    EXPECT_EQ(stats.superseded, 2u);
+    EXPECT_EQ(stats.taken, 2u);
+}
+
+TEST(LatestFrameMailboxTests, UntakenFrameIsReleasedAtDestruction)
+{
+    RecordingReleaser releaser;
+    {
+        LatestFrameMailbox mailbox(&releaser);
+        mailbox.Publish(Frame(1), 100);
+
+        LatchedFrame frame;
+        ASSERT_TRUE(mailbox.Take(frame));
+        mailbox.Publish(Frame(2), 200);
+    }
+
+    ASSERT_EQ(releaser.released.size(), 1u);
+    EXPECT_EQ(releaser.released[0], Frame(2));
+}
+
+TEST(LatestFrameMailboxTests, ReleaseAllEmptiesTheMailbox)
+{
+    RecordingReleaser releaser;
+    LatestFrameMailbox mailbox(&releaser);
+    mailbox.Publish(Frame(1), 100);
+    mailbox.ReleaseAll();
+
+    LatchedFrame frame;
+    EXPECT_FALSE(mailbox.Take(frame));
+    EXPECT_EQ(releaser.released.size(), 1u);
+
+    // Still usable
+    mailbox.Publish(Frame(2), 200);
+    ASSERT_TRUE(mailbox.Take(frame));
+    EXPECT_EQ(frame.frame, Frame(2));
+    EXPECT_EQ(releaser.released.size(), 1u);
+}
+
+TEST(LatestFrameMailboxTests, ConcurrentFramesAreTakenInOrderOrReleasedOnce)
+{
+    constexpr uint64_t FrameCount = 200000;
+
+    CountingReleaser releaser;
+    LatestFrameMailbox mailbox(&releaser);
+    std::atomic<bool> done{ false };
+
+    // Capture times follow the frame ids, so both must match on every take
+    std::thread producer([&]()
+    {
+        for (uint64_t id = 1; id <= FrameCount; ++id)
+        {
+            mailbox.Publish(Frame(static_cast<uintptr_t>(id)), id * 10);
+        }
+        done.store(true, std::memory_order_release);
+    });
+
+    uint64_t taken = 0;
+    uint64_t lastId = 0;
+    bool consistent = true;
+    bool ordered = true;
+    for (;;)
+    {
+        const bool finished = done.load(std::memory_order_acquire);
+        LatchedFrame frame;
+        while (mailbox.Take(frame))
+        {
+            const uint64_t id = reinterpret_cast<uintptr_t>(frame.frame);
+            consistent &= frame.captureTime == id * 10;
+            ordered &= id > lastId;
+            lastId = id;
+            taken++;
+        }
+        if (finished)
+        {
+            break;
+        }
+    }
+    producer.join();
+
+    EXPECT_TRUE(consistent);
+    EXPECT_TRUE(ordered);
+    EXPECT_EQ(lastId, FrameCount);
+    EXPECT_EQ(taken + releaser.released.load(), FrameCount);
+
+    const LatestFrameMailboxStats stats = mailbox.GetStats();
+    EXPECT_EQ(stats.published, FrameCount);
+    EXPECT_EQ(stats.taken, taken);
+    EXPECT_EQ(stats.superseded, releaser.released.load());
+}
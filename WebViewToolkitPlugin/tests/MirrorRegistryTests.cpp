@@ -0,0 +1,201 @@
+// ============================================================================
+// WebViewToolkit - MirrorRegistry Tests
+// ============================================================================
+
+#include "Core/MirrorRegistry.h"
+
+#include <gtest/gtest.h>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    void* FakeTexture(uintptr_t value)
+    {
+        return reinterpret_cast<void*>(value);
+    }
+}
+
+TEST(MirrorRegistryTests, ConsumersOfTheSameSizeShareAMirror)
+{
+    MirrorRegistry registry;
+
+    EXPECT_EQ(registry.AddRef(256, 256), InvalidMirrorId);
+    const MirrorId id = registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    ASSERT_NE(id, InvalidMirrorId);
+
+    EXPECT_EQ(registry.AddRef(256, 256), id);
+    EXPECT_EQ(registry.AddRef(512, 256), InvalidMirrorId);
+    EXPECT_EQ(registry.GetCount(), 1u);
+}
+
+TEST(MirrorRegistryTests, TextureIsHandedBackWithTheLastConsumer)
+{
+    MirrorRegistry registry;
+    const MirrorId id = registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    registry.AddRef(256, 256);
+
+    void* texture = FakeTexture(99);
+    EXPECT_TRUE(registry.Release(id, texture));
+    EXPECT_EQ(texture, nullptr);
+    EXPECT_EQ(registry.GetTexture(id), FakeTexture(1));
+
+    EXPECT_TRUE(registry.Release(id, texture));
+    EXPECT_EQ(texture, FakeTexture(1));
+    EXPECT_TRUE(registry.IsEmpty());
+
+    EXPECT_FALSE(registry.Release(id, texture));
+    EXPECT_EQ(registry.GetTexture(id), nullptr);
+}
+
+TEST(MirrorRegistryTests, IdsAreNotReused)
+{
+    MirrorRegistry registry;
+    const MirrorId first = registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    void* texture = nullptr;
+    registry.Release(first, texture);
+
+    const MirrorId second = registry.Add(FakeTexture(2), 256, 256, 256, 256);
+    EXPECT_NE(second, first);
+    EXPECT_FALSE(registry.Release(first, texture));
+}
+
+TEST(MirrorRegistryTests, RejectsInvalidMirrorsAndTooManyMirrors)
+{
+    MirrorRegistry registry;
+    EXPECT_EQ(registry.Add(nullptr, 256, 256, 256, 256), InvalidMirrorId);
+    EXPECT_EQ(registry.Add(FakeTexture(1), 0, 256, 0, 256), InvalidMirrorId);
+    EXPECT_EQ(registry.Add(FakeTexture(1), 256, 256, 128, 256), InvalidMirrorId);
+
+    for (uint32_t i = 0; i < MirrorRegistry::MaxMirrors; i++)
+    {
+        EXPECT_NE(registry.Add(FakeTexture(i + 1), 64 + i, 64, 64 + i, 64), InvalidMirrorId);
+    }
+    EXPECT_EQ(registry.Add(FakeTexture(100), 1024, 1024, 1024, 1024), InvalidMirrorId);
+}
+
+TEST(MirrorRegistryTests, ContentThatFitsIsCopiedOneToOne)
+{
+    MirrorRegistry registry;
+    const MirrorId id = registry.Add(FakeTexture(1), 1024, 1024, 1024, 1024);
+
+    std::vector<MirrorCopy> copies;
+    registry.PlanFanOut(800, 600, false, copies);
+
+    ASSERT_EQ(copies.size(), 1u);
+    EXPECT_EQ(copies[0].id, id);
+    EXPECT_EQ(copies[0].texture, FakeTexture(1));
+    EXPECT_EQ(copies[0].width, 800u);
+    EXPECT_EQ(copies[0].height, 600u);
+    EXPECT_FALSE(copies[0].scaled);
+
+    float uv[4];
+    ASSERT_TRUE(registry.GetUVRect(id, uv));
+    EXPECT_FLOAT_EQ(uv[2], 800.0f / 1024.0f);
+    EXPECT_FLOAT_EQ(uv[3], 600.0f / 1024.0f);
+}
+
+TEST(MirrorRegistryTests, UVRectIsRelativeToALargerTexture)
+{
+    MirrorRegistry registry;
+    const MirrorId id = registry.Add(FakeTexture(1), 200, 100, 256, 128);
+
+    uint32_t textureWidth = 0;
+    uint32_t textureHeight = 0;
+    ASSERT_TRUE(registry.GetTextureSize(id, textureWidth, textureHeight));
+    EXPECT_EQ(textureWidth, 256u);
+    EXPECT_EQ(textureHeight, 128u);
+
+    // Before the first frame: the whole mirror
+    float uv[4];
+    ASSERT_TRUE(registry.GetUVRect(id, uv));
+    EXPECT_FLOAT_EQ(uv[2], 200.0f / 256.0f);
+    EXPECT_FLOAT_EQ(uv[3], 100.0f / 128.0f);
+
+    std::vector<MirrorCopy> copies;
+    registry.PlanFanOut(400, 400, true, copies);
+    ASSERT_EQ(copies.size(), 1u);
+    EXPECT_EQ(copies[0].width, 100u);
+    EXPECT_EQ(copies[0].height, 100u);
+
+    ASSERT_TRUE(registry.GetUVRect(id, uv));
+    EXPECT_FLOAT_EQ(uv[2], 100.0f / 256.0f);
+    EXPECT_FLOAT_EQ(uv[3], 100.0f / 128.0f);
+}
+
+TEST(MirrorRegistryTests, LargerContentIsScaledDownKeepingItsAspectRatio)
+{
+    MirrorRegistry registry;
+    const MirrorId wide = registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    const MirrorId tall = registry.Add(FakeTexture(2), 400, 100, 400, 100);
+
+    std::vector<MirrorCopy> copies;
+    registry.PlanFanOut(1280, 720, true, copies);
+
+    ASSERT_EQ(copies.size(), 2u);
+    EXPECT_EQ(copies[0].id, wide);
+    EXPECT_EQ(copies[0].width, 256u);
+    EXPECT_EQ(copies[0].height, 144u);
+    EXPECT_TRUE(copies[0].scaled);
+
+    EXPECT_EQ(copies[1].id, tall);
+    EXPECT_EQ(copies[1].width, 178u);     // 177.8 rounded
+    EXPECT_EQ(copies[1].height, 100u);
+    EXPECT_TRUE(copies[1].scaled);
+
+    EXPECT_EQ(registry.GetStats().scaledCopies, 2u);
+}
+
+TEST(MirrorRegistryTests, ExtremeAspectRatiosKeepAtLeastOnePixel)
+{
+    MirrorRegistry registry;
+    registry.Add(FakeTexture(1), 16, 16, 16, 16);
+
+    std::vector<MirrorCopy> copies;
+    registry.PlanFanOut(4096, 1, true, copies);
+
+    ASSERT_EQ(copies.size(), 1u);
+    EXPECT_EQ(copies[0].width, 16u);
+    EXPECT_EQ(copies[0].height, 1u);
+}
+
+TEST(MirrorRegistryTests, ContentThatDoesNotFitIsSkippedWithoutScaling)
+{
+    MirrorRegistry registry;
+    registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    const MirrorId large = registry.Add(FakeTexture(2), 2048, 2048, 2048, 2048);
+
+    std::vector<MirrorCopy> copies;
+    registry.PlanFanOut(1280, 720, false, copies);
+
+    ASSERT_EQ(copies.size(), 1u);
+    EXPECT_EQ(copies[0].id, large);
+    EXPECT_EQ(registry.GetStats().skippedCopies, 1u);
+    EXPECT_EQ(registry.GetStats().copies, 1u);
+}
+
+TEST(MirrorRegistryTests, EmptyContentPlansNothing)
+{
+    MirrorRegistry registry;
+    registry.Add(FakeTexture(1), 256, 256, 256, 256);
+
+    std::vector<MirrorCopy> copies{ MirrorCopy{} };
+    registry.PlanFanOut(0, 720, true, copies);
+    EXPECT_TRUE(copies.empty());
+}
+
+TEST(MirrorRegistryTests, ClearHandsOutEveryTexture)
+{
+    MirrorRegistry registry;
+    registry.Add(FakeTexture(1), 256, 256, 256, 256);
+    registry.Add(FakeTexture(2), 512, 512, 512, 512);
+    registry.AddRef(256, 256);
+
+    std::vector<void*> textures;
+    registry.Clear(textures);
+
+    ASSERT_EQ(textures.size(), 2u);
+    EXPECT_EQ(textures[0], FakeTexture(1));
+    EXPECT_EQ(textures[1], FakeTexture(2));
+    EXPECT_TRUE(registry.IsEmpty());
+}
@@ -0,0 +1,158 @@
+// ============================================================================
+// WebViewToolkit - PendingHandleQueue Tests
+// ============================================================================
+
+#include "Core/PendingHandleQueue.h"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+TEST(PendingHandleQueueTests, CapacityRoundsUpToPowerOfTwo)
+{
+    EXPECT_EQ(PendingHandleQueue(0).GetCapacity(), 2u);
+    EXPECT_EQ(PendingHandleQueue(5).GetCapacity(), 8u);
+    EXPECT_EQ(PendingHandleQueue(64).GetCapacity(), 64u);
+}
+
+TEST(PendingHandleQueueTests, PopsInPushOrder)
+{
+    PendingHandleQueue queue(8);
+    uint32_t handle = 0;
+    EXPECT_FALSE(queue.TryPop(handle));
+
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        EXPECT_TRUE(queue.Push(i));
+    }
+    for (uint32_t i = 1; i <= 3; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(handle));
+        EXPECT_EQ(handle, i);
+    }
+    EXPECT_FALSE(queue.TryPop(handle));
+}
+
+TEST(PendingHandleQueueTests, WrapsAroundManyTimes)
+{
+    PendingHandleQueue queue(4);
+    uint32_t handle = 0;
+
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        ASSERT_TRUE(queue.Push(i));
+        ASSERT_TRUE(queue.Push(i + 1000));
+        ASSERT_TRUE(queue.TryPop(handle));
+        EXPECT_EQ(handle, i);
+        ASSERT_TRUE(queue.TryPop(handle));
+        EXPECT_EQ(handle, i + 1000);
+    }
+    EXPECT_FALSE(queue.TakeOverflow());
+}
+
+TEST(PendingHandleQueueTests, FullQueueReportsOverflowOnce)
+{
+    PendingHandleQueue queue(4);
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        EXPECT_TRUE(queue.Push(i));
+    }
+    EXPECT_FALSE(queue.TakeOverflow());
+
+    EXPECT_FALSE(queue.Push(99));
+    EXPECT_TRUE(queue.TakeOverflow());
+    EXPECT_FALSE(queue.TakeOverflow());
+
+    // Room again after a pop
+    uint32_t handle = 0;
+    ASSERT_TRUE(queue.TryPop(handle));
+    EXPECT_EQ(handle, 0u);
+    EXPECT_TRUE(queue.Push(4));
+}
+
+TEST(PendingHandleQueueTests, FlagQueuesEachViewOnceUntilCleared)
+{
+    PendingHandleQueue queue(8);
+    PendingFlag flag;
+
+    // Three frames before the render thread looks: one entry
+    for (int frame = 0; frame < 3; ++frame)
+    {
+        if (flag.Raise())
+        {
+            queue.Push(7);
+        }
+    }
+
+    uint32_t handle = 0;
+    ASSERT_TRUE(queue.TryPop(handle));
+    EXPECT_FALSE(queue.TryPop(handle));
+
+    // A frame arriving after the visit started queues the view again
+    flag.Clear();
+    EXPECT_TRUE(flag.Raise());
+    EXPECT_FALSE(flag.Raise());
+}
+
+TEST(PendingHandleQueueTests, ConcurrentProducersNeverLoseAView)
+{
+    constexpr uint32_t ViewCount = 64;
+    constexpr int ProducerCount = 4;
+    constexpr int FramesPerProducer = 20000;
+
+    PendingHandleQueue queue(ViewCount);
+    std::vector<PendingFlag> flags(ViewCount);
+    std::vector<uint32_t> visits(ViewCount, 0);
+    std::atomic<int> producersLeft{ ProducerCount };
+
+    std::vector<std::thread> producers;
+    for (int p = 0; p < ProducerCount; ++p)
+    {
+        producers.emplace_back([&, p]()
+        {
+            for (int i = 0; i < FramesPerProducer; ++i)
+            {
+                const uint32_t view = static_cast<uint32_t>(i * 7 + p) % ViewCount;
+                if (flags[view].Raise())
+                {
+                    queue.Push(view);
+                }
+            }
+            producersLeft.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    // Render thread: a view is in the queue at most once, so the queue sized
+    // for the view count never overflows
+    auto drain = [&]()
+    {
+        uint32_t view = 0;
+        while (queue.TryPop(view))
+        {
+            ASSERT_LT(view, ViewCount);
+            EXPECT_TRUE(flags[view].IsRaised());
+            flags[view].Clear();
+            visits[view]++;
+        }
+    };
+    while (producersLeft.load(std::memory_order_acquire) != 0)
+    {
+        drain();
+    }
+    for (auto& producer : producers)
+    {
+        producer.join();
+    }
+    drain();
+
+    EXPECT_FALSE(queue.TakeOverflow());
+    for (uint32_t view = 0; view < ViewCount; ++view)
+    {
+        EXPECT_GE(visits[view], 1u) << "view " << view;
+        EXPECT_FALSE(flags[view].IsRaised()) << "view " << view;
+    }
+}
@@ -0,0 +1,411 @@
+// ============================================================================
+// WebViewToolkit - PixelKernels Tests
+// ============================================================================
+// Every instruction set is checked against closed-form references, then
+// against the scalar kernels on random images with awkward widths/pitches.
+// ============================================================================
+
+#include "Core/ImageFlip.h"
+#include "Core/PixelKernels.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // One pixel per (channel value, alpha) pair, channels offset so they differ
+    std::vector<uint8_t> MakeAllPairs()
+    {
+        std::vector<uint8_t> pixels(256 * 256 * 4);
+        for (uint32_t a = 0; a < 256; a++)
+        {
+            for (uint32_t c = 0; c < 256; c++)
+            {
+                uint8_t* p = &pixels[(a * 256 + c) * 4];
+                p[0] = static_cast<uint8_t>(c);
+                p[1] = static_cast<uint8_t>(c * 7 + 3);
+                p[2] = static_cast<uint8_t>(255 - c);
+                p[3] = static_cast<uint8_t>(a);
+            }
+        }
+        return pixels;
+    }
+
+    uint8_t ExpectedPremultiply(uint32_t c, uint32_t a)
+    {
+        // c * a / 255 is never exactly halfway, so lround is unambiguous
+        return static_cast<uint8_t>(std::lround(c * a / 255.0));
+    }
+
+    uint8_t ExpectedUnpremultiply(uint32_t c, uint32_t a)
+    {
+        return a == 0 ? 0 : static_cast<uint8_t>(std::min<uint32_t>(255, (c * 255 + a / 2) / a));
+    }
+
+    bool RunRow(const std::vector<uint8_t>& src, std::vector<uint8_t>& dst, PixelOps ops)
+    {
+        dst.assign(src.size(), 0);
+        PixelTransform transform;
+        transform.src = src.data();
+        transform.srcPitch = src.size();
+        transform.dst = dst.data();
+        transform.dstPitch = dst.size();
+        transform.width = static_cast<uint32_t>(src.size() / 4);
+        transform.height = 1;
+        transform.ops = ops;
+        return TransformPixels(transform);
+    }
+
+    class PixelKernelsIsaTests : public ::testing::TestWithParam<PixelIsa>
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!SetPixelKernelIsa(GetParam()))
+            {
+                GTEST_SKIP() << GetPixelIsaName(GetParam()) << " not supported on this build/CPU";
+            }
+        }
+
+        void TearDown() override
+        {
+            ResetPixelKernelIsa();
+        }
+    };
+}
+
+TEST_P(PixelKernelsIsaTests, SwizzleSwapsFirstAndThirdChannel)
+{
+    auto src = MakeAllPairs();
+    std::vector<uint8_t> dst;
+    ASSERT_TRUE(RunRow(src, dst, PixelOps::SwizzleRB));
+
+    for (size_t i = 0; i < src.size(); i += 4)
+    {
+        ASSERT_EQ(dst[i + 0], src[i + 2]) << "pixel " << i / 4;
+        ASSERT_EQ(dst[i + 1], src[i + 1]) << "pixel " << i / 4;
+        ASSERT_EQ(dst[i + 2], src[i + 0]) << "pixel " << i / 4;
+        ASSERT_EQ(dst[i + 3], src[i + 3]) << "pixel " << i / 4;
+    }
+}
+
+TEST_P(PixelKernelsIsaTests, PremultiplyIsExactForEveryChannelAlphaPair)
+{
+    auto src = MakeAllPairs();
+    std::vector<uint8_t> dst;
+    ASSERT_TRUE(RunRow(src, dst, PixelOps::Premultiply));
+
+    for (size_t i = 0; i < src.size(); i += 4)
+    {
+        const uint32_t a = src[i + 3];
+        for (int c = 0; c < 3; c++)
+        {
+            ASSERT_EQ(dst[i + c], ExpectedPremultiply(src[i + c], a)) << "c=" << int(src[i + c]) << " a=" << a;
+        }
+        ASSERT_EQ(dst[i + 3], a);
+    }
+}
+
+TEST_P(PixelKernelsIsaTests, UnpremultiplyIsExactForEveryChannelAlphaPair)
+{
+    auto src = MakeAllPairs();
+    std::vector<uint8_t> dst;
+    ASSERT_TRUE(RunRow(src, dst, PixelOps::Unpremultiply));
+
+    for (size_t i = 0; i < src.size(); i += 4)
+    {
+        const uint32_t a = src[i + 3];
+        for (int c = 0; c < 3; c++)
+        {
+            ASSERT_EQ(dst[i + c], ExpectedUnpremultiply(src[i + c], a)) << "c=" << int(src[i + c]) << " a=" << a;
+        }
+        ASSERT_EQ(dst[i + 3], a);
+    }
+}
+
+TEST_P(PixelKernelsIsaTests, MatchesScalarOnRandomImages)
+{
+    const PixelOps opSets[] = {
+        PixelOps::None,
+        PixelOps::SwizzleRB,
+        PixelOps::Premultiply,
+        PixelOps::Unpremultiply,
+        PixelOps::SwizzleRB | PixelOps::Premultiply,
+        PixelOps::SwizzleRB | PixelOps::Unpremultiply,
+    };
+
+    std::mt19937 rng(1234);
+    for (uint32_t width : { 1u, 3u, 4u, 7u, 8u, 15u, 16u, 17u, 33u, 67u })
+    {
+        const uint32_t height = 1 + width % 5;
+        const size_t srcPitch = width * 4 + (width % 3) * 4;
+        const size_t dstPitch = width * 4 + 12;
+
+        std::vector<uint8_t> src(srcPitch * height);
+        for (auto& byte : src)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        for (PixelOps ops : opSets)
+        {
+            for (bool flipY : { false, true })
+            {
+                std::vector<uint8_t> expected(dstPitch * height, 0xCD);
+                std::vector<uint8_t> actual(dstPitch * height, 0xCD);
+
+                PixelTransform transform;
+                transform.src = src.data();
+                transform.srcPitch = srcPitch;
+                transform.dstPitch = dstPitch;
+                transform.width = width;
+                transform.height = height;
+                transform.ops = ops;
+                transform.flipY = flipY;
+
+                ASSERT_TRUE(SetPixelKernelIsa(PixelIsa::Scalar));
+                transform.dst = expected.data();
+                ASSERT_TRUE(TransformPixels(transform));
+
+                ASSERT_TRUE(SetPixelKernelIsa(GetParam()));
+                transform.dst = actual.data();
+                ASSERT_TRUE(TransformPixels(transform));
+
+                ASSERT_EQ(expected, actual) << "width=" << width << " ops=" << static_cast<uint32_t>(ops) << " flipY=" << flipY;
+            }
+        }
+    }
+}
+
+TEST_P(PixelKernelsIsaTests, InPlaceTransformMatchesOutOfPlace)
+{
+    auto src = MakeAllPairs();
+    std::vector<uint8_t> expected;
+    ASSERT_TRUE(RunRow(src, expected, PixelOps::SwizzleRB | PixelOps::Premultiply));
+
+    PixelTransform transform;
+    transform.src = src.data();
+    transform.srcPitch = src.size();
+    transform.dst = src.data();
+    transform.dstPitch = src.size();
+    transform.width = static_cast<uint32_t>(src.size() / 4);
+    transform.height = 1;
+    transform.ops = PixelOps::SwizzleRB | PixelOps::Premultiply;
+    ASSERT_TRUE(TransformPixels(transform));
+
+    EXPECT_EQ(src, expected);
+}
+
+TEST_P(PixelKernelsIsaTests, TileSignaturesMatchScalar)
+{
+    std::mt19937 rng(99);
+    for (uint32_t tileWidth : { 8u, 16u, 64u })
+    {
+        for (uint32_t width : { 1u, 7u, 8u, 9u, 63u, 64u, 65u, 200u })
+        {
+            std::vector<uint8_t> row(width * 4);
+            for (auto& byte : row)
+            {
+                byte = static_cast<uint8_t>(rng());
+            }
+
+            const size_t tiles = (width + tileWidth - 1) / tileWidth;
+            std::vector<TileSignature> expected(tiles, TileSignature::Seed());
+            std::vector<TileSignature> actual(tiles, TileSignature::Seed());
+
+            // Two rows, so the second one starts from a non-seed state
+            ASSERT_TRUE(SetPixelKernelIsa(PixelIsa::Scalar));
+            ASSERT_TRUE(HashTileRow(row.data(), width, tileWidth, expected.data()));
+            ASSERT_TRUE(HashTileRow(row.data(), width, tileWidth, expected.data()));
+
+            ASSERT_TRUE(SetPixelKernelIsa(GetParam()));
+            ASSERT_TRUE(HashTileRow(row.data(), width, tileWidth, actual.data()));
+            ASSERT_TRUE(HashTileRow(row.data(), width, tileWidth, actual.data()));
+
+            EXPECT_TRUE(expected == actual) << "width=" << width << " tileWidth=" << tileWidth;
+        }
+    }
+}
+
+TEST_P(PixelKernelsIsaTests, LineSignaturesMatchScalar)
+{
+    std::mt19937 rng(77);
+    for (uint32_t width : { 1u, 7u, 8u, 9u, 63u, 64u, 65u, 200u })
+    {
+        std::vector<uint8_t> row(width * 4);
+        for (auto& byte : row)
+        {
+            byte = static_cast<uint8_t>(rng());
+        }
+
+        std::vector<uint32_t> expectedColumns(width, 1u);
+        std::vector<uint32_t> actualColumns(width, 1u);
+        TileSignature expectedRow = TileSignature::Seed();
+        TileSignature actualRow = TileSignature::Seed();
+
+        // Two rows, so the second one starts from a non-seed state
+        ASSERT_TRUE(SetPixelKernelIsa(PixelIsa::Scalar));
+        ASSERT_TRUE(HashLineRow(row.data(), width, expectedColumns.data(), expectedRow));
+        ASSERT_TRUE(HashLineRow(row.data(), width, expectedColumns.data(), expectedRow));
+
+        ASSERT_TRUE(SetPixelKernelIsa(GetParam()));
+        ASSERT_TRUE(HashLineRow(row.data(), width, actualColumns.data(), actualRow));
+        ASSERT_TRUE(HashLineRow(row.data(), width, actualColumns.data(), actualRow));
+
+        EXPECT_TRUE(expectedRow == actualRow) << "width=" << width;
+        EXPECT_EQ(expectedColumns, actualColumns) << "width=" << width;
+
+        // The row signature is the one of a tile spanning the whole row
+        TileSignature tile = TileSignature::Seed();
+        ASSERT_TRUE(HashTileRow(row.data(), width, (width + 7) / 8 * 8, &tile));
+        ASSERT_TRUE(HashTileRow(row.data(), width, (width + 7) / 8 * 8, &tile));
+        EXPECT_TRUE(tile == actualRow) << "width=" << width;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(AllIsas, PixelKernelsIsaTests,
+    ::testing::Values(PixelIsa::Scalar, PixelIsa::SSE2, PixelIsa::AVX2, PixelIsa::NEON),
+    [](const ::testing::TestParamInfo<PixelIsa>& info) { return std::string(GetPixelIsaName(info.param)); });
+
+TEST(PixelKernelsTests, FlipMatchesReference)
+{
+    const uint32_t width = 13, height = 9;
+    const size_t srcPitch = 64;
+    std::vector<uint8_t> src(srcPitch * height);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<uint8_t>(i * 13);
+    }
+
+    std::vector<uint8_t> expected(width * 4 * height);
+    FlipRows(src.data(), srcPitch, expected.data(), width * 4, width * 4, height);
+
+    std::vector<uint8_t> buffer;
+    ASSERT_EQ(TransformPixelsIntoBuffer(src.data(), srcPitch, width, height, PixelOps::None, true, buffer), width * 4u);
+    buffer.resize(expected.size());
+    EXPECT_EQ(buffer, expected);
+}
+
+TEST(PixelKernelsTests, RejectsInvalidTransforms)
+{
+    uint8_t pixels[64] = {};
+    PixelTransform transform;
+    transform.src = pixels;
+    transform.dst = pixels + 32;
+    transform.srcPitch = 16;
+    transform.dstPitch = 16;
+    transform.width = 4;
+    transform.height = 2;
+
+    PixelTransform bad = transform;
+    bad.src = nullptr;
+    EXPECT_FALSE(TransformPixels(bad));
+
+    bad = transform;
+    bad.dstPitch = 12;  // Smaller than a row
+    EXPECT_FALSE(TransformPixels(bad));
+
+    bad = transform;
+    bad.ops = PixelOps::Premultiply | PixelOps::Unpremultiply;
+    EXPECT_FALSE(TransformPixels(bad));
+
+    bad = transform;
+    bad.dst = pixels;
+    bad.flipY = true;   // In-place flip would overwrite rows before reading them
+    EXPECT_FALSE(TransformPixels(bad));
+
+    EXPECT_TRUE(TransformPixels(transform));
+}
+
+TEST(PixelKernelsTests, BestIsaIsSelectedByDefault)
+{
+    ResetPixelKernelIsa();
+    const PixelIsa active = GetPixelKernelIsa();
+    EXPECT_TRUE(IsPixelIsaSupported(active));
+    EXPECT_TRUE(IsPixelIsaSupported(PixelIsa::Scalar));
+
+    if (IsPixelIsaSupported(PixelIsa::AVX2))
+    {
+        EXPECT_EQ(active, PixelIsa::AVX2);
+    }
+}
+
+TEST(PixelKernelsTests, UnsupportedIsaLeavesSelectionUnchanged)
+{
+    ResetPixelKernelIsa();
+    const PixelIsa active = GetPixelKernelIsa();
+
+    for (PixelIsa isa : { PixelIsa::SSE2, PixelIsa::AVX2, PixelIsa::NEON })
+    {
+        if (!IsPixelIsaSupported(isa))
+        {
+            EXPECT_FALSE(SetPixelKernelIsa(isa));
+            EXPECT_EQ(GetPixelKernelIsa(), active);
+        }
+    }
+}
+
+TEST(PixelKernelsTests, HashTileRowRejectsInvalidTileWidths)
+{
+    uint8_t row[64] = {};
+    TileSignature signatures[2] = { TileSignature::Seed(), TileSignature::Seed() };
+
+    EXPECT_FALSE(HashTileRow(row, 16, 0, signatures));
+    EXPECT_FALSE(HashTileRow(row, 16, 12, signatures));
+    EXPECT_FALSE(HashTileRow(nullptr, 16, 8, signatures));
+    EXPECT_FALSE(HashTileRow(row, 16, 8, nullptr));
+    EXPECT_TRUE(HashTileRow(row, 16, 8, signatures));
+}
+
+TEST(PixelKernelsTests, IntoBufferPacksRowsTightly)
+{
+    const uint32_t width = 6, height = 3;
+    const size_t srcPitch = 32;
+    std::vector<uint8_t> src(srcPitch * height);
+    for (size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = static_cast<uint8_t>(i);
+    }
+    std::vector<uint8_t> buffer;
+
+    const size_t pitch = TransformPixelsIntoBuffer(src.data(), srcPitch, width, height, PixelOps::None, true, buffer);
+
+    ASSERT_EQ(pitch, width * 4u);
+    ASSERT_GE(buffer.size(), pitch * height);
+    for (uint32_t y = 0; y < height; y++)
+    {
+        EXPECT_EQ(0, std::memcmp(&buffer[y * pitch], &src[(height - 1 - y) * srcPitch], pitch)) << "row " << y;
+    }
+}
+
+TEST(PixelKernelsTests, IntoBufferReusesStorage)
+{
+    std::vector<uint8_t> large(64 * 16), small(32 * 8);
+    std::vector<uint8_t> buffer;
+
+    TransformPixelsIntoBuffer(large.data(), 64, 16, 16, PixelOps::None, true, buffer);
+    const uint8_t* storage = buffer.data();
+
+    // Same or smaller frames must not reallocate
+    TransformPixelsIntoBuffer(large.data(), 64, 16, 16, PixelOps::None, true, buffer);
+    TransformPixelsIntoBuffer(small.data(), 32, 8, 8, PixelOps::SwizzleRB, false, buffer);
+    EXPECT_EQ(buffer.data(), storage);
+}
+
+TEST(PixelKernelsTests, IntoBufferWithEmptyInputWritesNothing)
+{
+    std::vector<uint8_t> buffer;
+    uint8_t pixel[4] = {};
+
+    EXPECT_EQ(TransformPixelsIntoBuffer(nullptr, 4, 1, 1, PixelOps::None, true, buffer), 0u);
+    EXPECT_EQ(TransformPixelsIntoBuffer(pixel, 4, 0, 1, PixelOps::None, true, buffer), 0u);
+    EXPECT_EQ(TransformPixelsIntoBuffer(pixel, 4, 1, 0, PixelOps::None, true, buffer), 0u);
+    EXPECT_TRUE(buffer.empty());
+}
@@ -0,0 +1,253 @@
+// ============================================================================
+// WebViewToolkit - ReadbackRing Tests
+// ============================================================================
+
+#include "Core/ReadbackRing.h"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // Fake device with a GPU timeline advanced explicitly by the test.
+    // Copies retire in submission order, one per AdvanceGpu() tick.
+    class FakeReadbackDevice final : public IReadbackDevice
+    {
+    public:
+        struct Query { uint64_t submitIndex = 0; };
+        struct Staging { uint32_t width; uint32_t height; void* lastSource = nullptr; };
+
+        void* CreateStagingTexture(uint32_t width, uint32_t height) override
+        {
+            if (failStagingCreation) return nullptr;
+            auto staging = std::make_unique<Staging>(Staging{ width, height });
+            void* handle = staging.get();
+            m_staging.insert(handle);
+            m_stagingStorage.push_back(std::move(staging));
+            return handle;
+        }
+
+        void DestroyStagingTexture(void* stagingTexture) override
+        {
+            ASSERT_EQ(m_staging.erase(stagingTexture), 1u) << "double destroy or unknown staging texture";
+        }
+
+        void* CreateCompletionQuery() override
+        {
+            auto query = std::make_unique<Query>();
+            void* handle = query.get();
+            m_queries.insert(handle);
+            m_queryStorage.push_back(std::move(query));
+            return handle;
+        }
+
+        void DestroyCompletionQuery(void* query) override
+        {
+            ASSERT_EQ(m_queries.erase(query), 1u) << "double destroy or unknown query";
+        }
+
+        void CopyToStaging(void* stagingTexture, void* sourceTexture, void* query) override
+        {
+            static_cast<Staging*>(stagingTexture)->lastSource = sourceTexture;
+            static_cast<Query*>(query)->submitIndex = m_submitCount++;
+            copies++;
+        }
+
+        bool IsCopyComplete(void* query) override
+        {
+            polls++;
+            return static_cast<Query*>(query)->submitIndex < m_completedCount;
+        }
+
+        void AdvanceGpu(uint64_t count = 1) { m_completedCount += count; }
+        void DrainGpu() { m_completedCount = m_submitCount; }
+
+        size_t LiveStagingCount() const { return m_staging.size(); }
+        size_t LiveQueryCount() const { return m_queries.size(); }
+
+        bool failStagingCreation = false;
+        int copies = 0;
+        int polls = 0;
+
+    private:
+        uint64_t m_submitCount = 0;
+        uint64_t m_completedCount = 0;
+        std::set<void*> m_staging;
+        std::set<void*> m_queries;
+        std::vector<std::unique_ptr<Staging>> m_stagingStorage;
+        std::vector<std::unique_ptr<Query>> m_queryStorage;
+    };
+
+    void* Source(uintptr_t id) { return reinterpret_cast<void*>(id); }
+}
+
+TEST(ReadbackRingTests, NothingIsAcquiredUntilCopyRetires)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 3);
+
+    EXPECT_EQ(ring.GetLastSubmittedSequence(), 0u);
+    ASSERT_TRUE(ring.Submit(Source(1), 64, 32));
+    EXPECT_EQ(ring.GetLastSubmittedSequence(), 1u);
+    EXPECT_EQ(ring.AcquireLatest(), nullptr);
+    EXPECT_EQ(ring.GetPendingCount(), 1u);
+
+    device.AdvanceGpu();
+    const ReadbackSlot* slot = ring.AcquireLatest();
+    ASSERT_NE(slot, nullptr);
+    EXPECT_EQ(slot->width, 64u);
+    EXPECT_EQ(slot->height, 32u);
+    EXPECT_EQ(slot->sequence, 1u);
+    ring.Release(slot);
+
+    EXPECT_EQ(ring.GetPendingCount(), 0u);
+}
+
+TEST(ReadbackRingTests, SteadyStateReusesStagingTextures)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 3);
+
+    int acquired = 0;
+    for (int frame = 0; frame < 100; ++frame)
+    {
+        ASSERT_TRUE(ring.Submit(Source(frame + 1), 128, 128));
+        if (const ReadbackSlot* slot = ring.AcquireLatest())
+        {
+            acquired++;
+            ring.Release(slot);
+        }
+        device.AdvanceGpu();
+    }
+
+    // One frame of latency: every frame but the last one is presented
+    EXPECT_EQ(acquired, 99);
+    EXPECT_LE(ring.GetStats().stagingCreated, 3u);
+    EXPECT_LE(device.LiveStagingCount(), 3u);
+    EXPECT_EQ(ring.GetStats().overwritten, 0u);
+}
+
+TEST(ReadbackRingTests, AcquireReturnsNewestCompletedAndSkipsOlder)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 4);
+
+    ASSERT_TRUE(ring.Submit(Source(1), 16, 16));
+    ASSERT_TRUE(ring.Submit(Source(2), 16, 16));
+    ASSERT_TRUE(ring.Submit(Source(3), 16, 16));
+    device.AdvanceGpu(2); // Retires copies 1 and 2, 3 still in flight
+
+    const ReadbackSlot* slot = ring.AcquireLatest();
+    ASSERT_NE(slot, nullptr);
+    EXPECT_EQ(slot->sequence, 2u);
+    ring.Release(slot);
+
+    EXPECT_EQ(ring.GetStats().skippedStale, 1u);
+    EXPECT_EQ(ring.GetPendingCount(), 1u);
+}
+
+TEST(ReadbackRingTests, FullRingOverwritesOldestInFlightSlot)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 2);
+
+    ASSERT_TRUE(ring.Submit(Source(1), 16, 16));
+    ASSERT_TRUE(ring.Submit(Source(2), 16, 16));
+    ASSERT_TRUE(ring.Submit(Source(3), 16, 16));
+
+    EXPECT_EQ(ring.GetStats().overwritten, 1u);
+    EXPECT_EQ(ring.GetStats().stagingCreated, 2u);
+    EXPECT_EQ(ring.GetPendingCount(), 2u);
+
+    device.DrainGpu();
+    const ReadbackSlot* slot = ring.AcquireLatest();
+    ASSERT_NE(slot, nullptr);
+    EXPECT_EQ(slot->sequence, 3u);
+    EXPECT_EQ(static_cast<FakeReadbackDevice::Staging*>(slot->stagingTexture)->lastSource, Source(3));
+    ring.Release(slot);
+}
+
+TEST(ReadbackRingTests, ResizeReallocatesAtNewSize)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 2);
+
+    ASSERT_TRUE(ring.Submit(Source(1), 100, 50));
+    ASSERT_TRUE(ring.Submit(Source(2), 200, 80));
+
+    EXPECT_EQ(ring.GetWidth(), 200u);
+    EXPECT_EQ(ring.GetHeight(), 80u);
+    EXPECT_EQ(device.LiveStagingCount(), 1u);
+    EXPECT_EQ(ring.GetPendingCount(), 1u);
+
+    device.DrainGpu();
+    const ReadbackSlot* slot = ring.AcquireLatest();
+    ASSERT_NE(slot, nullptr);
+    EXPECT_EQ(slot->width, 200u);
+    EXPECT_EQ(slot->height, 80u);
+    ring.Release(slot);
+}
+
+TEST(ReadbackRingTests, AcquireWhileHoldingSlotReturnsNull)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device, 3);
+
+    ASSERT_TRUE(ring.Submit(Source(1), 8, 8));
+    device.AdvanceGpu();
+    const ReadbackSlot* slot = ring.AcquireLatest();
+    ASSERT_NE(slot, nullptr);
+
+    ASSERT_TRUE(ring.Submit(Source(2), 8, 8));
+    device.AdvanceGpu();
+    EXPECT_EQ(ring.AcquireLatest(), nullptr);
+
+    ring.Release(slot);
+    const ReadbackSlot* next = ring.AcquireLatest();
+    ASSERT_NE(next, nullptr);
+    EXPECT_EQ(next->sequence, 2u);
+    ring.Release(next);
+}
+
+TEST(ReadbackRingTests, StagingCreationFailureIsReported)
+{
+    FakeReadbackDevice device;
+    device.failStagingCreation = true;
+    ReadbackRing ring(&device, 2);
+
+    EXPECT_FALSE(ring.Submit(Source(1), 8, 8));
+    EXPECT_EQ(device.copies, 0);
+    EXPECT_EQ(ring.GetPendingCount(), 0u);
+}
+
+TEST(ReadbackRingTests, RejectsInvalidSubmissions)
+{
+    FakeReadbackDevice device;
+    ReadbackRing ring(&device);
+
+    EXPECT_FALSE(ring.Submit(nullptr, 8, 8));
+    EXPECT_FALSE(ring.Submit(Source(1), 0, 8));
+    EXPECT_FALSE(ring.Submit(Source(1), 8, 0));
+    EXPECT_EQ(ring.GetDepth(), ReadbackRing::DefaultDepth);
+}
+
+TEST(ReadbackRingTests, DestructionReleasesAllDeviceObjects)
+{
+    FakeReadbackDevice device;
+    {
+        ReadbackRing ring(&device, 3);
+        for (int i = 0; i < 5; ++i)
+        {
+            ASSERT_TRUE(ring.Submit(Source(i + 1), 32, 32));
+        }
+        EXPECT_GT(device.LiveStagingCount(), 0u);
+    }
+
+    EXPECT_EQ(device.LiveStagingCount(), 0u);
+    EXPECT_EQ(device.LiveQueryCount(), 0u);
+}
@@ -0,0 +1,175 @@
+// ============================================================================
+// WebViewToolkit - RenderScaleController Tests
+// ============================================================================
+
+#include "Core/RenderScaleController.h"
+
+#include <gtest/gtest.h>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    RenderScaleSettings Budget(float frameBudgetMs)
+    {
+        RenderScaleSettings settings;
+        settings.frameBudgetMs = frameBudgetMs;
+        settings.windowFrames = 4;
+        settings.calmWindowsToRaise = 2;
+        return settings;
+    }
+
+    // Feed whole windows of identical frames, returns how often the scale changed
+    int RunWindows(RenderScaleController& controller, int windows, float frameTimeMs, float coverage)
+    {
+        int changes = 0;
+        for (uint32_t i = 0; i < static_cast<uint32_t>(windows) * controller.GetSettings().windowFrames; ++i)
+        {
+            changes += controller.OnFrame(frameTimeMs, coverage) ? 1 : 0;
+        }
+        return changes;
+    }
+
+    // Frame time of a view whose cost is proportional to its pixel count
+    float PixelCost(const RenderScaleController& controller, float fullScaleMs)
+    {
+        return fullScaleMs * controller.GetScale() * controller.GetScale();
+    }
+}
+
+TEST(RenderScaleControllerTests, ScaleDimensionRoundsAndNeverReachesZero)
+{
+    EXPECT_EQ(ScaleDimension(1920, 0.5f), 960u);
+    EXPECT_EQ(ScaleDimension(1001, 0.5f), 501u);
+    EXPECT_EQ(ScaleDimension(3, 0.25f), 1u);
+    EXPECT_EQ(ScaleDimension(0, 1.0f), 1u);
+}
+
+TEST(RenderScaleControllerTests, InitialScaleIsQuantizedAndClamped)
+{
+    EXPECT_FLOAT_EQ(RenderScaleController().GetScale(), 1.0f);
+    EXPECT_FLOAT_EQ(RenderScaleController(RenderScaleSettings{}, 0.6f).GetScale(), 0.5f);
+    EXPECT_FLOAT_EQ(RenderScaleController(RenderScaleSettings{}, 0.01f).GetScale(), MinRenderScale);
+    EXPECT_FLOAT_EQ(RenderScaleController(RenderScaleSettings{}, 4.0f).GetScale(), MaxRenderScale);
+}
+
+TEST(RenderScaleControllerTests, DecidesOnlyAtWindowEnd)
+{
+    RenderScaleController controller(Budget(0.0f));
+
+    for (int i = 0; i < 3; ++i)
+    {
+        EXPECT_FALSE(controller.OnFrame(1.0f, 0.25f));
+    }
+    EXPECT_TRUE(controller.OnFrame(1.0f, 0.25f));
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.5f);
+    EXPECT_EQ(controller.GetStats().windows, 1u);
+}
+
+TEST(RenderScaleControllerTests, CoverageRoundsUpToTheNextStep)
+{
+    RenderScaleController controller(Budget(0.0f));
+
+    // sqrt(0.3) = 0.548: a 0.5 texture would undersample, 0.625 does not
+    EXPECT_EQ(RunWindows(controller, 1, 1.0f, 0.3f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.625f);
+
+    // Shown larger than its logical size: never above full resolution
+    EXPECT_EQ(RunWindows(controller, 1, 1.0f, 4.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 1.0f);
+
+    // Off screen: the minimum, not zero
+    EXPECT_EQ(RunWindows(controller, 1, 1.0f, 0.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), MinRenderScale);
+}
+
+TEST(RenderScaleControllerTests, CoverageUsesTheLargestInTheWindow)
+{
+    RenderScaleController controller(Budget(0.0f));
+
+    // A view flying past the camera is sized for its closest approach
+    for (int i = 0; i < 3; ++i)
+    {
+        controller.OnFrame(1.0f, 0.0625f);
+    }
+    EXPECT_FALSE(controller.OnFrame(1.0f, 1.0f));
+    EXPECT_FLOAT_EQ(controller.GetScale(), 1.0f);
+}
+
+TEST(RenderScaleControllerTests, OverBudgetScalesByPixelCost)
+{
+    RenderScaleController controller(Budget(4.0f));
+
+    // 16 ms at full scale against 4 ms: a quarter of the pixels, half the side
+    EXPECT_EQ(RunWindows(controller, 1, 16.0f, 1.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.5f);
+    EXPECT_EQ(controller.GetStats().lowered, 1u);
+}
+
+TEST(RenderScaleControllerTests, SmallOverrunStillDropsOneStep)
+{
+    RenderScaleController controller(Budget(4.0f));
+
+    EXPECT_EQ(RunWindows(controller, 1, 4.1f, 1.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.875f);
+}
+
+TEST(RenderScaleControllerTests, ConvergesWithoutOscillating)
+{
+    RenderScaleController controller(Budget(4.0f));
+
+    // 10 ms at full scale: the budget fits sqrt(0.4) = 0.63 of the side
+    int changes = 0;
+    for (int window = 0; window < 40; ++window)
+    {
+        changes += RunWindows(controller, 1, PixelCost(controller, 10.0f), 1.0f);
+    }
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.625f);
+    EXPECT_LE(changes, 2);
+
+    // 0.75 would cost 5.6 ms, so the scale is never tried
+    EXPECT_EQ(controller.GetStats().raised, 0u);
+}
+
+TEST(RenderScaleControllerTests, HeadroomRaisesOneStepAfterCalmWindows)
+{
+    RenderScaleController controller(Budget(4.0f));
+    RunWindows(controller, 1, 16.0f, 1.0f);
+    ASSERT_FLOAT_EQ(controller.GetScale(), 0.5f);
+
+    // The load dropped to 4 ms at full scale: 1 ms at 0.5, 1.56 ms at 0.625
+    EXPECT_EQ(RunWindows(controller, 1, PixelCost(controller, 4.0f), 1.0f), 0);
+    EXPECT_EQ(RunWindows(controller, 1, PixelCost(controller, 4.0f), 1.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.625f);
+
+    // Full scale would cost 4 ms, above 90% of the budget
+    for (int window = 0; window < 20; ++window)
+    {
+        RunWindows(controller, 1, PixelCost(controller, 4.0f), 1.0f);
+    }
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.875f);
+}
+
+TEST(RenderScaleControllerTests, BudgetAndCoverageTakeTheLowerScale)
+{
+    RenderScaleController controller(Budget(4.0f));
+    RunWindows(controller, 1, 16.0f, 1.0f);
+    ASSERT_FLOAT_EQ(controller.GetScale(), 0.5f);
+
+    // Shrinking on screen lowers further; the budget limit stays in force
+    EXPECT_EQ(RunWindows(controller, 1, 1.0f, 0.0625f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.25f);
+    EXPECT_EQ(RunWindows(controller, 1, 1.0f, 1.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.5f);
+}
+
+TEST(RenderScaleControllerTests, MinimumScaleIsRespected)
+{
+    RenderScaleSettings settings = Budget(1.0f);
+    settings.minScale = 0.5f;
+    RenderScaleController controller(settings);
+
+    EXPECT_EQ(RunWindows(controller, 4, 100.0f, 1.0f), 1);
+    EXPECT_FLOAT_EQ(controller.GetScale(), 0.5f);
+    EXPECT_EQ(RunWindows(controller, 1, 100.0f, 0.0f), 0);
+}
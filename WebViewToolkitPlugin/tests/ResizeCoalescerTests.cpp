@@ -0,0 +1,168 @@
+// ============================================================================
+// WebViewToolkit - ResizeCoalescer Tests
+// ============================================================================
+
+#include "Core/ResizeCoalescer.h"
+
+#include <gtest/gtest.h>
+
+using namespace WebViewToolkit;
+
+TEST(ResizeCoalescerTests, FirstRequestAppliesAtOnce)
+{
+    ResizeCoalescer coalescer(100);
+
+    EXPECT_TRUE(coalescer.Request(800, 600, 5000));
+    EXPECT_FALSE(coalescer.HasPending());
+    EXPECT_EQ(coalescer.GetStats().requested, 1u);
+    EXPECT_EQ(coalescer.GetStats().applied, 1u);
+}
+
+TEST(ResizeCoalescerTests, RequestsWithinTheIntervalWaitForTheTrailingEdge)
+{
+    ResizeCoalescer coalescer(100);
+    coalescer.Request(800, 600, 0);
+
+    EXPECT_FALSE(coalescer.Request(810, 600, 10));
+    EXPECT_FALSE(coalescer.Request(820, 600, 20));
+    EXPECT_FALSE(coalescer.Request(830, 600, 30));
+    EXPECT_TRUE(coalescer.HasPending());
+
+    uint32_t width = 0, height = 0;
+    EXPECT_FALSE(coalescer.Poll(99, width, height));
+    ASSERT_TRUE(coalescer.Poll(100, width, height));
+    EXPECT_EQ(width, 830u);
+    EXPECT_EQ(height, 600u);
+    EXPECT_FALSE(coalescer.HasPending());
+    EXPECT_FALSE(coalescer.Poll(500, width, height));
+
+    EXPECT_EQ(coalescer.GetStats().requested, 4u);
+    EXPECT_EQ(coalescer.GetStats().applied, 2u);
+    EXPECT_EQ(coalescer.GetStats().coalesced, 2u);
+}
+
+TEST(ResizeCoalescerTests, RequestAfterTheIntervalAppliesAtOnce)
+{
+    ResizeCoalescer coalescer(100);
+    coalescer.Request(800, 600, 0);
+    coalescer.Request(900, 600, 50);
+
+    // The pending request is replaced by one that may go through directly
+    EXPECT_TRUE(coalescer.Request(1000, 600, 150));
+    EXPECT_FALSE(coalescer.HasPending());
+    EXPECT_EQ(coalescer.GetStats().applied, 2u);
+    EXPECT_EQ(coalescer.GetStats().coalesced, 1u);
+}
+
+TEST(ResizeCoalescerTests, ReturningToTheAppliedSizeDropsThePendingResize)
+{
+    ResizeCoalescer coalescer(100);
+    coalescer.Request(800, 600, 0);
+    coalescer.Request(900, 600, 10);
+
+    EXPECT_FALSE(coalescer.Request(800, 600, 20));
+    EXPECT_FALSE(coalescer.HasPending());
+
+    uint32_t width = 0, height = 0;
+    EXPECT_FALSE(coalescer.Poll(200, width, height));
+    EXPECT_EQ(coalescer.GetStats().applied, 1u);
+}
+
+TEST(ResizeCoalescerTests, ForgottenSizeIsAppliedWhenRequestedAgain)
+{
+    ResizeCoalescer coalescer(0);
+    ASSERT_TRUE(coalescer.Request(800, 600, 0));
+
+    // e.g. the atlas had no room for it
+    coalescer.ForgetAppliedSize();
+    EXPECT_TRUE(coalescer.Request(800, 600, 10));
+    EXPECT_FALSE(coalescer.Request(800, 600, 20));
+}
+
+TEST(ResizeCoalescerTests, ZeroIntervalAppliesEveryChange)
+{
+    ResizeCoalescer coalescer(0);
+
+    for (uint32_t width = 100; width < 200; width += 10)
+    {
+        EXPECT_TRUE(coalescer.Request(width, 100, 7));
+    }
+    EXPECT_EQ(coalescer.GetStats().applied, 10u);
+    EXPECT_EQ(coalescer.GetStats().coalesced, 0u);
+}
+
+TEST(ResizeCoalescerTests, IntervalChangesApplyToThePendingResize)
+{
+    ResizeCoalescer coalescer(1000);
+    coalescer.Request(800, 600, 0);
+    coalescer.Request(900, 600, 10);
+
+    uint32_t width = 0, height = 0;
+    EXPECT_FALSE(coalescer.Poll(50, width, height));
+    coalescer.SetInterval(50);
+    EXPECT_EQ(coalescer.GetInterval(), 50u);
+    EXPECT_TRUE(coalescer.Poll(50, width, height));
+    EXPECT_EQ(width, 900u);
+}
+
+TEST(ResizeCoalescerTests, ClockGoingBackwardsDoesNotStall)
+{
+    ResizeCoalescer coalescer(100);
+    coalescer.Request(800, 600, 1000);
+    coalescer.Request(900, 600, 1010);
+
+    uint32_t width = 0, height = 0;
+    EXPECT_TRUE(coalescer.Poll(10, width, height));
+    EXPECT_EQ(width, 900u);
+}
+
+TEST(ResizeCoalescerTests, DragResizeAppliesOncePerIntervalAndEndsAtTheFinalSize)
+{
+    ResizeCoalescer coalescer(100);
+    uint32_t appliedWidth = 0;
+    uint32_t appliedHeight = 0;
+    uint64_t lastApplyMs = 0;
+    bool anyApplied = false;
+
+    auto apply = [&](uint32_t width, uint32_t height, uint64_t nowMs)
+    {
+        if (anyApplied)
+        {
+            EXPECT_GE(nowMs - lastApplyMs, 100u);
+        }
+        anyApplied = true;
+        appliedWidth = width;
+        appliedHeight = height;
+        lastApplyMs = nowMs;
+    };
+
+    // One second of dragging at 60 Hz, polled once per frame, then idle frames
+    uint64_t nowMs = 0;
+    uint32_t width = 640;
+    for (int frame = 0; frame < 120; frame++, nowMs += 16)
+    {
+        if (frame < 60)
+        {
+            width += 3;
+            if (coalescer.Request(width, 480, nowMs))
+            {
+                apply(width, 480, nowMs);
+            }
+        }
+
+        uint32_t pollWidth = 0, pollHeight = 0;
+        if (coalescer.Poll(nowMs, pollWidth, pollHeight))
+        {
+            apply(pollWidth, pollHeight, nowMs);
+        }
+    }
+
+    EXPECT_EQ(appliedWidth, width);
+    EXPECT_EQ(appliedHeight, 480u);
+    EXPECT_FALSE(coalescer.HasPending());
+
+    const ResizeStats& stats = coalescer.GetStats();
+    EXPECT_EQ(stats.requested, 60u);
+    EXPECT_LE(stats.applied, 11u);
+    EXPECT_EQ(stats.requested, stats.applied + stats.coalesced);
+}
@@ -0,0 +1,147 @@
+// ============================================================================
+// WebViewToolkit - ResizeTransaction Tests
+// ============================================================================
+
+#include "Core/ResizeTransaction.h"
+
+#include <gtest/gtest.h>
+
+using namespace WebViewToolkit;
+
+TEST(ResizeTransactionTests, FramesArePresentedWithoutAResize)
+{
+    ResizeTransaction transaction;
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 0, true), ResizeFrameAction::Present);
+    EXPECT_EQ(transaction.OnFrame(640, 512, 10, false), ResizeFrameAction::Present);
+    EXPECT_FALSE(transaction.IsActive());
+}
+
+TEST(ResizeTransactionTests, OldSizedFramesAreStretchedUntilTheNewSizeArrives)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 1000);
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 1016, true), ResizeFrameAction::Stretch);
+    EXPECT_EQ(transaction.OnFrame(512, 512, 1033, true), ResizeFrameAction::Stretch);
+    EXPECT_EQ(transaction.GetSourceWidth(), 500u);
+    EXPECT_EQ(transaction.GetSourceHeight(), 400u);
+
+    EXPECT_EQ(transaction.OnFrame(640, 512, 1050, true), ResizeFrameAction::Present);
+    EXPECT_FALSE(transaction.IsActive());
+    EXPECT_EQ(transaction.OnFrame(512, 512, 1066, true), ResizeFrameAction::Present);
+
+    const auto& stats = transaction.GetStats();
+    EXPECT_EQ(stats.completed, 1u);
+    EXPECT_EQ(stats.stretchedFrames, 2u);
+    EXPECT_EQ(stats.lastLatencyMs, 50u);
+}
+
+TEST(ResizeTransactionTests, FramesAreHeldWhenTheyCannotBeStretched)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 0);
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 16, false), ResizeFrameAction::Hold);
+    EXPECT_EQ(transaction.OnFrame(640, 512, 33, false), ResizeFrameAction::Present);
+    EXPECT_EQ(transaction.GetStats().heldFrames, 1u);
+}
+
+TEST(ResizeTransactionTests, WithoutPresentedContentFramesAreHeld)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(0, 0, 640, 512, 0);
+
+    EXPECT_EQ(transaction.OnFrame(256, 256, 16, true), ResizeFrameAction::Hold);
+}
+
+TEST(ResizeTransactionTests, ResizeWithinTheFrameSizeCompletesOnTheNextFrame)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 512, 512, 0);
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 16, true), ResizeFrameAction::Present);
+    EXPECT_EQ(transaction.GetStats().completed, 1u);
+    EXPECT_EQ(transaction.GetStats().stretchedFrames, 0u);
+}
+
+TEST(ResizeTransactionTests, LaterResizeKeepsTheOriginalSourceAndRestartsTheClock)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 0);
+    EXPECT_EQ(transaction.OnFrame(512, 512, 16, true), ResizeFrameAction::Stretch);
+
+    // The frames still show the content from before the first resize
+    transaction.Begin(640, 512, 768, 640, 100);
+    EXPECT_EQ(transaction.GetSourceWidth(), 500u);
+    EXPECT_EQ(transaction.GetSourceHeight(), 400u);
+
+    // A frame of the superseded size is not the one waited for
+    EXPECT_EQ(transaction.OnFrame(640, 512, 116, true), ResizeFrameAction::Stretch);
+    EXPECT_EQ(transaction.OnFrame(768, 640, 130, true), ResizeFrameAction::Present);
+
+    const auto& stats = transaction.GetStats();
+    EXPECT_EQ(stats.superseded, 1u);
+    EXPECT_EQ(stats.completed, 1u);
+    EXPECT_EQ(stats.lastLatencyMs, 30u);
+}
+
+TEST(ResizeTransactionTests, NextResizeStretchesFromTheCompletedSize)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 0);
+    transaction.OnFrame(640, 512, 16, true);
+
+    transaction.Begin(600, 480, 768, 640, 100);
+    EXPECT_EQ(transaction.GetSourceWidth(), 600u);
+    EXPECT_EQ(transaction.GetSourceHeight(), 480u);
+}
+
+TEST(ResizeTransactionTests, GivesUpAfterTheTimeout)
+{
+    ResizeTransaction transaction(200);
+    transaction.Begin(500, 400, 640, 512, 1000);
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 1199, false), ResizeFrameAction::Hold);
+    EXPECT_EQ(transaction.OnFrame(512, 512, 1200, false), ResizeFrameAction::Present);
+    EXPECT_FALSE(transaction.IsActive());
+
+    const auto& stats = transaction.GetStats();
+    EXPECT_EQ(stats.timedOut, 1u);
+    EXPECT_EQ(stats.completed, 0u);
+    EXPECT_EQ(stats.lastLatencyMs, 0u);
+}
+
+TEST(ResizeTransactionTests, ClockGoingBackwardsDoesNotHoldForever)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 1000);
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 900, false), ResizeFrameAction::Present);
+    EXPECT_EQ(transaction.GetStats().timedOut, 1u);
+}
+
+TEST(ResizeTransactionTests, TracksTheWorstLatency)
+{
+    ResizeTransaction transaction;
+
+    transaction.Begin(500, 400, 640, 512, 0);
+    transaction.OnFrame(640, 512, 80, true);
+    transaction.Begin(640, 512, 768, 640, 1000);
+    transaction.OnFrame(768, 640, 1020, true);
+
+    const auto& stats = transaction.GetStats();
+    EXPECT_EQ(stats.completed, 2u);
+    EXPECT_EQ(stats.lastLatencyMs, 20u);
+    EXPECT_EQ(stats.maxLatencyMs, 80u);
+}
+
+TEST(ResizeTransactionTests, CancelPresentsTheNextFrame)
+{
+    ResizeTransaction transaction;
+    transaction.Begin(500, 400, 640, 512, 0);
+    transaction.Cancel();
+
+    EXPECT_EQ(transaction.OnFrame(512, 512, 16, false), ResizeFrameAction::Present);
+    EXPECT_EQ(transaction.GetStats().heldFrames, 0u);
+}
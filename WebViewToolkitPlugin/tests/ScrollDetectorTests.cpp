@@ -0,0 +1,393 @@
+// ============================================================================
+// WebViewToolkit - ScrollDetector Tests
+// ============================================================================
+
+#include "Core/ScrollDetector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // A page taller and wider than the viewport; frames are views into it
+    struct Page
+    {
+        Page(uint32_t w, uint32_t h, uint32_t seed = 1)
+            : width(w), height(h), pixels(static_cast<size_t>(w) * h)
+        {
+            std::mt19937 rng(seed);
+            for (auto& pixel : pixels)
+            {
+                pixel = rng();
+            }
+        }
+
+        // Every pixel of these rows takes one color, like the blank gaps between paragraphs
+        void FillRows(uint32_t top, uint32_t bottom, uint32_t color)
+        {
+            std::fill(pixels.begin() + static_cast<size_t>(top) * width, pixels.begin() + static_cast<size_t>(bottom) * width, color);
+        }
+
+        uint32_t width;
+        uint32_t height;
+        std::vector<uint32_t> pixels;
+    };
+
+    struct Frame
+    {
+        Frame(uint32_t w, uint32_t h, size_t rowPadding = 0)
+            : width(w), height(h), pitch(w * 4 + rowPadding), pixels(pitch * h)
+        {
+        }
+
+        Frame(const Page& page, uint32_t left, uint32_t top, uint32_t w, uint32_t h, size_t rowPadding = 0)
+            : Frame(w, h, rowPadding)
+        {
+            for (uint32_t y = 0; y < h; y++)
+            {
+                std::memcpy(At(0, y), &page.pixels[static_cast<size_t>(top + y) * page.width + left], static_cast<size_t>(w) * 4);
+            }
+        }
+
+        uint8_t* At(uint32_t x, uint32_t y) { return &pixels[y * pitch + x * 4]; }
+        const uint8_t* At(uint32_t x, uint32_t y) const { return &pixels[y * pitch + x * 4]; }
+
+        // Pixel content only, the row padding is not part of the image
+        bool SameImage(const Frame& other) const
+        {
+            for (uint32_t y = 0; y < height; y++)
+            {
+                if (std::memcmp(At(0, y), other.At(0, y), static_cast<size_t>(width) * 4) != 0)
+                {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        uint32_t width;
+        uint32_t height;
+        size_t pitch;
+        std::vector<uint8_t> pixels;
+    };
+
+    bool Detect(ScrollDetector& detector, const Frame& frame)
+    {
+        return detector.Detect(frame.pixels.data(), frame.pitch, frame.width, frame.height);
+    }
+
+    void CopyRect(const Frame& src, int32_t srcX, int32_t srcY, Frame& dst, const PixelRect& dstRect)
+    {
+        for (int32_t y = dstRect.top; y < dstRect.bottom; y++)
+        {
+            std::memcpy(dst.At(dstRect.left, y), src.At(srcX, srcY + (y - dstRect.top)),
+                static_cast<size_t>(dstRect.right - dstRect.left) * 4);
+        }
+    }
+
+    // What the destination holds after the update: the previous frame, each
+    // move in order through a scratch copy, then the patches from the new frame
+    Frame ApplyUpdate(const ScrollDetector& detector, const Frame& previous, const Frame& current)
+    {
+        Frame result = previous;
+        for (const ScrollMove& move : detector.GetMoves())
+        {
+            const Frame scratch = result;
+            const PixelRect placed{ move.source.left + move.dx, move.source.top + move.dy,
+                move.source.right + move.dx, move.source.bottom + move.dy };
+            CopyRect(scratch, move.source.left, move.source.top, result, placed);
+        }
+        for (const PixelRect& patch : detector.GetPatches())
+        {
+            CopyRect(current, patch.left, patch.top, result, patch);
+        }
+        return result;
+    }
+
+    bool operator==(const PixelRect& a, const PixelRect& b)
+    {
+        return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+    }
+}
+
+TEST(ScrollDetectorTests, FirstFrameHasNoShift)
+{
+    Page page(64, 200);
+    ScrollDetector detector;
+
+    EXPECT_FALSE(Detect(detector, Frame(page, 0, 0, 64, 100)));
+    EXPECT_TRUE(detector.GetMoves().empty());
+    EXPECT_TRUE(detector.GetPatches().empty());
+}
+
+TEST(ScrollDetectorTests, ScrollingDownMovesContentUp)
+{
+    Page page(64, 200);
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 64, 100);
+    const Frame current(page, 0, 30, 64, 100);
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftX(), 0);
+    EXPECT_EQ(detector.GetShiftY(), -30);
+    EXPECT_EQ(detector.GetShiftedLineCount(), 70u);
+
+    ASSERT_EQ(detector.GetMoves().size(), 1u);
+    EXPECT_TRUE(detector.GetMoves()[0].source == (PixelRect{ 0, 30, 64, 100 }));
+    EXPECT_EQ(detector.GetMoves()[0].dy, -30);
+
+    // Only the exposed strip is uploaded
+    ASSERT_EQ(detector.GetPatches().size(), 1u);
+    EXPECT_TRUE(detector.GetPatches()[0] == (PixelRect{ 0, 70, 64, 100 }));
+    EXPECT_EQ(detector.GetPatchArea(), 64 * 30);
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, ScrollingUpMovesContentDown)
+{
+    Page page(64, 200);
+    ScrollDetector detector;
+    const Frame previous(page, 0, 50, 64, 100);
+    const Frame current(page, 0, 25, 64, 100);
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftY(), 25);
+
+    ASSERT_EQ(detector.GetPatches().size(), 1u);
+    EXPECT_TRUE(detector.GetPatches()[0] == (PixelRect{ 0, 0, 64, 25 }));
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, HorizontalScrollMovesColumns)
+{
+    Page page(300, 80);
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 200, 80);
+    const Frame current(page, 44, 0, 200, 80);
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftX(), -44);
+    EXPECT_EQ(detector.GetShiftY(), 0);
+
+    ASSERT_EQ(detector.GetMoves().size(), 1u);
+    EXPECT_TRUE(detector.GetMoves()[0].source == (PixelRect{ 44, 0, 200, 80 }));
+    EXPECT_EQ(detector.GetMoves()[0].dx, -44);
+    ASSERT_EQ(detector.GetPatches().size(), 1u);
+    EXPECT_TRUE(detector.GetPatches()[0] == (PixelRect{ 156, 0, 200, 80 }));
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, FixedHeaderIsLeftAlone)
+{
+    Page page(64, 300);
+    ScrollDetector detector;
+    Frame previous(page, 0, 0, 64, 120);
+    Frame current(page, 0, 40, 64, 120);
+
+    // The first 16 rows are a header that does not scroll
+    const Page header(64, 16, 9);
+    for (uint32_t y = 0; y < 16; y++)
+    {
+        std::memcpy(previous.At(0, y), &header.pixels[y * 64], 64 * 4);
+        std::memcpy(current.At(0, y), &header.pixels[y * 64], 64 * 4);
+    }
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftY(), -40);
+
+    ASSERT_EQ(detector.GetMoves().size(), 1u);
+    EXPECT_TRUE(detector.GetMoves()[0].source == (PixelRect{ 0, 56, 64, 120 }));
+    ASSERT_EQ(detector.GetPatches().size(), 1u);
+    EXPECT_TRUE(detector.GetPatches()[0] == (PixelRect{ 0, 80, 64, 120 }));
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, StickyBandSplitsTheMoveIntoOrderedBands)
+{
+    for (int32_t offset : { -24, 24 })
+    {
+        SCOPED_TRACE(offset);
+        Page page(48, 400);
+        ScrollDetector detector;
+        Frame previous(page, 0, 100, 48, 160);
+        Frame current(page, 0, static_cast<uint32_t>(100 - offset), 48, 160);
+
+        // Rows 70-80 stay put in both frames, the rest scrolls around them
+        const Page sticky(48, 10, 5);
+        for (uint32_t y = 0; y < 10; y++)
+        {
+            std::memcpy(previous.At(0, 70 + y), &sticky.pixels[y * 48], 48 * 4);
+            std::memcpy(current.At(0, 70 + y), &sticky.pixels[y * 48], 48 * 4);
+        }
+
+        Detect(detector, previous);
+        ASSERT_TRUE(Detect(detector, current));
+        EXPECT_EQ(detector.GetShiftY(), offset);
+        EXPECT_GE(detector.GetMoves().size(), 2u);
+
+        // Applied in the given order, no band reads rows an earlier one overwrote
+        EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+    }
+}
+
+TEST(ScrollDetectorTests, BlankRowsDoNotSplitTheMove)
+{
+    Page page(64, 400);
+    for (uint32_t top = 20; top < 400; top += 40)
+    {
+        page.FillRows(top, top + 12, 0xFFFFFFFFu);
+    }
+
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 64, 200);
+    const Frame current(page, 0, 17, 64, 200);
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftY(), -17);
+    EXPECT_EQ(detector.GetMoves().size(), 1u);
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, ScrollIntoBlankSpaceIsMovesOnly)
+{
+    // Below row 60 the page is blank, so the exposed strip needs no upload
+    Page page(64, 200);
+    page.FillRows(60, 200, 0xFFFFFFFFu);
+
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 64, 100);
+    const Frame current(page, 0, 30, 64, 100);
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftY(), -30);
+    EXPECT_FALSE(detector.GetMoves().empty());
+    EXPECT_TRUE(detector.GetPatches().empty());
+    EXPECT_EQ(detector.GetPatchArea(), 0);
+    EXPECT_TRUE(ApplyUpdate(detector, previous, current).SameImage(current));
+}
+
+TEST(ScrollDetectorTests, UnrelatedFrameIsNotAScroll)
+{
+    ScrollDetector detector;
+    Detect(detector, Frame(Page(64, 100, 1), 0, 0, 64, 100));
+    EXPECT_FALSE(Detect(detector, Frame(Page(64, 100, 2), 0, 0, 64, 100)));
+    EXPECT_TRUE(detector.GetMoves().empty());
+    EXPECT_TRUE(detector.GetPatches().empty());
+}
+
+TEST(ScrollDetectorTests, SmallChangeIsNotAScroll)
+{
+    Page page(64, 100);
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 64, 100);
+    Frame current = previous;
+    for (uint32_t y = 10; y < 14; y++)
+    {
+        current.At(5, y)[0] ^= 0xFF;
+    }
+
+    Detect(detector, previous);
+    EXPECT_FALSE(Detect(detector, current));
+    EXPECT_FALSE(Detect(detector, current));
+}
+
+TEST(ScrollDetectorTests, ShiftMustExplainMostChangedLines)
+{
+    Page page(64, 200);
+    ScrollDetector detector;
+    const Frame previous(page, 0, 0, 64, 100);
+
+    // 20 rows scrolled, 60 replaced: a content change, not a scroll
+    Frame current(page, 0, 20, 64, 100);
+    const Page replacement(64, 60, 3);
+    for (uint32_t y = 0; y < 60; y++)
+    {
+        std::memcpy(current.At(0, 40 + y), &replacement.pixels[y * 64], 64 * 4);
+    }
+
+    Detect(detector, previous);
+    EXPECT_FALSE(Detect(detector, current));
+}
+
+TEST(ScrollDetectorTests, RowPaddingIsIgnored)
+{
+    Page page(40, 200);
+    ScrollDetector detector;
+    Frame previous(page, 0, 0, 40, 90, 24);
+    Frame current(page, 0, 12, 40, 90, 24);
+    for (uint32_t y = 0; y < 90; y++)
+    {
+        std::memset(current.At(40, y), static_cast<int>(y), 24);
+    }
+
+    Detect(detector, previous);
+    ASSERT_TRUE(Detect(detector, current));
+    EXPECT_EQ(detector.GetShiftY(), -12);
+}
+
+TEST(ScrollDetectorTests, ResizeAndResetForgetThePreviousFrame)
+{
+    Page page(64, 300);
+    ScrollDetector detector;
+
+    Detect(detector, Frame(page, 0, 0, 64, 100));
+    EXPECT_FALSE(Detect(detector, Frame(page, 0, 20, 64, 120)));
+    EXPECT_TRUE(Detect(detector, Frame(page, 0, 40, 64, 120)));
+
+    detector.Reset();
+    EXPECT_FALSE(Detect(detector, Frame(page, 0, 60, 64, 120)));
+    EXPECT_TRUE(Detect(detector, Frame(page, 0, 80, 64, 120)));
+}
+
+TEST(ScrollDetectorTests, InvalidInputResets)
+{
+    Page page(64, 200);
+    ScrollDetector detector;
+    const Frame frame(page, 0, 0, 64, 100);
+
+    Detect(detector, frame);
+    EXPECT_FALSE(detector.Detect(nullptr, frame.pitch, 64, 100));
+    EXPECT_FALSE(detector.Detect(frame.pixels.data(), 16, 64, 100));
+    EXPECT_FALSE(Detect(detector, Frame(page, 0, 30, 64, 100)));
+}
+
+TEST(ScrollDetectorTests, SameResultOnEveryInstructionSet)
+{
+    Page page(406, 260);
+    const Frame previous(page, 0, 0, 203, 130);
+    const Frame scrolledDown(page, 0, 33, 203, 130);
+    const Frame scrolledRight(page, 21, 0, 203, 130);
+
+    for (PixelIsa isa : { PixelIsa::Scalar, PixelIsa::SSE2, PixelIsa::AVX2, PixelIsa::NEON })
+    {
+        if (!SetPixelKernelIsa(isa))
+        {
+            continue;
+        }
+        SCOPED_TRACE(GetPixelIsaName(isa));
+
+        ScrollDetector detector;
+        Detect(detector, previous);
+        ASSERT_TRUE(Detect(detector, scrolledDown));
+        EXPECT_EQ(detector.GetShiftY(), -33);
+        EXPECT_TRUE(ApplyUpdate(detector, previous, scrolledDown).SameImage(scrolledDown));
+
+        detector.Reset();
+        Detect(detector, previous);
+        ASSERT_TRUE(Detect(detector, scrolledRight));
+        EXPECT_EQ(detector.GetShiftX(), -21);
+        EXPECT_TRUE(ApplyUpdate(detector, previous, scrolledRight).SameImage(scrolledRight));
+    }
+    ResetPixelKernelIsa();
+}
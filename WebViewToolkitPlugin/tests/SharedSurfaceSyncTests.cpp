@@ -0,0 +1,413 @@
+// ============================================================================
+// WebViewToolkit - SharedSurfaceSync Tests
+// ============================================================================
+// Runs the sync state machine against a software device pair: two command
+// queues executed explicitly by the test, fences that block a queue at a
+// wait, and CPU pixel buffers. The device flags GPU hazards: a write landing
+// before an earlier-recorded read of the surface has executed, or a read
+// executing before the write it was recorded after.
+// ============================================================================
+
+#include "Core/SharedSurfaceSync.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <memory>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    struct SoftwareTexture
+    {
+        uint32_t width = 0;
+        uint32_t height = 0;
+        std::vector<uint32_t> pixels;
+
+        SoftwareTexture(uint32_t w, uint32_t h) : width(w), height(h), pixels(static_cast<size_t>(w) * h) {}
+
+        // Frame f stores f * 1000 + y in row y, so frames and flips are recognizable
+        void Fill(uint32_t frame)
+        {
+            for (uint32_t y = 0; y < height; y++)
+            {
+                for (uint32_t x = 0; x < width; x++)
+                {
+                    pixels[y * width + x] = frame * 1000 + y;
+                }
+            }
+        }
+
+        bool Holds(uint32_t frame, bool flipped) const
+        {
+            for (uint32_t y = 0; y < height; y++)
+            {
+                const uint32_t row = flipped ? height - 1 - y : y;
+                for (uint32_t x = 0; x < width; x++)
+                {
+                    if (pixels[y * width + x] != frame * 1000 + row)
+                    {
+                        return false;
+                    }
+                }
+            }
+            return true;
+        }
+    };
+
+    class SoftwareSharedSurfaceDevice final : public ISharedSurfaceDevice
+    {
+    public:
+        struct Surface
+        {
+            std::unique_ptr<SoftwareTexture> texture;
+            uint64_t recordedWrites = 0;
+            uint64_t executedWrites = 0;
+            std::multiset<uint64_t> pendingReads;  // Write generation each queued read expects
+        };
+
+        void* CreateSharedSurface(uint32_t width, uint32_t height) override
+        {
+            if (failSurfaceCreation) return nullptr;
+            auto surface = std::make_unique<Surface>();
+            surface->texture = std::make_unique<SoftwareTexture>(width, height);
+            void* handle = surface.get();
+            m_live.insert(handle);
+            m_storage.push_back(std::move(surface));
+            return handle;
+        }
+
+        void DestroySharedSurface(void* surface) override
+        {
+            ASSERT_EQ(m_live.erase(surface), 1u) << "double destroy or unknown surface";
+        }
+
+        void ProducerWait(uint64_t consumerValue) override
+        {
+            m_producer.push_back({ Command::Wait, consumerValue });
+        }
+
+        void ProducerCopy(void* surface, void* sourceTexture, FlipMode flipMode) override
+        {
+            // Capture the source now: the capture frame is recycled after this call
+            Command command{ Command::CopyIn };
+            command.surface = static_cast<Surface*>(surface);
+            command.snapshot = *static_cast<SoftwareTexture*>(sourceTexture);
+            command.flip = flipMode != FlipMode::None;
+            command.generation = ++command.surface->recordedWrites;
+            m_producer.push_back(std::move(command));
+        }
+
+        void ProducerSignal(uint64_t producerValue) override
+        {
+            m_producer.push_back({ Command::Signal, producerValue });
+        }
+
+        void ConsumerWait(uint64_t producerValue) override
+        {
+            m_consumer.push_back({ Command::Wait, producerValue });
+        }
+
+        void ConsumerCopy(void* surface, void* destinationTexture) override
+        {
+            Command command{ Command::CopyOut };
+            command.surface = static_cast<Surface*>(surface);
+            command.destination = static_cast<SoftwareTexture*>(destinationTexture);
+            command.generation = command.surface->recordedWrites;
+            command.surface->pendingReads.insert(command.generation);
+            m_consumer.push_back(std::move(command));
+        }
+
+        void ConsumerSignal(uint64_t consumerValue) override
+        {
+            m_consumer.push_back({ Command::Signal, consumerValue });
+        }
+
+        uint64_t GetConsumerCompletedValue() override
+        {
+            return m_consumerFence;
+        }
+
+        /// Execute producer commands until the queue is empty or blocked (or maxCommands ran)
+        void RunProducer(size_t maxCommands = SIZE_MAX) { Run(m_producer, m_consumerFence, m_producerFence, maxCommands); }
+        void RunConsumer(size_t maxCommands = SIZE_MAX) { Run(m_consumer, m_producerFence, m_consumerFence, maxCommands); }
+
+        void Drain()
+        {
+            while (!m_producer.empty() || !m_consumer.empty())
+            {
+                const size_t before = m_producer.size() + m_consumer.size();
+                RunProducer();
+                RunConsumer();
+                ASSERT_LT(m_producer.size() + m_consumer.size(), before) << "queues deadlocked";
+            }
+        }
+
+        size_t LiveSurfaceCount() const { return m_live.size(); }
+
+        bool failSurfaceCreation = false;
+        int hazards = 0;
+
+    private:
+        struct Command
+        {
+            enum Type { Wait, Signal, CopyIn, CopyOut } type;
+            uint64_t value = 0;
+            Surface* surface = nullptr;
+            SoftwareTexture snapshot{ 0, 0 };
+            SoftwareTexture* destination = nullptr;
+            bool flip = false;
+            uint64_t generation = 0;
+        };
+
+        void Run(std::deque<Command>& queue, uint64_t& waitFence, uint64_t& signalFence, size_t maxCommands)
+        {
+            for (size_t executed = 0; executed < maxCommands && !queue.empty(); executed++)
+            {
+                Command& command = queue.front();
+                switch (command.type)
+                {
+                case Command::Wait:
+                    if (waitFence < command.value)
+                    {
+                        return; // Blocked on the other queue
+                    }
+                    break;
+                case Command::Signal:
+                    signalFence = command.value;
+                    break;
+                case Command::CopyIn:
+                {
+                    // Write-after-read: a read recorded before this write is still queued
+                    const auto& reads = command.surface->pendingReads;
+                    if (!reads.empty() && *reads.begin() < command.generation)
+                    {
+                        hazards++;
+                    }
+                    command.surface->executedWrites = command.generation;
+                    SoftwareTexture& target = *command.surface->texture;
+                    for (uint32_t y = 0; y < target.height; y++)
+                    {
+                        const uint32_t srcY = command.flip ? target.height - 1 - y : y;
+                        std::copy_n(&command.snapshot.pixels[srcY * target.width], target.width, &target.pixels[y * target.width]);
+                    }
+                    break;
+                }
+                case Command::CopyOut:
+                    // Read-after-write: the surface must hold the write this read follows
+                    if (command.surface->executedWrites != command.generation)
+                    {
+                        hazards++;
+                    }
+                    *command.destination = *command.surface->texture;
+                    command.surface->pendingReads.erase(command.surface->pendingReads.find(command.generation));
+                    break;
+                }
+                queue.pop_front();
+            }
+        }
+
+        std::deque<Command> m_producer;
+        std::deque<Command> m_consumer;
+        uint64_t m_producerFence = 0;
+        uint64_t m_consumerFence = 0;
+
+        std::set<void*> m_live;
+        std::vector<std::unique_ptr<Surface>> m_storage;
+    };
+}
+
+TEST(SharedSurfaceSyncTests, FrameReachesDestinationFlipped)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device);
+    SoftwareTexture source(4, 3), destination(4, 3);
+
+    source.Fill(7);
+    ASSERT_TRUE(sync.Publish(&source, 4, 3, FlipMode::SinglePass));
+    EXPECT_TRUE(sync.HasPendingFrame());
+    ASSERT_TRUE(sync.ConsumeLatest(&destination));
+    EXPECT_FALSE(sync.HasPendingFrame());
+
+    device.Drain();
+    EXPECT_TRUE(destination.Holds(7, true));
+    EXPECT_EQ(device.GetConsumerCompletedValue(), 1u);
+    EXPECT_EQ(device.hazards, 0);
+}
+
+TEST(SharedSurfaceSyncTests, ConsumerWaitsForProducerOnTheGpu)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device);
+    SoftwareTexture source(2, 2), destination(2, 2);
+
+    source.Fill(1);
+    ASSERT_TRUE(sync.Publish(&source, 2, 2, FlipMode::None));
+    ASSERT_TRUE(sync.ConsumeLatest(&destination));
+
+    // The producer has not run yet: the consumer must not read a stale surface
+    device.RunConsumer();
+    EXPECT_FALSE(destination.Holds(1, false));
+
+    device.RunProducer();
+    device.RunConsumer();
+    EXPECT_TRUE(destination.Holds(1, false));
+}
+
+TEST(SharedSurfaceSyncTests, ProducerNeverOverwritesASurfaceBeingRead)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device, 2);
+    SoftwareTexture source(2, 2), destination(2, 2);
+
+    // The consumer GPU stalls completely while frames keep coming
+    for (uint32_t frame = 1; frame <= 6; frame++)
+    {
+        source.Fill(frame);
+        ASSERT_TRUE(sync.Publish(&source, 2, 2, FlipMode::None));
+        ASSERT_TRUE(sync.ConsumeLatest(&destination));
+        device.RunProducer();
+    }
+
+    EXPECT_GT(sync.GetStats().producerWaits, 0u);
+    device.Drain();
+    EXPECT_EQ(device.hazards, 0);
+    EXPECT_TRUE(destination.Holds(6, false));
+}
+
+TEST(SharedSurfaceSyncTests, ConsumeTakesNewestAndDropsOlder)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device, 3);
+    SoftwareTexture source(2, 2), destination(2, 2);
+
+    for (uint32_t frame = 1; frame <= 3; frame++)
+    {
+        source.Fill(frame);
+        ASSERT_TRUE(sync.Publish(&source, 2, 2, FlipMode::None));
+    }
+    ASSERT_TRUE(sync.ConsumeLatest(&destination));
+    EXPECT_FALSE(sync.ConsumeLatest(&destination));
+
+    device.Drain();
+    EXPECT_TRUE(destination.Holds(3, false));
+    EXPECT_EQ(sync.GetStats().dropped, 2u);
+    EXPECT_EQ(sync.GetStats().consumed, 1u);
+}
+
+TEST(SharedSurfaceSyncTests, FullRingOfUnconsumedFramesRecyclesOldest)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device, 2);
+    SoftwareTexture source(2, 2), destination(2, 2);
+
+    for (uint32_t frame = 1; frame <= 5; frame++)
+    {
+        source.Fill(frame);
+        ASSERT_TRUE(sync.Publish(&source, 2, 2, FlipMode::None));
+    }
+
+    EXPECT_EQ(sync.GetStats().surfacesCreated, 2u);
+    EXPECT_EQ(sync.GetStats().producerWaits, 0u);
+    ASSERT_TRUE(sync.ConsumeLatest(&destination));
+    device.Drain();
+    EXPECT_TRUE(destination.Holds(5, false));
+}
+
+TEST(SharedSurfaceSyncTests, RandomInterleavingsStayCoherent)
+{
+    std::mt19937 rng(42);
+
+    for (uint32_t depth : { 1u, 2u, 3u })
+    {
+        SoftwareSharedSurfaceDevice device;
+        SharedSurfaceSync sync(&device, depth);
+        SoftwareTexture source(3, 5), destination(3, 5);
+
+        uint32_t published = 0;
+        uint32_t lastConsumed = 0;
+        for (int step = 0; step < 2000; step++)
+        {
+            switch (rng() % 4)
+            {
+            case 0:
+                source.Fill(++published);
+                ASSERT_TRUE(sync.Publish(&source, 3, 5, FlipMode::RowCopy));
+                break;
+            case 1:
+                if (sync.ConsumeLatest(&destination))
+                {
+                    lastConsumed = published;
+                }
+                break;
+            case 2:
+                device.RunProducer(rng() % 4);
+                break;
+            case 3:
+                device.RunConsumer(rng() % 4);
+                break;
+            }
+        }
+
+        if (sync.ConsumeLatest(&destination))
+        {
+            lastConsumed = published;
+        }
+        device.Drain();
+
+        EXPECT_EQ(device.hazards, 0) << "depth " << depth;
+        if (lastConsumed != 0)
+        {
+            EXPECT_TRUE(destination.Holds(lastConsumed, true)) << "depth " << depth;
+        }
+    }
+}
+
+TEST(SharedSurfaceSyncTests, ResizeRecreatesSurfaces)
+{
+    SoftwareSharedSurfaceDevice device;
+    SharedSurfaceSync sync(&device, 2);
+    SoftwareTexture small(2, 2), large(4, 4), destination(4, 4);
+
+    ASSERT_TRUE(sync.Publish(&small, 2, 2, FlipMode::None));
+    device.Drain();
+    ASSERT_TRUE(sync.Publish(&large, 4, 4, FlipMode::None));
+
+    EXPECT_EQ(device.LiveSurfaceCount(), 1u);
+    EXPECT_EQ(sync.GetWidth(), 4u);
+    ASSERT_TRUE(sync.ConsumeLatest(&destination));
+    device.Drain();
+    EXPECT_EQ(destination.width, 4u);
+}
+
+TEST(SharedSurfaceSyncTests, SurfaceCreationFailureIsReported)
+{
+    SoftwareSharedSurfaceDevice device;
+    device.failSurfaceCreation = true;
+    SharedSurfaceSync sync(&device);
+    SoftwareTexture source(2, 2), destination(2, 2);
+
+    EXPECT_FALSE(sync.Publish(&source, 2, 2, FlipMode::None));
+    EXPECT_FALSE(sync.HasPendingFrame());
+    EXPECT_FALSE(sync.ConsumeLatest(&destination));
+    EXPECT_EQ(sync.GetProducerValue(), 0u);
+}
+
+TEST(SharedSurfaceSyncTests, DestructionReleasesAllSurfaces)
+{
+    SoftwareSharedSurfaceDevice device;
+    {
+        SharedSurfaceSync sync(&device, 3);
+        SoftwareTexture source(2, 2);
+        for (int i = 0; i < 4; i++)
+        {
+            ASSERT_TRUE(sync.Publish(&source, 2, 2, FlipMode::None));
+        }
+        EXPECT_EQ(device.LiveSurfaceCount(), 3u);
+    }
+    EXPECT_EQ(device.LiveSurfaceCount(), 0u);
+}
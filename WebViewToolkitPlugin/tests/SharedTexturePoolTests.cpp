@@ -0,0 +1,288 @@
+// ============================================================================
+// WebViewToolkit - SharedTexturePool Tests
+// ============================================================================
+
+#include "Core/SharedTexturePool.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    class FakeTextureFactory final : public ISharedTextureFactory
+    {
+    public:
+        struct Texture { uint32_t width; uint32_t height; };
+
+        void* CreateTexture(uint32_t width, uint32_t height) override
+        {
+            if (failCreation > 0)
+            {
+                failCreation--;
+                return nullptr;
+            }
+            auto texture = std::make_unique<Texture>(Texture{ width, height });
+            void* handle = texture.get();
+            m_live[handle] = std::move(texture);
+            return handle;
+        }
+
+        void DestroyTexture(void* texture) override
+        {
+            ASSERT_EQ(m_live.erase(texture), 1u) << "double destroy or unknown texture";
+            destroyed++;
+        }
+
+        size_t LiveCount() const { return m_live.size(); }
+        const Texture& Get(void* texture) const { return *m_live.at(texture); }
+
+        int failCreation = 0;
+        int destroyed = 0;
+
+    private:
+        std::map<void*, std::unique_ptr<Texture>> m_live;
+    };
+
+    constexpr uint64_t TextureBytes(uint32_t width, uint32_t height)
+    {
+        return static_cast<uint64_t>(width) * height * SharedTexturePool::BytesPerTexel;
+    }
+}
+
+TEST(SharedTexturePoolTests, RoundsUpToBuckets)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    EXPECT_EQ(pool.RoundUp(0), 64u);
+    EXPECT_EQ(pool.RoundUp(1), 64u);
+    EXPECT_EQ(pool.RoundUp(64), 64u);
+    EXPECT_EQ(pool.RoundUp(65), 128u);
+    EXPECT_EQ(pool.RoundUp(1024), 1024u);
+    EXPECT_EQ(pool.RoundUp(1025), 1152u);
+    EXPECT_EQ(pool.RoundUp(1920), 1920u);
+    EXPECT_EQ(pool.RoundUp(1921), 2048u);
+}
+
+TEST(SharedTexturePoolTests, AcquireAllocatesTheRoundedSize)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    void* texture = pool.Acquire(300, 200);
+    ASSERT_NE(texture, nullptr);
+    EXPECT_EQ(factory.Get(texture).width, 320u);
+    EXPECT_EQ(factory.Get(texture).height, 256u);
+
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(pool.GetAllocatedSize(texture, width, height));
+    EXPECT_EQ(width, 320u);
+    EXPECT_EQ(height, 256u);
+    EXPECT_EQ(pool.GetStats().created, 1u);
+    EXPECT_EQ(pool.GetStats().liveCount, 1u);
+}
+
+TEST(SharedTexturePoolTests, AnimatedResizeWithinTheSlackKeepsTheTexture)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+    void* texture = pool.Acquire(400, 300);
+
+    // A panel animating between 300 and 448 texels wide never reallocates
+    for (uint32_t width = 300; width <= 448; width += 4)
+    {
+        EXPECT_TRUE(pool.ResizeInPlace(texture, width, 300)) << width;
+    }
+    EXPECT_EQ(pool.GetStats().created, 1u);
+    EXPECT_EQ(factory.LiveCount(), 1u);
+}
+
+TEST(SharedTexturePoolTests, ResizeInPlaceRefusesGrowthAndLargeShrinks)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+    void* texture = pool.Acquire(512, 512);
+
+    EXPECT_FALSE(pool.ResizeInPlace(texture, 513, 512));   // Does not fit
+    EXPECT_TRUE(pool.ResizeInPlace(texture, 256, 512));    // 512 - 256 within the slack
+    EXPECT_FALSE(pool.ResizeInPlace(texture, 192, 512));   // 512 - 192 is not
+    EXPECT_FALSE(pool.ResizeInPlace(nullptr, 64, 64));
+    EXPECT_EQ(pool.GetStats().resizedInPlace, 1u);
+}
+
+TEST(SharedTexturePoolTests, ReleasedTexturesAreReused)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    void* first = pool.Acquire(640, 480);
+    ASSERT_TRUE(pool.Release(first));
+    EXPECT_EQ(pool.GetStats().idleCount, 1u);
+    EXPECT_EQ(pool.GetStats().idleBytes, TextureBytes(640, 512));
+
+    void* second = pool.Acquire(600, 470);
+    EXPECT_EQ(second, first);
+    EXPECT_EQ(pool.GetStats().reused, 1u);
+    EXPECT_EQ(pool.GetStats().created, 1u);
+    EXPECT_EQ(pool.GetStats().idleBytes, 0u);
+}
+
+TEST(SharedTexturePoolTests, AcquirePrefersTheSmallestFittingIdleTexture)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    void* large = pool.Acquire(512, 512);
+    void* small = pool.Acquire(384, 384);
+    pool.Release(small);
+    pool.Release(large);
+
+    EXPECT_EQ(pool.Acquire(320, 320), small);
+    EXPECT_EQ(pool.Acquire(320, 320), large);
+}
+
+TEST(SharedTexturePoolTests, IdleTexturesFarTooLargeAreNotReused)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    void* large = pool.Acquire(1920, 1080);
+    pool.Release(large);
+
+    void* small = pool.Acquire(200, 100);
+    EXPECT_NE(small, large);
+    EXPECT_EQ(factory.Get(small).width, 256u);
+    EXPECT_EQ(pool.GetStats().created, 2u);
+}
+
+TEST(SharedTexturePoolTests, IdleBytesAreCappedOldestFirst)
+{
+    FakeTextureFactory factory;
+    SharedTexturePoolSettings settings;
+    settings.maxIdleBytes = 2 * TextureBytes(256, 256);
+    SharedTexturePool pool(&factory, settings);
+
+    void* textures[3];
+    for (auto& texture : textures)
+    {
+        texture = pool.Acquire(256, 256);
+    }
+    for (auto* texture : textures)
+    {
+        pool.Release(texture);
+    }
+
+    EXPECT_EQ(factory.destroyed, 1);
+    EXPECT_EQ(factory.LiveCount(), 2u);
+    EXPECT_EQ(pool.GetStats().idleCount, 2u);
+    EXPECT_LE(pool.GetStats().idleBytes, settings.maxIdleBytes);
+
+    // The oldest release went; the newest is handed out first
+    EXPECT_EQ(pool.Acquire(256, 256), textures[2]);
+    EXPECT_EQ(pool.Acquire(256, 256), textures[1]);
+}
+
+TEST(SharedTexturePoolTests, ReleaseRejectsForeignTextures)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    int foreign = 0;
+    EXPECT_FALSE(pool.Release(&foreign));
+
+    void* texture = pool.Acquire(64, 64);
+    EXPECT_TRUE(pool.Release(texture));
+    EXPECT_FALSE(pool.Release(texture));
+}
+
+TEST(SharedTexturePoolTests, FailedCreationTrimsIdleTexturesAndRetries)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    pool.Release(pool.Acquire(128, 128));
+    factory.failCreation = 1;
+
+    void* texture = pool.Acquire(1024, 1024);
+    EXPECT_NE(texture, nullptr);
+    EXPECT_EQ(pool.GetStats().idleCount, 0u);
+    EXPECT_EQ(factory.destroyed, 1);
+
+    factory.failCreation = 2;
+    EXPECT_EQ(pool.Acquire(2048, 2048), nullptr);
+    EXPECT_EQ(pool.GetStats().liveCount, 1u);
+}
+
+TEST(SharedTexturePoolTests, ResetDestroysIdleAndForgetsLiveTextures)
+{
+    FakeTextureFactory factory;
+    SharedTexturePool pool(&factory);
+
+    void* live = pool.Acquire(256, 256);
+    pool.Release(pool.Acquire(512, 512));
+    pool.Reset();
+
+    EXPECT_EQ(factory.destroyed, 1);
+    EXPECT_EQ(pool.GetStats().idleCount, 0u);
+    EXPECT_EQ(pool.GetStats().liveCount, 0u);
+    EXPECT_FALSE(pool.Release(live));
+}
+
+TEST(SharedTexturePoolTests, ChurnNeverLeaksOrExceedsTheCap)
+{
+    FakeTextureFactory factory;
+    SharedTexturePoolSettings settings;
+    settings.maxIdleBytes = 16ull << 20;
+    SharedTexturePool pool(&factory, settings);
+
+    std::mt19937 rng(13);
+    std::uniform_int_distribution<uint32_t> size(1, 1600);
+    std::uniform_int_distribution<int> action(0, 2);
+    std::vector<void*> views(8, nullptr);
+
+    for (int step = 0; step < 5000; step++)
+    {
+        void*& view = views[step % views.size()];
+        const uint32_t width = size(rng);
+        const uint32_t height = size(rng);
+
+        if (!view)
+        {
+            view = pool.Acquire(width, height);
+            ASSERT_NE(view, nullptr);
+        }
+        else if (action(rng) == 0)
+        {
+            ASSERT_TRUE(pool.Release(view));
+            view = nullptr;
+        }
+        else if (!pool.ResizeInPlace(view, width, height))
+        {
+            // As the backends resize: the old texture goes back before the new one is taken
+            ASSERT_TRUE(pool.Release(view));
+            view = pool.Acquire(width, height);
+            ASSERT_NE(view, nullptr);
+        }
+
+        if (view)
+        {
+            const auto& texture = factory.Get(view);
+            uint32_t allocatedWidth = 0, allocatedHeight = 0;
+            ASSERT_TRUE(pool.GetAllocatedSize(view, allocatedWidth, allocatedHeight));
+            ASSERT_EQ(texture.width, allocatedWidth);
+            ASSERT_EQ(texture.height, allocatedHeight);
+        }
+        ASSERT_LE(pool.GetStats().idleBytes, settings.maxIdleBytes);
+        ASSERT_EQ(factory.LiveCount(), pool.GetStats().liveCount + pool.GetStats().idleCount);
+    }
+
+    pool.Trim();
+    EXPECT_EQ(factory.LiveCount(), pool.GetStats().liveCount);
+    EXPECT_GT(pool.GetStats().reused + pool.GetStats().resizedInPlace, 0u);
+}
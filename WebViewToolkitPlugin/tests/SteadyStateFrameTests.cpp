@@ -0,0 +1,339 @@
+// ============================================================================
+// WebViewToolkit - Steady-State Frame Budget Tests
+// ============================================================================
+// Drives the portable parts of a render event through a mock backend, the
+// way the D3D backends do once no view is created or resized, and checks
+// that a frame does no heap allocation, no QueryInterface and creates no
+// device object. The first frames may allocate while buffers warm up.
+// ============================================================================
+
+#include "Core/CopyBatch.h"
+#include "Core/DirtyRegion.h"
+#include "Core/FrameDrain.h"
+#include "Core/FrameHandoff.h"
+#include "Core/FrameResourceCounters.h"
+#include "Core/FrameVersionTable.h"
+#include "Core/GpuFence.h"
+#include "Core/MirrorRegistry.h"
+#include "Core/ReadbackRing.h"
+#include "Core/ScrollDetector.h"
+#include "Core/SurfaceTextureCache.h"
+#include "Core/TileChangeDetector.h"
+#include "Core/UploadRingAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Every allocation of this test binary is counted on its thread
+void* operator new(std::size_t size)
+{
+    WebViewToolkit::FrameResourceCounters::CountAllocation();
+    if (void* p = std::malloc(size ? size : 1))
+    {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+void operator delete[](void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    constexpr uint32_t Width = 256;
+    constexpr uint32_t Height = 128;
+    constexpr uint32_t SurfaceCount = 3;
+
+    enum class FrameContent
+    {
+        DirtyRects,     // Capture reports dirty rectangles
+        TileDetected,   // No metadata, one pixel changes per frame
+        Scrolling,      // No metadata, the content moves up three rows per frame
+    };
+
+    // Backend double: device objects come from fixed arrays, and every
+    // creation or interface query is counted like the real backends do
+    class MockBackend final : public IReadbackDevice, public ISurfaceTextureResolver, public ICopyBatchRecorder,
+        public IFrameReleaser, public IGpuFence
+    {
+    public:
+        // IReadbackDevice
+        void* CreateStagingTexture(uint32_t, uint32_t) override
+        {
+            FrameResourceCounters::CountObjectCreation();
+            return &m_staging[m_stagingCount++ % 8];
+        }
+        void DestroyStagingTexture(void*) override {}
+        void* CreateCompletionQuery() override
+        {
+            FrameResourceCounters::CountObjectCreation();
+            return &m_queries[m_queryCount++ % 8];
+        }
+        void DestroyCompletionQuery(void*) override {}
+        void CopyToStaging(void*, void*, void* query) override { *static_cast<uint64_t*>(query) = ++m_submitted; }
+        bool IsCopyComplete(void* query) override { return *static_cast<uint64_t*>(query) <= m_completed; }
+
+        // ISurfaceTextureResolver
+        void* ResolveTexture(void* surface) override
+        {
+            FrameResourceCounters::CountQueryInterface();
+            return static_cast<char*>(surface) + 1;
+        }
+        void ReleaseEntry(void*, void*) override {}
+
+        // ICopyBatchRecorder
+        void BeginAccess(void* const*, uint32_t) override {}
+        void RecordCopy(const CopyBatchEntry&) override { copies++; }
+        void EndAccess(void* const*, uint32_t) override {}
+        void Flush() override {}
+
+        // IFrameReleaser
+        void ReleaseFrame(void*, void*) override { released++; }
+
+        // IGpuFence
+        uint64_t Signal() override { return ++m_fenceValue; }
+        uint64_t GetCompletedValue() override { return m_fenceValue; }
+        void Wait(uint64_t) override {}
+
+        void AdvanceGpu() { m_completed = m_submitted; }
+
+        uint64_t copies = 0;
+        uint64_t released = 0;
+
+    private:
+        uint64_t m_staging[8] = {};
+        uint64_t m_queries[8] = {};
+        uint32_t m_stagingCount = 0;
+        uint32_t m_queryCount = 0;
+        uint64_t m_submitted = 0;
+        uint64_t m_completed = 0;
+        uint64_t m_fenceValue = 0;
+    };
+
+    struct MockFrame
+    {
+        void* surface = nullptr;
+        explicit operator bool() const { return surface != nullptr; }
+    };
+
+    // One view: captured, copied through the readback ring, fanned out to a
+    // mirror, handed off and versioned
+    class FrameLoop
+    {
+    public:
+        FrameLoop()
+            : m_ring(&m_backend)
+            , m_surfaces(&m_backend)
+            , m_uploads(&m_backend, 4u * Width * Height * 4u)
+            , m_handoff(&m_backend)
+            , m_pixels(Width * Height, 0u)
+        {
+            for (size_t i = 0; i < m_pixels.size(); i++)
+            {
+                m_pixels[i] = static_cast<uint32_t>(i * 2654435761u);
+            }
+            m_versions.Register(1);
+            m_mirrors.Add(&m_mirrorTexture, Width / 2, Height / 2, Width / 2, Height / 2);
+        }
+
+        void RunFrame(FrameContent content)
+        {
+            const bool withDirtyRects = content == FrameContent::DirtyRects;
+
+            // Capture: two frames queued, the newest wins
+            m_queued = 2;
+            const MockFrame frame = DrainFrames(FrameDrainMode::Latest,
+                [this]() { return NextFrame(); },
+                [](MockFrame&) {},
+                m_counters);
+            ASSERT_TRUE(frame);
+
+            void* texture = m_surfaces.Get(frame.surface);
+            ASSERT_NE(texture, nullptr);
+
+            // Mirrors
+            m_mirrors.PlanFanOut(Width, Height, true, m_mirrorCopies);
+            for (const MirrorCopy& copy : m_mirrorCopies)
+            {
+                m_batch.Submit(CopyBatchEntry{ texture, copy.texture, nullptr, 0 }, m_backend);
+            }
+
+            // Readback ring with dirty-region or tile-based uploads
+            m_frame++;
+            if (content == FrameContent::Scrolling)
+            {
+                std::rotate(m_pixels.begin(), m_pixels.begin() + Width * 3, m_pixels.end());
+            }
+            else
+            {
+                m_pixels[(m_frame * 97) % m_pixels.size()] = static_cast<uint32_t>(m_frame);
+            }
+            ASSERT_TRUE(m_ring.Submit(texture, Width, Height));
+            const PixelRect dirty{ 0, 0, 32, static_cast<int32_t>(8 + m_frame % 8) };
+            m_history.Record(m_ring.GetLastSubmittedSequence(), withDirtyRects ? &dirty : nullptr, withDirtyRects ? 1 : 0);
+            m_backend.AdvanceGpu();
+
+            if (const ReadbackSlot* slot = m_ring.AcquireLatest())
+            {
+                const auto* pixels = reinterpret_cast<const uint8_t*>(m_pixels.data());
+                const bool scrolled = m_scroll.Detect(pixels, Width * 4u, Width, Height);
+                if (m_history.Collect(m_lastUploaded, slot->sequence, m_dirtyScratch))
+                {
+                    m_coalescer.Coalesce(m_dirtyScratch.data(), m_dirtyScratch.size(), Width, Height);
+                }
+                else
+                {
+                    const auto& tiles = m_tiles.Detect(pixels, Width * 4u, Width, Height);
+                    m_coalescer.Coalesce(tiles.data(), tiles.size(), Width, Height);
+                }
+                if (scrolled)
+                {
+                    const auto& patches = m_scroll.GetPatches();
+                    m_coalescer.Coalesce(patches.data(), patches.size(), Width, Height);
+                    scrolledFrames++;
+                }
+                m_history.DiscardThrough(slot->sequence);
+                m_lastUploaded = slot->sequence;
+
+                uint64_t offset = 0;
+                ASSERT_TRUE(m_uploads.Allocate(Width * Height * 4u, 512, offset));
+                m_batch.Submit(CopyBatchEntry{ nullptr, &m_unityTexture, nullptr, 1 }, m_backend);
+                m_ring.Release(slot);
+            }
+
+            // One submission for the render event
+            m_batch.Begin();
+            m_batch.End(m_backend);
+            m_uploads.Submit();
+            m_uploads.Reclaim();
+
+            // Zero-copy handoff and consumer side
+            m_handoff.Collect();
+            m_handoff.Publish(frame.surface, texture, Width, Height);
+            m_handoff.Acquire();
+
+            m_counters.RecordPresented();
+            m_versions.Publish(1, m_frame);
+        }
+
+        uint64_t scrolledFrames = 0;
+
+    private:
+        MockFrame NextFrame()
+        {
+            if (m_queued == 0)
+            {
+                return MockFrame{};
+            }
+            m_queued--;
+            m_nextSurface = (m_nextSurface + 1) % SurfaceCount;
+            return MockFrame{ &m_surfaceStorage[m_nextSurface] };
+        }
+
+        MockBackend m_backend;
+        ReadbackRing m_ring;
+        SurfaceTextureCache m_surfaces;
+        UploadRingAllocator m_uploads;
+        FrameHandoff m_handoff;
+        DirtyRegionHistory m_history;
+        DirtyRegionCoalescer m_coalescer;
+        TileChangeDetector m_tiles;
+        ScrollDetector m_scroll;
+        CopyBatch m_batch;
+        MirrorRegistry m_mirrors;
+        FrameVersionTable m_versions;
+        CaptureFrameCounters m_counters;
+
+        std::vector<uint32_t> m_pixels;
+        std::vector<PixelRect> m_dirtyScratch;
+        std::vector<MirrorCopy> m_mirrorCopies;
+        uint64_t m_surfaceStorage[SurfaceCount * 2] = {};
+        uint64_t m_mirrorTexture = 0;
+        uint64_t m_unityTexture = 0;
+        uint32_t m_nextSurface = 0;
+        uint32_t m_queued = 0;
+        uint64_t m_frame = 0;
+        uint64_t m_lastUploaded = 0;
+    };
+
+    void ExpectSteadyStateWithinBudget(FrameContent content)
+    {
+        auto loop = std::make_unique<FrameLoop>();
+
+        // Warm-up: staging textures, surface lookups and scratch buffers
+        for (int i = 0; i < 16; i++)
+        {
+            loop->RunFrame(content);
+        }
+
+        FrameResourceMonitor monitor;
+        for (int i = 0; i < 200; i++)
+        {
+            monitor.BeginFrame();
+            loop->RunFrame(content);
+            monitor.EndFrame();
+        }
+
+        const FrameResourceStats stats = monitor.GetStats();
+        EXPECT_EQ(stats.frames, 200u);
+        EXPECT_EQ(stats.totalAllocations, 0u);
+        EXPECT_EQ(stats.totalQueryInterfaces, 0u);
+        EXPECT_EQ(stats.totalObjectCreations, 0u);
+        EXPECT_EQ(stats.framesOverBudget, 0u);
+        EXPECT_EQ(loop->scrolledFrames > 0, content == FrameContent::Scrolling);
+    }
+}
+
+TEST(SteadyStateFrameTests, OperatorNewIsCounted)
+{
+    FrameResourceMonitor monitor;
+    monitor.BeginFrame();
+    auto value = std::make_unique<int>(1);
+    std::vector<int> values(16);
+    monitor.EndFrame();
+
+    EXPECT_EQ(monitor.GetStats().lastAllocations, 2u);
+}
+
+TEST(SteadyStateFrameTests, DirtyRegionFramesStayWithinBudget)
+{
+    ExpectSteadyStateWithinBudget(FrameContent::DirtyRects);
+}
+
+TEST(SteadyStateFrameTests, TileDetectedFramesStayWithinBudget)
+{
+    ExpectSteadyStateWithinBudget(FrameContent::TileDetected);
+}
+
+TEST(SteadyStateFrameTests, ScrolledFramesStayWithinBudget)
+{
+    ExpectSteadyStateWithinBudget(FrameContent::Scrolling);
+}
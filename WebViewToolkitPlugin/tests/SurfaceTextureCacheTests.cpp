@@ -0,0 +1,130 @@
+// ============================================================================
+// WebViewToolkit - SurfaceTextureCache Tests
+// ============================================================================
+
+#include "Core/SurfaceTextureCache.h"
+
+#include <gtest/gtest.h>
+
+#include <map>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // Surfaces are small integers; a surface's texture is surface + 100
+    class FakeResolver final : public ISurfaceTextureResolver
+    {
+    public:
+        void* ResolveTexture(void* surface) override
+        {
+            resolves++;
+            const uintptr_t id = reinterpret_cast<uintptr_t>(surface);
+            if (id == failingSurface)
+            {
+                return nullptr;
+            }
+            references[id]++;
+            return reinterpret_cast<void*>(id + 100);
+        }
+
+        void ReleaseEntry(void* surface, void* texture) override
+        {
+            const uintptr_t id = reinterpret_cast<uintptr_t>(surface);
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(texture), id + 100);
+            EXPECT_GT(references[id], 0);
+            references[id]--;
+        }
+
+        int LiveReferences() const
+        {
+            int live = 0;
+            for (const auto& pair : references)
+            {
+                live += pair.second;
+            }
+            return live;
+        }
+
+        std::map<uintptr_t, int> references;
+        int resolves = 0;
+        uintptr_t failingSurface = 0;
+    };
+
+    void* Surface(uintptr_t id)
+    {
+        return reinterpret_cast<void*>(id);
+    }
+}
+
+TEST(SurfaceTextureCacheTests, EachSurfaceIsResolvedOnce)
+{
+    FakeResolver resolver;
+    SurfaceTextureCache cache(&resolver);
+
+    for (int lap = 0; lap < 10; lap++)
+    {
+        for (uintptr_t id = 1; id <= 3; id++)
+        {
+            EXPECT_EQ(cache.Get(Surface(id)), Surface(id + 100));
+        }
+    }
+
+    EXPECT_EQ(resolver.resolves, 3);
+    EXPECT_EQ(cache.GetStats().misses, 3u);
+    EXPECT_EQ(cache.GetStats().hits, 27u);
+    EXPECT_EQ(cache.GetCount(), 3u);
+}
+
+TEST(SurfaceTextureCacheTests, OldestEntryIsReplacedWhenFull)
+{
+    FakeResolver resolver;
+    SurfaceTextureCache cache(&resolver);
+
+    for (uintptr_t id = 1; id <= SurfaceTextureCache::Capacity + 1; id++)
+    {
+        cache.Get(Surface(id));
+    }
+
+    EXPECT_EQ(cache.GetStats().evictions, 1u);
+    EXPECT_EQ(resolver.references[1], 0);
+    EXPECT_EQ(resolver.LiveReferences(), static_cast<int>(SurfaceTextureCache::Capacity));
+
+    // Surface 1 has to be resolved again
+    const int resolves = resolver.resolves;
+    cache.Get(Surface(1));
+    EXPECT_EQ(resolver.resolves, resolves + 1);
+}
+
+TEST(SurfaceTextureCacheTests, FailedResolveIsNotCached)
+{
+    FakeResolver resolver;
+    resolver.failingSurface = 2;
+    SurfaceTextureCache cache(&resolver);
+
+    EXPECT_EQ(cache.Get(Surface(2)), nullptr);
+    EXPECT_EQ(cache.Get(Surface(2)), nullptr);
+    EXPECT_EQ(resolver.resolves, 2);
+    EXPECT_EQ(cache.GetCount(), 0u);
+
+    EXPECT_EQ(cache.Get(nullptr), nullptr);
+    EXPECT_EQ(resolver.resolves, 2);
+}
+
+TEST(SurfaceTextureCacheTests, ClearAndDestructionReleaseEveryEntry)
+{
+    FakeResolver resolver;
+    {
+        SurfaceTextureCache cache(&resolver);
+        cache.Get(Surface(1));
+        cache.Get(Surface(2));
+
+        cache.Clear();
+        EXPECT_EQ(resolver.LiveReferences(), 0);
+        EXPECT_EQ(cache.GetCount(), 0u);
+
+        cache.Get(Surface(3));
+        EXPECT_EQ(resolver.LiveReferences(), 1);
+    }
+    EXPECT_EQ(resolver.LiveReferences(), 0);
+}
@@ -0,0 +1,177 @@
+// ============================================================================
+// WebViewToolkit - TileChangeDetector Tests
+// ============================================================================
+
+#include "Core/TileChangeDetector.h"
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <random>
+#include <vector>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    struct Frame
+    {
+        Frame(uint32_t w, uint32_t h, size_t rowPadding = 0)
+            : width(w), height(h), pitch(w * 4 + rowPadding), pixels(pitch * h)
+        {
+            std::mt19937 rng(w * 31 + h);
+            for (auto& byte : pixels)
+            {
+                byte = static_cast<uint8_t>(rng());
+            }
+        }
+
+        uint8_t* At(uint32_t x, uint32_t y) { return &pixels[y * pitch + x * 4]; }
+
+        uint32_t width;
+        uint32_t height;
+        size_t pitch;
+        std::vector<uint8_t> pixels;
+    };
+
+    bool operator==(const PixelRect& a, const PixelRect& b)
+    {
+        return a.left == b.left && a.top == b.top && a.right == b.right && a.bottom == b.bottom;
+    }
+
+    const std::vector<PixelRect>& Detect(TileChangeDetector& detector, const Frame& frame)
+    {
+        return detector.Detect(frame.pixels.data(), frame.pitch, frame.width, frame.height);
+    }
+}
+
+TEST(TileChangeDetectorTests, FirstFrameIsFullyChanged)
+{
+    Frame frame(200, 100);
+    TileChangeDetector detector(64);
+
+    const auto& changed = Detect(detector, frame);
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_TRUE(changed[0] == (PixelRect{ 0, 0, 200, 100 }));
+    EXPECT_TRUE(detector.IsFullFrame());
+    EXPECT_EQ(detector.GetTileCount(), 4u * 2u);
+    EXPECT_EQ(detector.GetChangedTileCount(), 8u);
+}
+
+TEST(TileChangeDetectorTests, IdenticalFrameReportsNothing)
+{
+    Frame frame(200, 100);
+    TileChangeDetector detector(64);
+    Detect(detector, frame);
+
+    EXPECT_TRUE(Detect(detector, frame).empty());
+    EXPECT_FALSE(detector.IsFullFrame());
+    EXPECT_EQ(detector.GetChangedTileCount(), 0u);
+}
+
+TEST(TileChangeDetectorTests, EverySinglePixelChangeIsDetected)
+{
+    // Walks one flipped bit over every pixel position of a tile, covering
+    // every lane and the scalar tail of a partial edge tile
+    Frame frame(72, 20);
+    TileChangeDetector detector(64);
+    Detect(detector, frame);
+
+    for (uint32_t y = 0; y < frame.height; y++)
+    {
+        for (uint32_t x = 0; x < frame.width; x++)
+        {
+            frame.At(x, y)[(x + y) % 4] ^= 0x10;
+            const auto& changed = Detect(detector, frame);
+            ASSERT_EQ(changed.size(), 1u) << x << "," << y;
+
+            const int32_t left = x < 64 ? 0 : 64;
+            const int32_t right = x < 64 ? 64 : 72;
+            EXPECT_TRUE(changed[0] == (PixelRect{ left, 0, right, 20 })) << x << "," << y;
+        }
+    }
+}
+
+TEST(TileChangeDetectorTests, AdjacentTilesMergeIntoRuns)
+{
+    Frame frame(256, 192);
+    TileChangeDetector detector(64);
+    Detect(detector, frame);
+
+    // Tiles (1,0), (2,0) form a run; (1,1), (2,1) stack under it; (0,2) is separate
+    frame.At(70, 5)[0] ^= 1;
+    frame.At(130, 60)[1] ^= 1;
+    frame.At(100, 100)[2] ^= 1;
+    frame.At(191, 127)[3] ^= 1;
+    frame.At(0, 150)[0] ^= 1;
+
+    const auto& changed = Detect(detector, frame);
+    ASSERT_EQ(changed.size(), 2u);
+    EXPECT_TRUE(changed[0] == (PixelRect{ 64, 0, 192, 128 }));
+    EXPECT_TRUE(changed[1] == (PixelRect{ 0, 128, 64, 192 }));
+    EXPECT_EQ(detector.GetChangedTileCount(), 5u);
+}
+
+TEST(TileChangeDetectorTests, DifferentSpansDoNotStack)
+{
+    Frame frame(192, 128);
+    TileChangeDetector detector(64);
+    Detect(detector, frame);
+
+    frame.At(0, 0)[0] ^= 1;
+    frame.At(70, 0)[0] ^= 1;
+    frame.At(0, 64)[0] ^= 1;
+
+    const auto& changed = Detect(detector, frame);
+    ASSERT_EQ(changed.size(), 2u);
+    EXPECT_TRUE(changed[0] == (PixelRect{ 0, 0, 128, 64 }));
+    EXPECT_TRUE(changed[1] == (PixelRect{ 0, 64, 64, 128 }));
+}
+
+TEST(TileChangeDetectorTests, RowPaddingIsIgnored)
+{
+    Frame frame(100, 40, 48);
+    TileChangeDetector detector(32);
+    Detect(detector, frame);
+
+    for (uint32_t y = 0; y < frame.height; y++)
+    {
+        std::memset(frame.At(frame.width, y), y, 48);
+    }
+    EXPECT_TRUE(Detect(detector, frame).empty());
+}
+
+TEST(TileChangeDetectorTests, ResizeAndResetReportFullFrame)
+{
+    TileChangeDetector detector(64);
+    Frame small(128, 128);
+    Frame large(256, 128);
+
+    Detect(detector, small);
+    Detect(detector, large);
+    EXPECT_TRUE(detector.IsFullFrame());
+
+    EXPECT_TRUE(Detect(detector, large).empty());
+    detector.Reset();
+    EXPECT_TRUE(Detect(detector, large).size() == 1u && detector.IsFullFrame());
+}
+
+TEST(TileChangeDetectorTests, InvalidInputReportsNothingAndResets)
+{
+    Frame frame(64, 64);
+    TileChangeDetector detector(64);
+    Detect(detector, frame);
+
+    EXPECT_TRUE(detector.Detect(nullptr, frame.pitch, 64, 64).empty());
+    EXPECT_TRUE(detector.Detect(frame.pixels.data(), 16, 64, 64).empty());
+
+    Detect(detector, frame);
+    EXPECT_TRUE(detector.IsFullFrame());
+}
+
+TEST(TileChangeDetectorTests, TileSizeIsRoundedToLaneMultiple)
+{
+    EXPECT_EQ(TileChangeDetector(60).GetTileSize(), 64u);
+    EXPECT_EQ(TileChangeDetector(0).GetTileSize(), 8u);
+    EXPECT_EQ(TileChangeDetector(32).GetTileSize(), 32u);
+}
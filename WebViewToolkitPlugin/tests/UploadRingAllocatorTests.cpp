@@ -0,0 +1,321 @@
+// ============================================================================
+// WebViewToolkit - UploadRingAllocator Tests
+// ============================================================================
+
+#include "Core/UploadRingAllocator.h"
+
+#include <gtest/gtest.h>
+
+#include <deque>
+#include <random>
+
+using namespace WebViewToolkit;
+
+namespace
+{
+    // GPU timeline the test advances by hand
+    class FakeTimeline : public IGpuFence
+    {
+    public:
+        uint64_t Signal() override { return ++submitted; }
+        uint64_t GetCompletedValue() override { return completed; }
+        void Wait(uint64_t value) override { waited.push_back(value); completed = value; }
+
+        void CompleteAll() { completed = submitted; }
+
+        uint64_t submitted = 0;
+        uint64_t completed = 0;
+        std::vector<uint64_t> waited;
+    };
+}
+
+TEST(UploadRingAllocatorTests, AlignsEachAllocation)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 4096);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(100, 256, offset));
+    EXPECT_EQ(offset, 0u);
+    ASSERT_TRUE(ring.Allocate(100, 256, offset));
+    EXPECT_EQ(offset, 256u);
+    ASSERT_TRUE(ring.Allocate(10, 1, offset));
+    EXPECT_EQ(offset, 356u);
+    ASSERT_TRUE(ring.Allocate(10, 512, offset));
+    EXPECT_EQ(offset, 512u);
+
+    EXPECT_EQ(ring.GetUsed(), 522u);
+    EXPECT_EQ(ring.GetStats().paddingBytes, 156u + 146u);
+    EXPECT_EQ(ring.GetStats().allocatedBytes, 220u);
+}
+
+TEST(UploadRingAllocatorTests, RejectsInvalidRequests)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    EXPECT_FALSE(ring.Allocate(0, 1, offset));
+    EXPECT_FALSE(ring.Allocate(1025, 1, offset));
+    EXPECT_FALSE(ring.Allocate(16, 0, offset));
+    EXPECT_FALSE(ring.Allocate(16, 48, offset));
+    EXPECT_FALSE(ring.WaitForSpace(1025, 1));
+    EXPECT_EQ(ring.GetStats().allocations, 0u);
+    EXPECT_EQ(ring.GetStats().outOfSpace, 0u);
+}
+
+TEST(UploadRingAllocatorTests, FullRingFailsUntilTheFenceCompletes)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(600, 1, offset));
+    EXPECT_EQ(ring.Submit(), 1u);
+
+    EXPECT_FALSE(ring.Allocate(600, 1, offset));
+    EXPECT_EQ(ring.GetStats().outOfSpace, 1u);
+
+    timeline.CompleteAll();
+    ASSERT_TRUE(ring.Allocate(600, 1, offset));
+    EXPECT_EQ(ring.GetPendingCount(), 0u);
+}
+
+TEST(UploadRingAllocatorTests, WrapsToTheStartWhenTheEndIsTooSmall)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(400, 1, offset));
+    ring.Submit();
+    ASSERT_TRUE(ring.Allocate(400, 1, offset));
+    EXPECT_EQ(offset, 400u);
+    ring.Submit();
+
+    // 224 bytes left at the end; the first submission still blocks the start
+    EXPECT_FALSE(ring.Allocate(300, 1, offset));
+
+    timeline.completed = 1;
+    ASSERT_TRUE(ring.Allocate(300, 1, offset));
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(ring.GetStats().wraps, 1u);
+    EXPECT_EQ(ring.GetStats().paddingBytes, 224u);
+    EXPECT_EQ(ring.GetUsed(), 400u + 224u + 300u);
+}
+
+TEST(UploadRingAllocatorTests, ReclaimsSubmissionsInOrder)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    for (int i = 0; i < 3; i++)
+    {
+        ASSERT_TRUE(ring.Allocate(100, 1, offset));
+        ring.Submit();
+    }
+
+    timeline.completed = 2;
+    EXPECT_EQ(ring.Reclaim(), 2u);
+    EXPECT_EQ(ring.GetUsed(), 100u);
+    EXPECT_EQ(ring.GetPendingCount(), 1u);
+
+    EXPECT_EQ(ring.Reclaim(), 0u);
+    timeline.CompleteAll();
+    EXPECT_EQ(ring.Reclaim(), 1u);
+    EXPECT_EQ(ring.GetUsed(), 0u);
+}
+
+TEST(UploadRingAllocatorTests, UnsubmittedAllocationsAreNeverReclaimed)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(500, 1, offset));
+    ring.Submit();
+    ASSERT_TRUE(ring.Allocate(500, 1, offset));
+
+    timeline.completed = 100;
+    ring.Reclaim();
+    EXPECT_EQ(ring.GetUsed(), 500u);
+
+    // Only submitted work can be waited for
+    EXPECT_FALSE(ring.WaitForSpace(600, 1));
+    EXPECT_TRUE(timeline.waited.empty());
+}
+
+TEST(UploadRingAllocatorTests, SubmitWithoutAllocationsSignalsNothing)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    EXPECT_EQ(ring.Submit(), 0u);
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(16, 1, offset));
+    EXPECT_EQ(ring.Submit(), 1u);
+    EXPECT_EQ(ring.Submit(), 0u);
+
+    EXPECT_EQ(timeline.submitted, 1u);
+    EXPECT_EQ(ring.GetStats().submissions, 1u);
+}
+
+TEST(UploadRingAllocatorTests, ExecutedWorkWithoutAllocationsIsSignaled)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    // A list of GPU-side moves only: nothing in the ring, but its command
+    // allocator and scratch texture must not be reused before it has run
+    EXPECT_EQ(ring.Submit(true), 1u);
+    EXPECT_EQ(timeline.submitted, 1u);
+    EXPECT_EQ(ring.GetPendingCount(), 0u);
+    EXPECT_EQ(ring.GetStats().submissions, 0u);
+
+    // With allocations it is the one signal that frees them
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(16, 1, offset));
+    EXPECT_EQ(ring.Submit(true), 2u);
+    EXPECT_EQ(timeline.submitted, 2u);
+    EXPECT_EQ(ring.GetPendingCount(), 1u);
+
+    // Without a timeline there is nothing to wait for
+    UploadRingAllocator untracked(nullptr, 1024);
+    EXPECT_EQ(untracked.Submit(true), 0u);
+}
+
+TEST(UploadRingAllocatorTests, WaitForSpaceBlocksOnlyOnTheSubmissionsInTheWay)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    for (int i = 0; i < 4; i++)
+    {
+        ASSERT_TRUE(ring.Allocate(256, 1, offset));
+        ring.Submit();
+    }
+
+    EXPECT_TRUE(ring.WaitForSpace(300, 1));
+    ASSERT_EQ(timeline.waited.size(), 2u);
+    EXPECT_EQ(timeline.waited[0], 1u);
+    EXPECT_EQ(timeline.waited[1], 2u);
+    EXPECT_EQ(ring.GetStats().waits, 2u);
+
+    ASSERT_TRUE(ring.Allocate(300, 1, offset));
+    EXPECT_EQ(offset, 0u);
+}
+
+TEST(UploadRingAllocatorTests, EmptyRingRestartsAtOffsetZero)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(300, 1, offset));
+    ring.Submit();
+    timeline.CompleteAll();
+    ring.Reclaim();
+
+    // The whole buffer is free, not just the part after the old head
+    ASSERT_TRUE(ring.Allocate(1024, 1, offset));
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(ring.GetStats().wraps, 0u);
+}
+
+TEST(UploadRingAllocatorTests, WithoutATimelineSubmittedSpaceIsFreeRightAway)
+{
+    UploadRingAllocator ring(nullptr, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(1000, 1, offset));
+    EXPECT_EQ(ring.Submit(), 0u);
+    EXPECT_EQ(ring.GetUsed(), 0u);
+    EXPECT_TRUE(ring.Allocate(1000, 1, offset));
+}
+
+TEST(UploadRingAllocatorTests, ResetFreesEverything)
+{
+    FakeTimeline timeline;
+    UploadRingAllocator ring(&timeline, 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(ring.Allocate(700, 1, offset));
+    ring.Submit();
+    ring.Reset();
+
+    EXPECT_EQ(ring.GetUsed(), 0u);
+    EXPECT_EQ(ring.GetPendingCount(), 0u);
+    ASSERT_TRUE(ring.Allocate(1024, 1, offset));
+    EXPECT_EQ(offset, 0u);
+}
+
+TEST(UploadRingAllocatorTests, LiveAllocationsNeverOverlap)
+{
+    FakeTimeline timeline;
+    const uint64_t capacity = 64 * 1024;
+    UploadRingAllocator ring(&timeline, capacity);
+    std::mt19937 rng(19);
+    std::uniform_int_distribution<uint64_t> size(1, 9000);
+    std::uniform_int_distribution<int> alignmentShift(0, 9);
+    std::uniform_int_distribution<int> action(0, 9);
+
+    struct Live
+    {
+        uint64_t offset;
+        uint64_t size;
+        uint64_t fenceValue;    // 0 until submitted
+    };
+    std::deque<Live> live;
+
+    for (int step = 0; step < 20000; step++)
+    {
+        const int what = action(rng);
+        if (what < 6)
+        {
+            const uint64_t bytes = size(rng);
+            const uint64_t alignment = uint64_t{1} << alignmentShift(rng);
+            uint64_t offset = 0;
+            if (!ring.Allocate(bytes, alignment, offset))
+            {
+                continue;
+            }
+
+            ASSERT_EQ(offset % alignment, 0u);
+            ASSERT_LE(offset + bytes, capacity);
+            for (const Live& other : live)
+            {
+                ASSERT_TRUE(offset + bytes <= other.offset || other.offset + other.size <= offset)
+                    << "step " << step;
+            }
+            live.push_back({ offset, bytes, 0 });
+        }
+        else if (what < 8)
+        {
+            const uint64_t value = ring.Submit();
+            for (Live& allocation : live)
+            {
+                if (allocation.fenceValue == 0)
+                {
+                    allocation.fenceValue = value;
+                }
+            }
+        }
+        else if (timeline.completed < timeline.submitted)
+        {
+            timeline.completed++;
+        }
+
+        // Mirror what the ring may have reclaimed: completed submissions only
+        ring.Reclaim();
+        while (!live.empty() && live.front().fenceValue != 0 && live.front().fenceValue <= timeline.completed)
+        {
+            live.pop_front();
+        }
+    }
+
+    EXPECT_GT(ring.GetStats().wraps, 0u);
+    EXPECT_GT(ring.GetStats().outOfSpace, 0u);
+    EXPECT_LE(ring.GetStats().maxUsed, capacity);
+}